@@ -0,0 +1,1035 @@
+/*
+ * Benchmarks for the scan/detect/install pipeline
+ *
+ * Generates a synthetic sysfs tree, pacman local database and lspci
+ * listing for each device count, then times every phase of a refresh and
+ * an install. lspci, pacman and mkinitcpio are the stubs in bench/stubs,
+ * which log each call so spawns can be counted. Allocations are counted
+ * through -Wl,--wrap (see the bench target in the Makefile), so only calls
+ * made by the project code are seen, not allocations inside libc. Before
+ * timing, each fixture is checked: device names, and a synthetic hotplug
+ * burst fed through the uevent queue; after it, the initramfs presets the
+ * install phase rebuilt.
+ *
+ * Usage: bench [stub-dir] [device-count...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <ftw.h>
+#include <sys/stat.h>
+#include <zlib.h>
+#include "../include/hardware.h"
+#include "../include/driver.h"
+#include "../include/driver_db.h"
+#include "../include/scan_cache.h"
+#include "../include/pci_ids.h"
+#include "../include/profile.h"
+#include "../include/initramfs.h"
+#include "../include/uevent.h"
+
+#define BENCH_DEFAULT_STUB_DIR "bench/stubs"
+#define BENCH_REPEATS 5
+#define BENCH_PACKAGES 1500
+
+static const int default_sizes[] = { 5, 50, 500, 5000 };
+
+// Allocation counters, fed by the --wrap'ed allocator entry points
+static unsigned long alloc_count = 0;
+static unsigned long long alloc_bytes = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+char *__real_strdup(const char *str);
+
+void *__wrap_malloc(size_t size) {
+    alloc_count++;
+    alloc_bytes += size;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size) {
+    alloc_count++;
+    alloc_bytes += (unsigned long long)nmemb * size;
+    return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    alloc_count++;
+    alloc_bytes += size;
+    return __real_realloc(ptr, size);
+}
+
+char *__wrap_strdup(const char *str) {
+    alloc_count++;
+    alloc_bytes += strlen(str) + 1;
+    return __real_strdup(str);
+}
+
+// One synthetic machine
+typedef struct {
+    char dir[256];
+    char sysfs[320];
+    char pacman_db[320];
+    char lspci_output[320];
+    char spawn_log[320];
+    char cache[320];
+    char pci_ids[320];
+    char pci_ids_index[320];
+    char profile[320];
+    char package_files[320];
+    int device_count;
+    Arena *arena;           // Holds hw_list and drivers
+    HardwareInfo *hw_list;
+    int hw_count;
+    DriverInfo *drivers;
+    int driver_count;
+} BenchFixture;
+
+// Device mix: one in six functions is a bridge the scan has to skip
+typedef struct {
+    unsigned int vendor;
+    unsigned int device;
+    unsigned int class_code;
+    const char *lspci;
+} BenchDevice;
+
+static const BenchDevice device_mix[] = {
+    { 0x10de, 0x1e84, 0x030000, "VGA compatible controller: NVIDIA Corporation TU104 [GeForce RTX 2070 SUPER] (rev a1)" },
+    { 0x1002, 0x73bf, 0x030000, "VGA compatible controller: Advanced Micro Devices, Inc. [AMD/ATI] Navi 21 (rev c1)" },
+    { 0x8086, 0x9a49, 0x030000, "VGA compatible controller: Intel Corporation TigerLake-LP GT2 [Iris Xe Graphics] (rev 01)" },
+    { 0x14e4, 0x4365, 0x028000, "Network controller: Broadcom Inc. and subsidiaries BCM43142 802.11b/g/n (rev 01)" },
+    { 0x8086, 0xa0c8, 0x040300, "Audio device: Intel Corporation Tiger Lake-LP Smart Sound Technology Audio Controller (rev 20)" },
+    { 0x8086, 0x9a14, 0x060000, "Host bridge: Intel Corporation 11th Gen Core Processor Host Bridge/DRAM Registers (rev 01)" },
+};
+
+#define DEVICE_MIX_COUNT ((int)(sizeof(device_mix) / sizeof(device_mix[0])))
+
+// Packages queried by the is_driver_installed phase (installed and not)
+static const char *lookup_packages[] = {
+    "mesa",
+    "nvidia-dkms lib32-nvidia-utils nvidia-settings",
+    "linux-firmware",
+    "broadcom-wl-dkms",
+    "xf86-video-amdgpu",
+    "sof-firmware",
+};
+
+#define LOOKUP_PACKAGE_COUNT ((int)(sizeof(lookup_packages) / sizeof(lookup_packages[0])))
+
+// Packages of the fixture database that drivers.conf refers to
+static const char *installed_driver_packages[] = {
+    "mesa", "linux-firmware", "xf86-video-amdgpu", "vulkan-intel",
+};
+
+// Packages the fixture repositories offer: everything drivers.conf refers to
+static const char *repo_packages[] = {
+    "broadcom-wl-dkms", "lib32-nvidia-utils", "linux-firmware", "mesa", "nvidia",
+    "nvidia-dkms", "nvidia-lts", "nvidia-open-dkms", "nvidia-settings", "sof-firmware",
+    "vulkan-intel", "vulkan-radeon", "xf86-video-amdgpu", "xf86-video-intel",
+};
+
+#define REPO_PACKAGE_COUNT ((int)(sizeof(repo_packages) / sizeof(repo_packages[0])))
+
+// Trimmed pci.ids: the device mix (Broadcom's device left out, so its name
+// falls back to the ID), subsystem lines, comments and the class section,
+// whose subclass lines must not be taken for devices
+static const char pci_ids_fixture[] =
+    "#\n"
+    "#\tList of PCI ID's (trimmed for the benchmark)\n"
+    "#\n"
+    "0001  SafeNet (wrong ID)\n"
+    "1002  Advanced Micro Devices, Inc. [AMD/ATI]\n"
+    "\t73bf  Navi 21 [Radeon RX 6800/6800 XT / 6900 XT]\n"
+    "\t\t1002 0e3a  Radeon RX 6900 XT\n"
+    "10de  NVIDIA Corporation\n"
+    "\t1e84  TU104 [GeForce RTX 2070 SUPER]\n"
+    "\t\t10de 139f  GeForce RTX 2070 SUPER\n"
+    "# Listed out of order on purpose\n"
+    "\t1e81  TU104 [GeForce RTX 2080 SUPER]\n"
+    "14e4  Broadcom Inc. and subsidiaries\n"
+    "8086  Intel Corporation\n"
+    "\t9a14  11th Gen Core Processor Host Bridge/DRAM Registers\n"
+    "\t9a49  TigerLake-LP GT2 [Iris Xe Graphics]\n"
+    "\ta0c8  Tiger Lake-LP Smart Sound Technology Audio Controller\n"
+    "\n"
+    "# List of known device classes, subclasses and programming interfaces\n"
+    "C 02  Network controller\n"
+    "\t80  Network controller\n"
+    "C 03  Display controller\n"
+    "\t00  VGA compatible controller\n"
+    "\t\t00  VGA controller\n";
+
+// Names the fixture must give (vendor, device, expected vendor and device name)
+typedef struct {
+    unsigned int vendor;
+    unsigned int device;
+    const char *vendor_name;
+    const char *device_name;
+} BenchName;
+
+static const BenchName expected_names[] = {
+    { 0x10de, 0x1e84, "NVIDIA Corporation", "TU104 [GeForce RTX 2070 SUPER]" },
+    { 0x1002, 0x73bf, "Advanced Micro Devices, Inc. [AMD/ATI]", "Navi 21 [Radeon RX 6800/6800 XT / 6900 XT]" },
+    { 0x8086, 0x9a49, "Intel Corporation", "TigerLake-LP GT2 [Iris Xe Graphics]" },
+    { 0x14e4, 0x4365, "Broadcom Inc. and subsidiaries", "Device 4365" },
+    { 0x8086, 0xa0c8, "Intel Corporation", "Tiger Lake-LP Smart Sound Technology Audio Controller" },
+};
+
+// Write a small file, creating it
+static bool write_file(const char *path, const char *content) {
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) {
+        perror(path);
+        return false;
+    }
+    fputs(content, fp);
+    return fclose(fp) == 0;
+}
+
+// Add one package to the fixture pacman local database
+static bool write_package(const char *db, const char *name, const char *version) {
+    char path[512];
+    char desc[256];
+
+    snprintf(path, sizeof(path), "%s/%s-%s", db, name, version);
+    if (mkdir(path, 0755) != 0) {
+        perror(path);
+        return false;
+    }
+
+    snprintf(path, sizeof(path), "%s/%s-%s/desc", db, name, version);
+    snprintf(desc, sizeof(desc), "%%NAME%%\n%s\n\n%%VERSION%%\n%s\n\n%%DESC%%\nBenchmark package\n\n",
+             name, version);
+    return write_file(path, desc);
+}
+
+// Append one file to a gzip'ed tar archive
+static bool write_tar_entry(gzFile gz, const char *name, const char *content) {
+    unsigned char header[512] = { 0 };
+    size_t size = strlen(content);
+    unsigned int checksum = 0;
+
+    snprintf((char *)header, 100, "%s", name);
+    memcpy(header + 100, "0000644", 8);
+    memcpy(header + 108, "0000000", 8);
+    memcpy(header + 116, "0000000", 8);
+    snprintf((char *)header + 124, 12, "%011zo", size);
+    memcpy(header + 136, "00000000000", 12);
+    header[156] = '0';
+    memcpy(header + 257, "ustar", 6);
+    memcpy(header + 263, "00", 2);
+    memset(header + 148, ' ', 8);
+    for (int i = 0; i < 512; i++) {
+        checksum += header[i];
+    }
+    snprintf((char *)header + 148, 8, "%06o", checksum);
+
+    static const unsigned char padding[512] = { 0 };
+    return gzwrite(gz, header, sizeof(header)) == sizeof(header) &&
+           gzwrite(gz, content, (unsigned int)size) == (int)size &&
+           gzwrite(gz, padding, (unsigned int)((512 - size % 512) % 512)) >= 0;
+}
+
+// Write a sync database offering the given packages
+static bool write_sync_db(const char *path, const char *const *packages, int count) {
+    gzFile gz = gzopen(path, "wb");
+    if (gz == NULL) {
+        perror(path);
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < count && ok; i++) {
+        char name[100];
+        char desc[512];
+        snprintf(name, sizeof(name), "%s-1.0-1/desc", packages[i]);
+        snprintf(desc, sizeof(desc),
+                 "%%FILENAME%%\n%s-1.0-1-x86_64.pkg.tar.zst\n\n%%NAME%%\n%s\n\n"
+                 "%%VERSION%%\n1.0-1\n\n%%CSIZE%%\n1048576\n\n%%ISIZE%%\n4194304\n\n",
+                 packages[i], packages[i]);
+        ok = write_tar_entry(gz, name, desc);
+    }
+
+    static const unsigned char end[1024] = { 0 };
+    ok = ok && gzwrite(gz, end, sizeof(end)) == sizeof(end);
+    return gzclose(gz) == Z_OK && ok;
+}
+
+// Kernels with an initramfs preset each, for the install phase's rebuild step
+// (preset, module directory, mkinitcpio.conf if not the default one). The
+// default configuration has the kms hook but not modconf; linux-zen's has modconf.
+static const char *const bench_kernels[][3] = {
+    { "linux", "6.9.1-arch1-1", NULL },
+    { "linux-lts", "6.6.30-1-lts", NULL },
+    { "linux-zen", "6.9.1-zen1-1-zen", "/etc/mkinitcpio-zen.conf" },
+    { "linux-hardened", "6.9.1-hardened1-1-hardened", NULL },
+};
+
+// File lists of the packages the install phase adds (the pacman stub copies
+// them into the local database): DRM modules built for two of the kernels,
+// DKMS trees whose modules are neither DRM drivers nor in MODULES, and the
+// modprobe.d file of a dependency none of the drivers names. Packages not
+// listed install no files.
+static const char *const bench_package_files[][2] = {
+    { "nvidia", "usr/lib/modules/6.9.1-arch1-1/kernel/drivers/gpu/drm/nvidia/nvidia-drm.ko.zst\n" },
+    { "nvidia-lts", "usr/lib/modules/6.6.30-1-lts/kernel/drivers/gpu/drm/nvidia/nvidia-drm.ko.zst\n" },
+    { "nvidia-dkms", "usr/src/nvidia-550.78/\nusr/src/nvidia-550.78/dkms.conf\n" },
+    { "nvidia-open-dkms", "usr/src/nvidia-open-550.78/\nusr/src/nvidia-open-550.78/dkms.conf\n" },
+    { "broadcom-wl-dkms", "usr/src/broadcom-wl-6.30.223.271/\nusr/src/broadcom-wl-6.30.223.271/dkms.conf\n" },
+    { "nvidia-utils", "usr/lib/modprobe.d/\nusr/lib/modprobe.d/nvidia-utils.conf\n" },
+};
+
+// Dependencies the pacman stub installs along with a package
+static const char *const bench_package_depends[][2] = {
+    { "nvidia", "nvidia-utils" },
+    { "nvidia-lts", "nvidia-utils" },
+    { "nvidia-dkms", "nvidia-utils" },
+    { "nvidia-open-dkms", "nvidia-utils" },
+};
+
+// The DKMS trees of those packages (directory, module, install location)
+static const char *const bench_dkms_trees[][3] = {
+    { "nvidia-550.78", "nvidia", "/kernel/drivers/video" },
+    { "nvidia-open-550.78", "nvidia", "/kernel/drivers/video" },
+    { "broadcom-wl-6.30.223.271", "wl", "/kernel/drivers/net/wireless" },
+};
+
+// Presets the install phase must rebuild: those of the DRM modules' kernels,
+// and linux-zen for nvidia-utils' modprobe.d file (modconf hook)
+static const char *const rebuilt_presets[] = { "linux", "linux-lts", "linux-zen" };
+
+// Add mkinitcpio presets, kernel module directories and DKMS trees below the
+// fixture, and the file lists of the packages the install phase adds
+static bool create_initramfs_fixture(const BenchFixture *fx) {
+    static const char *const dirs[] = { "etc", "etc/mkinitcpio.d", "usr", "usr/lib", "usr/lib/modules",
+                                        "usr/src", "package-files" };
+    char path[512];
+    char content[256];
+
+    for (size_t i = 0; i < sizeof(dirs) / sizeof(dirs[0]); i++) {
+        snprintf(path, sizeof(path), "%s/%s", fx->dir, dirs[i]);
+        if (mkdir(path, 0755) != 0) {
+            perror(path);
+            return false;
+        }
+    }
+
+    snprintf(path, sizeof(path), "%s%s", fx->dir, MKINITCPIO_CONFIG);
+    if (!write_file(path, "MODULES=()\nHOOKS=(base udev autodetect kms block filesystems fsck)\n")) {
+        return false;
+    }
+
+    for (size_t i = 0; i < sizeof(bench_kernels) / sizeof(bench_kernels[0]); i++) {
+        const char *config = bench_kernels[i][2];
+        if (config != NULL) {
+            snprintf(path, sizeof(path), "%s%s", fx->dir, config);
+            if (!write_file(path, "MODULES=()\nHOOKS=(base udev autodetect modconf kms block filesystems fsck)\n")) {
+                return false;
+            }
+        }
+
+        snprintf(path, sizeof(path), "%s%s/%s.preset", fx->dir, MKINITCPIO_PRESET_DIR, bench_kernels[i][0]);
+        snprintf(content, sizeof(content), "ALL_kver=\"/boot/vmlinuz-%s\"\n%s%s%sPRESETS=('default')\n",
+                 bench_kernels[i][0], config != NULL ? "ALL_config=\"" : "",
+                 config != NULL ? config : "", config != NULL ? "\"\n" : "");
+        if (!write_file(path, content)) {
+            return false;
+        }
+
+        snprintf(path, sizeof(path), "%s%s/%s", fx->dir, KERNEL_MODULES_DIR, bench_kernels[i][1]);
+        if (mkdir(path, 0755) != 0) {
+            perror(path);
+            return false;
+        }
+        snprintf(path, sizeof(path), "%s%s/%s/pkgbase", fx->dir, KERNEL_MODULES_DIR, bench_kernels[i][1]);
+        snprintf(content, sizeof(content), "%s\n", bench_kernels[i][0]);
+        if (!write_file(path, content)) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < sizeof(bench_dkms_trees) / sizeof(bench_dkms_trees[0]); i++) {
+        snprintf(path, sizeof(path), "%s/usr/src/%s", fx->dir, bench_dkms_trees[i][0]);
+        if (mkdir(path, 0755) != 0) {
+            perror(path);
+            return false;
+        }
+        snprintf(path, sizeof(path), "%s/usr/src/%s/dkms.conf", fx->dir, bench_dkms_trees[i][0]);
+        snprintf(content, sizeof(content), "PACKAGE_NAME=\"%s\"\nBUILT_MODULE_NAME[0]=\"%s\"\n"
+                 "DEST_MODULE_LOCATION[0]=\"%s\"\nAUTOINSTALL=\"yes\"\n",
+                 bench_dkms_trees[i][1], bench_dkms_trees[i][1], bench_dkms_trees[i][2]);
+        if (!write_file(path, content)) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < sizeof(bench_package_files) / sizeof(bench_package_files[0]); i++) {
+        snprintf(path, sizeof(path), "%s/%s", fx->package_files, bench_package_files[i][0]);
+        if (!write_file(path, bench_package_files[i][1])) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < sizeof(bench_package_depends) / sizeof(bench_package_depends[0]); i++) {
+        snprintf(path, sizeof(path), "%s/%s.depends", fx->package_files, bench_package_depends[i][0]);
+        snprintf(content, sizeof(content), "%s\n", bench_package_depends[i][1]);
+        if (!write_file(path, content)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Add a PCI function to the fixture's sysfs tree
+static bool write_pci_device(const BenchFixture *fx, const char *address, const BenchDevice *dev,
+                             unsigned int subsys_device) {
+    char path[512];
+    char value[128];
+
+    snprintf(path, sizeof(path), "%s/bus/pci/devices/%s", fx->sysfs, address);
+    if (mkdir(path, 0755) != 0) {
+        perror(path);
+        return false;
+    }
+
+    static const char *const attrs[] = { "vendor", "device", "class",
+                                         "subsystem_vendor", "subsystem_device", "modalias" };
+    for (size_t a = 0; a < sizeof(attrs) / sizeof(attrs[0]); a++) {
+        switch (a) {
+            case 0: snprintf(value, sizeof(value), "0x%04x\n", dev->vendor); break;
+            case 1: snprintf(value, sizeof(value), "0x%04x\n", dev->device); break;
+            case 2: snprintf(value, sizeof(value), "0x%06x\n", dev->class_code); break;
+            case 3: snprintf(value, sizeof(value), "0x%04x\n", dev->vendor); break;
+            case 4: snprintf(value, sizeof(value), "0x%04x\n", subsys_device); break;
+            default:
+                snprintf(value, sizeof(value), "pci:v%08Xd%08Xsv%08Xsd%08Xbc%02Xsc%02Xi%02X\n",
+                         dev->vendor, dev->device, dev->vendor, subsys_device,
+                         dev->class_code >> 16, (dev->class_code >> 8) & 0xff,
+                         dev->class_code & 0xff);
+        }
+
+        char attr_path[640];
+        snprintf(attr_path, sizeof(attr_path), "%s/%s", path, attrs[a]);
+        if (!write_file(attr_path, value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Build the sysfs tree, lspci listing and pacman database for N devices
+static bool create_fixture(BenchFixture *fx, int device_count) {
+    memset(fx, 0, sizeof(BenchFixture));
+    fx->device_count = device_count;
+
+    strcpy(fx->dir, "/tmp/system-drivers-bench.XXXXXX");
+    if (mkdtemp(fx->dir) == NULL) {
+        perror("mkdtemp");
+        return false;
+    }
+
+    snprintf(fx->sysfs, sizeof(fx->sysfs), "%s/sys", fx->dir);
+    snprintf(fx->pacman_db, sizeof(fx->pacman_db), "%s/local", fx->dir);
+    snprintf(fx->lspci_output, sizeof(fx->lspci_output), "%s/lspci.txt", fx->dir);
+    snprintf(fx->spawn_log, sizeof(fx->spawn_log), "%s/spawns.log", fx->dir);
+    snprintf(fx->cache, sizeof(fx->cache), "%s/scan.cache", fx->dir);
+    snprintf(fx->pci_ids, sizeof(fx->pci_ids), "%s/pci.ids", fx->dir);
+    snprintf(fx->pci_ids_index, sizeof(fx->pci_ids_index), "%s/pci-ids.index", fx->dir);
+    snprintf(fx->profile, sizeof(fx->profile), "%s/profile.conf", fx->dir);
+    snprintf(fx->package_files, sizeof(fx->package_files), "%s/package-files", fx->dir);
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/bus", fx->sysfs);
+    if (mkdir(fx->sysfs, 0755) != 0 || mkdir(path, 0755) != 0) {
+        perror(path);
+        return false;
+    }
+    snprintf(path, sizeof(path), "%s/bus/pci", fx->sysfs);
+    mkdir(path, 0755);
+    snprintf(path, sizeof(path), "%s/bus/pci/devices", fx->sysfs);
+    mkdir(path, 0755);
+
+    FILE *lspci = fopen(fx->lspci_output, "w");
+    if (lspci == NULL) {
+        perror(fx->lspci_output);
+        return false;
+    }
+
+    for (int i = 0; i < device_count; i++) {
+        const BenchDevice *dev = &device_mix[i % DEVICE_MIX_COUNT];
+        char address[16];
+
+        snprintf(address, sizeof(address), "0000:%02x:%02x.%x",
+                 (i >> 8) & 0xff, (i >> 3) & 0x1f, i & 7);
+        if (!write_pci_device(fx, address, dev, 0x1000 + i % 16)) {
+            fclose(lspci);
+            return false;
+        }
+
+        fprintf(lspci, "%s %s\n", address + 5, dev->lspci);
+    }
+
+    if (fclose(lspci) != 0) {
+        return false;
+    }
+
+    if (!write_file(fx->pci_ids, pci_ids_fixture)) {
+        return false;
+    }
+
+    if (mkdir(fx->pacman_db, 0755) != 0) {
+        perror(fx->pacman_db);
+        return false;
+    }
+    snprintf(path, sizeof(path), "%s/ALPM_DB_VERSION", fx->pacman_db);
+    write_file(path, "9\n");
+
+    // Freshly synced repositories: installs within the sync TTL skip pacman -Sy
+    snprintf(path, sizeof(path), "%s/sync", fx->dir);
+    if (mkdir(path, 0755) != 0) {
+        perror(path);
+        return false;
+    }
+    snprintf(path, sizeof(path), "%s/sync/core.db", fx->dir);
+    if (!write_sync_db(path, repo_packages, 0)) {
+        return false;
+    }
+    snprintf(path, sizeof(path), "%s/sync/extra.db", fx->dir);
+    if (!write_sync_db(path, repo_packages, REPO_PACKAGE_COUNT)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < sizeof(installed_driver_packages) / sizeof(installed_driver_packages[0]); i++) {
+        if (!write_package(fx->pacman_db, installed_driver_packages[i], "1.0-1")) {
+            return false;
+        }
+    }
+    for (int i = 0; i < BENCH_PACKAGES; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "bench-package-%04d", i);
+        if (!write_package(fx->pacman_db, name, "1.0-1")) {
+            return false;
+        }
+    }
+
+    return create_initramfs_fixture(fx);
+}
+
+// nftw callback removing one fixture entry
+static int remove_entry(const char *path, const struct stat *st, int flag, struct FTW *ftw) {
+    (void)st;    // Unused
+    (void)flag;  // Unused
+    (void)ftw;   // Unused
+    return remove(path);
+}
+
+// Remove a fixture and the data loaded from it
+static void destroy_fixture(BenchFixture *fx) {
+    arena_destroy(fx->arena);
+    nftw(fx->dir, remove_entry, 16, FTW_DEPTH | FTW_PHYS);
+}
+
+// Count the subprocesses the stubs have logged
+static int count_spawns(const BenchFixture *fx) {
+    FILE *fp = fopen(fx->spawn_log, "r");
+    int count = 0;
+    int c;
+
+    if (fp == NULL) {
+        return 0;
+    }
+    while ((c = fgetc(fp)) != EOF) {
+        if (c == '\n') {
+            count++;
+        }
+    }
+    fclose(fp);
+    return count;
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Phases; each one undoes its own allocations so it can be repeated
+
+static void phase_scan_sysfs(BenchFixture *fx) {
+    Arena *arena = arena_create();
+    HardwareInfo *hw_list = NULL;
+    scan_hardware_sysfs(arena, fx->sysfs, &hw_list);
+    arena_destroy(arena);
+}
+
+// Map pci.ids and load its index, as the first sysfs scan of a process does
+static void phase_pci_ids_open(BenchFixture *fx) {
+    pci_ids_close(pci_ids_open(fx->pci_ids, fx->pci_ids_index));
+}
+
+static void phase_scan_lspci(BenchFixture *fx) {
+    (void)fx;  // Unused
+    Arena *arena = arena_create();
+    HardwareInfo *hw_list = NULL;
+    scan_hardware_lspci(arena, &hw_list);
+    arena_destroy(arena);
+}
+
+static void phase_load_pacman_db(BenchFixture *fx) {
+    (void)fx;  // Unused
+    refresh_installed_packages();
+}
+
+static void phase_is_driver_installed(BenchFixture *fx) {
+    for (int i = 0; i < fx->device_count; i++) {
+        is_driver_installed(lookup_packages[i % LOOKUP_PACKAGE_COUNT]);
+    }
+}
+
+static void phase_detect_drivers(BenchFixture *fx) {
+    Arena *arena = arena_create();
+    DriverInfo *drivers = NULL;
+    detect_drivers(arena, fx->hw_list, fx->hw_count, &drivers);
+    arena_destroy(arena);
+}
+
+static void phase_refresh_cold(BenchFixture *fx) {
+    unlink(fx->cache);
+    Arena *arena = arena_create();
+    HardwareInfo *hw_list = NULL;
+    DriverInfo *drivers = NULL;
+    int hw_count = 0;
+    scan_and_detect_cached(arena, &hw_list, &hw_count, &drivers);
+    arena_destroy(arena);
+}
+
+static void phase_refresh_cached(BenchFixture *fx) {
+    (void)fx;  // Unused
+    Arena *arena = arena_create();
+    HardwareInfo *hw_list = NULL;
+    DriverInfo *drivers = NULL;
+    int hw_count = 0;
+    scan_and_detect_cached(arena, &hw_list, &hw_count, &drivers);
+    arena_destroy(arena);
+}
+
+// Apply the fixture's own profile: all satisfied, so no transaction runs
+static void phase_profile_apply(BenchFixture *fx) {
+    ProfileApplyOptions options = { false, NULL, NULL };
+    ProfileReport report;
+    if (profile_apply(fx->profile, fx->hw_list, fx->hw_count, fx->drivers, fx->driver_count,
+                      &options, &report) && report.install_count > 0) {
+        fprintf(stderr, "%s: %d drivers to install, expected none\n", fx->profile,
+                report.install_count);
+    }
+    profile_report_free(&report);
+}
+
+static void phase_install(BenchFixture *fx) {
+    DriverInfo **batch = malloc(sizeof(DriverInfo *) * (fx->driver_count + 1));
+    int batch_count = 0;
+
+    for (int i = 0; i < fx->driver_count; i++) {
+        if (!fx->drivers[i].is_installed) {
+            batch[batch_count++] = &fx->drivers[i];
+        }
+    }
+    install_drivers(batch, batch_count);
+
+    // install_drivers() marks them installed; keep the next repeat identical
+    for (int i = 0; i < batch_count; i++) {
+        batch[i]->is_installed = false;
+    }
+    free(batch);
+}
+
+typedef struct {
+    const char *name;
+    void (*run)(BenchFixture *fx);
+    int repeats;
+} BenchPhase;
+
+static const BenchPhase phases[] = {
+    { "scan_sysfs",        phase_scan_sysfs,          BENCH_REPEATS },
+    { "pci_ids_open",      phase_pci_ids_open,        BENCH_REPEATS },
+    { "scan_lspci",        phase_scan_lspci,          BENCH_REPEATS },
+    { "load_pacman_db",    phase_load_pacman_db,      BENCH_REPEATS },
+    { "is_installed",      phase_is_driver_installed, BENCH_REPEATS },
+    { "detect_drivers",    phase_detect_drivers,      BENCH_REPEATS },
+    { "refresh_cold",      phase_refresh_cold,        BENCH_REPEATS },
+    { "refresh_cached",    phase_refresh_cached,      BENCH_REPEATS },
+    { "profile_apply",     phase_profile_apply,       BENCH_REPEATS },
+    { "install",           phase_install,             1 },
+};
+
+// Run a phase; reports the best time and the counters of the last run
+static void run_phase(FILE *out, const BenchPhase *phase, BenchFixture *fx) {
+    double best = -1;
+    unsigned long allocs = 0;
+    unsigned long long bytes = 0;
+    int spawns = 0;
+
+    for (int r = 0; r < phase->repeats; r++) {
+        unlink(fx->spawn_log);
+        alloc_count = 0;
+        alloc_bytes = 0;
+
+        double start = now_us();
+        phase->run(fx);
+        double elapsed = now_us() - start;
+
+        fflush(stdout);
+        allocs = alloc_count;
+        bytes = alloc_bytes;
+        spawns = count_spawns(fx);
+        if (best < 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    fprintf(out, "%-16s %8d %12.1f %10lu %12llu %7d\n",
+            phase->name, fx->device_count, best, allocs, bytes, spawns);
+    fflush(out);
+}
+
+// Check the names the sysfs scan took from the pci.ids fixture
+static bool check_names(const BenchFixture *fx) {
+    bool ok = true;
+
+    for (int i = 0; i < fx->hw_count; i++) {
+        const HardwareInfo *hw = &fx->hw_list[i];
+        for (size_t n = 0; n < sizeof(expected_names) / sizeof(expected_names[0]); n++) {
+            const BenchName *name = &expected_names[n];
+            if (name->vendor == hw->vendor_id && name->device == hw->device_id &&
+                (strcmp(hw->vendor, name->vendor_name) != 0 || strcmp(hw->device, name->device_name) != 0)) {
+                fprintf(stderr, "%s: named \"%s\" \"%s\", expected \"%s\" \"%s\"\n",
+                        hw->pci_id, hw->vendor, hw->device, name->vendor_name, name->device_name);
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+// Raw kernel uevent message: "action@devpath" and the NUL-separated keys
+static size_t build_uevent(char *buf, size_t size, const char *action, const char *devpath,
+                           const char *const *keys) {
+    size_t len = (size_t)snprintf(buf, size, "%s@%s", action, devpath) + 1;
+    len += (size_t)snprintf(buf + len, size - len, "ACTION=%s", action) + 1;
+    len += (size_t)snprintf(buf + len, size - len, "DEVPATH=%s", devpath) + 1;
+    for (; *keys != NULL; keys++) {
+        len += (size_t)snprintf(buf + len, size - len, "%s", *keys) + 1;
+    }
+    return len;
+}
+
+// Whether the cached scan lists a device at address
+static bool cached_scan_has(const char *address) {
+    Arena *arena = arena_create();
+    HardwareInfo *hw_list = NULL;
+    DriverInfo *drivers = NULL;
+    int hw_count = 0;
+    bool found = false;
+
+    scan_and_detect_cached(arena, &hw_list, &hw_count, &drivers);
+    for (int i = 0; i < hw_count && !found; i++) {
+        found = hardware_has_address(&hw_list[i], address);
+    }
+    arena_destroy(arena);
+    return found;
+}
+
+// Feed a hotplug burst through the event queue: one debounced batch with only
+// the add/remove events, and a scan cache that no longer serves the old list
+static bool check_hotplug(const BenchFixture *fx) {
+    static UeventQueue queue;
+    static const char address[] = "0000:fe:00.0";
+    static const char *const pci_keys[] = {
+        "SUBSYSTEM=pci", "PCI_SLOT_NAME=0000:fe:00.0",
+        "MODALIAS=pci:v000010DEd00001E84sv000010DEsd0000BEEFbc03sc00i00", NULL
+    };
+    static const char *const usb_device_keys[] = {
+        "SUBSYSTEM=usb", "DEVTYPE=usb_device", "PRODUCT=46d/a4d/100", NULL
+    };
+    static const char *const usb_interface_keys[] = {
+        "SUBSYSTEM=usb", "DEVTYPE=usb_interface", "PRODUCT=46d/a4d/100", "INTERFACE=1/1/0", NULL
+    };
+    const char *pci_path = "/devices/pci0000:fe/0000:fe:00.0";
+    const char *usb_path = "/devices/pci0000:00/0000:00:14.0/usb1/1-2";
+    char buf[UEVENT_BUFFER_SIZE];
+    bool ok = true;
+
+    // Warm the cache, then plug in a GPU the fixture doesn't have
+    if (cached_scan_has(address)) {
+        fprintf(stderr, "hotplug: %s present before it was added\n", address);
+        return false;
+    }
+    ScanCacheKeys before;
+    scan_cache_compute_keys(&before);
+    const BenchDevice gpu = { 0x10de, 0x1e84, 0x030000, NULL };
+    if (!write_pci_device(fx, address, &gpu, 0xbeef)) {
+        return false;
+    }
+
+    // A burst: PCI add, USB device (not an interface) add, a change, USB interface add
+    uevent_queue_clear(&queue);
+    size_t len = build_uevent(buf, sizeof(buf), "add", pci_path, pci_keys);
+    bool queued = uevent_queue_inject(&queue, buf, len, 1000);
+    len = build_uevent(buf, sizeof(buf), "add", usb_path, usb_device_keys);
+    queued = queued && !uevent_queue_inject(&queue, buf, len, 1050);
+    len = build_uevent(buf, sizeof(buf), "change", pci_path, pci_keys);
+    queued = queued && !uevent_queue_inject(&queue, buf, len, 1100);
+    len = build_uevent(buf, sizeof(buf), "add", "/devices/pci0000:00/0000:00:14.0/usb1/1-2/1-2:1.0",
+                       usb_interface_keys);
+    queued = queued && uevent_queue_inject(&queue, buf, len, 1200);
+    if (!queued || queue.count != 2 || queue.overflow) {
+        fprintf(stderr, "hotplug: burst of %d queued events (overflow %d) is not just its 2 adds\n",
+                queue.count, queue.overflow);
+        ok = false;
+    }
+
+    // Handled once, a debounce interval after the last event that counted
+    if (uevent_queue_due(&queue, 1200 + UEVENT_DEBOUNCE_MS - 1) ||
+        !uevent_queue_due(&queue, 1200 + UEVENT_DEBOUNCE_MS)) {
+        fprintf(stderr, "hotplug: burst not due exactly %d ms after its last event\n",
+                UEVENT_DEBOUNCE_MS);
+        ok = false;
+    }
+
+    // The incremental update reads the added function alone
+    Arena *arena = arena_create();
+    HardwareInfo hw;
+    if (arena == NULL || queue.count < 1 ||
+        !scan_pci_device(arena, fx->sysfs, queue.events[0].pci_slot, &hw) ||
+        hw.type != HW_GPU_NVIDIA || strcmp(uevent_device_address(&queue.events[0]), address) != 0) {
+        fprintf(stderr, "hotplug: added PCI device not read back from sysfs\n");
+        ok = false;
+    }
+    if (arena == NULL || queue.count < 2 || !uevent_usb_hardware(arena, &queue.events[1], &hw) ||
+        hw.type != HW_AUDIO) {
+        fprintf(stderr, "hotplug: added USB interface not recognized as audio\n");
+        ok = false;
+    }
+    arena_destroy(arena);
+    uevent_queue_clear(&queue);
+
+    // The next refresh must not reuse the cached list without the new device
+    ScanCacheKeys after;
+    scan_cache_compute_keys(&after);
+    if (after.pci_devices == before.pci_devices || !cached_scan_has(address)) {
+        fprintf(stderr, "hotplug: scan cache still valid after %s was added\n", address);
+        ok = false;
+    }
+
+    // Unplug it again: sysfs goes first, then the kernel sends the event
+    char path[512];
+    static const char *const attrs[] = { "vendor", "device", "class",
+                                         "subsystem_vendor", "subsystem_device", "modalias" };
+    for (size_t a = 0; a < sizeof(attrs) / sizeof(attrs[0]); a++) {
+        snprintf(path, sizeof(path), "%s/bus/pci/devices/%s/%s", fx->sysfs, address, attrs[a]);
+        unlink(path);
+    }
+    snprintf(path, sizeof(path), "%s/bus/pci/devices/%s", fx->sysfs, address);
+    rmdir(path);
+
+    len = build_uevent(buf, sizeof(buf), "remove", pci_path, pci_keys);
+    if (!uevent_queue_inject(&queue, buf, len, 2000) || queue.count != 1 ||
+        queue.events[0].action != UEVENT_REMOVE) {
+        fprintf(stderr, "hotplug: remove event not queued\n");
+        ok = false;
+    }
+    uevent_queue_clear(&queue);
+    if (cached_scan_has(address)) {
+        fprintf(stderr, "hotplug: scan cache still lists %s after its removal\n", address);
+        ok = false;
+    }
+
+    // A burst longer than the queue turns into one rescan
+    len = build_uevent(buf, sizeof(buf), "add", pci_path, pci_keys);
+    for (int i = 0; i <= UEVENT_QUEUE_SIZE; i++) {
+        uevent_queue_inject(&queue, buf, len, 3000 + i);
+    }
+    if (!queue.overflow || queue.count != UEVENT_QUEUE_SIZE ||
+        !uevent_queue_due(&queue, 3000 + UEVENT_QUEUE_SIZE + UEVENT_DEBOUNCE_MS)) {
+        fprintf(stderr, "hotplug: overlong burst not turned into a rescan\n");
+        ok = false;
+    }
+    uevent_queue_clear(&queue);
+
+    return ok;
+}
+
+// Check the initramfs rebuilds of the install phase in its spawn log: one
+// mkinitcpio -p per preset whose images gained a module, and nothing else
+static bool check_initramfs_rebuilds(const BenchFixture *fx) {
+    FILE *fp = fopen(fx->spawn_log, "r");
+    if (fp == NULL) {
+        perror(fx->spawn_log);
+        return false;
+    }
+
+    int runs[sizeof(bench_kernels) / sizeof(bench_kernels[0])] = { 0 };
+    bool ok = true;
+    char line[4096];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        line[strcspn(line, "\n")] = '\0';
+        if (strncmp(line, "mkinitcpio ", strlen("mkinitcpio ")) != 0) {
+            continue;
+        }
+
+        bool known = false;
+        for (size_t k = 0; k < sizeof(bench_kernels) / sizeof(bench_kernels[0]); k++) {
+            char expected[128];
+            snprintf(expected, sizeof(expected), "mkinitcpio -p %s", bench_kernels[k][0]);
+            if (strcmp(line, expected) == 0) {
+                runs[k]++;
+                known = true;
+            }
+        }
+        if (!known) {
+            fprintf(stderr, "install: unexpected \"%s\"\n", line);
+            ok = false;
+        }
+    }
+    fclose(fp);
+
+    for (size_t k = 0; k < sizeof(bench_kernels) / sizeof(bench_kernels[0]); k++) {
+        int expected = 0;
+        for (size_t r = 0; r < sizeof(rebuilt_presets) / sizeof(rebuilt_presets[0]); r++) {
+            expected += strcmp(bench_kernels[k][0], rebuilt_presets[r]) == 0;
+        }
+        if (runs[k] != expected) {
+            fprintf(stderr, "install: preset %s rebuilt %d times, expected %d\n",
+                    bench_kernels[k][0], runs[k], expected);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// Benchmark all phases for one device count
+static bool bench_size(FILE *out, int device_count) {
+    BenchFixture fx;
+
+    if (!create_fixture(&fx, device_count)) {
+        fprintf(stderr, "Could not create fixture for %d devices\n", device_count);
+        destroy_fixture(&fx);
+        return false;
+    }
+
+    set_sysfs_root(fx.sysfs);
+    set_pacman_db_path(fx.pacman_db);
+    set_scan_cache_path(fx.cache);
+    set_pci_ids_path(fx.pci_ids, fx.pci_ids_index);
+    set_initramfs_root(fx.dir);
+    setenv("BENCH_LSPCI_OUTPUT", fx.lspci_output, 1);
+    setenv("BENCH_SPAWN_LOG", fx.spawn_log, 1);
+    setenv("BENCH_PACKAGE_FILES", fx.package_files, 1);
+
+    // Inputs of the phases that work on an existing scan
+    refresh_installed_packages();
+    fx.arena = arena_create();
+    if (fx.arena == NULL) {
+        destroy_fixture(&fx);
+        return false;
+    }
+    fx.hw_count = scan_hardware_sysfs(fx.arena, fx.sysfs, &fx.hw_list);
+    if (fx.hw_count < 0) {
+        fprintf(stderr, "Could not scan %s\n", fx.sysfs);
+        destroy_fixture(&fx);
+        return false;
+    }
+    if (!check_names(&fx)) {
+        destroy_fixture(&fx);
+        return false;
+    }
+    fx.driver_count = detect_drivers(fx.arena, fx.hw_list, fx.hw_count, &fx.drivers);
+    if (!check_hotplug(&fx)) {
+        destroy_fixture(&fx);
+        return false;
+    }
+
+    // Profile of the installed drivers, applied back onto the same machine
+    FILE *profile = fopen(fx.profile, "w");
+    if (profile == NULL || profile_write(profile, fx.hw_list, fx.hw_count, fx.drivers,
+                                         fx.driver_count) < 0 || fclose(profile) != 0) {
+        fprintf(stderr, "Could not write %s\n", fx.profile);
+        destroy_fixture(&fx);
+        return false;
+    }
+
+    for (size_t i = 0; i < sizeof(phases) / sizeof(phases[0]); i++) {
+        run_phase(out, &phases[i], &fx);
+    }
+
+    // The install phase runs last, so its spawn log is still there
+    bool ok = check_initramfs_rebuilds(&fx);
+
+    destroy_fixture(&fx);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    const char *stub_dir = argc > 1 ? argv[1] : BENCH_DEFAULT_STUB_DIR;
+    char stub_path[512];
+    char path[4096];
+
+    // Never let the install phase reach the real pacman or mkinitcpio
+    static const char *const stubs[] = { "lspci", "pacman", "mkinitcpio" };
+    for (size_t i = 0; i < sizeof(stubs) / sizeof(stubs[0]); i++) {
+        snprintf(stub_path, sizeof(stub_path), "%s/%s", stub_dir, stubs[i]);
+        if (access(stub_path, X_OK) != 0) {
+            fprintf(stderr, "Missing stub %s; run from the source tree or pass the stub directory\n",
+                    stub_path);
+            return 1;
+        }
+    }
+    if (realpath(stub_dir, stub_path) == NULL) {
+        perror(stub_dir);
+        return 1;
+    }
+    const char *old_path = getenv("PATH");
+    snprintf(path, sizeof(path), "%s:%s", stub_path, old_path != NULL ? old_path : "/usr/bin:/bin");
+    setenv("PATH", path, 1);
+
+    // Keep the built-in driver table only
+    set_driver_db_override_path("/nonexistent/system-drivers-bench.conf");
+
+    // Progress messages of the code under test go to stderr, results to stdout
+    FILE *out = fdopen(dup(STDOUT_FILENO), "w");
+    if (out == NULL) {
+        perror("dup stdout");
+        return 1;
+    }
+    fflush(stdout);
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    fprintf(out, "%-16s %8s %12s %10s %12s %7s\n",
+            "phase", "devices", "best_us", "allocs", "alloc_bytes", "spawns");
+
+    int status = 0;
+    if (argc > 2) {
+        for (int i = 2; i < argc; i++) {
+            int size = atoi(argv[i]);
+            if (size <= 0 || !bench_size(out, size)) {
+                status = 1;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < sizeof(default_sizes) / sizeof(default_sizes[0]); i++) {
+            if (!bench_size(out, default_sizes[i])) {
+                status = 1;
+            }
+        }
+    }
+
+    fclose(out);
+    return status;
+}
@@ -0,0 +1,4026 @@
+/*
+ * Built-in driver database
+ *
+ * Generated by tools/gen_driver_table.c from data/drivers.conf - do not edit.
+ */
+
+#include "../include/driver_db.h"
+
+static const DriverMapping entries[] = {
+    {0xffff, 0xffff, 0xffff, HW_GPU_NVIDIA,
+     "nvidia-dkms lib32-nvidia-utils nvidia-settings",
+     "NVIDIA Complete Driver",
+     "NVIDIA driver with DKMS modules and 32-bit support",
+     true, true},
+    {0xffff, 0xffff, 0xffff, HW_GPU_NVIDIA,
+     "nvidia",
+     "NVIDIA Standard Driver",
+     "Standard NVIDIA proprietary graphics driver",
+     true, false},
+    {0xffff, 0xffff, 0xffff, HW_GPU_NVIDIA,
+     "nvidia-lts",
+     "NVIDIA LTS Driver",
+     "NVIDIA driver for LTS kernel",
+     true, false},
+    {0x10de, 0x1e00, 0x2fff, HW_GPU_NVIDIA,
+     "nvidia-open-dkms lib32-nvidia-utils nvidia-settings",
+     "NVIDIA Open Kernel Modules",
+     "Open source NVIDIA kernel modules for Turing and newer GPUs",
+     true, false},
+    {0xffff, 0xffff, 0xffff, HW_GPU_AMD,
+     "xf86-video-amdgpu",
+     "AMDGPU Driver",
+     "Open source AMD graphics driver",
+     true, true},
+    {0xffff, 0xffff, 0xffff, HW_GPU_AMD,
+     "vulkan-radeon",
+     "AMD Vulkan Driver",
+     "Vulkan support for AMD GPUs",
+     false, true},
+    {0xffff, 0xffff, 0xffff, HW_GPU_AMD,
+     "mesa",
+     "Mesa 3D Graphics",
+     "Open source 3D graphics library",
+     false, true},
+    {0xffff, 0xffff, 0xffff, HW_GPU_INTEL,
+     "xf86-video-intel",
+     "Intel Graphics Driver",
+     "Intel integrated graphics driver",
+     true, true},
+    {0xffff, 0xffff, 0xffff, HW_GPU_INTEL,
+     "vulkan-intel",
+     "Intel Vulkan Driver",
+     "Vulkan support for Intel GPUs",
+     false, true},
+    {0xffff, 0xffff, 0xffff, HW_GPU_INTEL,
+     "mesa",
+     "Mesa 3D Graphics",
+     "Open source 3D graphics library",
+     false, true},
+    {0xffff, 0xffff, 0xffff, HW_NETWORK,
+     "linux-firmware",
+     "Linux Firmware",
+     "Firmware files for Linux kernel drivers",
+     false, true},
+    {0x14e4, 0x4353, 0x4353, HW_NETWORK,
+     "broadcom-wl-dkms",
+     "Broadcom Wireless Driver",
+     "Proprietary driver for Broadcom BCM43224 wireless",
+     true, false},
+    {0x14e4, 0x4357, 0x4357, HW_NETWORK,
+     "broadcom-wl-dkms",
+     "Broadcom Wireless Driver",
+     "Proprietary driver for Broadcom BCM43225 wireless",
+     true, false},
+    {0x14e4, 0x4365, 0x4365, HW_NETWORK,
+     "broadcom-wl-dkms",
+     "Broadcom Wireless Driver",
+     "Proprietary driver for Broadcom BCM43142 wireless",
+     true, false},
+    {0xffff, 0xffff, 0xffff, HW_AUDIO,
+     "sof-firmware",
+     "Sound Open Firmware",
+     "Firmware for modern audio hardware",
+     false, true},
+};
+
+static const unsigned int displacements[] = {
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x4, 0x1, 0x0, 0x0, 0x3, 0x0, 0x4, 0x0,
+    0x3, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x4, 0x5, 0x2, 0x0, 0x1,
+    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x4, 0x2, 0x0,
+    0x0, 0x4, 0x0, 0x2, 0x0, 0x6, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x2, 0x0, 0x0, 0x4, 0x0,
+    0x3, 0x0, 0x0, 0x1, 0x1, 0x0, 0x2, 0x0,
+    0x0, 0x7, 0x1, 0x0, 0x0, 0x1, 0x2, 0x0,
+    0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x5, 0x4, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x2,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x2, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x6, 0x0,
+    0x0, 0x1, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x0, 0x4, 0x0, 0x4, 0x0, 0x2,
+    0x0, 0x1, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x9, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x4,
+    0x0, 0x5, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x2, 0x9, 0x0, 0x0, 0x1, 0x6, 0x0,
+    0x1, 0x1, 0x2, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x3, 0x5, 0x0, 0x2, 0x0, 0x3,
+    0x0, 0x1, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x1, 0x1, 0x0, 0x2, 0x0, 0x8,
+    0x0, 0x1, 0x1, 0x0, 0x8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x0, 0x2, 0x1, 0x1, 0x2,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x3, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x1, 0x2,
+    0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x5, 0x6, 0x0, 0x0, 0x0, 0x1, 0x2, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x2, 0x1, 0x1,
+    0x3, 0x0, 0x1, 0x1, 0x1, 0x0, 0x2, 0x0,
+    0x0, 0x0, 0x5, 0x1, 0x2, 0x4, 0x1, 0x0,
+    0x1, 0x0, 0x2, 0x0, 0x7, 0x1, 0x0, 0x1,
+    0x0, 0x3, 0x0, 0x1, 0x0, 0x1, 0x0, 0x2,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x2, 0x2,
+    0x0, 0x7, 0x1, 0x1, 0x1, 0x0, 0x0, 0x2,
+    0x0, 0x4, 0x2, 0x0, 0x1, 0x5, 0x0, 0x1,
+    0x1, 0x1, 0x9, 0x2, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x6, 0x2, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x3, 0x1, 0x1, 0x0, 0x2, 0x3,
+    0x1, 0x5, 0x2, 0x1, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x2, 0x1, 0x1, 0x0, 0x0, 0x2, 0x0,
+    0x1, 0x2, 0x1, 0x0, 0x0, 0x0, 0x2, 0x7,
+    0x2, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0,
+    0x3, 0x0, 0x0, 0x2, 0x2, 0x1, 0x1, 0x1,
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x4, 0x4, 0x6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0x0, 0x1, 0x0, 0x0, 0x2, 0x0,
+    0x3, 0x1, 0x0, 0x0, 0x1, 0x0, 0x5, 0x0,
+    0x1, 0x1, 0x0, 0x7, 0x0, 0x1, 0x2, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0,
+    0x0, 0x2, 0x0, 0x3, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x5, 0x1, 0x0, 0x3, 0x3, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x5, 0x2, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x8, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x3, 0x0, 0x0, 0x0, 0x3, 0x1, 0x1,
+    0x2, 0x0, 0x2, 0x1, 0x2, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x2, 0x0, 0x2, 0x4, 0x0,
+    0x3, 0x1, 0x2, 0x2, 0x0, 0x3, 0x0, 0x1,
+    0x1, 0x5, 0x5, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x5, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x3, 0x2, 0x0,
+    0x0, 0x0, 0x3, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x2, 0x1, 0x0, 0x0, 0x4, 0x0,
+    0x0, 0x3, 0x0, 0x2, 0x0, 0x0, 0x0, 0x2,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xb, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x4, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x2, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x5, 0x1,
+    0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x9, 0x4, 0x0, 0x0,
+    0x0, 0x1, 0x3, 0x0, 0x3, 0x1, 0x0, 0x1,
+    0x0, 0x6, 0x1, 0x6, 0xa, 0x2, 0x4, 0x2,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x1, 0x4,
+    0x0, 0x1, 0x4, 0x0, 0x2, 0x0, 0x3, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x5, 0x2, 0x5,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0xb, 0x2, 0x2,
+    0x0, 0x0, 0x1, 0x2, 0x0, 0x5, 0x0, 0x6,
+    0x0, 0x1, 0x1, 0x5, 0x0, 0x1, 0x3, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x2, 0x0, 0x4, 0x0, 0x0,
+    0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x7, 0x0, 0x2, 0x0, 0x2, 0x0, 0x0,
+    0x1, 0x0, 0x7, 0x6, 0x0, 0x1, 0x5, 0x3,
+    0x0, 0x3, 0x1, 0x6, 0x2, 0x0, 0x4, 0x1,
+    0x7, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x1, 0x2, 0x0, 0x6, 0x8, 0x0, 0x5, 0x9,
+    0x0, 0x0, 0x0, 0x2, 0x6, 0x1, 0x2, 0x0,
+    0x1, 0x3, 0x1, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x7, 0x0, 0x6, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x2, 0x2, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x3,
+    0x2, 0x1, 0x1, 0x5, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x3, 0x1, 0x2, 0x3, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x1, 0x0, 0x0, 0x2, 0x3, 0x0, 0x2, 0x0,
+    0x2, 0x0, 0x0, 0x1, 0x1, 0x0, 0x6, 0x2,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x5, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x2, 0x2, 0x1, 0x2, 0x0,
+    0x1, 0x2, 0x1, 0x3, 0x1, 0x0, 0x1, 0x1,
+    0x2, 0xe, 0x0, 0x0, 0x0, 0x0, 0x5, 0x3,
+    0x0, 0x0, 0x3, 0x4, 0x0, 0x5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x11, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x3, 0x0, 0x4, 0x1, 0x3,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x5, 0x3, 0x3, 0x0, 0x1, 0x3, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x2, 0x0,
+    0x5, 0x2, 0x3, 0xa, 0x0, 0x3, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x3, 0x2, 0x1, 0x3, 0x2,
+    0x3, 0x0, 0x1, 0x1, 0x0, 0x1, 0x3, 0x0,
+    0x0, 0x1, 0x0, 0x4, 0x1, 0x0, 0x1, 0x0,
+    0x2, 0x6, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x5, 0x2, 0x0, 0x0, 0x4, 0x2, 0x3, 0x1,
+    0x5, 0x1, 0x0, 0x0, 0x0, 0x1, 0x5, 0x0,
+    0x1, 0x0, 0x2, 0x0, 0x0, 0x1, 0x0, 0x3,
+    0x0, 0xa, 0x8, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x3, 0x1, 0x0, 0x0, 0x0, 0x4,
+    0x0, 0x2, 0x3, 0x6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x3, 0x6, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x2, 0x0, 0x4, 0x6,
+    0x0, 0x1, 0x6, 0x2, 0x4, 0x0, 0x2, 0x1,
+    0x0, 0x2, 0x0, 0x1, 0x3, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x2, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x2, 0x3, 0x2, 0x0, 0x1, 0x0, 0x0,
+    0x2, 0x4, 0x1, 0x1, 0x3, 0x0, 0x1, 0x0,
+    0x3, 0x3, 0x1, 0x0, 0x0, 0x2, 0x0, 0x4,
+    0x1, 0x0, 0x3, 0x2, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0x2, 0x3, 0x8,
+    0x1, 0x2, 0x1, 0x1, 0x1, 0x0, 0x5, 0x0,
+    0x3, 0x1, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x2, 0x0, 0x0, 0x5, 0x2, 0x6,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x4, 0x2,
+    0x1, 0x0, 0x4, 0x5, 0x0, 0x0, 0x0, 0x3,
+    0x2, 0x0, 0x1, 0xa, 0x0, 0x1, 0x3, 0x0,
+    0x2, 0x0, 0x3, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x4, 0x0, 0x0, 0x1, 0x0, 0x3, 0x1, 0x8,
+    0x6, 0x5, 0x0, 0x1, 0x2, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x3, 0x0, 0x4, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x2, 0x0, 0x0, 0x3, 0x3, 0x2,
+    0x1, 0x2, 0x1, 0x0, 0x0, 0x2, 0x0, 0x3,
+    0x1, 0x5, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x2,
+    0x0, 0x6, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x7, 0x4, 0x6, 0x1, 0x2, 0x0,
+    0x1, 0x8, 0x0, 0x3, 0x2, 0x0, 0x4, 0x5,
+    0x2, 0x0, 0x0, 0x0, 0x2, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x4, 0x4, 0x1, 0x0, 0x1, 0x5, 0x4,
+    0x0, 0x2, 0x0, 0x1, 0xc, 0x0, 0x4, 0x7,
+    0x2, 0x1, 0x0, 0x5, 0x0, 0x0, 0x2, 0x4,
+    0x0, 0x3, 0x1, 0x2, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x3, 0x2, 0x0, 0x2, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0xa, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0x0, 0x1, 0x2, 0x1, 0x0, 0x3, 0x5,
+    0x4, 0x0, 0x1, 0x1, 0x5, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x3, 0x1, 0x1, 0x1, 0x3,
+    0x3, 0x7, 0x0, 0x3, 0x5, 0x3, 0x0, 0x3,
+    0x4, 0x1, 0x0, 0x2, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x2, 0x2, 0x3, 0x0, 0x0, 0x1, 0x4,
+    0x3, 0x3, 0x2, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x2, 0x4, 0x2, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x4, 0x5, 0x0, 0x3,
+    0xc, 0x0, 0x0, 0x4, 0x0, 0x8, 0x3, 0x1,
+    0x0, 0x0, 0x2, 0x1, 0x0, 0x5, 0x0, 0x2,
+    0x1, 0x0, 0x2, 0x4, 0x0, 0x3, 0x0, 0x0,
+    0x5, 0x2, 0x0, 0x0, 0xd, 0xc, 0x0, 0x3,
+    0x5, 0xa, 0x0, 0x2, 0x2, 0x0, 0x7, 0x0,
+    0x2, 0x0, 0x5, 0x1, 0x3, 0x2, 0x0, 0x1,
+    0x2, 0x0, 0x3, 0x0, 0x7, 0x1, 0x1, 0x1,
+    0x3, 0x2, 0x0, 0x0, 0x3, 0x1, 0x0, 0x6,
+    0x0, 0x2, 0x4, 0x6, 0x0, 0x8, 0x4, 0x0,
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x3, 0x2, 0x0, 0x0, 0x1, 0x3, 0x0,
+    0x1, 0x7, 0x1, 0x0, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x1, 0x3, 0x0, 0x0,
+    0x1, 0x1, 0x2, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0xb, 0x0, 0x0, 0x0, 0x4, 0x0,
+    0x0, 0x0, 0x6, 0x2, 0x6, 0x0, 0x0, 0x1,
+    0x2, 0x3, 0x4, 0x0, 0x2, 0x2, 0x0, 0x3,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x6, 0x1, 0x0,
+    0x2, 0x7, 0x0, 0x2, 0x0, 0x5, 0x0, 0x1,
+    0x7, 0x6, 0x0, 0x2, 0x0, 0x0, 0x2, 0x5,
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x4, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x6, 0x0, 0x2,
+    0x0, 0x0, 0x3, 0x0, 0x0, 0x1, 0x0, 0xa,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x4, 0x0,
+    0x1, 0x7, 0x6, 0x3, 0x1, 0x2, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x2, 0x0, 0x2, 0x0, 0x6,
+    0x2, 0x0, 0x1, 0xb, 0x0, 0x0, 0x0, 0x2,
+    0x7, 0x0, 0x2, 0x0, 0x0, 0x0, 0x3, 0x3,
+    0x3, 0x3, 0x9, 0x0, 0x2, 0x2, 0x3, 0x5,
+    0x5, 0x5, 0x6, 0xb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x5, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x6, 0x5, 0x10, 0x0, 0x3, 0x0, 0x5,
+    0x3, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x2, 0x3, 0x1, 0x0, 0x0,
+    0x5, 0x8, 0x3, 0x3, 0x0, 0x1, 0x6, 0x3,
+    0x2, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0x0, 0x1, 0x5, 0x4, 0x0, 0x5, 0x0,
+    0x0, 0x0, 0x3, 0x1, 0x9, 0x0, 0x0, 0x2,
+    0x3, 0x0, 0x0, 0x0, 0x2, 0x3, 0x2, 0x9,
+    0x17, 0x6, 0x7, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x4, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x1, 0x0, 0xe, 0x0, 0x0, 0x2,
+    0x3, 0x0, 0x2, 0x5, 0x6, 0x1, 0x0, 0x6,
+    0x3, 0x2, 0x1, 0x1, 0x7, 0x0, 0xa, 0x6,
+    0x0, 0x2, 0x3, 0x2, 0x5, 0x2, 0x0, 0x0,
+    0x2, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x4, 0x0, 0x1, 0x0, 0x9, 0xc, 0x0,
+    0x2, 0x0, 0x1, 0x0, 0x0, 0x1, 0x7, 0x0,
+    0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x2, 0x2,
+    0x0, 0x2, 0x0, 0x0, 0x4, 0x0, 0xc, 0x0,
+    0x1, 0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x4, 0x4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x8, 0x1, 0x3, 0x2, 0x0,
+    0x0, 0x5, 0x3, 0x0, 0x1, 0x6, 0x6, 0x4,
+    0x0, 0x3, 0x0, 0x0, 0x1, 0x2, 0x2, 0x1,
+    0x1, 0xb, 0x4, 0x8, 0x0, 0x2, 0x2, 0x4,
+    0x0, 0x0, 0x3, 0x0, 0x0, 0xb, 0x3, 0x0,
+    0x2, 0x3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x2,
+    0x0, 0x2, 0x4, 0x0, 0x4, 0x0, 0x1, 0x0,
+    0x2, 0x1, 0x2, 0x2, 0x5, 0x1, 0x4, 0x0,
+    0x0, 0x0, 0x4, 0x2, 0x4, 0x0, 0x7, 0x2,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x2,
+    0x4, 0x1, 0x2, 0x0, 0x0, 0xd, 0x0, 0x3,
+    0x0, 0x1, 0x5, 0x0, 0x7, 0x0, 0x3, 0x0,
+    0x3, 0x0, 0x2, 0x0, 0x0, 0x8, 0x4, 0x3,
+    0x0, 0x2, 0x2, 0x0, 0x3, 0x4, 0x0, 0x0,
+    0x4, 0x0, 0x0, 0x3, 0x2, 0x3, 0x1, 0x2,
+    0x2, 0x0, 0x2, 0x1, 0x2, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x6, 0x1, 0x0, 0x1, 0x3,
+};
+
+static const unsigned int slot_keys[] = {
+    0x10de1ef8, 0x10de2cb6, 0xffffffff, 0x10de2293, 0x10de2665, 0xffffffff, 0xffffffff, 0x10de2e46,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e7a,
+    0x10de1f67, 0x10de2e98, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b7b, 0x10de1ed3, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2071, 0x10de2374, 0x10de2db2, 0xffffffff, 0x10de2d4e,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e5f, 0x10de2799, 0xffffffff, 0x10de2c35, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2f27, 0xffffffff, 0x10de1fa8, 0x10de27f4, 0xffffffff, 0x10de1e76,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2878, 0x10de28cf, 0x10de237a, 0xffffffff, 0xffffffff,
+    0x10de2bbf, 0x10de2396, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2bac, 0xffffffff, 0xffffffff,
+    0x10de1fba, 0x10de28ee, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2e55, 0xffffffff, 0x10de25fe,
+    0x10de1e3d, 0x10de2e27, 0x10de2edd, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de212c, 0xffffffff,
+    0x10de2c94, 0xffffffff, 0x10de258c, 0xffffffff, 0x10de29e7, 0x10de2df5, 0xffffffff, 0x10de2870,
+    0xffffffff, 0x10de2cf2, 0x10de28ef, 0x10de2429, 0x10de284b, 0x10de2515, 0xffffffff, 0x10de1f40,
+    0xffffffff, 0xffffffff, 0x10de2f22, 0xffffffff, 0xffffffff, 0x10de2b63, 0x10de2c5c, 0x10de22db,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a2d, 0x10de21c3, 0xffffffff, 0x10de1ff7, 0x10de2cf5,
+    0x10de1e12, 0xffffffff, 0x10de2838, 0x10de2746, 0x10de2faa, 0x10de2aa0, 0x10de2cb8, 0xffffffff,
+    0x10de2c1c, 0xffffffff, 0x10de2580, 0x10de1e97, 0xffffffff, 0x10de23a1, 0xffffffff, 0x10de2a41,
+    0xffffffff, 0x10de251a, 0x10de23d7, 0xffffffff, 0xffffffff, 0x10de2134, 0x10de2933, 0x10de226d,
+    0x10de278e, 0x10de212a, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de27d7, 0x10de2f7e, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de22b4,
+    0x10de2fa1, 0xffffffff, 0x10de2c3e, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f80, 0x10de25aa,
+    0x10de2247, 0x10de2ffd, 0xffffffff, 0x10de1fe9, 0xffffffff, 0xffffffff, 0x10de1e61, 0x10de1e4a,
+    0x10de2357, 0x10de22ca, 0x10de2c10, 0x10de1e67, 0x10de1f72, 0x10de2837, 0x10de2e80, 0xffffffff,
+    0xffffffff, 0x10de2407, 0x10de2784, 0x10de2fa8, 0xffffffff, 0x10de2b62, 0xffffffff, 0xffffffff,
+    0x10de2fa0, 0x10de2480, 0x10de21a8, 0xffffffff, 0x10de1e8e, 0xffffffff, 0xffffffff, 0x10de2db9,
+    0x10de24ec, 0xffffffff, 0xffffffff, 0x10de2a65, 0xffffffff, 0x10de1e90, 0xffffffff, 0x10de25a8,
+    0xffffffff, 0x10de2955, 0x10de2b77, 0x10de221c, 0x10de1f56, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2174, 0x10de2350, 0x10de2cf4, 0x10de28c6, 0xffffffff, 0x10de29d7, 0xffffffff, 0xffffffff,
+    0x10de27f6, 0xffffffff, 0x10de2733, 0x10de2a69, 0xffffffff, 0x10de2902, 0x10de20cc, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de245d, 0x10de2531, 0x10de2f5e, 0x10de2649, 0x10de2558, 0x10de1ec9,
+    0xffffffff, 0x10de2151, 0x10de241f, 0x10de2b8b, 0xffffffff, 0x10de28e3, 0xffffffff, 0x10de23ee,
+    0x10de259a, 0xffffffff, 0x10de205a, 0xffffffff, 0x10de2d8d, 0x10de26c4, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2c7b, 0x10de21dc, 0xffffffff, 0xffffffff, 0x10de2ef2, 0x10de28c4, 0xffffffff,
+    0x10de2d64, 0x10de2adc, 0xffffffff, 0xffffffff, 0x10de1e99, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2c67, 0xffffffff, 0x10de1f0a, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ca8, 0x10de2a53,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de275b, 0xffffffff, 0xffffffff, 0x10de27e2,
+    0x10de265c, 0x10de28aa, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2cf0, 0x10de23ab, 0x10de2782,
+    0xffffffff, 0x10de1f3d, 0x10de2dc8, 0xffffffff, 0xffffffff, 0x10de2814, 0x10de26b5, 0x10de2462,
+    0x10de2390, 0x10de27ce, 0xffffffff, 0xffffffff, 0x10de249b, 0x10de20ce, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2f93, 0x10de1e0c, 0x10de2eec, 0x10de2d1d, 0xffffffff, 0x10de2f9a,
+    0x10de2369, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de239e, 0x10de27b0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b36, 0xffffffff, 0x10de1e88,
+    0x10de2e49, 0x10de2084, 0x10de273d, 0xffffffff, 0x10de2eb1, 0xffffffff, 0x10de24ea, 0xffffffff,
+    0x10de2b96, 0xffffffff, 0xffffffff, 0x10de2ec9, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1fcf,
+    0xffffffff, 0x10de2c03, 0x10de250f, 0x10de1f7b, 0xffffffff, 0x10de22c4, 0xffffffff, 0x10de24be,
+    0x10de21ed, 0x10de253f, 0x10de2a82, 0x10de20bf, 0x10de239b, 0x10de2f3a, 0x10de25ec, 0xffffffff,
+    0x10de2b70, 0xffffffff, 0x10de2db5, 0x10de2c53, 0x10de221f, 0x10de27fa, 0xffffffff, 0xffffffff,
+    0x10de2657, 0x10de288c, 0xffffffff, 0xffffffff, 0x10de1f32, 0xffffffff, 0x10de20d2, 0x10de1ec7,
+    0x10de2109, 0x10de2d5e, 0xffffffff, 0x10de2ae9, 0x10de269c, 0x10de24c0, 0x10de28c3, 0xffffffff,
+    0x10de2732, 0x10de28af, 0xffffffff, 0x10de2055, 0x10de285a, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2bf2, 0xffffffff, 0x10de2764, 0x10de2e73, 0x10de2846, 0xffffffff, 0xffffffff, 0x10de232e,
+    0x10de2aa6, 0x10de2831, 0x10de29b6, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de1e5e, 0x10de2c30, 0x10de2a57, 0xffffffff, 0x10de2d2d, 0xffffffff, 0x10de1e53, 0x10de24a9,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de29d5, 0x10de2889, 0xffffffff, 0x10de2bd5,
+    0x10de2e79, 0xffffffff, 0x10de2c45, 0xffffffff, 0x10de226f, 0xffffffff, 0xffffffff, 0x10de1e47,
+    0xffffffff, 0xffffffff, 0x10de28d7, 0x10de239d, 0x10de219a, 0x10de294a, 0x10de2408, 0x10de2fe5,
+    0xffffffff, 0xffffffff, 0x10de268d, 0xffffffff, 0xffffffff, 0x10de2753, 0x10de236a, 0x10de2523,
+    0x10de23e2, 0xffffffff, 0x10de2449, 0x10de2aad, 0x10de1e95, 0x10de1f84, 0xffffffff, 0x10de1e20,
+    0x10de261f, 0x10de2650, 0x10de2c96, 0x10de21b5, 0xffffffff, 0x10de1f1c, 0x10de23f4, 0x10de24da,
+    0x10de227f, 0x10de251b, 0x10de299c, 0xffffffff, 0xffffffff, 0x10de2591, 0xffffffff, 0x10de2962,
+    0x10de26fe, 0xffffffff, 0x10de2748, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2101, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2a6c, 0xffffffff, 0x10de2bbb, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de24e1,
+    0xffffffff, 0x10de228c, 0xffffffff, 0x10de27c7, 0xffffffff, 0x10de1f7f, 0x10de2c5d, 0x10de25ba,
+    0xffffffff, 0x10de266f, 0xffffffff, 0x10de2ca5, 0x10de24d9, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de234b, 0xffffffff, 0xffffffff, 0x10de2f4c, 0x10de2c7d, 0x10de21e0, 0xffffffff,
+    0x10de2f87, 0x10de2497, 0x10de2c33, 0xffffffff, 0x10de1f1b, 0xffffffff, 0x10de2c15, 0xffffffff,
+    0x10de2c91, 0xffffffff, 0x10de23ba, 0x10de2170, 0x10de2a37, 0x10de2bab, 0xffffffff, 0x10de2097,
+    0x10de2f1f, 0xffffffff, 0x10de295a, 0x10de2148, 0x10de24c6, 0x10de1f05, 0xffffffff, 0xffffffff,
+    0x10de2c0d, 0x10de25bd, 0x10de2f36, 0xffffffff, 0x10de2817, 0xffffffff, 0x10de2a4a, 0xffffffff,
+    0x10de2c21, 0x10de2629, 0xffffffff, 0xffffffff, 0x10de28b6, 0x10de29a0, 0x10de254c, 0xffffffff,
+    0x10de2aac, 0x10de2b8d, 0x10de2321, 0xffffffff, 0x10de2e96, 0x10de1f9c, 0x10de2169, 0x10de2c87,
+    0xffffffff, 0xffffffff, 0x10de26be, 0xffffffff, 0x10de288a, 0xffffffff, 0xffffffff, 0x10de23a8,
+    0x10de1e72, 0xffffffff, 0x10de210d, 0xffffffff, 0x10de2620, 0xffffffff, 0x10de2920, 0x10de2e14,
+    0x10de2f8d, 0x10de201f, 0x10de2ef6, 0x10de2eab, 0xffffffff, 0xffffffff, 0x10de2c89, 0xffffffff,
+    0xffffffff, 0x10de2f6b, 0x10de2d5a, 0xffffffff, 0xffffffff, 0x10de218f, 0xffffffff, 0x10de2cfa,
+    0xffffffff, 0xffffffff, 0x10de2335, 0x10de2a26, 0x10de25d1, 0x10de2a3e, 0xffffffff, 0x10de2133,
+    0xffffffff, 0xffffffff, 0x10de2090, 0xffffffff, 0x10de216d, 0x10de23fb, 0x10de27cd, 0xffffffff,
+    0x10de24f7, 0x10de225b, 0x10de2021, 0xffffffff, 0x10de2862, 0xffffffff, 0x10de1e3e, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de26d3, 0x10de2245, 0x10de2063,
+    0xffffffff, 0x10de1ef6, 0x10de2796, 0x10de2a62, 0xffffffff, 0xffffffff, 0x10de2068, 0x10de2155,
+    0x10de2709, 0x10de2872, 0x10de267b, 0xffffffff, 0x10de20a2, 0x10de27e7, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2192, 0x10de254d, 0x10de2c5f, 0xffffffff, 0xffffffff, 0x10de264a, 0x10de2206,
+    0x10de2b2c, 0x10de289b, 0x10de27cb, 0x10de2525, 0xffffffff, 0x10de21a2, 0x10de27e5, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2fc1, 0x10de24f5, 0x10de214d, 0xffffffff, 0x10de22e3, 0xffffffff,
+    0xffffffff, 0x10de249d, 0x10de2ac0, 0xffffffff, 0xffffffff, 0x10de1e01, 0x10de2d36, 0xffffffff,
+    0xffffffff, 0x10de2e75, 0xffffffff, 0xffffffff, 0x10de2a94, 0xffffffff, 0x10de2996, 0x10de2af0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2c2b, 0x10de2c82, 0xffffffff, 0x10de2eba, 0xffffffff,
+    0x10de2ed4, 0x10de1e11, 0x10de2cb2, 0x10de2008, 0x10de240e, 0x10de2c93, 0x10de2c14, 0xffffffff,
+    0x10de29aa, 0xffffffff, 0x10de21ff, 0xffffffff, 0x10de2c88, 0x10de2d00, 0xffffffff, 0x10de2dc0,
+    0x10de1ee1, 0xffffffff, 0xffffffff, 0x10de259f, 0xffffffff, 0x10de2dad, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2ad0, 0xffffffff, 0x10de2d25, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de23a4,
+    0x10de1edd, 0x10de27b6, 0x10de2f34, 0x10de2b25, 0x10de2268, 0xffffffff, 0x10de26b3, 0x10de2d51,
+    0x10de269a, 0xffffffff, 0x10de28a7, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2f79, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b1b, 0x10de2885, 0x10de2864,
+    0xffffffff, 0x10de27d0, 0xffffffff, 0x10de243b, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e50,
+    0x10de29eb, 0x10de1eb4, 0xffffffff, 0xffffffff, 0x10de1ee6, 0x10de2dd1, 0x10de20ff, 0x10de2769,
+    0xffffffff, 0x10de20ab, 0xffffffff, 0x10de2366, 0x10de2668, 0x10de1f29, 0x10de1e6a, 0x10de204f,
+    0xffffffff, 0x10de2f59, 0x10de2ec7, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2f0a,
+    0xffffffff, 0xffffffff, 0x10de24ab, 0x10de23b9, 0xffffffff, 0x10de2031, 0x10de2dcd, 0x10de2b98,
+    0x10de27f2, 0xffffffff, 0x10de2e05, 0x10de2472, 0x10de21e7, 0x10de269d, 0xffffffff, 0x10de2935,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2177, 0xffffffff, 0x10de2fc3, 0x10de2af6, 0xffffffff,
+    0xffffffff, 0x10de23a7, 0xffffffff, 0x10de2d95, 0xffffffff, 0x10de2762, 0xffffffff, 0x10de238b,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2fbc, 0x10de2f3d, 0x10de2acc, 0xffffffff, 0x10de25c0,
+    0xffffffff, 0xffffffff, 0x10de25ae, 0x10de2398, 0xffffffff, 0x10de2313, 0xffffffff, 0x10de2047,
+    0x10de1e92, 0xffffffff, 0x10de256b, 0x10de21a6, 0x10de2abf, 0x10de231a, 0x10de2f56, 0xffffffff,
+    0x10de28e6, 0x10de27aa, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2452, 0x10de2c22, 0x10de23a3,
+    0xffffffff, 0x10de1e56, 0x10de2861, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de276e, 0x10de265e,
+    0x10de2bbc, 0x10de2a29, 0xffffffff, 0x10de1f9a, 0x10de1fc1, 0xffffffff, 0x10de201a, 0xffffffff,
+    0xffffffff, 0x10de2477, 0xffffffff, 0xffffffff, 0x10de2cf9, 0x10de2c99, 0x10de2909, 0xffffffff,
+    0x10de2c68, 0xffffffff, 0xffffffff, 0x10de2136, 0x10de2fcd, 0xffffffff, 0xffffffff, 0x10de2345,
+    0x10de2cec, 0xffffffff, 0x10de29d2, 0x10de2454, 0x10de2a7a, 0x10de2f21, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2efd, 0x10de2d71, 0x10de1ec0, 0x10de2d46, 0xffffffff, 0xffffffff, 0x10de2ea2,
+    0x10de1e96, 0xffffffff, 0xffffffff, 0x10de2559, 0xffffffff, 0x10de2297, 0x10de2114, 0x10de2f46,
+    0xffffffff, 0xffffffff, 0x10de20ea, 0x10de2fe1, 0xffffffff, 0x10de2c2f, 0xffffffff, 0x10de25e2,
+    0x10de27ab, 0x10de2a79, 0xffffffff, 0x10de2ea7, 0xffffffff, 0x10de259b, 0x10de2ea6, 0x10de20bb,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2e9b, 0xffffffff, 0xffffffff, 0x10de2111, 0x10de2662,
+    0x10de2c0a, 0xffffffff, 0xffffffff, 0x10de23d1, 0xffffffff, 0xffffffff, 0x10de2d9f, 0xffffffff,
+    0xffffffff, 0x10de2552, 0xffffffff, 0x10de1f78, 0x10de242f, 0x10de26ce, 0xffffffff, 0x10de2cda,
+    0xffffffff, 0x10de1ea6, 0x10de2cdc, 0x10de2cc5, 0x10de20c1, 0x10de24b8, 0x10de21d1, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de1f6f, 0xffffffff, 0x10de2f1a, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de29da, 0xffffffff, 0xffffffff, 0x10de22c1, 0x10de28b2, 0xffffffff, 0x10de24a7,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2913, 0xffffffff, 0x10de27c2, 0x10de25e5, 0x10de256e,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ceb, 0xffffffff, 0xffffffff, 0x10de1f97, 0xffffffff,
+    0x10de248d, 0x10de27df, 0x10de2f2b, 0x10de254b, 0xffffffff, 0x10de2e60, 0x10de2ef7, 0xffffffff,
+    0x10de1e91, 0xffffffff, 0x10de2210, 0xffffffff, 0x10de1e36, 0x10de1f0d, 0xffffffff, 0x10de2284,
+    0x10de1f5f, 0xffffffff, 0x10de24f0, 0x10de227b, 0xffffffff, 0x10de2f6d, 0xffffffff, 0x10de2bfd,
+    0x10de24b0, 0x10de1f99, 0x10de2c9e, 0x10de2e2c, 0xffffffff, 0x10de2574, 0x10de2d22, 0x10de1e04,
+    0x10de2995, 0x10de24ba, 0x10de2a96, 0x10de2219, 0xffffffff, 0x10de2a59, 0xffffffff, 0x10de2aee,
+    0xffffffff, 0xffffffff, 0x10de2ce9, 0xffffffff, 0x10de1e7f, 0x10de2182, 0x10de237f, 0xffffffff,
+    0x10de22fe, 0x10de25f8, 0x10de24ad, 0x10de20c9, 0x10de2cc3, 0xffffffff, 0xffffffff, 0x10de2df9,
+    0x10de2488, 0x10de203d, 0xffffffff, 0xffffffff, 0x10de1e8a, 0x10de2e0b, 0xffffffff, 0xffffffff,
+    0x10de24c9, 0xffffffff, 0xffffffff, 0x10de2fdf, 0x10de2c83, 0x10de2b2b, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2d27, 0xffffffff, 0x10de2188, 0x10de1e0e, 0xffffffff, 0xffffffff,
+    0x10de2479, 0xffffffff, 0xffffffff, 0x10de2c7c, 0x10de24a0, 0x10de25a9, 0x10de24db, 0xffffffff,
+    0x10de2dd9, 0xffffffff, 0xffffffff, 0x10de2a6e, 0x10de20d7, 0x10de2595, 0x10de2ffa, 0x10de2bde,
+    0x10de2683, 0x10de24f3, 0x10de1e4d, 0xffffffff, 0x10de20e3, 0x10de29e2, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2c2e, 0xffffffff, 0x10de299e, 0x10de2fba, 0x10de23a9, 0x10de211f, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de27bc,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2e33, 0xffffffff, 0x10de2c7a, 0x10de2fb3, 0x10de251f,
+    0x10de2399, 0x10de2346, 0x10de244f, 0x10de235c, 0xffffffff, 0xffffffff, 0x10de1f01, 0x10de2bf0,
+    0xffffffff, 0x10de24ce, 0x10de2f23, 0x10de235d, 0x10de27f0, 0xffffffff, 0x10de2887, 0xffffffff,
+    0x10de1fdd, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de246f, 0x10de23ef, 0x10de2654,
+    0x10de21ec, 0x10de229d, 0xffffffff, 0x10de2883, 0xffffffff, 0x10de24d8, 0x10de29ba, 0x10de21a9,
+    0x10de2603, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de278b, 0xffffffff, 0x10de229a, 0xffffffff,
+    0x10de2dcf, 0x10de23c0, 0xffffffff, 0xffffffff, 0x10de28ed, 0xffffffff, 0x10de1fae, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de23b5, 0xffffffff, 0x10de284d, 0x10de22ed, 0x10de2b4a, 0x10de1f54,
+    0x10de2e0f, 0x10de2058, 0x10de264f, 0x10de2476, 0x10de2abe, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de25d7, 0xffffffff, 0x10de2175, 0x10de1ffd, 0xffffffff, 0xffffffff, 0x10de218b,
+    0xffffffff, 0x10de2ae3, 0xffffffff, 0x10de2e7d, 0x10de2e42, 0x10de27d6, 0xffffffff, 0x10de2f4e,
+    0x10de2899, 0xffffffff, 0x10de2d90, 0xffffffff, 0xffffffff, 0x10de2d6a, 0x10de26d0, 0x10de2b53,
+    0xffffffff, 0xffffffff, 0x10de2932, 0x10de2475, 0x10de27b8, 0xffffffff, 0x10de28fe, 0x10de2841,
+    0x10de21a3, 0xffffffff, 0xffffffff, 0x10de2023, 0x10de239a, 0xffffffff, 0x10de28f2, 0xffffffff,
+    0x10de2e91, 0xffffffff, 0xffffffff, 0x10de2087, 0x10de2113, 0xffffffff, 0x10de2713, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2c07, 0x10de2469, 0x10de2ca9, 0x10de1e1c, 0xffffffff, 0xffffffff,
+    0x10de2711, 0xffffffff, 0x10de2164, 0x10de2dee, 0xffffffff, 0x10de1f1d, 0x10de2871, 0xffffffff,
+    0x10de2b51, 0xffffffff, 0x10de2f6f, 0x10de222f, 0x10de295d, 0x10de2ece, 0xffffffff, 0xffffffff,
+    0x10de2d8e, 0x10de23f3, 0x10de2461, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2fc2, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2fa2, 0xffffffff, 0x10de216f, 0xffffffff, 0x10de29e6,
+    0xffffffff, 0x10de2140, 0xffffffff, 0x10de1fb8, 0x10de2300, 0xffffffff, 0xffffffff, 0x10de20d9,
+    0xffffffff, 0x10de2821, 0x10de2ada, 0x10de29dc, 0x10de286e, 0x10de2213, 0xffffffff, 0xffffffff,
+    0x10de2aff, 0x10de2b74, 0x10de1f0f, 0xffffffff, 0xffffffff, 0x10de204d, 0xffffffff, 0x10de2fee,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2187, 0x10de1ecf, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de27b3, 0x10de262c, 0x10de1eb0, 0x10de292e, 0x10de2f75,
+    0xffffffff, 0x10de213c, 0xffffffff, 0x10de2916, 0x10de2c58, 0x10de2c70, 0x10de21e9, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2b7c, 0x10de25c9, 0x10de24b1, 0x10de2c49, 0xffffffff, 0xffffffff,
+    0x10de2fc4, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de24b2, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2d5c, 0xffffffff, 0x10de1e19, 0x10de2f94, 0xffffffff, 0x10de2ac7, 0xffffffff, 0xffffffff,
+    0x10de1e59, 0xffffffff, 0x10de2faf, 0x10de24cd, 0xffffffff, 0x10de2bf1, 0x10de2abd, 0x10de2352,
+    0x10de26a6, 0xffffffff, 0x10de21bd, 0x10de2986, 0xffffffff, 0x10de2bc1, 0xffffffff, 0x10de28ea,
+    0xffffffff, 0xffffffff, 0x10de2b56, 0x10de21fd, 0xffffffff, 0xffffffff, 0x10de21c4, 0xffffffff,
+    0x10de2dd2, 0x10de2680, 0x10de238d, 0xffffffff, 0x10de2f2a, 0x10de2024, 0x10de20a9, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de29bd, 0xffffffff, 0x10de2b2e, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de255f, 0xffffffff, 0x10de2c47, 0xffffffff,
+    0xffffffff, 0x10de2583, 0xffffffff, 0xffffffff, 0x10de2779, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2e9f, 0xffffffff, 0x10de20f9, 0xffffffff, 0x10de2a49, 0xffffffff, 0x10de297b, 0xffffffff,
+    0x10de234d, 0xffffffff, 0x10de213b, 0x10de260c, 0x10de29d9, 0xffffffff, 0x10de2e61, 0xffffffff,
+    0xffffffff, 0x10de2253, 0x10de2cf8, 0x10de1e60, 0x10de2e11, 0xffffffff, 0x10de21bc, 0xffffffff,
+    0xffffffff, 0x10de2209, 0xffffffff, 0x10de2f8a, 0x10de2789, 0xffffffff, 0xffffffff, 0x10de2355,
+    0x10de2934, 0xffffffff, 0x10de2c38, 0xffffffff, 0xffffffff, 0x10de2e8f, 0x10de23bf, 0xffffffff,
+    0x10de2b9e, 0x10de2344, 0x10de1efc, 0xffffffff, 0x10de2ec6, 0xffffffff, 0xffffffff, 0x10de2037,
+    0x10de24fd, 0x10de2bce, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2694, 0x10de264b, 0xffffffff,
+    0x10de2ab2, 0x10de26f6, 0x10de2e44, 0xffffffff, 0x10de2b49, 0x10de240d, 0xffffffff, 0x10de2c09,
+    0x10de1f08, 0x10de2fca, 0x10de266c, 0xffffffff, 0x10de2546, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de1f50, 0x10de2b86, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de1fcc, 0x10de22d9, 0x10de22c9, 0xffffffff, 0x10de26fc, 0x10de2e6e, 0x10de2a0d, 0xffffffff,
+    0xffffffff, 0x10de20dd, 0xffffffff, 0x10de20f6, 0xffffffff, 0xffffffff, 0x10de29cd, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de22d6, 0xffffffff, 0xffffffff, 0x10de20d1, 0xffffffff,
+    0x10de2d83, 0x10de2927, 0xffffffff, 0x10de205c, 0x10de2329, 0xffffffff, 0xffffffff, 0x10de2940,
+    0xffffffff, 0x10de2ce8, 0x10de2d96, 0xffffffff, 0x10de2cbe, 0x10de2046, 0x10de260e, 0xffffffff,
+    0xffffffff, 0x10de2051, 0xffffffff, 0xffffffff, 0x10de2d41, 0x10de2a1c, 0x10de2d75, 0x10de1fb2,
+    0xffffffff, 0x10de2f4d, 0x10de1fb3, 0x10de1f36, 0x10de2c0c, 0x10de2c19, 0x10de28e7, 0x10de244e,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de254a, 0xffffffff, 0x10de26d9, 0x10de26b1, 0x10de2cfe,
+    0x10de28e4, 0x10de202b, 0xffffffff, 0x10de20b6, 0x10de251c, 0x10de1e83, 0xffffffff, 0xffffffff,
+    0x10de2124, 0x10de27dc, 0xffffffff, 0x10de2f66, 0xffffffff, 0x10de2e18, 0x10de235e, 0x10de24d3,
+    0x10de2171, 0x10de2f78, 0xffffffff, 0x10de2ddf, 0xffffffff, 0x10de2ce2, 0x10de2a6f, 0x10de2430,
+    0xffffffff, 0x10de2609, 0x10de2ce3, 0x10de2836, 0x10de2847, 0x10de1e21, 0xffffffff, 0x10de2dc6,
+    0xffffffff, 0x10de2dba, 0x10de2122, 0x10de2a0e, 0x10de2bc2, 0x10de26dc, 0x10de2919, 0x10de2881,
+    0x10de1eab, 0x10de2aa3, 0x10de2fcb, 0x10de2944, 0xffffffff, 0x10de2cdf, 0x10de28c7, 0xffffffff,
+    0x10de1e30, 0xffffffff, 0xffffffff, 0x10de2306, 0x10de291d, 0x10de2b8a, 0x10de237b, 0x10de219e,
+    0x10de2120, 0xffffffff, 0xffffffff, 0x10de27a1, 0xffffffff, 0x10de2b54, 0x10de2a9c, 0x10de2fbd,
+    0xffffffff, 0xffffffff, 0x10de2dcc, 0x10de204b, 0x10de2f44, 0x10de2903, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de296c, 0xffffffff,
+    0x10de2b65, 0x10de297f, 0x10de2d15, 0x10de2719, 0xffffffff, 0x10de2b05, 0x10de2a47, 0x10de2a9b,
+    0x10de232a, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2776, 0x10de2e88,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de235a, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de27f5, 0xffffffff, 0xffffffff, 0x10de2547, 0x10de2b89, 0x10de2e97, 0x10de2009,
+    0x10de286a, 0x10de261c, 0xffffffff, 0x10de26d7, 0x10de295f, 0x10de2ba6, 0x10de2278, 0xffffffff,
+    0x10de2d2a, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2797, 0x10de2266, 0x10de26f7,
+    0x10de24c4, 0x10de2323, 0x10de29c1, 0x10de1fed, 0xffffffff, 0x10de284c, 0xffffffff, 0x10de2e12,
+    0x10de2207, 0xffffffff, 0x10de2a46, 0x10de22d8, 0x10de24c8, 0x10de28d5, 0xffffffff, 0x10de2afe,
+    0xffffffff, 0xffffffff, 0x10de2b91, 0xffffffff, 0x10de205e, 0xffffffff, 0x10de1ee4, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de23b1, 0x10de1ec8, 0x10de2b3b, 0x10de222e, 0x10de21b8, 0xffffffff,
+    0x10de29c0, 0x10de2360, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2f99, 0xffffffff, 0x10de24d2,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2816, 0x10de24b7, 0xffffffff, 0xffffffff, 0x10de2cb0,
+    0x10de2857, 0x10de2ad5, 0x10de2a39, 0x10de234a, 0x10de2dea, 0xffffffff, 0xffffffff, 0x10de28bf,
+    0xffffffff, 0x10de1eb6, 0x10de2014, 0x10de25db, 0x10de1e79, 0x10de2985, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2a4d, 0x10de25b5, 0x10de2fe0, 0xffffffff, 0xffffffff, 0x10de1f4d,
+    0x10de2df2, 0xffffffff, 0xffffffff, 0x10de2db1, 0x10de2e3b, 0xffffffff, 0xffffffff, 0x10de2ab9,
+    0x10de23e9, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de23ce, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2152, 0xffffffff, 0xffffffff, 0x10de25dc, 0x10de29be, 0x10de297a,
+    0xffffffff, 0xffffffff, 0x10de2fa4, 0x10de2184, 0xffffffff, 0x10de2ce7, 0xffffffff, 0xffffffff,
+    0x10de25bf, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2054, 0x10de259c, 0x10de2ee9, 0x10de2823,
+    0x10de1fbb, 0xffffffff, 0xffffffff, 0x10de1e93, 0xffffffff, 0xffffffff, 0x10de2d66, 0x10de2fb7,
+    0x10de2d9b, 0xffffffff, 0xffffffff, 0x10de289e, 0xffffffff, 0xffffffff, 0x10de2f70, 0x10de21f3,
+    0x10de21b0, 0x10de1ff1, 0x10de281c, 0x10de22e5, 0x10de1f46, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de269b, 0x10de2a42, 0xffffffff, 0x10de22a1, 0xffffffff, 0x10de2730, 0x10de2998, 0xffffffff,
+    0xffffffff, 0x10de2b5c, 0x10de221d, 0x10de2e08, 0xffffffff, 0xffffffff, 0x10de2cd3, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2bd6, 0x10de2fbe, 0x10de22a4, 0xffffffff, 0x10de2186, 0xffffffff,
+    0xffffffff, 0x10de26d8, 0x10de2c20, 0x10de229c, 0x10de2082, 0xffffffff, 0x10de2c13, 0x10de294c,
+    0xffffffff, 0x10de2ee3, 0x10de278a, 0xffffffff, 0xffffffff, 0x10de2353, 0xffffffff, 0x10de28d2,
+    0xffffffff, 0x10de2a63, 0xffffffff, 0x10de2891, 0x10de263b, 0x10de243f, 0xffffffff, 0xffffffff,
+    0x10de22f6, 0x10de224d, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de272e, 0x10de26aa, 0x10de1fc3,
+    0x10de23ac, 0x10de249f, 0x10de2d54, 0xffffffff, 0x10de2c8c, 0xffffffff, 0xffffffff, 0x10de24aa,
+    0x10de2521, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a95, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de239c, 0xffffffff, 0x10de271a, 0xffffffff, 0x10de2132, 0xffffffff, 0x10de266d,
+    0xffffffff, 0x10de2522, 0xffffffff, 0x10de2647, 0x10de2af5, 0x10de2a4b, 0x10de2f8b, 0x10de2ba4,
+    0xffffffff, 0x10de2095, 0xffffffff, 0xffffffff, 0x10de250e, 0xffffffff, 0xffffffff, 0x10de1e9d,
+    0x10de1ee8, 0x10de1f79, 0x10de1f31, 0x10de2d1e, 0xffffffff, 0x10de261a, 0x10de2564, 0x10de279d,
+    0xffffffff, 0xffffffff, 0x10de2d7f, 0xffffffff, 0x10de2a71, 0xffffffff, 0xffffffff, 0x10de2966,
+    0xffffffff, 0x10de2039, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2c5e, 0x10de2102, 0x10de2994,
+    0x10de2e20, 0xffffffff, 0x10de2e09, 0x10de1ea0, 0x10de2b0c, 0x10de277c, 0x10de2e3a, 0x10de2984,
+    0x10de20aa, 0xffffffff, 0x10de2517, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2092, 0x10de2a68, 0x10de224a, 0x10de20e1, 0x10de2257, 0x10de2239, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2076, 0x10de2a10, 0x10de2563, 0x10de2106, 0x10de29f0, 0x10de234c, 0xffffffff,
+    0x10de264d, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2077, 0x10de293f, 0xffffffff,
+    0x10de2967, 0x10de2138, 0x10de2e50, 0x10de2513, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de291f, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e42, 0xffffffff, 0x10de2d70, 0x10de2402,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de29cf, 0x10de2566, 0xffffffff,
+    0x10de2230, 0x10de1f89, 0xffffffff, 0x10de2638, 0x10de28cb, 0x10de2659, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e9b, 0xffffffff, 0xffffffff, 0x10de2a50, 0xffffffff,
+    0xffffffff, 0x10de281a, 0xffffffff, 0xffffffff, 0x10de23c4, 0xffffffff, 0x10de2315, 0x10de2d56,
+    0xffffffff, 0x10de1f8b, 0xffffffff, 0x10de2765, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2215,
+    0x10de2b02, 0xffffffff, 0xffffffff, 0x10de262f, 0x10de2a87, 0x10de2c59, 0x10de2414, 0x10de2bd4,
+    0x10de2c0b, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2eaf, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2ea5, 0x10de20d5, 0x10de2025, 0x10de22bb, 0x10de2433, 0xffffffff, 0xffffffff, 0x10de2aa4,
+    0x10de21c1, 0x10de296e, 0x10de23bc, 0x10de2c00, 0x10de2a8e, 0xffffffff, 0x10de2f57, 0xffffffff,
+    0xffffffff, 0x10de257f, 0xffffffff, 0x10de2daa, 0xffffffff, 0x10de2a4c, 0x10de2319, 0x10de2d11,
+    0x10de2bc0, 0x10de2d76, 0xffffffff, 0xffffffff, 0x10de1f8d, 0x10de2e6d, 0xffffffff, 0x10de26a4,
+    0x10de20f5, 0xffffffff, 0xffffffff, 0x10de23a6, 0x10de2bb6, 0x10de1e5c, 0xffffffff, 0x10de2c56,
+    0xffffffff, 0x10de25d9, 0x10de2bdd, 0x10de2c7f, 0x10de1fdb, 0x10de2a8a, 0x10de24ae, 0x10de24e7,
+    0x10de291b, 0xffffffff, 0x10de224f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de23c1,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2153, 0x10de26ef, 0x10de28da, 0xffffffff,
+    0x10de2c8a, 0xffffffff, 0xffffffff, 0x10de2035, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de244b,
+    0xffffffff, 0x10de2250, 0x10de24fe, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de270a, 0xffffffff,
+    0x10de2427, 0x10de208f, 0xffffffff, 0x10de2809, 0x10de1f41, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de28a5, 0xffffffff, 0x10de296b, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2dbc,
+    0x10de2ea8, 0x10de2f1d, 0x10de2436, 0xffffffff, 0x10de2d0c, 0x10de21be, 0x10de22c0, 0x10de1e03,
+    0xffffffff, 0x10de2640, 0xffffffff, 0xffffffff, 0x10de2b47, 0x10de27db, 0xffffffff, 0x10de2a0a,
+    0xffffffff, 0xffffffff, 0x10de2c8b, 0x10de282f, 0xffffffff, 0x10de27da, 0x10de2bbd, 0xffffffff,
+    0x10de2cc0, 0xffffffff, 0x10de2330, 0x10de2a2f, 0x10de2d3d, 0x10de24a4, 0x10de2e04, 0x10de25e0,
+    0xffffffff, 0x10de25c7, 0xffffffff, 0x10de27bb, 0xffffffff, 0x10de1f77, 0xffffffff, 0x10de278c,
+    0x10de2fa9, 0xffffffff, 0x10de2d80, 0x10de28d1, 0xffffffff, 0x10de1e7d, 0xffffffff, 0x10de24b4,
+    0x10de28bc, 0xffffffff, 0xffffffff, 0x10de2c3b, 0x10de2fbb, 0x10de27e6, 0x10de2a99, 0xffffffff,
+    0x10de22f9, 0xffffffff, 0x10de2e4a, 0x10de260f, 0x10de27f7, 0xffffffff, 0x10de275d, 0x10de2444,
+    0xffffffff, 0x10de2c57, 0xffffffff, 0xffffffff, 0x10de209f, 0x10de23dc, 0xffffffff, 0x10de1f87,
+    0x10de2a64, 0x10de2a90, 0x10de249c, 0x10de2a97, 0xffffffff, 0xffffffff, 0x10de22e1, 0x10de2b10,
+    0x10de2cab, 0xffffffff, 0xffffffff, 0x10de2570, 0x10de242b, 0xffffffff, 0x10de2de0, 0x10de1f93,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2c11, 0xffffffff, 0xffffffff, 0x10de2971, 0x10de2442,
+    0xffffffff, 0x10de217a, 0x10de2e1e, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2c4e, 0x10de29fd, 0xffffffff, 0x10de2be7, 0xffffffff, 0x10de2197, 0xffffffff, 0x10de20b0,
+    0x10de24fa, 0x10de2e71, 0x10de24c7, 0x10de2088, 0x10de2c3a, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2c8e, 0xffffffff, 0x10de1fe5, 0xffffffff, 0xffffffff, 0x10de218e, 0x10de2b14, 0x10de2cbb,
+    0xffffffff, 0x10de2b6d, 0xffffffff, 0x10de2cb1, 0x10de26bc, 0xffffffff, 0x10de2bc4, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2cae, 0xffffffff,
+    0x10de245e, 0x10de2634, 0xffffffff, 0x10de1fdc, 0x10de2f97, 0x10de1fac, 0x10de236c, 0x10de20cd,
+    0x10de22c2, 0x10de226c, 0x10de225c, 0x10de2819, 0x10de27b2, 0x10de2b5e, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2682, 0x10de2d2b, 0x10de22bf, 0x10de2a01, 0xffffffff, 0xffffffff, 0x10de2b50,
+    0xffffffff, 0x10de1f7e, 0x10de2191, 0xffffffff, 0xffffffff, 0x10de2be6, 0x10de1fe1, 0xffffffff,
+    0x10de200d, 0x10de2b16, 0x10de2445, 0x10de1e40, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de290f,
+    0x10de2c9d, 0xffffffff, 0x10de2104, 0x10de1f38, 0x10de2bec, 0xffffffff, 0x10de29ac, 0x10de2898,
+    0x10de2e9e, 0xffffffff, 0x10de1f2d, 0x10de20e8, 0x10de2beb, 0xffffffff, 0x10de28d9, 0x10de263f,
+    0x10de1f57, 0x10de2596, 0x10de27a7, 0x10de22e0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2ab5, 0xffffffff, 0xffffffff, 0x10de2594, 0x10de2e00, 0x10de2a44, 0x10de2506, 0x10de2ddb,
+    0xffffffff, 0x10de274a, 0xffffffff, 0x10de21d0, 0x10de23c3, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de28fc, 0x10de2e8c, 0xffffffff, 0x10de226e, 0xffffffff, 0xffffffff, 0x10de1f1f,
+    0xffffffff, 0x10de2aa5, 0x10de21df, 0xffffffff, 0x10de2910, 0x10de27fe, 0xffffffff, 0x10de23f7,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e78, 0xffffffff, 0x10de1f47, 0x10de22cf, 0x10de2af3,
+    0x10de269f, 0x10de2627, 0x10de2f3b, 0xffffffff, 0xffffffff, 0x10de1e6b, 0x10de27e4, 0x10de2fad,
+    0x10de2464, 0x10de2a3d, 0x10de202e, 0x10de2162, 0xffffffff, 0xffffffff, 0x10de2434, 0xffffffff,
+    0x10de2d5d, 0x10de2d18, 0x10de248f, 0xffffffff, 0x10de2a3f, 0x10de2dd8, 0xffffffff, 0xffffffff,
+    0x10de2364, 0x10de1f9f, 0xffffffff, 0xffffffff, 0x10de2116, 0x10de21f8, 0x10de22d4, 0x10de2843,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de28d3, 0xffffffff, 0x10de2ed6, 0xffffffff, 0x10de2420,
+    0xffffffff, 0x10de24b9, 0x10de2852, 0x10de285c, 0x10de2081, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d8b, 0x10de2abb, 0x10de1e1d, 0xffffffff, 0x10de2526,
+    0x10de24ef, 0xffffffff, 0x10de2696, 0x10de2342, 0x10de2efc, 0x10de2e1c, 0xffffffff, 0x10de2f26,
+    0x10de2d5f, 0x10de1feb, 0xffffffff, 0x10de2f88, 0xffffffff, 0xffffffff, 0x10de2103, 0xffffffff,
+    0x10de2d32, 0x10de2361, 0x10de1f20, 0x10de21cd, 0xffffffff, 0x10de2bc7, 0xffffffff, 0x10de2ff4,
+    0x10de2ab1, 0x10de25e6, 0x10de25a3, 0x10de2042, 0xffffffff, 0x10de2421, 0x10de2aca, 0x10de1ede,
+    0xffffffff, 0xffffffff, 0x10de2613, 0x10de2a35, 0x10de2c44, 0x10de22e4, 0x10de2163, 0x10de2541,
+    0x10de2671, 0x10de2c54, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2aab, 0x10de2bb4, 0x10de2bfb,
+    0x10de2f41, 0x10de2ec1, 0x10de246b, 0x10de2edc, 0x10de1e37, 0xffffffff, 0x10de29e5, 0xffffffff,
+    0x10de253a, 0x10de2f31, 0xffffffff, 0x10de2c27, 0xffffffff, 0x10de2437, 0x10de2fed, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b30,
+    0x10de294d, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2be3, 0xffffffff, 0x10de2617,
+    0xffffffff, 0xffffffff, 0x10de1f07, 0xffffffff, 0x10de2367, 0xffffffff, 0x10de2636, 0xffffffff,
+    0xffffffff, 0x10de26a3, 0xffffffff, 0x10de2eb0, 0xffffffff, 0x10de223d, 0x10de2808, 0xffffffff,
+    0x10de2ed3, 0xffffffff, 0x10de28ff, 0x10de28be, 0x10de252f, 0xffffffff, 0x10de2f98, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2281, 0x10de222b, 0x10de2602, 0x10de250b, 0x10de2545, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ea4,
+    0x10de2327, 0x10de2b64, 0x10de1edf, 0xffffffff, 0x10de27ac, 0x10de2d23, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de238e, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ac2, 0xffffffff, 0x10de2f67,
+    0x10de2ce5, 0x10de2947, 0x10de29fe, 0x10de2795, 0x10de2f9b, 0x10de259d, 0x10de29f2, 0x10de29c7,
+    0x10de230b, 0x10de2ce1, 0x10de24bb, 0x10de2a31, 0x10de2618, 0x10de2e24, 0x10de20cb, 0x10de29b2,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e08, 0x10de1f69,
+    0xffffffff, 0x10de2e03, 0x10de2bfe, 0x10de2f58, 0xffffffff, 0xffffffff, 0x10de246e, 0xffffffff,
+    0xffffffff, 0x10de1fbe, 0x10de2b5a, 0x10de25d6, 0xffffffff, 0xffffffff, 0x10de20b5, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2628, 0x10de2f3c, 0x10de22ee, 0xffffffff, 0x10de2791,
+    0x10de2135, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1ecb, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de23f5, 0xffffffff, 0x10de2ff7, 0xffffffff, 0xffffffff, 0x10de2359, 0x10de2c78,
+    0x10de215b, 0x10de2f96, 0x10de293c, 0x10de2bdb, 0xffffffff, 0xffffffff, 0x10de2df0, 0xffffffff,
+    0xffffffff, 0x10de227a, 0x10de1e2a, 0x10de2289, 0x10de2e1b, 0xffffffff, 0x10de1fda, 0x10de2280,
+    0x10de2cd5, 0x10de2d07, 0xffffffff, 0x10de2d30, 0x10de21e2, 0xffffffff, 0xffffffff, 0x10de2a2e,
+    0xffffffff, 0xffffffff, 0x10de2f50, 0x10de222c, 0x10de21b1, 0xffffffff, 0x10de282e, 0x10de2eb9,
+    0x10de2b9a, 0x10de227d, 0x10de1f2e, 0xffffffff, 0x10de24cc, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2f82, 0x10de29ea, 0x10de268c, 0x10de22e7, 0x10de2581, 0xffffffff, 0xffffffff, 0x10de2fcf,
+    0x10de1f90, 0xffffffff, 0xffffffff, 0x10de2f77, 0x10de2d9c, 0xffffffff, 0x10de236b, 0x10de236f,
+    0x10de2cf3, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de28f6, 0x10de289d, 0x10de2eb6,
+    0x10de1e2b, 0xffffffff, 0x10de2a02, 0x10de2588, 0xffffffff, 0x10de2670, 0x10de21bb, 0x10de2363,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b46, 0xffffffff, 0xffffffff, 0x10de211d, 0x10de1fb1,
+    0x10de2f71, 0x10de2fce, 0x10de29b8, 0x10de2a06, 0x10de2e3c, 0x10de24e0, 0x10de255d, 0x10de2df4,
+    0x10de2e10, 0xffffffff, 0x10de2724, 0x10de2392, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2689,
+    0xffffffff, 0xffffffff, 0x10de25b6, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de1f25, 0xffffffff, 0xffffffff, 0x10de20e0, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d6e,
+    0x10de2da6, 0xffffffff, 0x10de29a7, 0x10de2584, 0xffffffff, 0xffffffff, 0x10de28d6, 0x10de2b9d,
+    0xffffffff, 0xffffffff, 0x10de1fbd, 0x10de1e6d, 0x10de2aec, 0x10de2539, 0xffffffff, 0x10de2f24,
+    0x10de25cc, 0x10de2b61, 0xffffffff, 0xffffffff, 0x10de1f51, 0x10de206f, 0x10de273e, 0x10de26c1,
+    0xffffffff, 0x10de2fd9, 0xffffffff, 0x10de26e4, 0xffffffff, 0x10de2a9e, 0xffffffff, 0x10de2df6,
+    0x10de2936, 0x10de251e, 0x10de2c72, 0xffffffff, 0x10de2df3, 0x10de22dd, 0x10de2a07, 0xffffffff,
+    0x10de2880, 0x10de1f85, 0xffffffff, 0x10de228e, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b18,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2dfd, 0x10de24e3, 0x10de1f2a, 0x10de2324, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b2f, 0xffffffff, 0xffffffff, 0x10de2a88, 0x10de2394,
+    0xffffffff, 0xffffffff, 0x10de2bb3, 0xffffffff, 0x10de2c61, 0x10de2267, 0x10de2c37, 0xffffffff,
+    0x10de2afc, 0xffffffff, 0x10de1f86, 0x10de2093, 0x10de21a4, 0xffffffff, 0xffffffff, 0x10de2767,
+    0xffffffff, 0xffffffff, 0x10de239f, 0xffffffff, 0x10de22b8, 0x10de2a43, 0xffffffff, 0xffffffff,
+    0x10de248a, 0xffffffff, 0x10de2865, 0x10de2ce6, 0x10de2aa8, 0x10de2fac, 0xffffffff, 0x14e44357,
+    0xffffffff, 0x10de22af, 0x10de2b94, 0xffffffff, 0xffffffff, 0x10de2412, 0xffffffff, 0x10de282a,
+    0x10de20bd, 0x10de2c69, 0x10de2d81, 0xffffffff, 0x10de2701, 0xffffffff, 0x10de2438, 0xffffffff,
+    0x10de24f1, 0x10de2908, 0xffffffff, 0x10de2dae, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de25b9, 0x10de280d, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d0e, 0x10de20b9,
+    0x10de287c, 0x10de1e82, 0x10de1f3c, 0x10de1f55, 0x10de2aae, 0x10de273c, 0x10de2211, 0xffffffff,
+    0xffffffff, 0x10de1ef5, 0x10de2da1, 0xffffffff, 0x10de2cc8, 0x10de22ba, 0x10de2d7e, 0x10de20cf,
+    0x10de2fab, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b31, 0xffffffff, 0x10de21cc, 0xffffffff,
+    0xffffffff, 0x10de211e, 0x10de2912, 0xffffffff, 0x10de2f69, 0x10de2708, 0x10de2244, 0xffffffff,
+    0x10de2348, 0x10de2756, 0xffffffff, 0xffffffff, 0x10de20ee, 0x10de24e8, 0x10de1f30, 0x10de25cf,
+    0xffffffff, 0x10de22a3, 0x10de2e54, 0x10de23e5, 0x10de2b81, 0x10de2458, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2e3d, 0xffffffff, 0x10de26a0, 0xffffffff, 0xffffffff, 0x10de21d3, 0x10de1eb2,
+    0xffffffff, 0xffffffff, 0x10de2b3e, 0xffffffff, 0xffffffff, 0x10de29c4, 0xffffffff, 0x10de2052,
+    0x10de2216, 0xffffffff, 0x10de2add, 0x10de2de6, 0x10de20b2, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2de5, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2826, 0x10de2380, 0xffffffff,
+    0xffffffff, 0x10de2ef3, 0x10de2232, 0x10de2ee5, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2642, 0x14e44353, 0xffffffff, 0xffffffff, 0x10de2f7a, 0xffffffff, 0x10de2387, 0x10de27de,
+    0xffffffff, 0x10de226b, 0xffffffff, 0x10de23f0, 0xffffffff, 0x10de2283, 0x10de25ce, 0x10de2e6c,
+    0xffffffff, 0x10de25d5, 0x10de25f1, 0x10de236d, 0x10de26f4, 0xffffffff, 0xffffffff, 0x10de225d,
+    0x10de2e2f, 0xffffffff, 0x10de2925, 0x10de216e, 0xffffffff, 0x10de2e81, 0xffffffff, 0x10de2165,
+    0x10de1e0a, 0x10de20a4, 0xffffffff, 0x10de213a, 0xffffffff, 0xffffffff, 0x10de1ff9, 0xffffffff,
+    0xffffffff, 0x10de2ca3, 0xffffffff, 0x10de20d0, 0x10de21f2, 0x10de2d37, 0xffffffff, 0x10de2377,
+    0x10de2c85, 0xffffffff, 0x10de2e74, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b4c,
+    0xffffffff, 0x10de1efd, 0x10de2e7c, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2a9f, 0x10de2a61, 0x10de2f12, 0xffffffff, 0x10de2ac8, 0xffffffff, 0x10de2f89, 0xffffffff,
+    0x10de2029, 0x10de294e, 0x10de2d3c, 0x10de2622, 0xffffffff, 0x10de23cd, 0x10de2828, 0x10de25b4,
+    0x10de2365, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f76, 0x10de2d93, 0x10de245b, 0xffffffff,
+    0xffffffff, 0x10de1f4c, 0x10de2e17, 0xffffffff, 0x10de286c, 0x10de2551, 0x10de21a5, 0x10de2f48,
+    0x10de2e7e, 0xffffffff, 0xffffffff, 0x10de2ae6, 0x10de2845, 0x10de29f7, 0xffffffff, 0x10de2959,
+    0x10de2e2a, 0xffffffff, 0x10de27ef, 0xffffffff, 0x10de24c3, 0x10de2efa, 0x10de26a5, 0xffffffff,
+    0x10de2356, 0x10de2409, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2bae, 0x10de1e29, 0x10de28f3, 0x10de241d, 0x10de2176, 0x10de2c01, 0xffffffff,
+    0x10de278d, 0x10de25fb, 0x10de258d, 0x10de2b1f, 0xffffffff, 0x10de2e1d, 0x10de25de, 0x10de22fa,
+    0xffffffff, 0xffffffff, 0x10de2a73, 0xffffffff, 0xffffffff, 0x10de28a4, 0x10de20a3, 0xffffffff,
+    0x10de1e13, 0x10de2d86, 0xffffffff, 0xffffffff, 0x10de2568, 0x10de20f4, 0xffffffff, 0xffffffff,
+    0x10de2661, 0x10de25f3, 0x10de2e52, 0xffffffff, 0x10de2593, 0xffffffff, 0x10de2043, 0xffffffff,
+    0x10de2416, 0xffffffff, 0x10de217f, 0x10de25b2, 0x10de28b7, 0xffffffff, 0x10de2efb, 0x10de2679,
+    0x10de204a, 0xffffffff, 0x10de1eb5, 0xffffffff, 0x10de2645, 0xffffffff, 0xffffffff, 0x10de2cbc,
+    0x10de242d, 0x10de2a67, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2667, 0xffffffff, 0x10de2705,
+    0x10de225a, 0x10de27cc, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de230a, 0x10de2a91, 0xffffffff,
+    0x10de2d38, 0xffffffff, 0x10de2dfe, 0x10de2eae, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b9b,
+    0x10de2ca6, 0xffffffff, 0x10de2c7e, 0x10de25ff, 0x10de2884, 0x10de2f86, 0xffffffff, 0x10de2697,
+    0xffffffff, 0xffffffff, 0x10de2e48, 0xffffffff, 0x10de2d10, 0xffffffff, 0x10de2041, 0x10de2e76,
+    0x10de2ee7, 0x10de2011, 0x10de1eac, 0x10de2474, 0x10de282b, 0xffffffff, 0x10de23b4, 0xffffffff,
+    0x10de2549, 0x10de2100, 0x10de1f9e, 0xffffffff, 0xffffffff, 0x10de20ba, 0xffffffff, 0x10de2aa7,
+    0x10de2181, 0x10de1e74, 0xffffffff, 0xffffffff, 0x10de1fc5, 0x10de2548, 0x10de24e6, 0xffffffff,
+    0x10de2168, 0xffffffff, 0x10de2759, 0x10de219f, 0x10de2c75, 0x10de1fd6, 0xffffffff, 0x10de1e87,
+    0x10de2dc4, 0x10de2d92, 0x10de2ad6, 0x10de2afd, 0x10de25a1, 0x10de1fce, 0xffffffff, 0x10de29ab,
+    0x10de2feb, 0xffffffff, 0x10de2f84, 0x10de263d, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2c92,
+    0xffffffff, 0x10de2988, 0x10de20c4, 0xffffffff, 0x10de2deb, 0x10de20c8, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2435, 0xffffffff, 0xffffffff, 0x10de20de, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de1e0f, 0x10de2a15, 0x10de2890, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2def, 0xffffffff,
+    0x10de23d2, 0x10de2c2d, 0x10de2c0e, 0x10de2083, 0xffffffff, 0xffffffff, 0x10de2d40, 0x10de2504,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a6b, 0x10de1fa0, 0x10de292a, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de1efa, 0x10de2e34, 0xffffffff, 0x10de2d20, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de21eb, 0x10de1ea8, 0x10de2d43, 0x10de1eaa, 0x10de1eca, 0x10de2f43, 0x10de27d4,
+    0x10de21ae, 0x10de2b34, 0x10de249e, 0x10de2d6f, 0x10de210a, 0x10de206b, 0x10de2fae, 0x10de1e31,
+    0xffffffff, 0x10de1f17, 0x10de2301, 0xffffffff, 0x10de1e0b, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2d12, 0x10de2d01, 0xffffffff, 0x10de231c, 0x10de2e38, 0x10de28eb, 0x10de2b2a, 0xffffffff,
+    0x10de2270, 0x10de28c5, 0xffffffff, 0x10de262d, 0x10de2875, 0xffffffff, 0x10de295b, 0x10de21dd,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2be8, 0xffffffff, 0x10de2676,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2158, 0x10de2a1e, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de20fe, 0x10de2537, 0x10de2448, 0xffffffff, 0x10de2271, 0x10de29bc, 0x10de2981, 0xffffffff,
+    0x10de1e9c, 0x10de213f, 0xffffffff, 0x10de2b40, 0xffffffff, 0xffffffff, 0x10de27d3, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de27bf, 0xffffffff, 0x10de1f95, 0x10de1edb, 0x10de2c42, 0x10de231e,
+    0x10de21fe, 0x10de1ec5, 0x10de1f8a, 0x10de1faf, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e62,
+    0x10de2e21, 0x10de2118, 0x10de2302, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de29dd, 0x10de2e9c,
+    0x10de2196, 0xffffffff, 0xffffffff, 0x10de2653, 0x10de28bb, 0x10de2e2b, 0x10de1e98, 0x10de2c23,
+    0x10de2b82, 0x10de24a5, 0x10de22f2, 0x10de2507, 0x10de27fd, 0x10de1f71, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de285e, 0xffffffff, 0x10de26b7, 0x10de27ba, 0xffffffff, 0x10de201c, 0x10de224c,
+    0x10de20e6, 0xffffffff, 0x10de22c7, 0x10de2df7, 0x10de22b2, 0xffffffff, 0x10de2ab4, 0x10de1e22,
+    0xffffffff, 0x10de2ac5, 0xffffffff, 0x10de2a19, 0x10de2af1, 0x10de26f9, 0xffffffff, 0xffffffff,
+    0x10de2607, 0xffffffff, 0xffffffff, 0x10de1e6e, 0xffffffff, 0x10de2f85, 0x10de2b4e, 0x10de2fb0,
+    0xffffffff, 0xffffffff, 0x10de2869, 0x10de2b00, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2958, 0x10de23d9, 0x10de2020, 0xffffffff, 0x10de2403, 0x10de2490,
+    0x10de2251, 0x10de1ef2, 0xffffffff, 0x10de2451, 0x10de2b45, 0xffffffff, 0x10de2453, 0x10de1f10,
+    0xffffffff, 0x10de2e78, 0x10de25c1, 0x10de1e63, 0xffffffff, 0x10de22eb, 0x10de29d8, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2d0f, 0x10de2fbf, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a7d,
+    0x10de1f96, 0x10de203a, 0xffffffff, 0x10de2105, 0xffffffff, 0x10de29f1, 0x10de238f, 0x10de2ef1,
+    0xffffffff, 0xffffffff, 0x10de2322, 0xffffffff, 0x10de244c, 0xffffffff, 0x10de2bf7, 0x10de2bf5,
+    0xffffffff, 0x10de2844, 0x10de25b0, 0xffffffff, 0x10de2e32, 0x10de2924, 0xffffffff, 0x10de2964,
+    0x10de2ba3, 0x10de1edc, 0xffffffff, 0x10de288d, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2ca0, 0xffffffff, 0xffffffff, 0x10de228d, 0xffffffff, 0x10de1f8f, 0x10de240a, 0x10de212e,
+    0x10de2840, 0x10de25e7, 0x10de293b, 0x10de2f5f, 0x10de298d, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2f7d, 0x10de27e9, 0xffffffff, 0xffffffff, 0x10de2c8f, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2ae5, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de27ad, 0xffffffff, 0xffffffff, 0x10de1eff,
+    0x10de2060, 0xffffffff, 0xffffffff, 0x10de2adb, 0x10de2a33, 0xffffffff, 0x10de24c1, 0x10de274b,
+    0xffffffff, 0x10de1e35, 0x10de2285, 0x10de279f, 0x10de1e27, 0x10de2c81, 0xffffffff, 0x10de249a,
+    0x10de214c, 0x10de25eb, 0xffffffff, 0xffffffff, 0x10de210b, 0x10de2d7b, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2091, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de24d4, 0xffffffff, 0xffffffff,
+    0x10de2050, 0x10de26ee, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2347, 0x10de2485, 0x10de2237,
+    0x10de2d57, 0x10de2979, 0xffffffff, 0x10de271e, 0xffffffff, 0x10de2911, 0xffffffff, 0xffffffff,
+    0x10de2ddc, 0x10de2c3d, 0x10de2d61, 0x10de2ec4, 0x10de24d7, 0xffffffff, 0x10de24b5, 0x10de2571,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2f83, 0x10de1ffb, 0x10de2080, 0x10de2cc1,
+    0x10de2ff8, 0x10de2498, 0x10de29cb, 0x10de2763, 0x10de208d, 0x10de2e4f, 0x10de26cc, 0x10de2ed5,
+    0x10de2bd7, 0xffffffff, 0x10de26bf, 0x10de2fcc, 0x10de2bcc, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2500, 0x10de26ae, 0x10de24a8, 0xffffffff, 0xffffffff, 0x10de2ef9, 0xffffffff, 0x10de2c9c,
+    0x10de28f1, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de26e9, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de28a6, 0x10de21b3, 0x10de29c6, 0xffffffff, 0x10de2e9a, 0x10de2fc5, 0xffffffff, 0x10de229e,
+    0x10de2c4c, 0x10de22cc, 0x10de29bf, 0xffffffff, 0x10de275a, 0x10de2e2e, 0x10de2d67, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de23c9, 0x10de2d47, 0xffffffff, 0x10de280f, 0xffffffff, 0x10de21b4,
+    0x10de2ba2, 0x10de2304, 0xffffffff, 0x10de284f, 0x10de20ad, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de24c5, 0xffffffff, 0x10de29ef, 0xffffffff, 0xffffffff, 0x10de22c8, 0xffffffff, 0x10de230e,
+    0x10de2362, 0xffffffff, 0x10de2404, 0x10de2b04, 0x10de2542, 0x10de2dd3, 0x10de204c, 0x10de2524,
+    0x10de24bd, 0x10de2fe2, 0x10de23ec, 0x10de1e52, 0xffffffff, 0x10de26a2, 0x10de2643, 0x10de2ce0,
+    0x10de2049, 0x10de2dc9, 0x10de266e, 0xffffffff, 0x10de2af9, 0xffffffff, 0x10de2739, 0x10de2b7a,
+    0xffffffff, 0x10de2fb2, 0x10de2146, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d3f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2519, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2180, 0x10de2922, 0xffffffff, 0x10de2f01, 0x10de2b2d, 0x10de21ef, 0xffffffff,
+    0x10de2dbb, 0xffffffff, 0xffffffff, 0x10de213d, 0xffffffff, 0x10de2579, 0xffffffff, 0xffffffff,
+    0x10de2b11, 0x10de2259, 0xffffffff, 0x10de2e36, 0x10de1e26, 0x10de233c, 0x10de2cad, 0x10de2332,
+    0xffffffff, 0xffffffff, 0x10de2bba, 0x10de23ff, 0xffffffff, 0xffffffff, 0x10de2079, 0x10de2f5c,
+    0x10de2204, 0xffffffff, 0x10de2723, 0xffffffff, 0xffffffff, 0x10de2c71, 0xffffffff, 0xffffffff,
+    0x10de2ea1, 0x10de232b, 0x10de218c, 0xffffffff, 0x10de27b1, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de279c, 0xffffffff, 0x10de1f49, 0x10de280e, 0xffffffff,
+    0x10de2de7, 0x10de2e51, 0x10de2ff2, 0x10de25d2, 0x10de2cff, 0x10de20e9, 0xffffffff, 0x10de21ea,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de29e4, 0x10de26ba, 0x10de289c, 0x10de2e66, 0x10de2eb7,
+    0x10de20af, 0xffffffff, 0x10de2c80, 0x10de2fc9, 0x10de275e, 0xffffffff, 0x10de22a6, 0x10de26ab,
+    0x10de2ff9, 0xffffffff, 0xffffffff, 0x10de25f5, 0xffffffff, 0xffffffff, 0x10de23e8, 0xffffffff,
+    0xffffffff, 0x10de2dd6, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e46, 0x10de1e18,
+    0x10de1fab, 0xffffffff, 0x10de1ecc, 0x10de22c6, 0xffffffff, 0xffffffff, 0x10de2a66, 0x10de2c8d,
+    0x10de228b, 0xffffffff, 0x10de297c, 0x10de2f17, 0x10de283a, 0x10de1e09, 0x10de2b72, 0x10de27a8,
+    0xffffffff, 0xffffffff, 0x10de2606, 0xffffffff, 0x10de2b15, 0x10de2973, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de28db, 0x10de228f, 0xffffffff, 0x10de2f0e, 0x10de226a, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2144, 0xffffffff, 0x10de2338, 0xffffffff, 0x10de1f6c, 0x10de2677,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ff6, 0x10de26ca,
+    0xffffffff, 0xffffffff, 0x10de246d, 0x10de22f0, 0x10de276a, 0x10de2c1f, 0x10de2e31, 0x10de2fdd,
+    0xffffffff, 0x10de285f, 0x10de2484, 0x10de2931, 0x10de2cc2, 0x10de28cd, 0xffffffff, 0x10de214a,
+    0x10de2286, 0x10de25ea, 0xffffffff, 0x10de21b7, 0x10de1fcd, 0x10de275c, 0xffffffff, 0x10de1f21,
+    0x10de2dab, 0xffffffff, 0x10de29c3, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de29fc,
+    0xffffffff, 0x10de2918, 0xffffffff, 0xffffffff, 0x10de2954, 0xffffffff, 0xffffffff, 0x10de215e,
+    0xffffffff, 0x10de20d6, 0x10de2a2a, 0x10de25a7, 0x10de2aa9, 0xffffffff, 0x10de26f3, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de26b4, 0xffffffff, 0xffffffff, 0x10de2af8, 0x10de2632, 0xffffffff,
+    0xffffffff, 0x10de23d8, 0x10de1f06, 0xffffffff, 0x10de2ea9, 0x10de210e, 0x10de22a0, 0x10de2fde,
+    0xffffffff, 0x10de29de, 0xffffffff, 0x10de1fc4, 0xffffffff, 0x10de2f30, 0xffffffff, 0xffffffff,
+    0x10de2771, 0x10de1e64, 0x10de2b3a, 0x10de280b, 0xffffffff, 0x10de1f00, 0xffffffff, 0x10de2326,
+    0x10de2db0, 0x10de2ea3, 0x10de1f16, 0x10de2033, 0x10de2b7d, 0xffffffff, 0xffffffff, 0x10de277e,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a85, 0x10de2499, 0x10de1fcb, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de1fa4, 0xffffffff, 0xffffffff, 0x10de2426, 0xffffffff, 0x10de21c6,
+    0x10de2395, 0x10de2543, 0x10de2f64, 0x10de1fca, 0x10de281b, 0x10de2685, 0x10de2804, 0xffffffff,
+    0x10de29b9, 0x10de2509, 0xffffffff, 0xffffffff, 0x10de283e, 0xffffffff, 0x10de28b8, 0xffffffff,
+    0x10de2dff, 0x10de2226, 0x10de2db6, 0x10de276c, 0x10de26c5, 0x10de1fea, 0x10de215c, 0xffffffff,
+    0x10de2c04, 0xffffffff, 0x10de23e3, 0xffffffff, 0x10de2423, 0xffffffff, 0x10de2470, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2189, 0x10de1f0e, 0xffffffff, 0x10de217d, 0x10de25ca, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de1f12, 0x10de2d17, 0x10de2fef, 0xffffffff, 0xffffffff, 0x10de2c76,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2108, 0x10de230d, 0xffffffff, 0xffffffff, 0x10de22b9,
+    0x10de255a, 0x10de2edf, 0x10de235f, 0x10de2f8f, 0x10de2644, 0x10de2d3e, 0xffffffff, 0x10de2e30,
+    0x10de274d, 0x10de2c64, 0xffffffff, 0x10de2e65, 0x10de26bb, 0x10de22fd, 0x10de2ffc, 0x10de2f06,
+    0xffffffff, 0x10de2059, 0x10de2c77, 0x10de2e0e, 0xffffffff, 0x10de24a6, 0xffffffff, 0x10de2c1e,
+    0x10de2f8c, 0xffffffff, 0x10de20da, 0xffffffff, 0x10de253c, 0x10de2d3b, 0x10de28b1, 0xffffffff,
+    0xffffffff, 0x10de23e4, 0x10de28ac, 0x10de1f81, 0x10de1f68, 0x10de208a, 0xffffffff, 0x10de23a5,
+    0xffffffff, 0xffffffff, 0x10de2ba5, 0x10de2820, 0x10de20db, 0xffffffff, 0xffffffff, 0x10de288e,
+    0xffffffff, 0xffffffff, 0x10de2373, 0x10de1fa7, 0x10de2e5e, 0x10de2ed9, 0x10de237d, 0xffffffff,
+    0x10de2a3a, 0xffffffff, 0x10de22aa, 0x10de29f9, 0x10de1fff, 0xffffffff, 0xffffffff, 0x10de29a9,
+    0xffffffff, 0x10de2a30, 0xffffffff, 0x10de2c26, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f27,
+    0x10de2d28, 0x10de2b6c, 0xffffffff, 0x10de21f6, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de247b, 0x10de29a3, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2e0d, 0x10de2db4,
+    0x10de2f90, 0xffffffff, 0x10de2699, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de279b,
+    0x10de2c41, 0xffffffff, 0x10de2382, 0xffffffff, 0x10de1e7b, 0x10de218d, 0x10de2b1c, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de28e9, 0x10de2241, 0x10de1ff4, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2f9d, 0x10de1f88, 0x10de28fa, 0xffffffff, 0x10de2832,
+    0x10de2e64, 0xffffffff, 0x10de256d, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2d7c, 0x10de2aa2, 0x10de271f, 0xffffffff, 0xffffffff, 0x10de2e40,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de26f1, 0x10de23f8, 0x10de1eed, 0x10de2156,
+    0x10de24a3, 0x10de2d06, 0xffffffff, 0x10de1fec, 0xffffffff, 0x10de206d, 0x10de1ea1, 0x10de2eff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de29e0, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de223f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de206e, 0x10de2716, 0x10de2218, 0x10de2471, 0xffffffff,
+    0x10de28f0, 0xffffffff, 0xffffffff, 0x10de2623, 0xffffffff, 0x10de2758, 0x10de248e, 0x10de28ce,
+    0x10de27e8, 0x10de2e86, 0x10de2f2c, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2022, 0x10de2741, 0x10de281e, 0xffffffff, 0xffffffff, 0x10de1fb6, 0x10de2240, 0xffffffff,
+    0x10de27dd, 0x10de1ff5, 0x10de2991, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2482, 0xffffffff,
+    0x10de2781, 0xffffffff, 0x10de1fc0, 0x10de2dc5, 0x10de2340, 0x10de2604, 0x10de2e19, 0x10de29ae,
+    0x10de1e7e, 0x10de2ad8, 0x10de257c, 0xffffffff, 0x10de1ed2, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e1e, 0x10de2fc0, 0xffffffff, 0xffffffff, 0x10de275f,
+    0x10de2974, 0x10de2e5a, 0xffffffff, 0x10de287e, 0x10de2b76, 0xffffffff, 0xffffffff, 0x10de2ed0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f5e, 0xffffffff, 0x10de2225, 0xffffffff,
+    0xffffffff, 0x10de2d21, 0xffffffff, 0x10de1f13, 0x10de20f8, 0xffffffff, 0xffffffff, 0x10de210c,
+    0xffffffff, 0x10de2619, 0x10de1eec, 0xffffffff, 0x10de2993, 0x10de2a9a, 0xffffffff, 0x10de2f6c,
+    0xffffffff, 0x10de278f, 0x10de262a, 0x10de2859, 0x10de2d8a, 0xffffffff, 0x10de2514, 0x10de2706,
+    0x10de1f0b, 0xffffffff, 0xffffffff, 0x10de2512, 0x10de271b, 0x10de2ee6, 0x10de29c9, 0x10de25dd,
+    0xffffffff, 0xffffffff, 0x10de27f3, 0x10de1f6b, 0xffffffff, 0xffffffff, 0x10de254e, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2d9a, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d2f, 0x10de21db,
+    0xffffffff, 0xffffffff, 0x10de25e4, 0x10de267f, 0xffffffff, 0xffffffff, 0x10de22a7, 0x10de1fc9,
+    0xffffffff, 0xffffffff, 0x10de1fd0, 0x10de211c, 0xffffffff, 0x10de2287, 0xffffffff, 0x10de2eb3,
+    0x10de25f2, 0x10de2085, 0x10de2877, 0x10de1fd2, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2560,
+    0x10de1ff2, 0xffffffff, 0x10de2384, 0xffffffff, 0xffffffff, 0x10de27be, 0x10de2942, 0xffffffff,
+    0x10de2131, 0x10de23ae, 0x10de2c0f, 0x10de24bc, 0x10de2489, 0x10de2e13, 0xffffffff, 0xffffffff,
+    0x10de2010, 0xffffffff, 0xffffffff, 0x10de26da, 0x10de2389, 0xffffffff, 0xffffffff, 0x10de2acb,
+    0x10de2b07, 0x10de1fe3, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de26d5, 0xffffffff, 0x10de25cd,
+    0x10de1f64, 0x10de2107, 0x10de2a52, 0x10de2ded, 0xffffffff, 0x10de2bb1, 0xffffffff, 0x10de2b22,
+    0x10de20b7, 0x10de20ed, 0x10de2368, 0x10de2f76, 0xffffffff, 0xffffffff, 0x10de2ac1, 0x10de26e0,
+    0xffffffff, 0x10de29d6, 0x10de2acf, 0x10de269e, 0xffffffff, 0x10de2cb3, 0x10de292d, 0x10de22f5,
+    0xffffffff, 0x10de2e15, 0xffffffff, 0x10de2d49, 0x10de2655, 0xffffffff, 0x10de2953, 0x10de2e62,
+    0x10de298e, 0xffffffff, 0xffffffff, 0x10de2a89, 0x10de267c, 0x10de2254, 0xffffffff, 0x10de2f3f,
+    0x10de2e68, 0x10de25a2, 0xffffffff, 0x10de25c3, 0x10de268b, 0x10de2b23, 0x10de2736, 0x10de1f94,
+    0xffffffff, 0x10de20c6, 0xffffffff, 0xffffffff, 0x10de25c8, 0xffffffff, 0x10de2c95, 0x10de2492,
+    0x10de2daf, 0x10de20a8, 0xffffffff, 0x10de21cb, 0xffffffff, 0xffffffff, 0x10de2bb2, 0xffffffff,
+    0xffffffff, 0x10de2397, 0x10de2c25, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b24, 0x10de1fd3,
+    0x10de2026, 0xffffffff, 0x10de2983, 0xffffffff, 0xffffffff, 0x10de293e, 0xffffffff, 0x10de1e1f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2478, 0x10de1ea9, 0xffffffff, 0xffffffff,
+    0x10de23e7, 0xffffffff, 0x10de2ead, 0x10de2424, 0x10de203f, 0xffffffff, 0xffffffff, 0x10de23b8,
+    0xffffffff, 0x10de1fe8, 0x10de2099, 0xffffffff, 0x10de26c9, 0x10de1eb3, 0x10de2417, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de215f, 0xffffffff, 0x10de2605, 0x10de1e2e, 0xffffffff,
+    0x10de2f54, 0x10de2a98, 0x10de1fe7, 0xffffffff, 0x10de2e6f, 0x10de2375, 0xffffffff, 0x10de2ab3,
+    0x10de212d, 0xffffffff, 0xffffffff, 0x10de22d2, 0x10de2ad2, 0x10de21b2, 0x10de1e23, 0xffffffff,
+    0xffffffff, 0x10de2203, 0x10de24b6, 0x10de2e3e, 0xffffffff, 0x10de2da8, 0x10de265a, 0x10de2af2,
+    0x10de1eb9, 0xffffffff, 0x10de1ed0, 0xffffffff, 0xffffffff, 0x10de28ca, 0xffffffff, 0x10de2115,
+    0x10de21aa, 0xffffffff, 0xffffffff, 0x10de2b8e, 0x10de26c6, 0x10de243d, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2dd0, 0x10de23c7, 0xffffffff, 0xffffffff, 0x10de283c, 0x10de299a,
+    0x10de1fe4, 0x10de2e41, 0x10de2460, 0x10de1f34, 0x10de2ecc, 0x10de2d03, 0x10de2379, 0xffffffff,
+    0xffffffff, 0x10de2e23, 0x10de2529, 0xffffffff, 0x10de22ea, 0xffffffff, 0xffffffff, 0x10de28cc,
+    0xffffffff, 0x10de2db8, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de23b6,
+    0xffffffff, 0x10de1ed7, 0x10de2904, 0x10de1eb8, 0x10de1f83, 0x10de2510, 0x10de2d58, 0x10de2ca7,
+    0xffffffff, 0x10de2a6a, 0x10de2a3b, 0x10de2b44, 0x10de2cfc, 0x10de2f2d, 0x10de2599, 0x10de2742,
+    0xffffffff, 0x10de1e77, 0xffffffff, 0x10de2a8d, 0x10de2a17, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2e0a, 0xffffffff, 0x10de2e85, 0x10de209e, 0x10de22b3, 0x10de20b4, 0xffffffff, 0x10de1fa5,
+    0x10de2317, 0xffffffff, 0x10de2358, 0x10de2e8d, 0xffffffff, 0xffffffff, 0x10de2573, 0x10de273a,
+    0xffffffff, 0x10de1f92, 0xffffffff, 0x10de26ed, 0x10de2447, 0x10de2827, 0xffffffff, 0xffffffff,
+    0x10de23de, 0xffffffff, 0x10de1f61, 0x10de2743, 0x10de2939, 0xffffffff, 0x10de2a08, 0xffffffff,
+    0x10de2783, 0xffffffff, 0x10de28bd, 0xffffffff, 0x10de2f47, 0x10de2f45, 0xffffffff, 0x10de21af,
+    0x10de2276, 0xffffffff, 0x10de2d94, 0xffffffff, 0xffffffff, 0x10de24a2, 0xffffffff, 0x10de2686,
+    0x10de22be, 0x10de2238, 0xffffffff, 0x10de2f53, 0xffffffff, 0x10de2074, 0x10de2eea, 0xffffffff,
+    0x10de2f42, 0x10de223b, 0x10de24e9, 0x10de201b, 0x10de2e25, 0x10de2ffb, 0x10de2f18, 0x10de2b12,
+    0x10de23f1, 0xffffffff, 0x10de2530, 0xffffffff, 0xffffffff, 0x10de2e77, 0xffffffff, 0xffffffff,
+    0x10de2565, 0xffffffff, 0x10de2907, 0xffffffff, 0x10de2e67, 0x10de1e28, 0xffffffff, 0xffffffff,
+    0x10de2577, 0x10de2096, 0xffffffff, 0x10de243a, 0x10de2325, 0xffffffff, 0x10de207c, 0x10de2f04,
+    0xffffffff, 0x10de2318, 0xffffffff, 0x10de2ae2, 0x10de2406, 0x10de2d85, 0x10de2117, 0xffffffff,
+    0x10de2b6f, 0x10de2242, 0x10de1f22, 0x10de23ea, 0xffffffff, 0x10de2ef0, 0x10de27ea, 0xffffffff,
+    0xffffffff, 0x10de2ea0, 0x10de2d0d, 0x10de2428, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2b93, 0xffffffff, 0x10de2802, 0x10de27c6, 0x10de1f42, 0x10de28d8,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de29f8, 0x10de2040, 0xffffffff, 0xffffffff, 0x10de2597,
+    0xffffffff, 0x10de1e00, 0x10de29ca, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de277a, 0x10de2e8e,
+    0xffffffff, 0x10de2f4f, 0xffffffff, 0x10de261d, 0x10de2600, 0x10de28b4, 0xffffffff, 0x10de2e8b,
+    0xffffffff, 0xffffffff, 0x10de2615, 0x10de2fb4, 0xffffffff, 0x10de1ee5, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2e9d, 0x10de28d4, 0xffffffff, 0x10de2ebc, 0x10de1f5c, 0x10de28b9,
+    0xffffffff, 0x10de2a05, 0x10de1fb4, 0x10de2bbe, 0xffffffff, 0xffffffff, 0x10de2961, 0x10de28fd,
+    0xffffffff, 0xffffffff, 0x10de20c0, 0x10de21ca, 0xffffffff, 0x10de203e, 0xffffffff, 0xffffffff,
+    0x10de22cd, 0x10de253e, 0x10de20d4, 0xffffffff, 0x10de2c02, 0x10de2a81, 0xffffffff, 0xffffffff,
+    0x10de241a, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de282d, 0x10de2681, 0x10de2b28, 0x10de1e05,
+    0x10de1ebc, 0xffffffff, 0xffffffff, 0x10de1f28, 0x10de24de, 0x10de2626, 0xffffffff, 0x10de2483,
+    0xffffffff, 0x10de20c7, 0xffffffff, 0xffffffff, 0x10de2950, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de1f2c, 0x10de23df, 0x10de2ebd, 0xffffffff, 0x10de2abc, 0xffffffff, 0x10de2a7b,
+    0x10de2a1a, 0x10de2a58, 0x10de1e44, 0xffffffff, 0xffffffff, 0x10de2d78, 0x10de2611, 0x10de27b4,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e4e, 0xffffffff,
+    0x10de2298, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de212f, 0x10de291c, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2937, 0x10de25af, 0x10de282c, 0x10de27cf, 0xffffffff, 0x10de26e3,
+    0x10de2d4c, 0xffffffff, 0xffffffff, 0x10de26e5, 0xffffffff, 0x10de1f63, 0x10de26a7, 0x10de255b,
+    0xffffffff, 0xffffffff, 0x10de290a, 0xffffffff, 0x10de235b, 0xffffffff, 0x10de2867, 0xffffffff,
+    0x10de1eae, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2f52, 0xffffffff, 0x10de21a7, 0x10de1fe0,
+    0x10de2f2e, 0xffffffff, 0x10de23d5, 0x10de283f, 0x10de2cd8, 0x10de2098, 0xffffffff, 0x10de23c2,
+    0x10de2896, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de23f9, 0xffffffff, 0x10de22cb, 0x10de1e33,
+    0xffffffff, 0x10de2ac4, 0xffffffff, 0x10de203c, 0x10de2eed, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de1f39, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de203b, 0x10de2b09,
+    0xffffffff, 0x10de2775, 0x10de26f0, 0xffffffff, 0x10de2b48, 0x10de215d, 0x10de2bcd, 0xffffffff,
+    0x10de2a16, 0x10de1f65, 0xffffffff, 0x10de273b, 0xffffffff, 0x10de2556, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2727, 0x10de2737, 0xffffffff, 0xffffffff, 0x10de2858, 0xffffffff, 0xffffffff,
+    0x10de2b0a, 0x10de1f43, 0x10de211b, 0xffffffff, 0x10de2036, 0xffffffff, 0x10de1ec3, 0xffffffff,
+    0x10de283d, 0x10de2dbd, 0xffffffff, 0x10de2641, 0x10de237c, 0xffffffff, 0x10de21d5, 0x10de2bb5,
+    0x10de2200, 0x10de25d0, 0x10de1e16, 0x10de24ac, 0x10de2d8f, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a45, 0x10de242a, 0xffffffff, 0x10de2d84,
+    0xffffffff, 0x10de28ba, 0xffffffff, 0x10de28ab, 0x10de2195, 0x10de1e24, 0xffffffff, 0x10de262e,
+    0x10de230c, 0x10de2656, 0x10de2923, 0x10de2441, 0xffffffff, 0x10de2487, 0xffffffff, 0xffffffff,
+    0x10de2f55, 0xffffffff, 0xffffffff, 0x10de2975, 0xffffffff, 0xffffffff, 0x10de2854, 0x10de2968,
+    0xffffffff, 0xffffffff, 0x10de2ecd, 0x10de21f5, 0xffffffff, 0xffffffff, 0x10de29c8, 0x10de2017,
+    0x10de206a, 0xffffffff, 0x10de2bee, 0x10de1f59, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de21f0,
+    0x10de2bd3, 0x10de26eb, 0xffffffff, 0x10de1ead, 0x10de2f4b, 0x10de2466, 0x10de2c9b, 0xffffffff,
+    0xffffffff, 0x10de27ec, 0xffffffff, 0x10de223c, 0xffffffff, 0x10de2c84, 0xffffffff, 0xffffffff,
+    0x10de2069, 0x10de2532, 0xffffffff, 0x10de2a03, 0xffffffff, 0x10de2a80, 0xffffffff, 0xffffffff,
+    0x10de2d79, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de281d, 0x10de1ef7,
+    0x10de2a21, 0xffffffff, 0x10de218a, 0xffffffff, 0xffffffff, 0x10de2652, 0x10de2067, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2112, 0xffffffff, 0x10de22ad, 0x10de2b26,
+    0xffffffff, 0x10de25a4, 0x10de2f95, 0xffffffff, 0xffffffff, 0x10de2929, 0xffffffff, 0x10de2b7f,
+    0xffffffff, 0x10de29a1, 0x10de22ec, 0xffffffff, 0x10de20f2, 0xffffffff, 0x10de2e4c, 0xffffffff,
+    0x10de1e39, 0x10de23fe, 0xffffffff, 0x10de2de1, 0xffffffff, 0xffffffff, 0x10de25fc, 0xffffffff,
+    0xffffffff, 0x10de2413, 0x10de286b, 0x10de2ff5, 0x10de23fc, 0x10de2190, 0x10de27e0, 0xffffffff,
+    0x10de209c, 0x10de297e, 0xffffffff, 0xffffffff, 0x10de2f2f, 0x10de2c36, 0xffffffff, 0xffffffff,
+    0x10de20eb, 0xffffffff, 0x10de277f, 0x10de2633, 0x10de2678, 0x10de1ff0, 0x10de2894, 0xffffffff,
+    0x10de227e, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2965, 0x10de237e, 0xffffffff, 0x10de2f37, 0xffffffff, 0x10de2900, 0x10de2b03, 0x10de2224,
+    0x10de2c86, 0x10de2715, 0xffffffff, 0x10de2efe, 0x10de23c8, 0xffffffff, 0x10de291e, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de21e3, 0x10de2bb9, 0xffffffff, 0x10de22bc, 0x10de2a09,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b1d, 0x10de2249, 0xffffffff, 0x10de2951, 0x10de20ec,
+    0x10de21e1, 0x10de2731, 0x10de20ef, 0x10de2af4, 0xffffffff, 0x10de28f7, 0x10de22fc, 0x10de274c,
+    0x10de2692, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e7c, 0x10de1e41, 0xffffffff, 0xffffffff,
+    0x10de20c2, 0x10de2e83, 0x10de2672, 0x10de2331, 0x10de2957, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de27ff, 0xffffffff, 0xffffffff, 0x10de2c24, 0x10de2419, 0x10de222d, 0x10de29ff, 0xffffffff,
+    0x10de2ca4, 0x10de2d4b, 0xffffffff, 0xffffffff, 0x10de26b0, 0xffffffff, 0x10de2cac, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de230f, 0xffffffff, 0x10de2acd, 0x10de2201, 0x10de290e, 0x10de2e7f,
+    0xffffffff, 0x10de2127, 0xffffffff, 0x10de259e, 0x10de1e51, 0xffffffff, 0x10de2265, 0xffffffff,
+    0x10de29b3, 0x10de2ced, 0xffffffff, 0xffffffff, 0x10de2f68, 0x10de246c, 0x10de205b, 0xffffffff,
+    0xffffffff, 0x10de26ec, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2926, 0xffffffff, 0xffffffff,
+    0x10de2eaa, 0x10de25e1, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de26a1, 0x10de2a8c, 0x10de2a5c,
+    0x10de1f8e, 0x10de2012, 0x10de28a8, 0x10de26b2, 0xffffffff, 0x10de2139, 0x10de2660, 0xffffffff,
+    0x10de1fb9, 0x10de2ab6, 0x10de2c05, 0x10de2d09, 0xffffffff, 0x10de24af, 0x10de2f09, 0x10de20f3,
+    0x10de27c4, 0xffffffff, 0x10de2e7b, 0x10de2d62, 0x10de247a, 0x10de2b38, 0x10de2997, 0xffffffff,
+    0x10de1f3e, 0x10de2cfd, 0x10de22df, 0xffffffff, 0x10de2598, 0x10de231b, 0xffffffff, 0x10de2a75,
+    0x10de2572, 0x10de2b29, 0x10de2264, 0x10de2ddd, 0x10de1e66, 0xffffffff, 0xffffffff, 0x10de2ecb,
+    0x10de258e, 0x10de20c3, 0x10de24dd, 0xffffffff, 0x10de23be, 0x10de2c79, 0x10de2062, 0x10de1f04,
+    0x10de2337, 0x10de2d1c, 0x10de24d6, 0xffffffff, 0xffffffff, 0x10de1fc7, 0x10de2f16, 0x10de2e94,
+    0x10de20e4, 0x10de2e7a, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de298f, 0x10de2905, 0xffffffff,
+    0x10de22a9, 0xffffffff, 0x10de2c2c, 0xffffffff, 0xffffffff, 0x10de2a1f, 0xffffffff, 0x10de2f11,
+    0x10de2141, 0xffffffff, 0x10de21f7, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de22ff, 0x10de2eb8,
+    0xffffffff, 0x10de2481, 0x10de1f44, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de20f7, 0x10de2f33,
+    0x10de2592, 0x10de23d0, 0xffffffff, 0xffffffff, 0x10de2960, 0x10de2053, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de200a, 0x10de2233, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2ba8, 0x10de2d0b, 0xffffffff, 0x10de2a14, 0x10de2145, 0x10de296f, 0x10de23b7, 0x10de1eee,
+    0x10de2be5, 0x10de257d, 0xffffffff, 0x10de2dda, 0x10de2c4d, 0x10de292f, 0xffffffff, 0x10de2e6a,
+    0xffffffff, 0xffffffff, 0x10de2d7d, 0x10de1f9d, 0xffffffff, 0x10de2db3, 0xffffffff, 0xffffffff,
+    0x10de2e57, 0xffffffff, 0x10de2ffe, 0x10de2747, 0xffffffff, 0x10de250a, 0x10de2f25, 0xffffffff,
+    0xffffffff, 0x10de2e39, 0x10de2d35, 0x10de2aa1, 0x10de2393, 0x10de2879, 0x10de2562, 0x10de247d,
+    0x10de2a7e, 0x10de1e4f, 0x10de1e8f, 0x10de2c9a, 0x10de2440, 0xffffffff, 0x10de2150, 0xffffffff,
+    0x10de29a8, 0x10de2ebb, 0x10de2578, 0xffffffff, 0xffffffff, 0x10de28a3, 0xffffffff, 0x10de2da3,
+    0x10de1f3f, 0x10de296d, 0xffffffff, 0xffffffff, 0x10de2e69, 0x10de270b, 0xffffffff, 0x10de2718,
+    0xffffffff, 0x10de1e14, 0xffffffff, 0xffffffff, 0x10de2ae8, 0x10de2ee2, 0x10de27af, 0xffffffff,
+    0x10de2cef, 0x10de2691, 0x10de1e38, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de267e, 0x10de21b6,
+    0x10de252c, 0xffffffff, 0x10de2d89, 0xffffffff, 0x10de2a0f, 0x10de26cb, 0xffffffff, 0xffffffff,
+    0x10de1e70, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de213e, 0x10de21ce, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2ebe, 0x10de20fb, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2e02, 0x10de2d50, 0x10de2fa7, 0xffffffff, 0xffffffff, 0x10de1f70, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2208, 0x10de252e, 0xffffffff, 0x10de2fdb, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2ee1, 0xffffffff, 0x10de26e8, 0xffffffff, 0x10de2952, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de1e8d, 0x10de2e87, 0x10de2f29, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2bd1, 0xffffffff, 0x10de2f7b, 0xffffffff, 0x10de28e8, 0x10de2842, 0x10de2ff3, 0x10de2ade,
+    0xffffffff, 0x10de1f4b, 0x10de2341, 0x10de23bd, 0x10de1f09, 0xffffffff, 0xffffffff, 0x10de1ea3,
+    0xffffffff, 0xffffffff, 0x10de2167, 0xffffffff, 0x10de29fa, 0xffffffff, 0x10de2586, 0x10de260a,
+    0x10de2788, 0xffffffff, 0xffffffff, 0x10de283b, 0xffffffff, 0x10de2d98, 0x10de2b83, 0x10de2dce,
+    0x10de28df, 0x10de2b97, 0x10de23eb, 0x10de24f4, 0x10de1e54, 0x10de257a, 0xffffffff, 0x10de27ca,
+    0x10de2fd6, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2800, 0x10de2608, 0x10de209d,
+    0x10de2a25, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ac9, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de29a6, 0xffffffff, 0x10de2fda, 0x10de28e0, 0x10de25f0, 0xffffffff, 0x10de1f75,
+    0xffffffff, 0x10de27e3, 0xffffffff, 0x10de26c7, 0xffffffff, 0x10de2849, 0x10de1e25, 0x10de2e84,
+    0xffffffff, 0x10de2714, 0x10de2cbf, 0x10de23cb, 0xffffffff, 0xffffffff, 0x10de2787, 0x10de23ca,
+    0x10de2089, 0x10de2269, 0xffffffff, 0x10de2c4f, 0x10de2388, 0x10de2a18, 0x10de2793, 0xffffffff,
+    0xffffffff, 0x10de2123, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2752, 0xffffffff, 0xffffffff,
+    0x10de2561, 0x10de272f, 0x10de1ed6, 0x10de2dbe, 0xffffffff, 0x10de2610, 0xffffffff, 0xffffffff,
+    0x10de234e, 0xffffffff, 0x10de2772, 0x10de244a, 0x10de2f80, 0x10de1f6e, 0x10de1f98, 0xffffffff,
+    0x10de2a76, 0xffffffff, 0x10de2af7, 0x10de1e17, 0xffffffff, 0x10de2c32, 0xffffffff, 0x10de2277,
+    0x10de247c, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2684, 0xffffffff, 0x10de1ffe, 0xffffffff,
+    0x10de25a0, 0x10de2576, 0x10de2fe6, 0x10de2d2c, 0x10de2c65, 0xffffffff, 0x10de2e47, 0xffffffff,
+    0xffffffff, 0x10de2b08, 0xffffffff, 0x10de293a, 0x10de2333, 0xffffffff, 0x10de1fde, 0x10de2646,
+    0x10de22d7, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de223a, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2860, 0x10de2824, 0x10de2ad1, 0xffffffff, 0x10de28a9, 0x10de23a0, 0x10de2cce, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de270e, 0xffffffff, 0x10de27c5, 0x10de2cdd, 0x10de2f63,
+    0x10de2707, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de25bb, 0xffffffff, 0x10de288b, 0x10de292c,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de20ac, 0x10de2a34, 0x10de22de, 0xffffffff, 0x10de240f,
+    0xffffffff, 0x10de29ee, 0x10de1e9a, 0x10de238a, 0x10de2c08, 0x10de2dfb, 0xffffffff, 0xffffffff,
+    0x10de20e2, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f91, 0x10de29f3, 0x10de2b69, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2621, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2130, 0xffffffff,
+    0x10de1f5a, 0x10de28ae, 0xffffffff, 0x10de22c5, 0x10de2590, 0x10de27d9, 0x10de26b8, 0xffffffff,
+    0x10de2d34, 0xffffffff, 0x10de299d, 0x10de2473, 0xffffffff, 0xffffffff, 0x10de2806, 0x10de2b4b,
+    0x10de291a, 0x10de2b85, 0xffffffff, 0xffffffff, 0x10de2d6b, 0xffffffff, 0xffffffff, 0x10de2637,
+    0x10de2527, 0xffffffff, 0x10de2e4b, 0xffffffff, 0x10de2f51, 0xffffffff, 0xffffffff, 0x10de2229,
+    0xffffffff, 0x10de224b, 0x10de2a54, 0x10de2b68, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d99,
+    0x10de2431, 0xffffffff, 0x10de27f1, 0xffffffff, 0x10de1e81, 0xffffffff, 0x10de1f4f, 0x10de2698,
+    0x10de1ed1, 0x10de1fb5, 0xffffffff, 0x10de1efb, 0x10de1f3a, 0xffffffff, 0x10de1ff8, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b79, 0x10de2614, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de295c, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f62, 0x10de1e5d, 0xffffffff,
+    0xffffffff, 0x10de2d39, 0x10de251d, 0x10de2bf9, 0xffffffff, 0x10de2a86, 0x10de1e6f, 0x10de2e0c,
+    0xffffffff, 0x10de22d3, 0x10de2863, 0xffffffff, 0xffffffff, 0x10de1ea7, 0xffffffff, 0x10de2cf6,
+    0x10de254f, 0x10de22f4, 0xffffffff, 0x10de29d3, 0xffffffff, 0x10de2f0c, 0x10de2a0b, 0x10de2274,
+    0xffffffff, 0xffffffff, 0x10de28e2, 0xffffffff, 0x10de2160, 0x10de2425, 0x10de2486, 0x10de2c16,
+    0xffffffff, 0xffffffff, 0x10de27b5, 0x10de271c, 0x10de284a, 0xffffffff, 0x10de2bf8, 0x10de25c5,
+    0xffffffff, 0x10de279a, 0x10de1e32, 0xffffffff, 0x10de26bd, 0x10de2f20, 0x10de2f6a, 0x10de287f,
+    0xffffffff, 0x10de2004, 0x10de2c28, 0x10de2371, 0x10de2582, 0x10de29f5, 0xffffffff, 0x10de2948,
+    0xffffffff, 0x10de285b, 0x10de2418, 0x10de2411, 0xffffffff, 0x10de2bd0, 0x10de1f2f, 0x10de231f,
+    0xffffffff, 0x10de2154, 0x10de1ff3, 0x10de244d, 0xffffffff, 0x10de299b, 0x10de272d, 0xffffffff,
+    0x10de2279, 0x10de1ee7, 0x10de1f6a, 0x10de2a5d, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2851,
+    0x10de2976, 0x10de2eb2, 0xffffffff, 0x10de2194, 0xffffffff, 0x10de2760, 0xffffffff, 0xffffffff,
+    0x10de220b, 0x10de257b, 0x10de2da4, 0x10de26dd, 0x10de1ef0, 0xffffffff, 0xffffffff, 0x10de210f,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2457, 0xffffffff, 0x10de1e68, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2eef, 0x10de2d44, 0x10de2d55, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f23,
+    0xffffffff, 0xffffffff, 0x10de1fe6, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de241c, 0x10de2b43,
+    0x10de24b3, 0x10de2744, 0xffffffff, 0x10de2bc8, 0x10de29f6, 0xffffffff, 0x10de27bd, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de1fd7, 0xffffffff, 0xffffffff, 0x10de223e, 0x10de256c, 0x10de2b60,
+    0x10de22fb, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2baa, 0x10de2231, 0x10de27fb, 0x10de1ffa,
+    0xffffffff, 0xffffffff, 0x10de2dd4, 0xffffffff, 0x10de2710, 0x10de2ad7, 0xffffffff, 0xffffffff,
+    0x10de2943, 0xffffffff, 0xffffffff, 0x10de1ef4, 0x10de2a55, 0xffffffff, 0xffffffff, 0x10de274e,
+    0x10de2295, 0x10de22e6, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f7a, 0x10de2263,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2969, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2639, 0x10de2c31, 0x10de2c51, 0x10de2468, 0x10de27a5, 0xffffffff, 0x10de23e1, 0x10de26d4,
+    0x10de2fea, 0x10de2d73, 0x10de2833, 0xffffffff, 0x10de2cd1, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de28c0, 0x10de28dc, 0xffffffff, 0xffffffff, 0x10de2351, 0xffffffff, 0x10de2745, 0x10de2f5a,
+    0x10de21d9, 0x10de2b6e, 0x10de2980, 0xffffffff, 0xffffffff, 0x10de1ec4, 0x10de28f8, 0xffffffff,
+    0xffffffff, 0x10de2f07, 0x10de2019, 0x10de24f8, 0x10de1fc6, 0xffffffff, 0x10de2292, 0x10de2c9f,
+    0x10de260d, 0x10de2c2a, 0x10de2fe9, 0x10de28c1, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2815,
+    0x10de2c50, 0x10de272b, 0x10de2003, 0xffffffff, 0x10de2946, 0x10de1e85, 0xffffffff, 0x10de1e58,
+    0x10de2d1b, 0x10de28de, 0x10de1ece, 0x10de2c6b, 0x10de22e9, 0x10de1e8c, 0x10de25be, 0x10de2b78,
+    0x10de2a20, 0xffffffff, 0x10de2e5d, 0xffffffff, 0xffffffff, 0x10de2cca, 0x10de26df, 0x10de1ea2,
+    0x10de2eeb, 0xffffffff, 0x10de25e8, 0xffffffff, 0xffffffff, 0x10de2b92, 0x10de2bb0, 0xffffffff,
+    0xffffffff, 0x10de2e95, 0x10de207d, 0xffffffff, 0xffffffff, 0x10de2eac, 0x10de265b, 0xffffffff,
+    0x10de1e3a, 0xffffffff, 0x10de2c43, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2803,
+    0xffffffff, 0xffffffff, 0x10de2f62, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ef4, 0x10de2391,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de21e8, 0xffffffff, 0x10de1e0d, 0x10de201d, 0x10de2cbd,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ff1, 0xffffffff, 0x10de2a27, 0x10de27ae,
+    0x10de2648, 0x10de2da5, 0x10de24ed, 0xffffffff, 0xffffffff, 0x10de2ebf, 0x10de252d, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b5f, 0x10de2834, 0x10de273f, 0x10de2ac3,
+    0xffffffff, 0x10de29ed, 0x10de20be, 0xffffffff, 0x10de2b4f, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de1ef3, 0x10de298b, 0x10de202c, 0xffffffff, 0x10de2494, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2ef5, 0xffffffff, 0xffffffff, 0x10de2a4f, 0xffffffff, 0x10de2893, 0x10de2f65,
+    0xffffffff, 0xffffffff, 0x10de2ac6, 0x10de224e, 0xffffffff, 0x10de202f, 0xffffffff, 0x10de2467,
+    0xffffffff, 0x10de258a, 0xffffffff, 0xffffffff, 0x10de280a, 0x10de25f7, 0x10de2866, 0x10de2311,
+    0x10de2505, 0x10de21c2, 0xffffffff, 0xffffffff, 0x10de236e, 0xffffffff, 0xffffffff, 0x10de2bd9,
+    0xffffffff, 0xffffffff, 0x10de2693, 0xffffffff, 0x10de2d60, 0x10de2228, 0x10de2ed1, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2557, 0x10de21d8, 0xffffffff,
+    0x10de2205, 0xffffffff, 0x10de22ef, 0xffffffff, 0x10de2334, 0x10de2e1a, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de29e1, 0x10de27c3, 0xffffffff,
+    0x10de2dbf, 0x10de247e, 0xffffffff, 0x10de26f5, 0xffffffff, 0xffffffff, 0x10de2c74, 0x10de220f,
+    0x10de2149, 0x10de2e1f, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2bc5, 0xffffffff,
+    0x10de292b, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2b6b, 0x10de2786, 0x10de2873, 0xffffffff,
+    0xffffffff, 0x10de261e, 0x10de2ba7, 0xffffffff, 0x10de2921, 0x10de1f03, 0x10de29d0, 0x10de2dde,
+    0x10de26fb, 0x10de2f00, 0x10de2f9c, 0x10de25cb, 0x10de263a, 0x10de1eb7, 0xffffffff, 0x10de277d,
+    0xffffffff, 0xffffffff, 0x10de2780, 0x10de2bed, 0xffffffff, 0xffffffff, 0x10de2456, 0x10de2185,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2159, 0x10de2725, 0x10de2874,
+    0x10de2ae0, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2234, 0xffffffff, 0x10de267a, 0x10de2990,
+    0x10de2fb6, 0x10de1fd5, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2044,
+    0x10de2a4e, 0x10de2edb, 0x10de2f38, 0x10de2bef, 0xffffffff, 0x10de229b, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de1e73, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de27a4, 0x10de2143, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de21ee, 0x10de2fd3, 0x10de2fa5, 0x10de28ad, 0x10de205f, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de1f6d, 0x10de286f, 0xffffffff, 0x10de2df1, 0xffffffff,
+    0x10de2850, 0xffffffff, 0x10de298a, 0x10de1fdf, 0x10de2721, 0xffffffff, 0xffffffff, 0x10de2c55,
+    0x10de2d53, 0x10de2073, 0xffffffff, 0x10de2c5a, 0xffffffff, 0xffffffff, 0x10de2d45, 0xffffffff,
+    0x10de24ca, 0xffffffff, 0xffffffff, 0x10de2aef, 0x10de219b, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2853, 0xffffffff, 0x10de2e4e, 0xffffffff, 0xffffffff, 0x10de2ad9, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2400, 0x10de2bb7, 0xffffffff,
+    0xffffffff, 0x10de1ed9, 0x10de2028, 0x10de21c7, 0x10de2720, 0xffffffff, 0x10de2e93, 0x10de2f19,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1fa6, 0xffffffff, 0xffffffff,
+    0x10de220c, 0xffffffff, 0xffffffff, 0x10de27ee, 0x10de24fb, 0x10de23a2, 0xffffffff, 0xffffffff,
+    0x10de2f9e, 0x10de2065, 0xffffffff, 0x10de27ed, 0x10de25ed, 0x10de2d1a, 0x10de2c62, 0x10de2b20,
+    0x10de2e72, 0x10de2343, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d1f, 0x10de2818,
+    0x10de289f, 0x10de1f73, 0x10de1f11, 0xffffffff, 0x10de2c1d, 0x10de2129, 0x10de2664, 0xffffffff,
+    0x10de2c63, 0x10de1eda, 0x10de265d, 0xffffffff, 0x10de1ed4, 0x10de24ee, 0xffffffff, 0x10de2d77,
+    0xffffffff, 0xffffffff, 0x10de1f1e, 0x10de26cf, 0xffffffff, 0xffffffff, 0x10de2be0, 0x10de2459,
+    0xffffffff, 0xffffffff, 0x10de2e45, 0x10de2bd8, 0x10de2383, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2496, 0xffffffff, 0xffffffff, 0x10de2f3e, 0x10de243c, 0x10de2d4d, 0x10de2ce4,
+    0xffffffff, 0x10de1e69, 0x10de1f14, 0x10de2ca2, 0x10de2aea, 0x10de2a0c, 0x10de2c6d, 0xffffffff,
+    0x10de2afa, 0x10de26cd, 0x10de21f1, 0xffffffff, 0xffffffff, 0x10de20dc, 0xffffffff, 0x10de270d,
+    0xffffffff, 0xffffffff, 0x10de2da7, 0x10de2fe7, 0x10de2dec, 0xffffffff, 0x10de268a, 0x10de1e4b,
+    0xffffffff, 0xffffffff, 0x10de1f2b, 0x10de2ec2, 0x10de2adf, 0xffffffff, 0x10de25e3, 0x10de22d1,
+    0x10de28b3, 0x10de232c, 0xffffffff, 0x10de232d, 0xffffffff, 0x10de2f60, 0x10de2066, 0x10de2b57,
+    0x10de24df, 0xffffffff, 0xffffffff, 0x10de2aaf, 0x10de2f35, 0xffffffff, 0x10de1fc2, 0x10de2057,
+    0x10de2261, 0x10de28c2, 0x10de2256, 0xffffffff, 0xffffffff, 0x10de2d33, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de1fb0, 0x10de2ccf, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ccc,
+    0x10de25da, 0xffffffff, 0x10de2b0b, 0x10de2d5b, 0x10de233f, 0xffffffff, 0x10de25bc, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de26f2, 0x10de2575, 0x10de2a32, 0x10de21f4,
+    0xffffffff, 0x10de2cea, 0x10de2703, 0x10de2bfa, 0x10de2f5d, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de221e, 0xffffffff, 0x10de2e26, 0xffffffff, 0xffffffff, 0x10de2e56, 0xffffffff, 0xffffffff,
+    0x10de23af, 0x10de294f, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2766, 0x10de2056, 0x10de28dd,
+    0xffffffff, 0x10de2e5c, 0x10de2651, 0x10de21b9, 0x10de1f35, 0x10de2038, 0xffffffff, 0x10de1eea,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2463, 0x10de2fd4, 0xffffffff, 0x10de207a, 0xffffffff,
+    0x10de2ef8, 0xffffffff, 0x10de2f0d, 0x10de1e1b, 0x10de2f05, 0x10de28b5, 0x10de2805, 0x10de2fb1,
+    0xffffffff, 0xffffffff, 0x10de1eba, 0xffffffff, 0x10de22c3, 0x10de200e, 0x10de2da9, 0x10de2b90,
+    0x10de1fd8, 0x10de28a2, 0x10de2c3c, 0xffffffff, 0x10de2a5f, 0xffffffff, 0x10de23aa, 0x10de1f9b,
+    0xffffffff, 0x10de2c5b, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2e82, 0xffffffff, 0xffffffff, 0x10de2761, 0xffffffff, 0x10de2ca1, 0xffffffff,
+    0x10de2502, 0xffffffff, 0xffffffff, 0x10de2794, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2b13, 0x10de23cf, 0xffffffff, 0x10de2c6e, 0xffffffff, 0x10de2cd7, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de1eaf, 0xffffffff, 0x10de2941, 0xffffffff, 0xffffffff, 0x10de2a5b,
+    0xffffffff, 0x10de2e4d, 0xffffffff, 0xffffffff, 0x10de220d, 0xffffffff, 0x10de2ae1, 0x10de2cf7,
+    0x10de22b6, 0x10de2236, 0x10de2235, 0xffffffff, 0xffffffff, 0x10de2a8f, 0xffffffff, 0xffffffff,
+    0x10de2ace, 0xffffffff, 0xffffffff, 0x10de29bb, 0xffffffff, 0x10de2299, 0xffffffff, 0x10de1f48,
+    0xffffffff, 0x10de22b7, 0x10de20b1, 0x10de2030, 0xffffffff, 0xffffffff, 0x10de2b88, 0x10de240c,
+    0x10de2b19, 0x10de26d1, 0x10de1f33, 0x10de2ab8, 0x10de2876, 0x10de26ea, 0x10de29e9, 0xffffffff,
+    0xffffffff, 0x10de2d7a, 0xffffffff, 0x10de2928, 0x10de276f, 0x10de1f0c, 0x10de1f24, 0x10de25c4,
+    0xffffffff, 0x10de2b42, 0x10de2768, 0x10de2c06, 0xffffffff, 0x10de2dc1, 0x10de2e6b, 0xffffffff,
+    0x10de220a, 0x10de2cb4, 0x10de2917, 0xffffffff, 0xffffffff, 0x10de297d, 0x10de1f74, 0x10de2422,
+    0xffffffff, 0x10de1fa9, 0xffffffff, 0x10de2567, 0x10de2446, 0x10de24f9, 0x10de2455, 0x10de2450,
+    0x10de212b, 0x10de2d24, 0x10de2da0, 0xffffffff, 0x10de26fd, 0x10de2589, 0xffffffff, 0x10de296a,
+    0x10de22f8, 0x10de2dcb, 0xffffffff, 0xffffffff, 0x10de20df, 0x10de2dd5, 0x10de2b0d, 0x10de2b8f,
+    0x10de28e1, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de21de, 0xffffffff, 0x10de2128, 0x10de2a9d,
+    0x10de286d, 0x10de21ab, 0x10de25b7, 0x10de25ad, 0x10de2a77, 0xffffffff, 0xffffffff, 0x10de28a0,
+    0xffffffff, 0xffffffff, 0x10de2d82, 0x10de2dd7, 0xffffffff, 0x10de2d3a, 0x10de258b, 0xffffffff,
+    0x10de23d3, 0xffffffff, 0x10de2007, 0x10de295e, 0x10de26b9, 0x10de21ac, 0x10de1ed8, 0x10de2822,
+    0xffffffff, 0x10de2757, 0xffffffff, 0xffffffff, 0x10de1e2c, 0x10de2cfb, 0x10de2f6e, 0xffffffff,
+    0x10de2214, 0x10de2137, 0x10de28a1, 0xffffffff, 0xffffffff, 0x10de21da, 0x10de29ad, 0xffffffff,
+    0x10de2410, 0xffffffff, 0x10de2405, 0x10de2b1a, 0xffffffff, 0x10de2f4a, 0x10de2fc7, 0xffffffff,
+    0x10de2be9, 0x10de2a93, 0xffffffff, 0x10de207e, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2b17, 0xffffffff, 0x10de2e92, 0xffffffff, 0x10de26a8, 0xffffffff, 0x10de2320,
+    0x10de2553, 0xffffffff, 0x10de20f1, 0xffffffff, 0xffffffff, 0x10de2b0e, 0x10de2de4, 0xffffffff,
+    0x10de2666, 0x10de2fb8, 0x10de2895, 0xffffffff, 0x10de2550, 0x10de1ffc, 0xffffffff, 0x10de1e75,
+    0xffffffff, 0xffffffff, 0x10de2c40, 0xffffffff, 0xffffffff, 0x10de27a2, 0xffffffff, 0xffffffff,
+    0x10de23d6, 0xffffffff, 0x10de1f7c, 0x10de2848, 0xffffffff, 0x10de2000, 0x10de2b21, 0xffffffff,
+    0x10de252a, 0x10de2dac, 0x10de217c, 0xffffffff, 0x10de24eb, 0x10de1f5d, 0xffffffff, 0xffffffff,
+    0x10de2cd4, 0x10de2d19, 0xffffffff, 0xffffffff, 0x10de2439, 0x10de272a, 0xffffffff, 0x10de2002,
+    0x10de2d87, 0xffffffff, 0xffffffff, 0x10de1e65, 0x10de2a8b, 0x10de2bea, 0xffffffff, 0x10de2963,
+    0xffffffff, 0x10de20a1, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1ea5, 0x10de2b71,
+    0x10de21d7, 0xffffffff, 0x10de1f19, 0x10de2fd0, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de20d3,
+    0x10de233e, 0x10de2d2e, 0x10de21a1, 0xffffffff, 0x10de2ba0, 0x10de25d4, 0x10de21fc, 0xffffffff,
+    0xffffffff, 0x10de2e2d, 0x10de26c0, 0x10de2a1d, 0x10de22f3, 0x10de2b95, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de238c, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de248c, 0xffffffff,
+    0x10de2b06, 0x10de2b8c, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de265f, 0xffffffff, 0x10de2c48,
+    0x10de22dc, 0x10de23bb, 0x10de2688, 0xffffffff, 0x10de2989, 0x10de2956, 0x10de22d5, 0x10de206c,
+    0x10de2aaa, 0x10de2b0f, 0x10de2202, 0xffffffff, 0x10de2518, 0xffffffff, 0xffffffff, 0x10de2770,
+    0x10de1e9e, 0x10de289a, 0x10de2751, 0x10de2df8, 0x10de2c46, 0x10de2b9f, 0x10de2a04, 0x10de2704,
+    0xffffffff, 0x10de1ef1, 0x10de2c97, 0x10de23b2, 0xffffffff, 0x10de26c2, 0x10de28b0, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2901, 0x10de2bff, 0x10de2013, 0xffffffff, 0xffffffff, 0x10de25fa,
+    0x10de1fef, 0x10de204e, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a72, 0x10de20a5, 0xffffffff,
+    0x10de2830, 0x10de23e0, 0x10de29ce, 0x10de2f73, 0x10de2b35, 0xffffffff, 0x10de2675, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2992, 0xffffffff, 0x10de2b66, 0x10de2c12, 0x10de2bda, 0x10de2f28,
+    0xffffffff, 0x10de233d, 0x10de2a84, 0x10de1ee0, 0x10de2296, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2336, 0x10de1e07, 0x10de2fe8, 0x10de222a, 0x10de280c, 0x10de2b32, 0x10de2339,
+    0xffffffff, 0x10de2495, 0xffffffff, 0x10de2c52, 0x10de22da, 0x10de21e4, 0x10de255c, 0xffffffff,
+    0x10de29a4, 0x10de248b, 0xffffffff, 0xffffffff, 0x10de22f1, 0x10de22ac, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de1f15, 0xffffffff, 0x10de2b3d, 0x10de21ad, 0xffffffff, 0x10de2015, 0x10de2a1b,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2be1, 0x10de2070, 0x10de2282, 0x10de1fa3, 0x10de26fa,
+    0xffffffff, 0xffffffff, 0x10de2695, 0xffffffff, 0x10de21d6, 0x10de2501, 0xffffffff, 0xffffffff,
+    0x10de2cc9, 0xffffffff, 0x10de2717, 0xffffffff, 0x10de2635, 0x10de1e1a, 0xffffffff, 0x10de27eb,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de21ba, 0x10de21bf, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2cf1, 0xffffffff, 0x10de1f5b, 0xffffffff, 0x10de290d, 0x10de25f6, 0x10de209a,
+    0x10de2754, 0x10de28f9, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de241b, 0x10de1f8c,
+    0x10de2e99, 0x10de2294, 0xffffffff, 0x10de20a0, 0xffffffff, 0xffffffff, 0x10de2868, 0x10de2e16,
+    0x10de2e01, 0x10de26c3, 0x10de2625, 0x10de2178, 0xffffffff, 0xffffffff, 0x10de2a6d, 0xffffffff,
+    0xffffffff, 0x10de221b, 0x10de21f9, 0xffffffff, 0xffffffff, 0x10de2027, 0xffffffff, 0x10de1e06,
+    0x10de1f7d, 0xffffffff, 0x10de2e58, 0x10de271d, 0xffffffff, 0xffffffff, 0x10de2222, 0xffffffff,
+    0x10de263c, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ed2, 0x10de2a78, 0x10de28fb,
+    0x10de2baf, 0xffffffff, 0x10de2258, 0x10de2f02, 0xffffffff, 0x10de2ae4, 0x10de29e8, 0x10de1f26,
+    0x10de1ea4, 0xffffffff, 0xffffffff, 0x10de1efe, 0xffffffff, 0x10de2b01, 0x10de216b, 0x10de2c29,
+    0xffffffff, 0x10de2ee0, 0x10de2a2b, 0x10de1ec1, 0x10de2c90, 0x10de2bfc, 0xffffffff, 0xffffffff,
+    0x10de28c9, 0xffffffff, 0x10de250c, 0xffffffff, 0x10de220e, 0xffffffff, 0xffffffff, 0x10de274f,
+    0x10de2b52, 0xffffffff, 0x10de22ce, 0x10de2f91, 0xffffffff, 0x10de293d, 0xffffffff, 0x10de2d63,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de26e6, 0x10de2734, 0x10de2fff, 0x10de23b3, 0xffffffff,
+    0x10de2f9f, 0x10de25ab, 0xffffffff, 0x10de1ed5, 0xffffffff, 0x10de2252, 0x10de2777, 0xffffffff,
+    0x10de21fa, 0x10de21d2, 0x10de299f, 0x10de20e5, 0xffffffff, 0xffffffff, 0x10de2ed7, 0x10de2eee,
+    0xffffffff, 0xffffffff, 0x10de1f1a, 0x10de2f15, 0x10de27d8, 0x10de1e5b, 0x10de24cf, 0xffffffff,
+    0xffffffff, 0x10de2f7f, 0x10de2d4f, 0xffffffff, 0x10de277b, 0xffffffff, 0x10de2674, 0xffffffff,
+    0xffffffff, 0x10de2f39, 0x10de2d9d, 0x10de2354, 0xffffffff, 0x10de1ef9, 0x10de1e2d, 0xffffffff,
+    0xffffffff, 0x10de2825, 0xffffffff, 0x10de25ef, 0x10de21c0, 0xffffffff, 0xffffffff, 0x10de2ee4,
+    0x10de1fd9, 0xffffffff, 0xffffffff, 0x10de2eda, 0xffffffff, 0xffffffff, 0x10de2e90, 0x10de2262,
+    0x10de2086, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2048, 0x10de2b84, 0x10de23da,
+    0x10de2223, 0x10de29cc, 0x10de2bc3, 0xffffffff, 0x10de2a7f, 0xffffffff, 0xffffffff, 0x10de22ae,
+    0x10de29db, 0x10de1ebd, 0x10de240b, 0xffffffff, 0x10de21d4, 0xffffffff, 0xffffffff, 0x10de24dc,
+    0x10de2a23, 0xffffffff, 0xffffffff, 0x10de2888, 0xffffffff, 0x10de2f14, 0x10de1f3b, 0x10de1e15,
+    0xffffffff, 0xffffffff, 0x10de2da2, 0xffffffff, 0x10de208c, 0x10de225f, 0x10de2d68, 0xffffffff,
+    0xffffffff, 0x10de2b3f, 0xffffffff, 0xffffffff, 0x14e44365, 0xffffffff, 0xffffffff, 0x10de23ed,
+    0xffffffff, 0x10de2dc2, 0xffffffff, 0xffffffff, 0x10de2075, 0x10de26b6, 0x10de2147, 0x10de2a28,
+    0x10de27c8, 0x10de272c, 0x10de2316, 0x10de245a, 0x10de26db, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2349, 0x10de268e, 0xffffffff, 0x10de2938, 0x10de253d, 0x10de1eb1, 0x10de27a6, 0x10de2c73,
+    0xffffffff, 0x10de24d5, 0xffffffff, 0x10de23fa, 0x10de27e1, 0x10de2536, 0x10de29d1, 0xffffffff,
+    0x10de20fd, 0x10de2e43, 0x10de2386, 0x10de2bb8, 0xffffffff, 0x10de294b, 0x10de2d6c, 0x10de1ec2,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2cc6, 0x10de1e71, 0xffffffff, 0x10de2b5d,
+    0xffffffff, 0x10de2e06, 0x10de1e6c, 0x10de217e, 0x10de2856, 0x10de211a, 0x10de29a2, 0xffffffff,
+    0xffffffff, 0x10de2cdb, 0x10de1fee, 0xffffffff, 0x10de29f4, 0x10de21c8, 0x10de2bf4, 0xffffffff,
+    0xffffffff, 0x10de2a40, 0xffffffff, 0xffffffff, 0x10de2892, 0xffffffff, 0x10de2687, 0x10de2d42,
+    0x10de216c, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2e53, 0xffffffff, 0xffffffff, 0x10de2f13,
+    0x10de2eb5, 0x10de2de9, 0xffffffff, 0x10de23f6, 0xffffffff, 0xffffffff, 0x10de2f32, 0x10de2658,
+    0x10de22b1, 0x10de202a, 0xffffffff, 0x10de2c34, 0x10de2260, 0x10de28ec, 0x10de2a3c, 0xffffffff,
+    0xffffffff, 0x10de2cd2, 0xffffffff, 0x10de22bd, 0xffffffff, 0x10de1e89, 0x10de214e, 0xffffffff,
+    0xffffffff, 0x10de1f45, 0x10de2d04, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2cee, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2493, 0x10de1f52, 0x10de27a9, 0xffffffff, 0x10de2fe3, 0x10de2ec8,
+    0x10de22b0, 0x10de2415, 0x10de27d1, 0xffffffff, 0x10de24e2, 0x10de2fc8, 0x10de24a1, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2ae7, 0x10de207f, 0x10de2c1a, 0x10de2eca, 0xffffffff,
+    0x10de1fb7, 0x10de2aed, 0x10de2ab0, 0x10de2555, 0x10de2217, 0x10de20f0, 0x10de2ec0, 0xffffffff,
+    0xffffffff, 0x10de2fa6, 0xffffffff, 0x10de2fb5, 0x10de2c17, 0x10de2e37, 0x10de2cb5, 0x10de2dc7,
+    0xffffffff, 0x10de2511, 0x10de1f4a, 0x10de2fd8, 0x10de2bcb, 0xffffffff, 0x10de228a, 0xffffffff,
+    0xffffffff, 0x10de2c18, 0x10de2f40, 0x10de1e4c, 0xffffffff, 0xffffffff, 0x10de1e45, 0x10de2a38,
+    0x10de2755, 0x10de2c3f, 0xffffffff, 0x10de28e5, 0x10de215a, 0xffffffff, 0xffffffff, 0x10de2401,
+    0xffffffff, 0x10de262b, 0x10de1ee9, 0x10de264e, 0xffffffff, 0x10de29a5, 0x10de20ae, 0x10de2a11,
+    0xffffffff, 0xffffffff, 0x10de2616, 0x10de2ad4, 0x10de2b55, 0x10de1fa1, 0x10de2712, 0x10de241e,
+    0x10de24cb, 0x10de2a7c, 0xffffffff, 0x10de1fbc, 0xffffffff, 0xffffffff, 0x10de26ac, 0xffffffff,
+    0x10de2045, 0x10de2554, 0x10de29b1, 0xffffffff, 0x10de1fad, 0x10de2221, 0x10de2064, 0xffffffff,
+    0x10de20b3, 0xffffffff, 0xffffffff, 0x10de2372, 0xffffffff, 0x10de288f, 0xffffffff, 0x10de25b8,
+    0xffffffff, 0x10de2e3f, 0x10de2886, 0x10de2bf6, 0x10de257e, 0xffffffff, 0xffffffff, 0x10de276b,
+    0x10de2538, 0xffffffff, 0xffffffff, 0x10de242e, 0xffffffff, 0x10de2ee8, 0x10de2508, 0x10de2cde,
+    0x10de2749, 0x10de2a12, 0x10de26c8, 0xffffffff, 0x10de2774, 0x10de2d14, 0x10de2e28, 0x10de2811,
+    0x10de1e5a, 0xffffffff, 0x10de25a6, 0x10de2a22, 0x10de29b4, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de225e, 0x10de2ccb, 0x10de2dca, 0xffffffff, 0x10de290c, 0x10de2308,
+    0x10de2d9e, 0x10de1e94, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de255e, 0x10de2193, 0xffffffff,
+    0xffffffff, 0x10de27f8, 0xffffffff, 0x10de2f49, 0x10de2dfa, 0x10de2b41, 0xffffffff, 0xffffffff,
+    0x10de2970, 0x10de252b, 0x10de24d0, 0xffffffff, 0x10de205d, 0xffffffff, 0x10de247f, 0x10de1fd4,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d8c, 0xffffffff, 0xffffffff, 0x10de22a8, 0xffffffff,
+    0x10de231d, 0xffffffff, 0xffffffff, 0x10de1ecd, 0x10de2631, 0x10de2173, 0x10de208e, 0x10de26a9,
+    0x10de2cb7, 0x10de233b, 0x10de253b, 0x10de26de, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de20c5, 0xffffffff, 0x10de2c98, 0xffffffff, 0xffffffff, 0x10de2d26, 0x10de2e8a, 0xffffffff,
+    0xffffffff, 0x10de2a83, 0xffffffff, 0x10de266b, 0x10de2183, 0xffffffff, 0x10de2310, 0x10de25ac,
+    0x10de2491, 0x10de24fc, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de28d0, 0x10de285d, 0xffffffff,
+    0x10de2740, 0x10de2945, 0xffffffff, 0x10de2303, 0xffffffff, 0x10de2034, 0xffffffff, 0x10de2c39,
+    0xffffffff, 0x10de1f53, 0xffffffff, 0x10de2199, 0x10de201e, 0xffffffff, 0x10de2798, 0x10de2305,
+    0xffffffff, 0xffffffff, 0x10de256a, 0x10de221a, 0xffffffff, 0x10de202d, 0x10de1e34, 0x10de2179,
+    0x10de2e35, 0x10de2166, 0x10de2d13, 0x10de2a2c, 0xffffffff, 0x10de2729, 0x10de2220, 0x10de219d,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e3c, 0x10de1e3f, 0x10de2161, 0xffffffff, 0x10de2273,
+    0xffffffff, 0x10de2275, 0x10de2198, 0x10de2c60, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2dc3, 0xffffffff, 0x10de2829, 0xffffffff, 0x10de208b, 0x10de242c, 0x10de214b, 0x10de1f37,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2fe4, 0xffffffff, 0x10de2e5b, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d31, 0x10de250d, 0x10de20d8,
+    0x10de216a, 0x10de2738, 0x10de2381, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2915, 0xffffffff,
+    0xffffffff, 0x10de2535, 0x10de2728, 0x10de258f, 0x10de28f4, 0x10de29c2, 0xffffffff, 0x10de2587,
+    0x10de2d16, 0xffffffff, 0xffffffff, 0x10de23f2, 0x10de2ede, 0xffffffff, 0x10de2ad3, 0xffffffff,
+    0x10de26ff, 0xffffffff, 0x10de2dfc, 0xffffffff, 0xffffffff, 0x10de2246, 0x10de26d2, 0xffffffff,
+    0xffffffff, 0x10de27a0, 0x10de219c, 0x10de2a60, 0xffffffff, 0xffffffff, 0x10de267d, 0x10de1f58,
+    0xffffffff, 0x10de2fd2, 0xffffffff, 0x10de23ad, 0xffffffff, 0xffffffff, 0x10de20e7, 0xffffffff,
+    0xffffffff, 0x10de2eb4, 0x10de2b33, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de2094, 0xffffffff, 0x10de26d6, 0x10de2bdc, 0xffffffff, 0x10de25fd, 0x10de1e80, 0x10de2b6a,
+    0x10de2a24, 0x10de1fc8, 0xffffffff, 0x10de2b27, 0x10de2839, 0xffffffff, 0x10de25d3, 0x10de2a00,
+    0xffffffff, 0x10de1e10, 0xffffffff, 0x10de245f, 0xffffffff, 0x10de2f0f, 0xffffffff, 0x10de2669,
+    0x10de2d88, 0xffffffff, 0x10de2790, 0x10de2702, 0x10de2520, 0xffffffff, 0xffffffff, 0xffffffff,
+    0x10de20bc, 0xffffffff, 0x10de1fd1, 0x10de29c5, 0x10de2de3, 0x10de2a5a, 0x10de2e59, 0xffffffff,
+    0x10de2272, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e43, 0xffffffff, 0xffffffff, 0x10de2d65,
+    0x10de2328, 0x10de2812, 0xffffffff, 0xffffffff, 0x10de2432, 0x10de2516, 0x10de2fd1, 0x10de270f,
+    0x10de2248, 0xffffffff, 0xffffffff, 0x10de2906, 0x10de21c9, 0xffffffff, 0x10de287b, 0x10de2d29,
+    0x10de20fc, 0x10de232f, 0x10de2aeb, 0xffffffff, 0x10de24e4, 0xffffffff, 0x10de2726, 0xffffffff,
+    0x10de2949, 0x10de20b8, 0xffffffff, 0x10de1fbf, 0xffffffff, 0x10de2540, 0xffffffff, 0x10de298c,
+    0x10de2999, 0xffffffff, 0xffffffff, 0x10de25c2, 0x10de2caf, 0x10de266a, 0xffffffff, 0x10de2d6d,
+    0xffffffff, 0xffffffff, 0x10de2d05, 0x10de2ec3, 0x10de2fd5, 0x10de2de8, 0xffffffff, 0x10de200f,
+    0xffffffff, 0xffffffff, 0x10de2de2, 0xffffffff, 0x10de2db7, 0x10de2b3c, 0x10de2b73, 0x10de2fa3,
+    0x10de2e07, 0x10de22e8, 0xffffffff, 0x10de2ff0, 0x10de1ee3, 0x10de207b, 0xffffffff, 0xffffffff,
+    0x10de26e1, 0x10de2bf3, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de29b0, 0x10de2290, 0xffffffff,
+    0x10de1ebe, 0x10de2119, 0x10de2ecf, 0x10de2ec5, 0xffffffff, 0xffffffff, 0x10de2f03, 0xffffffff,
+    0x10de27fc, 0xffffffff, 0x10de2c6f, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2d97, 0x10de2f1b,
+    0xffffffff, 0x10de2813, 0x10de2d91, 0x10de28f5, 0x10de2d59, 0x10de2e22, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2d74, 0x10de20a7, 0x10de2d02, 0xffffffff, 0x10de2b7e, 0x10de27d5, 0x10de2e5f,
+    0x10de2982, 0x10de1ebf, 0x10de2c6a, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de26e7, 0xffffffff,
+    0x10de2443, 0x10de1e02, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de1e84, 0x10de2307,
+    0x10de2f5b, 0x10de2a56, 0xffffffff, 0x10de2bdf, 0xffffffff, 0x10de2624, 0xffffffff, 0x10de217b,
+    0x10de25df, 0xffffffff, 0x10de1e57, 0x10de22b5, 0xffffffff, 0x10de2ba1, 0x10de2ba9, 0x10de2b75,
+    0x10de2385, 0xffffffff, 0xffffffff, 0x10de2016, 0xffffffff, 0x10de2bc6, 0xffffffff, 0x10de25f4,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2f1c, 0xffffffff, 0x10de2544, 0x10de23dd,
+    0x10de2b39, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de233a, 0xffffffff, 0x10de2977, 0x10de2cba,
+    0x10de1e86, 0xffffffff, 0xffffffff, 0x10de25ee, 0x10de28c8, 0xffffffff, 0x10de2314, 0x10de264c,
+    0xffffffff, 0x10de2978, 0x10de2078, 0xffffffff, 0xffffffff, 0x10de2528, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2072, 0x10de276d, 0xffffffff, 0x10de287d, 0x10de2cd9, 0x10de29fb, 0x10de2227,
+    0x10de2fec, 0x10de2a74, 0xffffffff, 0xffffffff, 0x10de2cb9, 0x10de270c, 0xffffffff, 0x10de214f,
+    0x10de27f9, 0x10de29b7, 0x10de2f1e, 0xffffffff, 0xffffffff, 0x10de2aba, 0x10de23db, 0xffffffff,
+    0x10de2f10, 0xffffffff, 0xffffffff, 0x10de2503, 0x10de1e48, 0x10de2157, 0x10de2d72, 0x10de2807,
+    0x10de2f08, 0xffffffff, 0xffffffff, 0x10de2b67, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de25b1, 0x10de2987, 0x10de27c1, 0xffffffff, 0x10de2735,
+    0x10de2bc9, 0x10de2378, 0xffffffff, 0x10de2309, 0xffffffff, 0x10de21fb, 0x10de2d48, 0x10de281f,
+    0xffffffff, 0x10de2e63, 0xffffffff, 0x10de24f2, 0xffffffff, 0xffffffff, 0x10de2673, 0x10de25a5,
+    0x10de2a92, 0x10de2bd2, 0xffffffff, 0x10de29ec, 0xffffffff, 0x10de21c5, 0xffffffff, 0x10de1fe2,
+    0x10de200c, 0x10de23e6, 0x10de2cd6, 0xffffffff, 0x10de2cd0, 0x10de290b, 0x10de2006, 0x10de2032,
+    0x10de2722, 0x10de2e70, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de234f, 0x10de200b,
+    0xffffffff, 0xffffffff, 0x10de24f6, 0x10de243e, 0x10de1e9f, 0xffffffff, 0x10de2663, 0xffffffff,
+    0x10de2e89, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de2c6c, 0xffffffff,
+    0x10de1e2f, 0x10de2690, 0x10de24d1, 0xffffffff, 0x10de21cf, 0x10de261b, 0x10de27b9, 0xffffffff,
+    0xffffffff, 0x10de1ff6, 0xffffffff, 0x10de20a6, 0xffffffff, 0x10de2b9c, 0x10de1e55, 0xffffffff,
+    0xffffffff, 0x10de2612, 0xffffffff, 0xffffffff, 0x10de2be4, 0x10de268f, 0x10de1faa, 0xffffffff,
+    0x10de2569, 0x10de2f92, 0x10de2ab7, 0x10de29af, 0x10de2bca, 0xffffffff, 0xffffffff, 0x10de1f4e,
+    0xffffffff, 0x10de2291, 0x10de2d0a, 0xffffffff, 0xffffffff, 0x10de1ec6, 0x10de2fd7, 0xffffffff,
+    0xffffffff, 0x10de23c6, 0xffffffff, 0xffffffff, 0x10de27c0, 0xffffffff, 0xffffffff, 0x10de2897,
+    0x10de2f8e, 0xffffffff, 0x10de2630, 0x10de263e, 0xffffffff, 0x10de279e, 0x10de2585, 0x10de23b0,
+    0x10de245c, 0x10de26af, 0xffffffff, 0x10de2f72, 0x10de23d4, 0xffffffff, 0x10de2465, 0x10de2e29,
+    0x10de25c6, 0x10de2785, 0x10de2018, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de26ad,
+    0x10de2810, 0x10de2a36, 0x10de22a5, 0x10de2370, 0x10de2b4d, 0xffffffff, 0x10de2801, 0xffffffff,
+    0xffffffff, 0x10de24e5, 0x10de22e2, 0x10de2700, 0x10de1f60, 0x10de2061, 0x10de1ee2, 0x10de2930,
+    0x10de2b5b, 0x10de2243, 0x10de2882, 0x10de2be2, 0xffffffff, 0x10de29df, 0x10de2533, 0xffffffff,
+    0x10de2792, 0x10de1eeb, 0x10de25b3, 0xffffffff, 0x10de2534, 0xffffffff, 0x10de2601, 0x10de24bf,
+    0xffffffff, 0x10de2855, 0x10de2b58, 0xffffffff, 0x10de21e6, 0xffffffff, 0x10de2b80, 0xffffffff,
+    0x10de2bcf, 0x10de27b7, 0x10de2778, 0xffffffff, 0xffffffff, 0x10de20fa, 0x10de22a2, 0xffffffff,
+    0x10de2121, 0xffffffff, 0x10de1f82, 0xffffffff, 0xffffffff, 0x10de260b, 0xffffffff, 0xffffffff,
+    0x10de27a3, 0xffffffff, 0xffffffff, 0x10de21a0, 0x10de2312, 0x10de287a, 0x10de2ed8, 0x10de2c66,
+    0x10de2a51, 0x10de2110, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de23cc, 0x10de229f, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a5e, 0xffffffff, 0x10de29d4, 0x10de2ccd, 0x10de29b5,
+    0x10de2d52, 0x10de2bad, 0xffffffff, 0x10de2773, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0x10de2a70, 0xffffffff, 0x10de25d8, 0xffffffff, 0x10de2b59,
+    0x10de2afb, 0xffffffff, 0x10de22d0, 0x10de2142, 0x10de20ca, 0x10de2c4a, 0x10de2c1b, 0xffffffff,
+    0xffffffff, 0x10de24c2, 0x10de2b99, 0x10de1eef, 0xffffffff, 0x10de27c9, 0xffffffff, 0xffffffff,
+    0x10de21e5, 0xffffffff, 0x10de2b1e, 0x10de2914, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2126, 0x10de2d4a, 0x10de2288, 0xffffffff, 0xffffffff, 0x10de25e9, 0xffffffff,
+    0xffffffff, 0x10de2caa, 0x10de2b37, 0x10de25f9, 0x10de2cc4, 0x10de2d69, 0xffffffff, 0xffffffff,
+    0x10de246a, 0x10de1e49, 0x10de1f66, 0xffffffff, 0x10de2125, 0x10de2005, 0xffffffff, 0x10de23c5,
+    0x10de2fb9, 0xffffffff, 0x10de26e2, 0x10de23fd, 0x10de2f81, 0xffffffff, 0xffffffff, 0x10de2001,
+    0xffffffff, 0xffffffff, 0x10de2255, 0x10de1ebb, 0x10de2a13, 0xffffffff, 0x10de2212, 0xffffffff,
+    0x10de2f7c, 0x10de2b87, 0x10de27d2, 0x10de1e8b, 0xffffffff, 0x10de1fa2, 0xffffffff, 0xffffffff,
+    0x10de256f, 0xffffffff, 0xffffffff, 0x10de284e, 0x10de2972, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0x10de2f74, 0x10de24ff, 0xffffffff, 0x10de2172, 0xffffffff, 0xffffffff, 0x10de2835,
+    0x10de1e3b, 0x10de2a48, 0x10de26f8, 0x10de2cc7, 0x10de22ab, 0x10de2f0b, 0xffffffff, 0x10de1f18,
+    0xffffffff, 0x10de209b, 0x10de2d08, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de22f7,
+    0xffffffff, 0xffffffff, 0x10de2fc6, 0x10de2fdc, 0xffffffff, 0x10de1f02, 0xffffffff, 0x10de2f61,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x10de227c, 0xffffffff,
+    0xffffffff, 0xffffffff, 0x10de2c4b, 0x10de2750, 0x10de29e3, 0xffffffff, 0xffffffff, 0x10de2376,
+};
+
+static const unsigned int slot_first[] = {
+    0xf8, 0xeb6, 0x0, 0x493, 0x865, 0x0, 0x0, 0x1046,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7a,
+    0x167, 0x1098, 0x0, 0x0, 0x0, 0xd7b, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x271, 0x574, 0xfb2, 0x0, 0xf4e,
+    0x0, 0x0, 0x0, 0x5f, 0x999, 0x0, 0xe35, 0x0,
+    0x0, 0x0, 0x1127, 0x0, 0x1a8, 0x9f4, 0x0, 0x76,
+    0x0, 0x0, 0x0, 0xa78, 0xacf, 0x57a, 0x0, 0x0,
+    0xdbf, 0x596, 0x0, 0x0, 0x0, 0xdac, 0x0, 0x0,
+    0x1ba, 0xaee, 0x0, 0x0, 0x0, 0x1055, 0x0, 0x7fe,
+    0x3d, 0x1027, 0x10dd, 0x0, 0x0, 0x0, 0x32c, 0x0,
+    0xe94, 0x0, 0x78c, 0x0, 0xbe7, 0xff5, 0x0, 0xa70,
+    0x0, 0xef2, 0xaef, 0x629, 0xa4b, 0x715, 0x0, 0x140,
+    0x0, 0x0, 0x1122, 0x0, 0x0, 0xd63, 0xe5c, 0x4db,
+    0x0, 0x0, 0x0, 0xc2d, 0x3c3, 0x0, 0x1f7, 0xef5,
+    0x12, 0x0, 0xa38, 0x946, 0x11aa, 0xca0, 0xeb8, 0x0,
+    0xe1c, 0x0, 0x780, 0x97, 0x0, 0x5a1, 0x0, 0xc41,
+    0x0, 0x71a, 0x5d7, 0x0, 0x0, 0x334, 0xb33, 0x46d,
+    0x98e, 0x32a, 0x0, 0x0, 0x0, 0x9d7, 0x117e, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b4,
+    0x11a1, 0x0, 0xe3e, 0x0, 0x0, 0x0, 0x180, 0x7aa,
+    0x447, 0x11fd, 0x0, 0x1e9, 0x0, 0x0, 0x61, 0x4a,
+    0x557, 0x4ca, 0xe10, 0x67, 0x172, 0xa37, 0x1080, 0x0,
+    0x0, 0x607, 0x984, 0x11a8, 0x0, 0xd62, 0x0, 0x0,
+    0x11a0, 0x680, 0x3a8, 0x0, 0x8e, 0x0, 0x0, 0xfb9,
+    0x6ec, 0x0, 0x0, 0xc65, 0x0, 0x90, 0x0, 0x7a8,
+    0x0, 0xb55, 0xd77, 0x41c, 0x156, 0x0, 0x0, 0x0,
+    0x374, 0x550, 0xef4, 0xac6, 0x0, 0xbd7, 0x0, 0x0,
+    0x9f6, 0x0, 0x933, 0xc69, 0x0, 0xb02, 0x2cc, 0x0,
+    0x0, 0x0, 0x65d, 0x731, 0x115e, 0x849, 0x758, 0xc9,
+    0x0, 0x351, 0x61f, 0xd8b, 0x0, 0xae3, 0x0, 0x5ee,
+    0x79a, 0x0, 0x25a, 0x0, 0xf8d, 0x8c4, 0x0, 0x0,
+    0x0, 0xe7b, 0x3dc, 0x0, 0x0, 0x10f2, 0xac4, 0x0,
+    0xf64, 0xcdc, 0x0, 0x0, 0x99, 0x0, 0x0, 0x0,
+    0xe67, 0x0, 0x10a, 0x0, 0x0, 0x0, 0xea8, 0xc53,
+    0x0, 0x0, 0x0, 0x0, 0x95b, 0x0, 0x0, 0x9e2,
+    0x85c, 0xaaa, 0x0, 0x0, 0x0, 0xef0, 0x5ab, 0x982,
+    0x0, 0x13d, 0xfc8, 0x0, 0x0, 0xa14, 0x8b5, 0x662,
+    0x590, 0x9ce, 0x0, 0x0, 0x69b, 0x2ce, 0x0, 0x0,
+    0x0, 0x0, 0x1193, 0xc, 0x10ec, 0xf1d, 0x0, 0x119a,
+    0x569, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59e, 0x9b0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd36, 0x0, 0x88,
+    0x1049, 0x284, 0x93d, 0x0, 0x10b1, 0x0, 0x6ea, 0x0,
+    0xd96, 0x0, 0x0, 0x10c9, 0x0, 0x0, 0x0, 0x1cf,
+    0x0, 0xe03, 0x70f, 0x17b, 0x0, 0x4c4, 0x0, 0x6be,
+    0x3ed, 0x73f, 0xc82, 0x2bf, 0x59b, 0x113a, 0x7ec, 0x0,
+    0xd70, 0x0, 0xfb5, 0xe53, 0x41f, 0x9fa, 0x0, 0x0,
+    0x857, 0xa8c, 0x0, 0x0, 0x132, 0x0, 0x2d2, 0xc7,
+    0x309, 0xf5e, 0x0, 0xce9, 0x89c, 0x6c0, 0xac3, 0x0,
+    0x932, 0xaaf, 0x0, 0x255, 0xa5a, 0x0, 0x0, 0x0,
+    0xdf2, 0x0, 0x964, 0x1073, 0xa46, 0x0, 0x0, 0x52e,
+    0xca6, 0xa31, 0xbb6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5e, 0xe30, 0xc57, 0x0, 0xf2d, 0x0, 0x53, 0x6a9,
+    0x0, 0x0, 0x0, 0x0, 0xbd5, 0xa89, 0x0, 0xdd5,
+    0x1079, 0x0, 0xe45, 0x0, 0x46f, 0x0, 0x0, 0x47,
+    0x0, 0x0, 0xad7, 0x59d, 0x39a, 0xb4a, 0x608, 0x11e5,
+    0x0, 0x0, 0x88d, 0x0, 0x0, 0x953, 0x56a, 0x723,
+    0x5e2, 0x0, 0x649, 0xcad, 0x95, 0x184, 0x0, 0x20,
+    0x81f, 0x850, 0xe96, 0x3b5, 0x0, 0x11c, 0x5f4, 0x6da,
+    0x47f, 0x71b, 0xb9c, 0x0, 0x0, 0x791, 0x0, 0xb62,
+    0x8fe, 0x0, 0x948, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x301, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc6c, 0x0, 0xdbb, 0x0, 0x0, 0x0, 0x6e1,
+    0x0, 0x48c, 0x0, 0x9c7, 0x0, 0x17f, 0xe5d, 0x7ba,
+    0x0, 0x86f, 0x0, 0xea5, 0x6d9, 0x0, 0x0, 0x0,
+    0x0, 0x54b, 0x0, 0x0, 0x114c, 0xe7d, 0x3e0, 0x0,
+    0x1187, 0x697, 0xe33, 0x0, 0x11b, 0x0, 0xe15, 0x0,
+    0xe91, 0x0, 0x5ba, 0x370, 0xc37, 0xdab, 0x0, 0x297,
+    0x111f, 0x0, 0xb5a, 0x348, 0x6c6, 0x105, 0x0, 0x0,
+    0xe0d, 0x7bd, 0x1136, 0x0, 0xa17, 0x0, 0xc4a, 0x0,
+    0xe21, 0x829, 0x0, 0x0, 0xab6, 0xba0, 0x74c, 0x0,
+    0xcac, 0xd8d, 0x521, 0x0, 0x1096, 0x19c, 0x369, 0xe87,
+    0x0, 0x0, 0x8be, 0x0, 0xa8a, 0x0, 0x0, 0x5a8,
+    0x72, 0x0, 0x30d, 0x0, 0x820, 0x0, 0xb20, 0x1014,
+    0x118d, 0x21f, 0x10f6, 0x10ab, 0x0, 0x0, 0xe89, 0x0,
+    0x0, 0x116b, 0xf5a, 0x0, 0x0, 0x38f, 0x0, 0xefa,
+    0x0, 0x0, 0x535, 0xc26, 0x7d1, 0xc3e, 0x0, 0x333,
+    0x0, 0x0, 0x290, 0x0, 0x36d, 0x5fb, 0x9cd, 0x0,
+    0x6f7, 0x45b, 0x221, 0x0, 0xa62, 0x0, 0x3e, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8d3, 0x445, 0x263,
+    0x0, 0xf6, 0x996, 0xc62, 0x0, 0x0, 0x268, 0x355,
+    0x909, 0xa72, 0x87b, 0x0, 0x2a2, 0x9e7, 0x0, 0x0,
+    0x0, 0x392, 0x74d, 0xe5f, 0x0, 0x0, 0x84a, 0x406,
+    0xd2c, 0xa9b, 0x9cb, 0x725, 0x0, 0x3a2, 0x9e5, 0x0,
+    0x0, 0x0, 0x11c1, 0x6f5, 0x34d, 0x0, 0x4e3, 0x0,
+    0x0, 0x69d, 0xcc0, 0x0, 0x0, 0x1, 0xf36, 0x0,
+    0x0, 0x1075, 0x0, 0x0, 0xc94, 0x0, 0xb96, 0xcf0,
+    0x0, 0x0, 0x0, 0xe2b, 0xe82, 0x0, 0x10ba, 0x0,
+    0x10d4, 0x11, 0xeb2, 0x208, 0x60e, 0xe93, 0xe14, 0x0,
+    0xbaa, 0x0, 0x3ff, 0x0, 0xe88, 0xf00, 0x0, 0xfc0,
+    0xe1, 0x0, 0x0, 0x79f, 0x0, 0xfad, 0x0, 0x0,
+    0x0, 0xcd0, 0x0, 0xf25, 0x0, 0x0, 0x0, 0x5a4,
+    0xdd, 0x9b6, 0x1134, 0xd25, 0x468, 0x0, 0x8b3, 0xf51,
+    0x89a, 0x0, 0xaa7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1179, 0x0, 0x0, 0x0, 0xd1b, 0xa85, 0xa64,
+    0x0, 0x9d0, 0x0, 0x63b, 0x0, 0x0, 0x0, 0x50,
+    0xbeb, 0xb4, 0x0, 0x0, 0xe6, 0xfd1, 0x2ff, 0x969,
+    0x0, 0x2ab, 0x0, 0x566, 0x868, 0x129, 0x6a, 0x24f,
+    0x0, 0x1159, 0x10c7, 0x0, 0x0, 0x0, 0x0, 0x110a,
+    0x0, 0x0, 0x6ab, 0x5b9, 0x0, 0x231, 0xfcd, 0xd98,
+    0x9f2, 0x0, 0x1005, 0x672, 0x3e7, 0x89d, 0x0, 0xb35,
+    0x0, 0x0, 0x0, 0x377, 0x0, 0x11c3, 0xcf6, 0x0,
+    0x0, 0x5a7, 0x0, 0xf95, 0x0, 0x962, 0x0, 0x58b,
+    0x0, 0x0, 0x0, 0x11bc, 0x113d, 0xccc, 0x0, 0x7c0,
+    0x0, 0x0, 0x7ae, 0x598, 0x0, 0x513, 0x0, 0x247,
+    0x92, 0x0, 0x76b, 0x3a6, 0xcbf, 0x51a, 0x1156, 0x0,
+    0xae6, 0x9aa, 0x0, 0x0, 0x0, 0x652, 0xe22, 0x5a3,
+    0x0, 0x56, 0xa61, 0x0, 0x0, 0x0, 0x96e, 0x85e,
+    0xdbc, 0xc29, 0x0, 0x19a, 0x1c1, 0x0, 0x21a, 0x0,
+    0x0, 0x677, 0x0, 0x0, 0xef9, 0xe99, 0xb09, 0x0,
+    0xe68, 0x0, 0x0, 0x336, 0x11cd, 0x0, 0x0, 0x545,
+    0xeec, 0x0, 0xbd2, 0x654, 0xc7a, 0x1121, 0x0, 0x0,
+    0x0, 0x10fd, 0xf71, 0xc0, 0xf46, 0x0, 0x0, 0x10a2,
+    0x96, 0x0, 0x0, 0x759, 0x0, 0x497, 0x314, 0x1146,
+    0x0, 0x0, 0x2ea, 0x11e1, 0x0, 0xe2f, 0x0, 0x7e2,
+    0x9ab, 0xc79, 0x0, 0x10a7, 0x0, 0x79b, 0x10a6, 0x2bb,
+    0x0, 0x0, 0x0, 0x109b, 0x0, 0x0, 0x311, 0x862,
+    0xe0a, 0x0, 0x0, 0x5d1, 0x0, 0x0, 0xf9f, 0x0,
+    0x0, 0x752, 0x0, 0x178, 0x62f, 0x8ce, 0x0, 0xeda,
+    0x0, 0xa6, 0xedc, 0xec5, 0x2c1, 0x6b8, 0x3d1, 0x0,
+    0x0, 0x0, 0x16f, 0x0, 0x111a, 0x0, 0x0, 0x0,
+    0x0, 0xbda, 0x0, 0x0, 0x4c1, 0xab2, 0x0, 0x6a7,
+    0x0, 0x0, 0x0, 0xb13, 0x0, 0x9c2, 0x7e5, 0x76e,
+    0x0, 0x0, 0x0, 0xeeb, 0x0, 0x0, 0x197, 0x0,
+    0x68d, 0x9df, 0x112b, 0x74b, 0x0, 0x1060, 0x10f7, 0x0,
+    0x91, 0x0, 0x410, 0x0, 0x36, 0x10d, 0x0, 0x484,
+    0x15f, 0x0, 0x6f0, 0x47b, 0x0, 0x116d, 0x0, 0xdfd,
+    0x6b0, 0x199, 0xe9e, 0x102c, 0x0, 0x774, 0xf22, 0x4,
+    0xb95, 0x6ba, 0xc96, 0x419, 0x0, 0xc59, 0x0, 0xcee,
+    0x0, 0x0, 0xee9, 0x0, 0x7f, 0x382, 0x57f, 0x0,
+    0x4fe, 0x7f8, 0x6ad, 0x2c9, 0xec3, 0x0, 0x0, 0xff9,
+    0x688, 0x23d, 0x0, 0x0, 0x8a, 0x100b, 0x0, 0x0,
+    0x6c9, 0x0, 0x0, 0x11df, 0xe83, 0xd2b, 0x0, 0x0,
+    0x0, 0x0, 0xf27, 0x0, 0x388, 0xe, 0x0, 0x0,
+    0x679, 0x0, 0x0, 0xe7c, 0x6a0, 0x7a9, 0x6db, 0x0,
+    0xfd9, 0x0, 0x0, 0xc6e, 0x2d7, 0x795, 0x11fa, 0xdde,
+    0x883, 0x6f3, 0x4d, 0x0, 0x2e3, 0xbe2, 0x0, 0x0,
+    0x0, 0xe2e, 0x0, 0xb9e, 0x11ba, 0x5a9, 0x31f, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9bc,
+    0x0, 0x0, 0x0, 0x1033, 0x0, 0xe7a, 0x11b3, 0x71f,
+    0x599, 0x546, 0x64f, 0x55c, 0x0, 0x0, 0x101, 0xdf0,
+    0x0, 0x6ce, 0x1123, 0x55d, 0x9f0, 0x0, 0xa87, 0x0,
+    0x1dd, 0x0, 0x0, 0x0, 0x0, 0x66f, 0x5ef, 0x854,
+    0x3ec, 0x49d, 0x0, 0xa83, 0x0, 0x6d8, 0xbba, 0x3a9,
+    0x803, 0x0, 0x0, 0x0, 0x98b, 0x0, 0x49a, 0x0,
+    0xfcf, 0x5c0, 0x0, 0x0, 0xaed, 0x0, 0x1ae, 0x0,
+    0x0, 0x0, 0x5b5, 0x0, 0xa4d, 0x4ed, 0xd4a, 0x154,
+    0x100f, 0x258, 0x84f, 0x676, 0xcbe, 0x0, 0x0, 0x0,
+    0x0, 0x7d7, 0x0, 0x375, 0x1fd, 0x0, 0x0, 0x38b,
+    0x0, 0xce3, 0x0, 0x107d, 0x1042, 0x9d6, 0x0, 0x114e,
+    0xa99, 0x0, 0xf90, 0x0, 0x0, 0xf6a, 0x8d0, 0xd53,
+    0x0, 0x0, 0xb32, 0x675, 0x9b8, 0x0, 0xafe, 0xa41,
+    0x3a3, 0x0, 0x0, 0x223, 0x59a, 0x0, 0xaf2, 0x0,
+    0x1091, 0x0, 0x0, 0x287, 0x313, 0x0, 0x913, 0x0,
+    0x0, 0x0, 0xe07, 0x669, 0xea9, 0x1c, 0x0, 0x0,
+    0x911, 0x0, 0x364, 0xfee, 0x0, 0x11d, 0xa71, 0x0,
+    0xd51, 0x0, 0x116f, 0x42f, 0xb5d, 0x10ce, 0x0, 0x0,
+    0xf8e, 0x5f3, 0x661, 0x0, 0x0, 0x0, 0x11c2, 0x0,
+    0x0, 0x0, 0x0, 0x11a2, 0x0, 0x36f, 0x0, 0xbe6,
+    0x0, 0x340, 0x0, 0x1b8, 0x500, 0x0, 0x0, 0x2d9,
+    0x0, 0xa21, 0xcda, 0xbdc, 0xa6e, 0x413, 0x0, 0x0,
+    0xcff, 0xd74, 0x10f, 0x0, 0x0, 0x24d, 0x0, 0x11ee,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x387, 0xcf, 0x0,
+    0x0, 0x0, 0x0, 0x9b3, 0x82c, 0xb0, 0xb2e, 0x1175,
+    0x0, 0x33c, 0x0, 0xb16, 0xe58, 0xe70, 0x3e9, 0x0,
+    0x0, 0x0, 0xd7c, 0x7c9, 0x6b1, 0xe49, 0x0, 0x0,
+    0x11c4, 0x0, 0x0, 0x0, 0x6b2, 0x0, 0x0, 0x0,
+    0xf5c, 0x0, 0x19, 0x1194, 0x0, 0xcc7, 0x0, 0x0,
+    0x59, 0x0, 0x11af, 0x6cd, 0x0, 0xdf1, 0xcbd, 0x552,
+    0x8a6, 0x0, 0x3bd, 0xb86, 0x0, 0xdc1, 0x0, 0xaea,
+    0x0, 0x0, 0xd56, 0x3fd, 0x0, 0x0, 0x3c4, 0x0,
+    0xfd2, 0x880, 0x58d, 0x0, 0x112a, 0x224, 0x2a9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbbd, 0x0, 0xd2e, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x75f, 0x0, 0xe47, 0x0,
+    0x0, 0x783, 0x0, 0x0, 0x979, 0x0, 0x0, 0x0,
+    0x109f, 0x0, 0x2f9, 0x0, 0xc49, 0x0, 0xb7b, 0x0,
+    0x54d, 0x0, 0x33b, 0x80c, 0xbd9, 0x0, 0x1061, 0x0,
+    0x0, 0x453, 0xef8, 0x60, 0x1011, 0x0, 0x3bc, 0x0,
+    0x0, 0x409, 0x0, 0x118a, 0x989, 0x0, 0x0, 0x555,
+    0xb34, 0x0, 0xe38, 0x0, 0x0, 0x108f, 0x5bf, 0x0,
+    0xd9e, 0x544, 0xfc, 0x0, 0x10c6, 0x0, 0x0, 0x237,
+    0x6fd, 0xdce, 0x0, 0x0, 0x0, 0x894, 0x84b, 0x0,
+    0xcb2, 0x8f6, 0x1044, 0x0, 0xd49, 0x60d, 0x0, 0xe09,
+    0x108, 0x11ca, 0x86c, 0x0, 0x746, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x150, 0xd86, 0x0, 0x0, 0x0, 0x0,
+    0x1cc, 0x4d9, 0x4c9, 0x0, 0x8fc, 0x106e, 0xc0d, 0x0,
+    0x0, 0x2dd, 0x0, 0x2f6, 0x0, 0x0, 0xbcd, 0x0,
+    0x0, 0x0, 0x0, 0x4d6, 0x0, 0x0, 0x2d1, 0x0,
+    0xf83, 0xb27, 0x0, 0x25c, 0x529, 0x0, 0x0, 0xb40,
+    0x0, 0xee8, 0xf96, 0x0, 0xebe, 0x246, 0x80e, 0x0,
+    0x0, 0x251, 0x0, 0x0, 0xf41, 0xc1c, 0xf75, 0x1b2,
+    0x0, 0x114d, 0x1b3, 0x136, 0xe0c, 0xe19, 0xae7, 0x64e,
+    0x0, 0x0, 0x0, 0x74a, 0x0, 0x8d9, 0x8b1, 0xefe,
+    0xae4, 0x22b, 0x0, 0x2b6, 0x71c, 0x83, 0x0, 0x0,
+    0x324, 0x9dc, 0x0, 0x1166, 0x0, 0x1018, 0x55e, 0x6d3,
+    0x371, 0x1178, 0x0, 0xfdf, 0x0, 0xee2, 0xc6f, 0x630,
+    0x0, 0x809, 0xee3, 0xa36, 0xa47, 0x21, 0x0, 0xfc6,
+    0x0, 0xfba, 0x322, 0xc0e, 0xdc2, 0x8dc, 0xb19, 0xa81,
+    0xab, 0xca3, 0x11cb, 0xb44, 0x0, 0xedf, 0xac7, 0x0,
+    0x30, 0x0, 0x0, 0x506, 0xb1d, 0xd8a, 0x57b, 0x39e,
+    0x320, 0x0, 0x0, 0x9a1, 0x0, 0xd54, 0xc9c, 0x11bd,
+    0x0, 0x0, 0xfcc, 0x24b, 0x1144, 0xb03, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb6c, 0x0,
+    0xd65, 0xb7f, 0xf15, 0x919, 0x0, 0xd05, 0xc47, 0xc9b,
+    0x52a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x976, 0x1088,
+    0x0, 0x0, 0x0, 0x0, 0x55a, 0x0, 0x0, 0x0,
+    0x0, 0x9f5, 0x0, 0x0, 0x747, 0xd89, 0x1097, 0x209,
+    0xa6a, 0x81c, 0x0, 0x8d7, 0xb5f, 0xda6, 0x478, 0x0,
+    0xf2a, 0x0, 0x0, 0x0, 0x0, 0x997, 0x466, 0x8f7,
+    0x6c4, 0x523, 0xbc1, 0x1ed, 0x0, 0xa4c, 0x0, 0x1012,
+    0x407, 0x0, 0xc46, 0x4d8, 0x6c8, 0xad5, 0x0, 0xcfe,
+    0x0, 0x0, 0xd91, 0x0, 0x25e, 0x0, 0xe4, 0x0,
+    0x0, 0x0, 0x5b1, 0xc8, 0xd3b, 0x42e, 0x3b8, 0x0,
+    0xbc0, 0x560, 0x0, 0x0, 0x0, 0x1199, 0x0, 0x6d2,
+    0x0, 0x0, 0x0, 0xa16, 0x6b7, 0x0, 0x0, 0xeb0,
+    0xa57, 0xcd5, 0xc39, 0x54a, 0xfea, 0x0, 0x0, 0xabf,
+    0x0, 0xb6, 0x214, 0x7db, 0x79, 0xb85, 0x0, 0x0,
+    0x0, 0x0, 0xc4d, 0x7b5, 0x11e0, 0x0, 0x0, 0x14d,
+    0xff2, 0x0, 0x0, 0xfb1, 0x103b, 0x0, 0x0, 0xcb9,
+    0x5e9, 0x0, 0x0, 0x0, 0x0, 0x5ce, 0x0, 0x0,
+    0x0, 0x0, 0x352, 0x0, 0x0, 0x7dc, 0xbbe, 0xb7a,
+    0x0, 0x0, 0x11a4, 0x384, 0x0, 0xee7, 0x0, 0x0,
+    0x7bf, 0x0, 0x0, 0x0, 0x254, 0x79c, 0x10e9, 0xa23,
+    0x1bb, 0x0, 0x0, 0x93, 0x0, 0x0, 0xf66, 0x11b7,
+    0xf9b, 0x0, 0x0, 0xa9e, 0x0, 0x0, 0x1170, 0x3f3,
+    0x3b0, 0x1f1, 0xa1c, 0x4e5, 0x146, 0x0, 0x0, 0x0,
+    0x89b, 0xc42, 0x0, 0x4a1, 0x0, 0x930, 0xb98, 0x0,
+    0x0, 0xd5c, 0x41d, 0x1008, 0x0, 0x0, 0xed3, 0x0,
+    0x0, 0x0, 0xdd6, 0x11be, 0x4a4, 0x0, 0x386, 0x0,
+    0x0, 0x8d8, 0xe20, 0x49c, 0x282, 0x0, 0xe13, 0xb4c,
+    0x0, 0x10e3, 0x98a, 0x0, 0x0, 0x553, 0x0, 0xad2,
+    0x0, 0xc63, 0x0, 0xa91, 0x83b, 0x63f, 0x0, 0x0,
+    0x4f6, 0x44d, 0x0, 0x0, 0x0, 0x92e, 0x8aa, 0x1c3,
+    0x5ac, 0x69f, 0xf54, 0x0, 0xe8c, 0x0, 0x0, 0x6aa,
+    0x721, 0x0, 0x0, 0x0, 0xc95, 0x0, 0x0, 0x0,
+    0x0, 0x59c, 0x0, 0x91a, 0x0, 0x332, 0x0, 0x86d,
+    0x0, 0x722, 0x0, 0x847, 0xcf5, 0xc4b, 0x118b, 0xda4,
+    0x0, 0x295, 0x0, 0x0, 0x70e, 0x0, 0x0, 0x9d,
+    0xe8, 0x179, 0x131, 0xf1e, 0x0, 0x81a, 0x764, 0x99d,
+    0x0, 0x0, 0xf7f, 0x0, 0xc71, 0x0, 0x0, 0xb66,
+    0x0, 0x239, 0x0, 0x0, 0x0, 0xe5e, 0x302, 0xb94,
+    0x1020, 0x0, 0x1009, 0xa0, 0xd0c, 0x97c, 0x103a, 0xb84,
+    0x2aa, 0x0, 0x717, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x292, 0xc68, 0x44a, 0x2e1, 0x457, 0x439, 0x0, 0x0,
+    0x0, 0x276, 0xc10, 0x763, 0x306, 0xbf0, 0x54c, 0x0,
+    0x84d, 0x0, 0x0, 0x0, 0x0, 0x277, 0xb3f, 0x0,
+    0xb67, 0x338, 0x1050, 0x713, 0x0, 0x0, 0x0, 0x0,
+    0xb1f, 0x0, 0x0, 0x0, 0x42, 0x0, 0xf70, 0x602,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbcf, 0x766, 0x0,
+    0x430, 0x189, 0x0, 0x838, 0xacb, 0x859, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9b, 0x0, 0x0, 0xc50, 0x0,
+    0x0, 0xa1a, 0x0, 0x0, 0x5c4, 0x0, 0x515, 0xf56,
+    0x0, 0x18b, 0x0, 0x965, 0x0, 0x0, 0x0, 0x415,
+    0xd02, 0x0, 0x0, 0x82f, 0xc87, 0xe59, 0x614, 0xdd4,
+    0xe0b, 0x0, 0x0, 0x0, 0x10af, 0x0, 0x0, 0x0,
+    0x10a5, 0x2d5, 0x225, 0x4bb, 0x633, 0x0, 0x0, 0xca4,
+    0x3c1, 0xb6e, 0x5bc, 0xe00, 0xc8e, 0x0, 0x1157, 0x0,
+    0x0, 0x77f, 0x0, 0xfaa, 0x0, 0xc4c, 0x519, 0xf11,
+    0xdc0, 0xf76, 0x0, 0x0, 0x18d, 0x106d, 0x0, 0x8a4,
+    0x2f5, 0x0, 0x0, 0x5a6, 0xdb6, 0x5c, 0x0, 0xe56,
+    0x0, 0x7d9, 0xddd, 0xe7f, 0x1db, 0xc8a, 0x6ae, 0x6e7,
+    0xb1b, 0x0, 0x44f, 0x0, 0x0, 0x0, 0x0, 0x5c1,
+    0x0, 0x0, 0x0, 0x0, 0x353, 0x8ef, 0xada, 0x0,
+    0xe8a, 0x0, 0x0, 0x235, 0x0, 0x0, 0x0, 0x64b,
+    0x0, 0x450, 0x6fe, 0x0, 0x0, 0x0, 0x90a, 0x0,
+    0x627, 0x28f, 0x0, 0xa09, 0x141, 0x0, 0x0, 0x0,
+    0xaa5, 0x0, 0xb6b, 0x0, 0x0, 0x0, 0x0, 0xfbc,
+    0x10a8, 0x111d, 0x636, 0x0, 0xf0c, 0x3be, 0x4c0, 0x3,
+    0x0, 0x840, 0x0, 0x0, 0xd47, 0x9db, 0x0, 0xc0a,
+    0x0, 0x0, 0xe8b, 0xa2f, 0x0, 0x9da, 0xdbd, 0x0,
+    0xec0, 0x0, 0x530, 0xc2f, 0xf3d, 0x6a4, 0x1004, 0x7e0,
+    0x0, 0x7c7, 0x0, 0x9bb, 0x0, 0x177, 0x0, 0x98c,
+    0x11a9, 0x0, 0xf80, 0xad1, 0x0, 0x7d, 0x0, 0x6b4,
+    0xabc, 0x0, 0x0, 0xe3b, 0x11bb, 0x9e6, 0xc99, 0x0,
+    0x4f9, 0x0, 0x104a, 0x80f, 0x9f7, 0x0, 0x95d, 0x644,
+    0x0, 0xe57, 0x0, 0x0, 0x29f, 0x5dc, 0x0, 0x187,
+    0xc64, 0xc90, 0x69c, 0xc97, 0x0, 0x0, 0x4e1, 0xd10,
+    0xeab, 0x0, 0x0, 0x770, 0x62b, 0x0, 0xfe0, 0x193,
+    0x0, 0x0, 0x0, 0xe11, 0x0, 0x0, 0xb71, 0x642,
+    0x0, 0x37a, 0x101e, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe4e, 0xbfd, 0x0, 0xde7, 0x0, 0x397, 0x0, 0x2b0,
+    0x6fa, 0x1071, 0x6c7, 0x288, 0xe3a, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe8e, 0x0, 0x1e5, 0x0, 0x0, 0x38e, 0xd14, 0xebb,
+    0x0, 0xd6d, 0x0, 0xeb1, 0x8bc, 0x0, 0xdc4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xeae, 0x0,
+    0x65e, 0x834, 0x0, 0x1dc, 0x1197, 0x1ac, 0x56c, 0x2cd,
+    0x4c2, 0x46c, 0x45c, 0xa19, 0x9b2, 0xd5e, 0x0, 0x0,
+    0x0, 0x882, 0xf2b, 0x4bf, 0xc01, 0x0, 0x0, 0xd50,
+    0x0, 0x17e, 0x391, 0x0, 0x0, 0xde6, 0x1e1, 0x0,
+    0x20d, 0xd16, 0x645, 0x40, 0x0, 0x0, 0x0, 0xb0f,
+    0xe9d, 0x0, 0x304, 0x138, 0xdec, 0x0, 0xbac, 0xa98,
+    0x109e, 0x0, 0x12d, 0x2e8, 0xdeb, 0x0, 0xad9, 0x83f,
+    0x157, 0x796, 0x9a7, 0x4e0, 0x0, 0x0, 0x0, 0x0,
+    0xcb5, 0x0, 0x0, 0x794, 0x1000, 0xc44, 0x706, 0xfdb,
+    0x0, 0x94a, 0x0, 0x3d0, 0x5c3, 0x0, 0x0, 0x0,
+    0x0, 0xafc, 0x108c, 0x0, 0x46e, 0x0, 0x0, 0x11f,
+    0x0, 0xca5, 0x3df, 0x0, 0xb10, 0x9fe, 0x0, 0x5f7,
+    0x0, 0x0, 0x0, 0x78, 0x0, 0x147, 0x4cf, 0xcf3,
+    0x89f, 0x827, 0x113b, 0x0, 0x0, 0x6b, 0x9e4, 0x11ad,
+    0x664, 0xc3d, 0x22e, 0x362, 0x0, 0x0, 0x634, 0x0,
+    0xf5d, 0xf18, 0x68f, 0x0, 0xc3f, 0xfd8, 0x0, 0x0,
+    0x564, 0x19f, 0x0, 0x0, 0x316, 0x3f8, 0x4d4, 0xa43,
+    0x0, 0x0, 0x0, 0xad3, 0x0, 0x10d6, 0x0, 0x620,
+    0x0, 0x6b9, 0xa52, 0xa5c, 0x281, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf8b, 0xcbb, 0x1d, 0x0, 0x726,
+    0x6ef, 0x0, 0x896, 0x542, 0x10fc, 0x101c, 0x0, 0x1126,
+    0xf5f, 0x1eb, 0x0, 0x1188, 0x0, 0x0, 0x303, 0x0,
+    0xf32, 0x561, 0x120, 0x3cd, 0x0, 0xdc7, 0x0, 0x11f4,
+    0xcb1, 0x7e6, 0x7a3, 0x242, 0x0, 0x621, 0xcca, 0xde,
+    0x0, 0x0, 0x813, 0xc35, 0xe44, 0x4e4, 0x363, 0x741,
+    0x871, 0xe54, 0x0, 0x0, 0x0, 0xcab, 0xdb4, 0xdfb,
+    0x1141, 0x10c1, 0x66b, 0x10dc, 0x37, 0x0, 0xbe5, 0x0,
+    0x73a, 0x1131, 0x0, 0xe27, 0x0, 0x637, 0x11ed, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd30,
+    0xb4d, 0x0, 0x0, 0x0, 0x0, 0xde3, 0x0, 0x817,
+    0x0, 0x0, 0x107, 0x0, 0x567, 0x0, 0x836, 0x0,
+    0x0, 0x8a3, 0x0, 0x10b0, 0x0, 0x43d, 0xa08, 0x0,
+    0x10d3, 0x0, 0xaff, 0xabe, 0x72f, 0x0, 0x1198, 0x0,
+    0x0, 0x0, 0x481, 0x42b, 0x802, 0x70b, 0x745, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10a4,
+    0x527, 0xd64, 0xdf, 0x0, 0x9ac, 0xf23, 0x0, 0x0,
+    0x0, 0x58e, 0x0, 0x0, 0x0, 0xcc2, 0x0, 0x1167,
+    0xee5, 0xb47, 0xbfe, 0x995, 0x119b, 0x79d, 0xbf2, 0xbc7,
+    0x50b, 0xee1, 0x6bb, 0xc31, 0x818, 0x1024, 0x2cb, 0xbb2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x169,
+    0x0, 0x1003, 0xdfe, 0x1158, 0x0, 0x0, 0x66e, 0x0,
+    0x0, 0x1be, 0xd5a, 0x7d6, 0x0, 0x0, 0x2b5, 0x0,
+    0x0, 0x0, 0x0, 0x828, 0x113c, 0x4ee, 0x0, 0x991,
+    0x335, 0x0, 0x0, 0x0, 0x0, 0xcb, 0x0, 0x0,
+    0x0, 0x5f5, 0x0, 0x11f7, 0x0, 0x0, 0x559, 0xe78,
+    0x35b, 0x1196, 0xb3c, 0xddb, 0x0, 0x0, 0xff0, 0x0,
+    0x0, 0x47a, 0x2a, 0x489, 0x101b, 0x0, 0x1da, 0x480,
+    0xed5, 0xf07, 0x0, 0xf30, 0x3e2, 0x0, 0x0, 0xc2e,
+    0x0, 0x0, 0x1150, 0x42c, 0x3b1, 0x0, 0xa2e, 0x10b9,
+    0xd9a, 0x47d, 0x12e, 0x0, 0x6cc, 0x0, 0x0, 0x0,
+    0x1182, 0xbea, 0x88c, 0x4e7, 0x781, 0x0, 0x0, 0x11cf,
+    0x190, 0x0, 0x0, 0x1177, 0xf9c, 0x0, 0x56b, 0x56f,
+    0xef3, 0x0, 0x0, 0x0, 0x0, 0xaf6, 0xa9d, 0x10b6,
+    0x2b, 0x0, 0xc02, 0x788, 0x0, 0x870, 0x3bb, 0x563,
+    0x0, 0x0, 0x0, 0xd46, 0x0, 0x0, 0x31d, 0x1b1,
+    0x1171, 0x11ce, 0xbb8, 0xc06, 0x103c, 0x6e0, 0x75d, 0xff4,
+    0x1010, 0x0, 0x924, 0x592, 0x0, 0x0, 0x0, 0x889,
+    0x0, 0x0, 0x7b6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x125, 0x0, 0x0, 0x2e0, 0x0, 0x0, 0x0, 0xf6e,
+    0xfa6, 0x0, 0xba7, 0x784, 0x0, 0x0, 0xad6, 0xd9d,
+    0x0, 0x0, 0x1bd, 0x6d, 0xcec, 0x739, 0x0, 0x1124,
+    0x7cc, 0xd61, 0x0, 0x0, 0x151, 0x26f, 0x93e, 0x8c1,
+    0x0, 0x11d9, 0x0, 0x8e4, 0x0, 0xc9e, 0x0, 0xff6,
+    0xb36, 0x71e, 0xe72, 0x0, 0xff3, 0x4dd, 0xc07, 0x0,
+    0xa80, 0x185, 0x0, 0x48e, 0x0, 0x0, 0x0, 0xd18,
+    0x0, 0x0, 0x0, 0xffd, 0x6e3, 0x12a, 0x524, 0x0,
+    0x0, 0x0, 0x0, 0xd2f, 0x0, 0x0, 0xc88, 0x594,
+    0x0, 0x0, 0xdb3, 0x0, 0xe61, 0x467, 0xe37, 0x0,
+    0xcfc, 0x0, 0x186, 0x293, 0x3a4, 0x0, 0x0, 0x967,
+    0x0, 0x0, 0x59f, 0x0, 0x4b8, 0xc43, 0x0, 0x0,
+    0x68a, 0x0, 0xa65, 0xee6, 0xca8, 0x11ac, 0x0, 0x1201,
+    0x0, 0x4af, 0xd94, 0x0, 0x0, 0x612, 0x0, 0xa2a,
+    0x2bd, 0xe69, 0xf81, 0x0, 0x901, 0x0, 0x638, 0x0,
+    0x6f1, 0xb08, 0x0, 0xfae, 0x0, 0x0, 0x0, 0x0,
+    0x7b9, 0xa0d, 0x0, 0x0, 0x0, 0x0, 0xf0e, 0x2b9,
+    0xa7c, 0x82, 0x13c, 0x155, 0xcae, 0x93c, 0x411, 0x0,
+    0x0, 0xf5, 0xfa1, 0x0, 0xec8, 0x4ba, 0xf7e, 0x2cf,
+    0x11ab, 0x0, 0x0, 0x0, 0xd31, 0x0, 0x3cc, 0x0,
+    0x0, 0x31e, 0xb12, 0x0, 0x1169, 0x908, 0x444, 0x0,
+    0x548, 0x956, 0x0, 0x0, 0x2ee, 0x6e8, 0x130, 0x7cf,
+    0x0, 0x4a3, 0x1054, 0x5e5, 0xd81, 0x658, 0x0, 0x0,
+    0x0, 0x103d, 0x0, 0x8a0, 0x0, 0x0, 0x3d3, 0xb2,
+    0x0, 0x0, 0xd3e, 0x0, 0x0, 0xbc4, 0x0, 0x252,
+    0x416, 0x0, 0xcdd, 0xfe6, 0x2b2, 0x0, 0x0, 0x0,
+    0xfe5, 0x0, 0x0, 0x0, 0x0, 0xa26, 0x580, 0x0,
+    0x0, 0x10f3, 0x432, 0x10e5, 0x0, 0x0, 0x0, 0x0,
+    0x842, 0x1200, 0x0, 0x0, 0x117a, 0x0, 0x587, 0x9de,
+    0x0, 0x46b, 0x0, 0x5f0, 0x0, 0x483, 0x7ce, 0x106c,
+    0x0, 0x7d5, 0x7f1, 0x56d, 0x8f4, 0x0, 0x0, 0x45d,
+    0x102f, 0x0, 0xb25, 0x36e, 0x0, 0x1081, 0x0, 0x365,
+    0xa, 0x2a4, 0x0, 0x33a, 0x0, 0x0, 0x1f9, 0x0,
+    0x0, 0xea3, 0x0, 0x2d0, 0x3f2, 0xf37, 0x0, 0x577,
+    0xe85, 0x0, 0x1074, 0x0, 0x0, 0x0, 0x0, 0xd4c,
+    0x0, 0xfd, 0x107c, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc9f, 0xc61, 0x1112, 0x0, 0xcc8, 0x0, 0x1189, 0x0,
+    0x229, 0xb4e, 0xf3c, 0x822, 0x0, 0x5cd, 0xa28, 0x7b4,
+    0x565, 0x0, 0x0, 0x0, 0x176, 0xf93, 0x65b, 0x0,
+    0x0, 0x14c, 0x1017, 0x0, 0xa6c, 0x751, 0x3a5, 0x1148,
+    0x107e, 0x0, 0x0, 0xce6, 0xa45, 0xbf7, 0x0, 0xb59,
+    0x102a, 0x0, 0x9ef, 0x0, 0x6c3, 0x10fa, 0x8a5, 0x0,
+    0x556, 0x609, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdae, 0x29, 0xaf3, 0x61d, 0x376, 0xe01, 0x0,
+    0x98d, 0x7fb, 0x78d, 0xd1f, 0x0, 0x101d, 0x7de, 0x4fa,
+    0x0, 0x0, 0xc73, 0x0, 0x0, 0xaa4, 0x2a3, 0x0,
+    0x13, 0xf86, 0x0, 0x0, 0x768, 0x2f4, 0x0, 0x0,
+    0x861, 0x7f3, 0x1052, 0x0, 0x793, 0x0, 0x243, 0x0,
+    0x616, 0x0, 0x37f, 0x7b2, 0xab7, 0x0, 0x10fb, 0x879,
+    0x24a, 0x0, 0xb5, 0x0, 0x845, 0x0, 0x0, 0xebc,
+    0x62d, 0xc67, 0x0, 0x0, 0x0, 0x867, 0x0, 0x905,
+    0x45a, 0x9cc, 0x0, 0x0, 0x0, 0x50a, 0xc91, 0x0,
+    0xf38, 0x0, 0xffe, 0x10ae, 0x0, 0x0, 0x0, 0xd9b,
+    0xea6, 0x0, 0xe7e, 0x7ff, 0xa84, 0x1186, 0x0, 0x897,
+    0x0, 0x0, 0x1048, 0x0, 0xf10, 0x0, 0x241, 0x1076,
+    0x10e7, 0x211, 0xac, 0x674, 0xa2b, 0x0, 0x5b4, 0x0,
+    0x749, 0x300, 0x19e, 0x0, 0x0, 0x2ba, 0x0, 0xca7,
+    0x381, 0x74, 0x0, 0x0, 0x1c5, 0x748, 0x6e6, 0x0,
+    0x368, 0x0, 0x959, 0x39f, 0xe75, 0x1d6, 0x0, 0x87,
+    0xfc4, 0xf92, 0xcd6, 0xcfd, 0x7a1, 0x1ce, 0x0, 0xbab,
+    0x11eb, 0x0, 0x1184, 0x83d, 0x0, 0x0, 0x0, 0xe92,
+    0x0, 0xb88, 0x2c4, 0x0, 0xfeb, 0x2c8, 0x0, 0x0,
+    0x0, 0x635, 0x0, 0x0, 0x2de, 0x0, 0x0, 0x0,
+    0xf, 0xc15, 0xa90, 0x0, 0x0, 0x0, 0xfef, 0x0,
+    0x5d2, 0xe2d, 0xe0e, 0x283, 0x0, 0x0, 0xf40, 0x704,
+    0x0, 0x0, 0x0, 0xc6b, 0x1a0, 0xb2a, 0x0, 0x0,
+    0x0, 0xfa, 0x1034, 0x0, 0xf20, 0x0, 0x0, 0x0,
+    0x0, 0x3eb, 0xa8, 0xf43, 0xaa, 0xca, 0x1143, 0x9d4,
+    0x3ae, 0xd34, 0x69e, 0xf6f, 0x30a, 0x26b, 0x11ae, 0x31,
+    0x0, 0x117, 0x501, 0x0, 0xb, 0x0, 0x0, 0x0,
+    0xf12, 0xf01, 0x0, 0x51c, 0x1038, 0xaeb, 0xd2a, 0x0,
+    0x470, 0xac5, 0x0, 0x82d, 0xa75, 0x0, 0xb5b, 0x3dd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xde8, 0x0, 0x876,
+    0x0, 0x0, 0x0, 0x358, 0xc1e, 0x0, 0x0, 0x0,
+    0x2fe, 0x737, 0x648, 0x0, 0x471, 0xbbc, 0xb81, 0x0,
+    0x9c, 0x33f, 0x0, 0xd40, 0x0, 0x0, 0x9d3, 0x0,
+    0x0, 0x0, 0x9bf, 0x0, 0x195, 0xdb, 0xe42, 0x51e,
+    0x3fe, 0xc5, 0x18a, 0x1af, 0x0, 0x0, 0x0, 0x62,
+    0x1021, 0x318, 0x502, 0x0, 0x0, 0x0, 0xbdd, 0x109c,
+    0x396, 0x0, 0x0, 0x853, 0xabb, 0x102b, 0x98, 0xe23,
+    0xd82, 0x6a5, 0x4f2, 0x707, 0x9fd, 0x171, 0x0, 0x0,
+    0x0, 0xa5e, 0x0, 0x8b7, 0x9ba, 0x0, 0x21c, 0x44c,
+    0x2e6, 0x0, 0x4c7, 0xff7, 0x4b2, 0x0, 0xcb4, 0x22,
+    0x0, 0xcc5, 0x0, 0xc19, 0xcf1, 0x8f9, 0x0, 0x0,
+    0x807, 0x0, 0x0, 0x6e, 0x0, 0x1185, 0xd4e, 0x11b0,
+    0x0, 0x0, 0xa69, 0xd00, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb58, 0x5d9, 0x220, 0x0, 0x603, 0x690,
+    0x451, 0xf2, 0x0, 0x651, 0xd45, 0x0, 0x653, 0x110,
+    0x0, 0x1078, 0x7c1, 0x63, 0x0, 0x4eb, 0xbd8, 0x0,
+    0x0, 0x0, 0xf0f, 0x11bf, 0x0, 0x0, 0x0, 0xc7d,
+    0x196, 0x23a, 0x0, 0x305, 0x0, 0xbf1, 0x58f, 0x10f1,
+    0x0, 0x0, 0x522, 0x0, 0x64c, 0x0, 0xdf7, 0xdf5,
+    0x0, 0xa44, 0x7b0, 0x0, 0x1032, 0xb24, 0x0, 0xb64,
+    0xda3, 0xdc, 0x0, 0xa8d, 0x0, 0x0, 0x0, 0x0,
+    0xea0, 0x0, 0x0, 0x48d, 0x0, 0x18f, 0x60a, 0x32e,
+    0xa40, 0x7e7, 0xb3b, 0x115f, 0xb8d, 0x0, 0x0, 0x0,
+    0x117d, 0x9e9, 0x0, 0x0, 0xe8f, 0x0, 0x0, 0x0,
+    0xce5, 0x0, 0x0, 0x0, 0x9ad, 0x0, 0x0, 0xff,
+    0x260, 0x0, 0x0, 0xcdb, 0xc33, 0x0, 0x6c1, 0x94b,
+    0x0, 0x35, 0x485, 0x99f, 0x27, 0xe81, 0x0, 0x69a,
+    0x34c, 0x7eb, 0x0, 0x0, 0x30b, 0xf7b, 0x0, 0x0,
+    0x0, 0x291, 0x0, 0x0, 0x0, 0x6d4, 0x0, 0x0,
+    0x250, 0x8ee, 0x0, 0x0, 0x0, 0x547, 0x685, 0x437,
+    0xf57, 0xb79, 0x0, 0x91e, 0x0, 0xb11, 0x0, 0x0,
+    0xfdc, 0xe3d, 0xf61, 0x10c4, 0x6d7, 0x0, 0x6b5, 0x771,
+    0x0, 0x0, 0x0, 0x0, 0x1183, 0x1fb, 0x280, 0xec1,
+    0x11f8, 0x698, 0xbcb, 0x963, 0x28d, 0x104f, 0x8cc, 0x10d5,
+    0xdd7, 0x0, 0x8bf, 0x11cc, 0xdcc, 0x0, 0x0, 0x0,
+    0x700, 0x8ae, 0x6a8, 0x0, 0x0, 0x10f9, 0x0, 0xe9c,
+    0xaf1, 0x0, 0x0, 0x0, 0x8e9, 0x0, 0x0, 0x0,
+    0xaa6, 0x3b3, 0xbc6, 0x0, 0x109a, 0x11c5, 0x0, 0x49e,
+    0xe4c, 0x4cc, 0xbbf, 0x0, 0x95a, 0x102e, 0xf67, 0x0,
+    0x0, 0x0, 0x5c9, 0xf47, 0x0, 0xa0f, 0x0, 0x3b4,
+    0xda2, 0x504, 0x0, 0xa4f, 0x2ad, 0x0, 0x0, 0x0,
+    0x6c5, 0x0, 0xbef, 0x0, 0x0, 0x4c8, 0x0, 0x50e,
+    0x562, 0x0, 0x604, 0xd04, 0x742, 0xfd3, 0x24c, 0x724,
+    0x6bd, 0x11e2, 0x5ec, 0x52, 0x0, 0x8a2, 0x843, 0xee0,
+    0x249, 0xfc9, 0x86e, 0x0, 0xcf9, 0x0, 0x939, 0xd7a,
+    0x0, 0x11b2, 0x346, 0x0, 0x0, 0x0, 0x0, 0xf3f,
+    0x0, 0x0, 0x0, 0x719, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x380, 0xb22, 0x0, 0x1101, 0xd2d, 0x3ef, 0x0,
+    0xfbb, 0x0, 0x0, 0x33d, 0x0, 0x779, 0x0, 0x0,
+    0xd11, 0x459, 0x0, 0x1036, 0x26, 0x53c, 0xead, 0x532,
+    0x0, 0x0, 0xdba, 0x5ff, 0x0, 0x0, 0x279, 0x115c,
+    0x404, 0x0, 0x923, 0x0, 0x0, 0xe71, 0x0, 0x0,
+    0x10a1, 0x52b, 0x38c, 0x0, 0x9b1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x99c, 0x0, 0x149, 0xa0e, 0x0,
+    0xfe7, 0x1051, 0x11f2, 0x7d2, 0xeff, 0x2e9, 0x0, 0x3ea,
+    0x0, 0x0, 0x0, 0xbe4, 0x8ba, 0xa9c, 0x1066, 0x10b7,
+    0x2af, 0x0, 0xe80, 0x11c9, 0x95e, 0x0, 0x4a6, 0x8ab,
+    0x11f9, 0x0, 0x0, 0x7f5, 0x0, 0x0, 0x5e8, 0x0,
+    0x0, 0xfd6, 0x0, 0x0, 0x0, 0x0, 0x46, 0x18,
+    0x1ab, 0x0, 0xcc, 0x4c6, 0x0, 0x0, 0xc66, 0xe8d,
+    0x48b, 0x0, 0xb7c, 0x1117, 0xa3a, 0x9, 0xd72, 0x9a8,
+    0x0, 0x0, 0x806, 0x0, 0xd15, 0xb73, 0x0, 0x0,
+    0x0, 0xadb, 0x48f, 0x0, 0x110e, 0x46a, 0x0, 0x0,
+    0x0, 0x0, 0x344, 0x0, 0x538, 0x0, 0x16c, 0x877,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11f6, 0x8ca,
+    0x0, 0x0, 0x66d, 0x4f0, 0x96a, 0xe1f, 0x1031, 0x11dd,
+    0x0, 0xa5f, 0x684, 0xb31, 0xec2, 0xacd, 0x0, 0x34a,
+    0x486, 0x7ea, 0x0, 0x3b7, 0x1cd, 0x95c, 0x0, 0x121,
+    0xfab, 0x0, 0xbc3, 0x0, 0x0, 0x0, 0x0, 0xbfc,
+    0x0, 0xb18, 0x0, 0x0, 0xb54, 0x0, 0x0, 0x35e,
+    0x0, 0x2d6, 0xc2a, 0x7a7, 0xca9, 0x0, 0x8f3, 0x0,
+    0x0, 0x0, 0x8b4, 0x0, 0x0, 0xcf8, 0x832, 0x0,
+    0x0, 0x5d8, 0x106, 0x0, 0x10a9, 0x30e, 0x4a0, 0x11de,
+    0x0, 0xbde, 0x0, 0x1c4, 0x0, 0x1130, 0x0, 0x0,
+    0x971, 0x64, 0xd3a, 0xa0b, 0x0, 0x100, 0x0, 0x526,
+    0xfb0, 0x10a3, 0x116, 0x233, 0xd7d, 0x0, 0x0, 0x97e,
+    0x0, 0x0, 0x0, 0xc85, 0x699, 0x1cb, 0x0, 0x0,
+    0x0, 0x0, 0x1a4, 0x0, 0x0, 0x626, 0x0, 0x3c6,
+    0x595, 0x743, 0x1164, 0x1ca, 0xa1b, 0x885, 0xa04, 0x0,
+    0xbb9, 0x709, 0x0, 0x0, 0xa3e, 0x0, 0xab8, 0x0,
+    0xfff, 0x426, 0xfb6, 0x96c, 0x8c5, 0x1ea, 0x35c, 0x0,
+    0xe04, 0x0, 0x5e3, 0x0, 0x623, 0x0, 0x670, 0x0,
+    0x0, 0x0, 0x389, 0x10e, 0x0, 0x37d, 0x7ca, 0x0,
+    0x0, 0x0, 0x112, 0xf17, 0x11ef, 0x0, 0x0, 0xe76,
+    0x0, 0x0, 0x0, 0x308, 0x50d, 0x0, 0x0, 0x4b9,
+    0x75a, 0x10df, 0x55f, 0x118f, 0x844, 0xf3e, 0x0, 0x1030,
+    0x94d, 0xe64, 0x0, 0x1065, 0x8bb, 0x4fd, 0x11fc, 0x1106,
+    0x0, 0x259, 0xe77, 0x100e, 0x0, 0x6a6, 0x0, 0xe1e,
+    0x118c, 0x0, 0x2da, 0x0, 0x73c, 0xf3b, 0xab1, 0x0,
+    0x0, 0x5e4, 0xaac, 0x181, 0x168, 0x28a, 0x0, 0x5a5,
+    0x0, 0x0, 0xda5, 0xa20, 0x2db, 0x0, 0x0, 0xa8e,
+    0x0, 0x0, 0x573, 0x1a7, 0x105e, 0x10d9, 0x57d, 0x0,
+    0xc3a, 0x0, 0x4aa, 0xbf9, 0x1ff, 0x0, 0x0, 0xba9,
+    0x0, 0xc30, 0x0, 0xe26, 0x0, 0x0, 0x0, 0x127,
+    0xf28, 0xd6c, 0x0, 0x3f6, 0x0, 0x0, 0x0, 0x0,
+    0x67b, 0xba3, 0x0, 0x0, 0x0, 0x0, 0x100d, 0xfb4,
+    0x1190, 0x0, 0x899, 0x0, 0x0, 0x0, 0x0, 0x99b,
+    0xe41, 0x0, 0x582, 0x0, 0x7b, 0x38d, 0xd1c, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xae9, 0x441, 0x1f4, 0x0,
+    0x0, 0x0, 0x0, 0x119d, 0x188, 0xafa, 0x0, 0xa32,
+    0x1064, 0x0, 0x76d, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf7c, 0xca2, 0x91f, 0x0, 0x0, 0x1040,
+    0x0, 0x0, 0x0, 0x0, 0x8f1, 0x5f8, 0xed, 0x356,
+    0x6a3, 0xf06, 0x0, 0x1ec, 0x0, 0x26d, 0xa1, 0x10ff,
+    0x0, 0x0, 0x0, 0xbe0, 0x0, 0x0, 0x0, 0x43f,
+    0x0, 0x0, 0x0, 0x26e, 0x916, 0x418, 0x671, 0x0,
+    0xaf0, 0x0, 0x0, 0x823, 0x0, 0x958, 0x68e, 0xace,
+    0x9e8, 0x1086, 0x112c, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x222, 0x941, 0xa1e, 0x0, 0x0, 0x1b6, 0x440, 0x0,
+    0x9dd, 0x1f5, 0xb91, 0x0, 0x0, 0x0, 0x682, 0x0,
+    0x981, 0x0, 0x1c0, 0xfc5, 0x540, 0x804, 0x1019, 0xbae,
+    0x7e, 0xcd8, 0x77c, 0x0, 0xd2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0x11c0, 0x0, 0x0, 0x95f,
+    0xb74, 0x105a, 0x0, 0xa7e, 0xd76, 0x0, 0x0, 0x10d0,
+    0x0, 0x0, 0x0, 0x0, 0x15e, 0x0, 0x425, 0x0,
+    0x0, 0xf21, 0x0, 0x113, 0x2f8, 0x0, 0x0, 0x30c,
+    0x0, 0x819, 0xec, 0x0, 0xb93, 0xc9a, 0x0, 0x116c,
+    0x0, 0x98f, 0x82a, 0xa59, 0xf8a, 0x0, 0x714, 0x906,
+    0x10b, 0x0, 0x0, 0x712, 0x91b, 0x10e6, 0xbc9, 0x7dd,
+    0x0, 0x0, 0x9f3, 0x16b, 0x0, 0x0, 0x74e, 0x0,
+    0x0, 0x0, 0xf9a, 0x0, 0x0, 0x0, 0xf2f, 0x3db,
+    0x0, 0x0, 0x7e4, 0x87f, 0x0, 0x0, 0x4a7, 0x1c9,
+    0x0, 0x0, 0x1d0, 0x31c, 0x0, 0x487, 0x0, 0x10b3,
+    0x7f2, 0x285, 0xa77, 0x1d2, 0x0, 0x0, 0x0, 0x760,
+    0x1f2, 0x0, 0x584, 0x0, 0x0, 0x9be, 0xb42, 0x0,
+    0x331, 0x5ae, 0xe0f, 0x6bc, 0x689, 0x1013, 0x0, 0x0,
+    0x210, 0x0, 0x0, 0x8da, 0x589, 0x0, 0x0, 0xccb,
+    0xd07, 0x1e3, 0x0, 0x0, 0x0, 0x8d5, 0x0, 0x7cd,
+    0x164, 0x307, 0xc52, 0xfed, 0x0, 0xdb1, 0x0, 0xd22,
+    0x2b7, 0x2ed, 0x568, 0x1176, 0x0, 0x0, 0xcc1, 0x8e0,
+    0x0, 0xbd6, 0xccf, 0x89e, 0x0, 0xeb3, 0xb2d, 0x4f5,
+    0x0, 0x1015, 0x0, 0xf49, 0x855, 0x0, 0xb53, 0x1062,
+    0xb8e, 0x0, 0x0, 0xc89, 0x87c, 0x454, 0x0, 0x113f,
+    0x1068, 0x7a2, 0x0, 0x7c3, 0x88b, 0xd23, 0x936, 0x194,
+    0x0, 0x2c6, 0x0, 0x0, 0x7c8, 0x0, 0xe95, 0x692,
+    0xfaf, 0x2a8, 0x0, 0x3cb, 0x0, 0x0, 0xdb2, 0x0,
+    0x0, 0x597, 0xe25, 0x0, 0x0, 0x0, 0xd24, 0x1d3,
+    0x226, 0x0, 0xb83, 0x0, 0x0, 0xb3e, 0x0, 0x1f,
+    0x0, 0x0, 0x0, 0x0, 0x678, 0xa9, 0x0, 0x0,
+    0x5e7, 0x0, 0x10ad, 0x624, 0x23f, 0x0, 0x0, 0x5b8,
+    0x0, 0x1e8, 0x299, 0x0, 0x8c9, 0xb3, 0x617, 0x0,
+    0x0, 0x0, 0x0, 0x35f, 0x0, 0x805, 0x2e, 0x0,
+    0x1154, 0xc98, 0x1e7, 0x0, 0x106f, 0x575, 0x0, 0xcb3,
+    0x32d, 0x0, 0x0, 0x4d2, 0xcd2, 0x3b2, 0x23, 0x0,
+    0x0, 0x403, 0x6b6, 0x103e, 0x0, 0xfa8, 0x85a, 0xcf2,
+    0xb9, 0x0, 0xd0, 0x0, 0x0, 0xaca, 0x0, 0x315,
+    0x3aa, 0x0, 0x0, 0xd8e, 0x8c6, 0x63d, 0x0, 0x0,
+    0x0, 0x0, 0xfd0, 0x5c7, 0x0, 0x0, 0xa3c, 0xb9a,
+    0x1e4, 0x1041, 0x660, 0x134, 0x10cc, 0xf03, 0x579, 0x0,
+    0x0, 0x1023, 0x729, 0x0, 0x4ea, 0x0, 0x0, 0xacc,
+    0x0, 0xfb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b6,
+    0x0, 0xd7, 0xb04, 0xb8, 0x183, 0x710, 0xf58, 0xea7,
+    0x0, 0xc6a, 0xc3b, 0xd44, 0xefc, 0x112d, 0x799, 0x942,
+    0x0, 0x77, 0x0, 0xc8d, 0xc17, 0x0, 0x0, 0x0,
+    0x100a, 0x0, 0x1085, 0x29e, 0x4b3, 0x2b4, 0x0, 0x1a5,
+    0x517, 0x0, 0x558, 0x108d, 0x0, 0x0, 0x773, 0x93a,
+    0x0, 0x192, 0x0, 0x8ed, 0x647, 0xa27, 0x0, 0x0,
+    0x5de, 0x0, 0x161, 0x943, 0xb39, 0x0, 0xc08, 0x0,
+    0x983, 0x0, 0xabd, 0x0, 0x1147, 0x1145, 0x0, 0x3af,
+    0x476, 0x0, 0xf94, 0x0, 0x0, 0x6a2, 0x0, 0x886,
+    0x4be, 0x438, 0x0, 0x1153, 0x0, 0x274, 0x10ea, 0x0,
+    0x1142, 0x43b, 0x6e9, 0x21b, 0x1025, 0x11fb, 0x1118, 0xd12,
+    0x5f1, 0x0, 0x730, 0x0, 0x0, 0x1077, 0x0, 0x0,
+    0x765, 0x0, 0xb07, 0x0, 0x1067, 0x28, 0x0, 0x0,
+    0x777, 0x296, 0x0, 0x63a, 0x525, 0x0, 0x27c, 0x1104,
+    0x0, 0x518, 0x0, 0xce2, 0x606, 0xf85, 0x317, 0x0,
+    0xd6f, 0x442, 0x122, 0x5ea, 0x0, 0x10f0, 0x9ea, 0x0,
+    0x0, 0x10a0, 0xf0d, 0x628, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd93, 0x0, 0xa02, 0x9c6, 0x142, 0xad8,
+    0x0, 0x0, 0x0, 0xbf8, 0x240, 0x0, 0x0, 0x797,
+    0x0, 0x0, 0xbca, 0x0, 0x0, 0x0, 0x97a, 0x108e,
+    0x0, 0x114f, 0x0, 0x81d, 0x800, 0xab4, 0x0, 0x108b,
+    0x0, 0x0, 0x815, 0x11b4, 0x0, 0xe5, 0x0, 0x0,
+    0x0, 0x0, 0x109d, 0xad4, 0x0, 0x10bc, 0x15c, 0xab9,
+    0x0, 0xc05, 0x1b4, 0xdbe, 0x0, 0x0, 0xb61, 0xafd,
+    0x0, 0x0, 0x2c0, 0x3ca, 0x0, 0x23e, 0x0, 0x0,
+    0x4cd, 0x73e, 0x2d4, 0x0, 0xe02, 0xc81, 0x0, 0x0,
+    0x61a, 0x0, 0x0, 0x0, 0xa2d, 0x881, 0xd28, 0x5,
+    0xbc, 0x0, 0x0, 0x128, 0x6de, 0x826, 0x0, 0x683,
+    0x0, 0x2c7, 0x0, 0x0, 0xb50, 0x0, 0x0, 0x0,
+    0x0, 0x12c, 0x5df, 0x10bd, 0x0, 0xcbc, 0x0, 0xc7b,
+    0xc1a, 0xc58, 0x44, 0x0, 0x0, 0xf78, 0x811, 0x9b4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x0,
+    0x498, 0x0, 0x0, 0x0, 0x0, 0x32f, 0xb1c, 0x0,
+    0x0, 0x0, 0xb37, 0x7af, 0xa2c, 0x9cf, 0x0, 0x8e3,
+    0xf4c, 0x0, 0x0, 0x8e5, 0x0, 0x163, 0x8a7, 0x75b,
+    0x0, 0x0, 0xb0a, 0x0, 0x55b, 0x0, 0xa67, 0x0,
+    0xae, 0x0, 0x0, 0x0, 0x1152, 0x0, 0x3a7, 0x1e0,
+    0x112e, 0x0, 0x5d5, 0xa3f, 0xed8, 0x298, 0x0, 0x5c2,
+    0xa96, 0x0, 0x0, 0x0, 0x5f9, 0x0, 0x4cb, 0x33,
+    0x0, 0xcc4, 0x0, 0x23c, 0x10ed, 0x0, 0x0, 0x0,
+    0x0, 0x139, 0x0, 0x0, 0x0, 0x0, 0x23b, 0xd09,
+    0x0, 0x975, 0x8f0, 0x0, 0xd48, 0x35d, 0xdcd, 0x0,
+    0xc16, 0x165, 0x0, 0x93b, 0x0, 0x756, 0x0, 0x0,
+    0x0, 0x927, 0x937, 0x0, 0x0, 0xa58, 0x0, 0x0,
+    0xd0a, 0x143, 0x31b, 0x0, 0x236, 0x0, 0xc3, 0x0,
+    0xa3d, 0xfbd, 0x0, 0x841, 0x57c, 0x0, 0x3d5, 0xdb5,
+    0x400, 0x7d0, 0x16, 0x6ac, 0xf8f, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc45, 0x62a, 0x0, 0xf84,
+    0x0, 0xaba, 0x0, 0xaab, 0x395, 0x24, 0x0, 0x82e,
+    0x50c, 0x856, 0xb23, 0x641, 0x0, 0x687, 0x0, 0x0,
+    0x1155, 0x0, 0x0, 0xb75, 0x0, 0x0, 0xa54, 0xb68,
+    0x0, 0x0, 0x10cd, 0x3f5, 0x0, 0x0, 0xbc8, 0x217,
+    0x26a, 0x0, 0xdee, 0x159, 0x0, 0x0, 0x0, 0x3f0,
+    0xdd3, 0x8eb, 0x0, 0xad, 0x114b, 0x666, 0xe9b, 0x0,
+    0x0, 0x9ec, 0x0, 0x43c, 0x0, 0xe84, 0x0, 0x0,
+    0x269, 0x732, 0x0, 0xc03, 0x0, 0xc80, 0x0, 0x0,
+    0xf79, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa1d, 0xf7,
+    0xc21, 0x0, 0x38a, 0x0, 0x0, 0x852, 0x267, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x312, 0x0, 0x4ad, 0xd26,
+    0x0, 0x7a4, 0x1195, 0x0, 0x0, 0xb29, 0x0, 0xd7f,
+    0x0, 0xba1, 0x4ec, 0x0, 0x2f2, 0x0, 0x104c, 0x0,
+    0x39, 0x5fe, 0x0, 0xfe1, 0x0, 0x0, 0x7fc, 0x0,
+    0x0, 0x613, 0xa6b, 0x11f5, 0x5fc, 0x390, 0x9e0, 0x0,
+    0x29c, 0xb7e, 0x0, 0x0, 0x112f, 0xe36, 0x0, 0x0,
+    0x2eb, 0x0, 0x97f, 0x833, 0x878, 0x1f0, 0xa94, 0x0,
+    0x47e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb65, 0x57e, 0x0, 0x1137, 0x0, 0xb00, 0xd03, 0x424,
+    0xe86, 0x915, 0x0, 0x10fe, 0x5c8, 0x0, 0xb1e, 0x0,
+    0x0, 0x0, 0x0, 0x3e3, 0xdb9, 0x0, 0x4bc, 0xc09,
+    0x0, 0x0, 0x0, 0xd1d, 0x449, 0x0, 0xb51, 0x2ec,
+    0x3e1, 0x931, 0x2ef, 0xcf4, 0x0, 0xaf7, 0x4fc, 0x94c,
+    0x892, 0x0, 0x0, 0x0, 0x7c, 0x41, 0x0, 0x0,
+    0x2c2, 0x1083, 0x872, 0x531, 0xb57, 0x0, 0x0, 0x0,
+    0x9ff, 0x0, 0x0, 0xe24, 0x619, 0x42d, 0xbff, 0x0,
+    0xea4, 0xf4b, 0x0, 0x0, 0x8b0, 0x0, 0xeac, 0x0,
+    0x0, 0x0, 0x50f, 0x0, 0xccd, 0x401, 0xb0e, 0x107f,
+    0x0, 0x327, 0x0, 0x79e, 0x51, 0x0, 0x465, 0x0,
+    0xbb3, 0xeed, 0x0, 0x0, 0x1168, 0x66c, 0x25b, 0x0,
+    0x0, 0x8ec, 0x0, 0x0, 0x0, 0xb26, 0x0, 0x0,
+    0x10aa, 0x7e1, 0x0, 0x0, 0x0, 0x8a1, 0xc8c, 0xc5c,
+    0x18e, 0x212, 0xaa8, 0x8b2, 0x0, 0x339, 0x860, 0x0,
+    0x1b9, 0xcb6, 0xe05, 0xf09, 0x0, 0x6af, 0x1109, 0x2f3,
+    0x9c4, 0x0, 0x107b, 0xf62, 0x67a, 0xd38, 0xb97, 0x0,
+    0x13e, 0xefd, 0x4df, 0x0, 0x798, 0x51b, 0x0, 0xc75,
+    0x772, 0xd29, 0x464, 0xfdd, 0x66, 0x0, 0x0, 0x10cb,
+    0x78e, 0x2c3, 0x6dd, 0x0, 0x5be, 0xe79, 0x262, 0x104,
+    0x537, 0xf1c, 0x6d6, 0x0, 0x0, 0x1c7, 0x1116, 0x1094,
+    0x2e4, 0x107a, 0x0, 0x0, 0x0, 0xb8f, 0xb05, 0x0,
+    0x4a9, 0x0, 0xe2c, 0x0, 0x0, 0xc1f, 0x0, 0x1111,
+    0x341, 0x0, 0x3f7, 0x0, 0x0, 0x0, 0x4ff, 0x10b8,
+    0x0, 0x681, 0x144, 0x0, 0x0, 0x0, 0x2f7, 0x1133,
+    0x792, 0x5d0, 0x0, 0x0, 0xb60, 0x253, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x20a, 0x433, 0x0, 0x0, 0x0,
+    0xda8, 0xf0b, 0x0, 0xc14, 0x345, 0xb6f, 0x5b7, 0xee,
+    0xde5, 0x77d, 0x0, 0xfda, 0xe4d, 0xb2f, 0x0, 0x106a,
+    0x0, 0x0, 0xf7d, 0x19d, 0x0, 0xfb3, 0x0, 0x0,
+    0x1057, 0x0, 0x11fe, 0x947, 0x0, 0x70a, 0x1125, 0x0,
+    0x0, 0x1039, 0xf35, 0xca1, 0x593, 0xa79, 0x762, 0x67d,
+    0xc7e, 0x4f, 0x8f, 0xe9a, 0x640, 0x0, 0x350, 0x0,
+    0xba8, 0x10bb, 0x778, 0x0, 0x0, 0xaa3, 0x0, 0xfa3,
+    0x13f, 0xb6d, 0x0, 0x0, 0x1069, 0x90b, 0x0, 0x918,
+    0x0, 0x14, 0x0, 0x0, 0xce8, 0x10e2, 0x9af, 0x0,
+    0xeef, 0x891, 0x38, 0x0, 0x0, 0x0, 0x87e, 0x3b6,
+    0x72c, 0x0, 0xf89, 0x0, 0xc0f, 0x8cb, 0x0, 0x0,
+    0x70, 0x0, 0x0, 0x0, 0x33e, 0x3ce, 0x0, 0x0,
+    0x0, 0x10be, 0x2fb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1002, 0xf50, 0x11a7, 0x0, 0x0, 0x170, 0x0, 0x0,
+    0x0, 0x408, 0x72e, 0x0, 0x11db, 0x0, 0x0, 0x0,
+    0x10e1, 0x0, 0x8e8, 0x0, 0xb52, 0x0, 0x0, 0x0,
+    0x0, 0x8d, 0x1087, 0x1129, 0x0, 0x0, 0x0, 0x0,
+    0xdd1, 0x0, 0x117b, 0x0, 0xae8, 0xa42, 0x11f3, 0xcde,
+    0x0, 0x14b, 0x541, 0x5bd, 0x109, 0x0, 0x0, 0xa3,
+    0x0, 0x0, 0x367, 0x0, 0xbfa, 0x0, 0x786, 0x80a,
+    0x988, 0x0, 0x0, 0xa3b, 0x0, 0xf98, 0xd83, 0xfce,
+    0xadf, 0xd97, 0x5eb, 0x6f4, 0x54, 0x77a, 0x0, 0x9ca,
+    0x11d6, 0x0, 0x0, 0x0, 0x0, 0xa00, 0x808, 0x29d,
+    0xc25, 0x0, 0x0, 0x0, 0x0, 0xcc9, 0x0, 0x0,
+    0x0, 0xba6, 0x0, 0x11da, 0xae0, 0x7f0, 0x0, 0x175,
+    0x0, 0x9e3, 0x0, 0x8c7, 0x0, 0xa49, 0x25, 0x1084,
+    0x0, 0x914, 0xebf, 0x5cb, 0x0, 0x0, 0x987, 0x5ca,
+    0x289, 0x469, 0x0, 0xe4f, 0x588, 0xc18, 0x993, 0x0,
+    0x0, 0x323, 0x0, 0x0, 0x0, 0x952, 0x0, 0x0,
+    0x761, 0x92f, 0xd6, 0xfbe, 0x0, 0x810, 0x0, 0x0,
+    0x54e, 0x0, 0x972, 0x64a, 0x1180, 0x16e, 0x198, 0x0,
+    0xc76, 0x0, 0xcf7, 0x17, 0x0, 0xe32, 0x0, 0x477,
+    0x67c, 0x0, 0x0, 0x0, 0x884, 0x0, 0x1fe, 0x0,
+    0x7a0, 0x776, 0x11e6, 0xf2c, 0xe65, 0x0, 0x1047, 0x0,
+    0x0, 0xd08, 0x0, 0xb3a, 0x533, 0x0, 0x1de, 0x846,
+    0x4d7, 0x0, 0x0, 0x0, 0x43a, 0x0, 0x0, 0x0,
+    0xa60, 0xa24, 0xcd1, 0x0, 0xaa9, 0x5a0, 0xece, 0x0,
+    0x0, 0x0, 0x0, 0x90e, 0x0, 0x9c5, 0xedd, 0x1163,
+    0x907, 0x0, 0x0, 0x0, 0x7bb, 0x0, 0xa8b, 0xb2c,
+    0x0, 0x0, 0x0, 0x2ac, 0xc34, 0x4de, 0x0, 0x60f,
+    0x0, 0xbee, 0x9a, 0x58a, 0xe08, 0xffb, 0x0, 0x0,
+    0x2e2, 0x0, 0x0, 0x0, 0x191, 0xbf3, 0xd69, 0x0,
+    0x0, 0x0, 0x821, 0x0, 0x0, 0x0, 0x330, 0x0,
+    0x15a, 0xaae, 0x0, 0x4c5, 0x790, 0x9d9, 0x8b8, 0x0,
+    0xf34, 0x0, 0xb9d, 0x673, 0x0, 0x0, 0xa06, 0xd4b,
+    0xb1a, 0xd85, 0x0, 0x0, 0xf6b, 0x0, 0x0, 0x837,
+    0x727, 0x0, 0x104b, 0x0, 0x1151, 0x0, 0x0, 0x429,
+    0x0, 0x44b, 0xc54, 0xd68, 0x0, 0x0, 0x0, 0xf99,
+    0x631, 0x0, 0x9f1, 0x0, 0x81, 0x0, 0x14f, 0x898,
+    0xd1, 0x1b5, 0x0, 0xfb, 0x13a, 0x0, 0x1f8, 0x0,
+    0x0, 0x0, 0x0, 0xd79, 0x814, 0x0, 0x0, 0x0,
+    0x0, 0xb5c, 0x0, 0x0, 0x0, 0x162, 0x5d, 0x0,
+    0x0, 0xf39, 0x71d, 0xdf9, 0x0, 0xc86, 0x6f, 0x100c,
+    0x0, 0x4d3, 0xa63, 0x0, 0x0, 0xa7, 0x0, 0xef6,
+    0x74f, 0x4f4, 0x0, 0xbd3, 0x0, 0x110c, 0xc0b, 0x474,
+    0x0, 0x0, 0xae2, 0x0, 0x360, 0x625, 0x686, 0xe16,
+    0x0, 0x0, 0x9b5, 0x91c, 0xa4a, 0x0, 0xdf8, 0x7c5,
+    0x0, 0x99a, 0x32, 0x0, 0x8bd, 0x1120, 0x116a, 0xa7f,
+    0x0, 0x204, 0xe28, 0x571, 0x782, 0xbf5, 0x0, 0xb48,
+    0x0, 0xa5b, 0x618, 0x611, 0x0, 0xdd0, 0x12f, 0x51f,
+    0x0, 0x354, 0x1f3, 0x64d, 0x0, 0xb9b, 0x92d, 0x0,
+    0x479, 0xe7, 0x16a, 0xc5d, 0x0, 0x0, 0x0, 0xa51,
+    0xb76, 0x10b2, 0x0, 0x394, 0x0, 0x960, 0x0, 0x0,
+    0x40b, 0x77b, 0xfa4, 0x8dd, 0xf0, 0x0, 0x0, 0x30f,
+    0x0, 0x0, 0x0, 0x657, 0x0, 0x68, 0x0, 0x0,
+    0x0, 0x10ef, 0xf44, 0xf55, 0x0, 0x0, 0x0, 0x123,
+    0x0, 0x0, 0x1e6, 0x0, 0x0, 0x0, 0x61c, 0xd43,
+    0x6b3, 0x944, 0x0, 0xdc8, 0xbf6, 0x0, 0x9bd, 0x0,
+    0x0, 0x0, 0x1d7, 0x0, 0x0, 0x43e, 0x76c, 0xd60,
+    0x4fb, 0x0, 0x0, 0x0, 0xdaa, 0x431, 0x9fb, 0x1fa,
+    0x0, 0x0, 0xfd4, 0x0, 0x910, 0xcd7, 0x0, 0x0,
+    0xb43, 0x0, 0x0, 0xf4, 0xc55, 0x0, 0x0, 0x94e,
+    0x495, 0x4e6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17a, 0x463,
+    0x0, 0x0, 0x0, 0xb69, 0x0, 0x0, 0x0, 0x0,
+    0x839, 0xe31, 0xe51, 0x668, 0x9a5, 0x0, 0x5e1, 0x8d4,
+    0x11ea, 0xf73, 0xa33, 0x0, 0xed1, 0x0, 0x0, 0x0,
+    0xac0, 0xadc, 0x0, 0x0, 0x551, 0x0, 0x945, 0x115a,
+    0x3d9, 0xd6e, 0xb80, 0x0, 0x0, 0xc4, 0xaf8, 0x0,
+    0x0, 0x1107, 0x219, 0x6f8, 0x1c6, 0x0, 0x492, 0xe9f,
+    0x80d, 0xe2a, 0x11e9, 0xac1, 0x0, 0x0, 0x0, 0xa15,
+    0xe50, 0x92b, 0x203, 0x0, 0xb46, 0x85, 0x0, 0x58,
+    0xf1b, 0xade, 0xce, 0xe6b, 0x4e9, 0x8c, 0x7be, 0xd78,
+    0xc20, 0x0, 0x105d, 0x0, 0x0, 0xeca, 0x8df, 0xa2,
+    0x10eb, 0x0, 0x7e8, 0x0, 0x0, 0xd92, 0xdb0, 0x0,
+    0x0, 0x1095, 0x27d, 0x0, 0x0, 0x10ac, 0x85b, 0x0,
+    0x3a, 0x0, 0xe43, 0x0, 0x0, 0x0, 0x0, 0xa03,
+    0x0, 0x0, 0x1162, 0x0, 0x0, 0x0, 0x10f4, 0x591,
+    0x0, 0x0, 0x0, 0x3e8, 0x0, 0xd, 0x21d, 0xebd,
+    0x0, 0x0, 0x0, 0x0, 0x11f1, 0x0, 0xc27, 0x9ae,
+    0x848, 0xfa5, 0x6ed, 0x0, 0x0, 0x10bf, 0x72d, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd5f, 0xa34, 0x93f, 0xcc3,
+    0x0, 0xbed, 0x2be, 0x0, 0xd4f, 0x0, 0x0, 0x0,
+    0xf3, 0xb8b, 0x22c, 0x0, 0x694, 0x0, 0x0, 0x0,
+    0x0, 0x10f5, 0x0, 0x0, 0xc4f, 0x0, 0xa93, 0x1165,
+    0x0, 0x0, 0xcc6, 0x44e, 0x0, 0x22f, 0x0, 0x667,
+    0x0, 0x78a, 0x0, 0x0, 0xa0a, 0x7f7, 0xa66, 0x511,
+    0x705, 0x3c2, 0x0, 0x0, 0x56e, 0x0, 0x0, 0xdd9,
+    0x0, 0x0, 0x893, 0x0, 0xf60, 0x428, 0x10d1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x757, 0x3d8, 0x0,
+    0x405, 0x0, 0x4ef, 0x0, 0x534, 0x101a, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbe1, 0x9c3, 0x0,
+    0xfbf, 0x67e, 0x0, 0x8f5, 0x0, 0x0, 0xe74, 0x40f,
+    0x349, 0x101f, 0x0, 0x0, 0x0, 0x0, 0xdc5, 0x0,
+    0xb2b, 0x0, 0x0, 0x0, 0xd6b, 0x986, 0xa73, 0x0,
+    0x0, 0x81e, 0xda7, 0x0, 0xb21, 0x103, 0xbd0, 0xfde,
+    0x8fb, 0x1100, 0x119c, 0x7cb, 0x83a, 0xb7, 0x0, 0x97d,
+    0x0, 0x0, 0x980, 0xded, 0x0, 0x0, 0x656, 0x385,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x359, 0x925, 0xa74,
+    0xce0, 0x0, 0x0, 0x0, 0x434, 0x0, 0x87a, 0xb90,
+    0x11b6, 0x1d5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x244,
+    0xc4e, 0x10db, 0x1138, 0xdef, 0x0, 0x49b, 0x0, 0x0,
+    0x0, 0x73, 0x0, 0x0, 0x0, 0x9a4, 0x343, 0x0,
+    0x0, 0x0, 0x3ee, 0x11d3, 0x11a5, 0xaad, 0x25f, 0x0,
+    0x0, 0x0, 0x0, 0x16d, 0xa6f, 0x0, 0xff1, 0x0,
+    0xa50, 0x0, 0xb8a, 0x1df, 0x921, 0x0, 0x0, 0xe55,
+    0xf53, 0x273, 0x0, 0xe5a, 0x0, 0x0, 0xf45, 0x0,
+    0x6ca, 0x0, 0x0, 0xcef, 0x39b, 0x0, 0x0, 0x0,
+    0x0, 0xa53, 0x0, 0x104e, 0x0, 0x0, 0xcd9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x600, 0xdb7, 0x0,
+    0x0, 0xd9, 0x228, 0x3c7, 0x920, 0x0, 0x1093, 0x1119,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a6, 0x0, 0x0,
+    0x40c, 0x0, 0x0, 0x9ee, 0x6fb, 0x5a2, 0x0, 0x0,
+    0x119e, 0x265, 0x0, 0x9ed, 0x7ed, 0xf1a, 0xe62, 0xd20,
+    0x1072, 0x543, 0x0, 0x0, 0x0, 0x0, 0xf1f, 0xa18,
+    0xa9f, 0x173, 0x111, 0x0, 0xe1d, 0x329, 0x864, 0x0,
+    0xe63, 0xda, 0x85d, 0x0, 0xd4, 0x6ee, 0x0, 0xf77,
+    0x0, 0x0, 0x11e, 0x8cf, 0x0, 0x0, 0xde0, 0x659,
+    0x0, 0x0, 0x1045, 0xdd8, 0x583, 0x0, 0x0, 0x0,
+    0x0, 0x696, 0x0, 0x0, 0x113e, 0x63c, 0xf4d, 0xee4,
+    0x0, 0x69, 0x114, 0xea2, 0xcea, 0xc0c, 0xe6d, 0x0,
+    0xcfa, 0x8cd, 0x3f1, 0x0, 0x0, 0x2dc, 0x0, 0x90d,
+    0x0, 0x0, 0xfa7, 0x11e7, 0xfec, 0x0, 0x88a, 0x4b,
+    0x0, 0x0, 0x12b, 0x10c2, 0xcdf, 0x0, 0x7e3, 0x4d1,
+    0xab3, 0x52c, 0x0, 0x52d, 0x0, 0x1160, 0x266, 0xd57,
+    0x6df, 0x0, 0x0, 0xcaf, 0x1135, 0x0, 0x1c2, 0x257,
+    0x461, 0xac2, 0x456, 0x0, 0x0, 0xf33, 0x0, 0x0,
+    0x0, 0x0, 0x1b0, 0xecf, 0x0, 0x0, 0x0, 0xecc,
+    0x7da, 0x0, 0xd0b, 0xf5b, 0x53f, 0x0, 0x7bc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f2, 0x775, 0xc32, 0x3f4,
+    0x0, 0xeea, 0x903, 0xdfa, 0x115d, 0x0, 0x0, 0x0,
+    0x41e, 0x0, 0x1026, 0x0, 0x0, 0x1056, 0x0, 0x0,
+    0x5af, 0xb4f, 0x0, 0x0, 0x0, 0x966, 0x256, 0xadd,
+    0x0, 0x105c, 0x851, 0x3b9, 0x135, 0x238, 0x0, 0xea,
+    0x0, 0x0, 0x0, 0x663, 0x11d4, 0x0, 0x27a, 0x0,
+    0x10f8, 0x0, 0x110d, 0x1b, 0x1105, 0xab5, 0xa05, 0x11b1,
+    0x0, 0x0, 0xba, 0x0, 0x4c3, 0x20e, 0xfa9, 0xd90,
+    0x1d8, 0xaa2, 0xe3c, 0x0, 0xc5f, 0x0, 0x5aa, 0x19b,
+    0x0, 0xe5b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1082, 0x0, 0x0, 0x961, 0x0, 0xea1, 0x0,
+    0x702, 0x0, 0x0, 0x994, 0x0, 0x0, 0x0, 0x0,
+    0xd13, 0x5cf, 0x0, 0xe6e, 0x0, 0xed7, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0x0, 0xb41, 0x0, 0x0, 0xc5b,
+    0x0, 0x104d, 0x0, 0x0, 0x40d, 0x0, 0xce1, 0xef7,
+    0x4b6, 0x436, 0x435, 0x0, 0x0, 0xc8f, 0x0, 0x0,
+    0xcce, 0x0, 0x0, 0xbbb, 0x0, 0x499, 0x0, 0x148,
+    0x0, 0x4b7, 0x2b1, 0x230, 0x0, 0x0, 0xd88, 0x60c,
+    0xd19, 0x8d1, 0x133, 0xcb8, 0xa76, 0x8ea, 0xbe9, 0x0,
+    0x0, 0xf7a, 0x0, 0xb28, 0x96f, 0x10c, 0x124, 0x7c4,
+    0x0, 0xd42, 0x968, 0xe06, 0x0, 0xfc1, 0x106b, 0x0,
+    0x40a, 0xeb4, 0xb17, 0x0, 0x0, 0xb7d, 0x174, 0x622,
+    0x0, 0x1a9, 0x0, 0x767, 0x646, 0x6f9, 0x655, 0x650,
+    0x32b, 0xf24, 0xfa0, 0x0, 0x8fd, 0x789, 0x0, 0xb6a,
+    0x4f8, 0xfcb, 0x0, 0x0, 0x2df, 0xfd5, 0xd0d, 0xd8f,
+    0xae1, 0x0, 0x0, 0x0, 0x3de, 0x0, 0x328, 0xc9d,
+    0xa6d, 0x3ab, 0x7b7, 0x7ad, 0xc77, 0x0, 0x0, 0xaa0,
+    0x0, 0x0, 0xf82, 0xfd7, 0x0, 0xf3a, 0x78b, 0x0,
+    0x5d3, 0x0, 0x207, 0xb5e, 0x8b9, 0x3ac, 0xd8, 0xa22,
+    0x0, 0x957, 0x0, 0x0, 0x2c, 0xefb, 0x116e, 0x0,
+    0x414, 0x337, 0xaa1, 0x0, 0x0, 0x3da, 0xbad, 0x0,
+    0x610, 0x0, 0x605, 0xd1a, 0x0, 0x114a, 0x11c7, 0x0,
+    0xde9, 0xc93, 0x0, 0x27e, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd17, 0x0, 0x1092, 0x0, 0x8a8, 0x0, 0x520,
+    0x753, 0x0, 0x2f1, 0x0, 0x0, 0xd0e, 0xfe4, 0x0,
+    0x866, 0x11b8, 0xa95, 0x0, 0x750, 0x1fc, 0x0, 0x75,
+    0x0, 0x0, 0xe40, 0x0, 0x0, 0x9a2, 0x0, 0x0,
+    0x5d6, 0x0, 0x17c, 0xa48, 0x0, 0x200, 0xd21, 0x0,
+    0x72a, 0xfac, 0x37c, 0x0, 0x6eb, 0x15d, 0x0, 0x0,
+    0xed4, 0xf19, 0x0, 0x0, 0x639, 0x92a, 0x0, 0x202,
+    0xf87, 0x0, 0x0, 0x65, 0xc8b, 0xdea, 0x0, 0xb63,
+    0x0, 0x2a1, 0x0, 0x0, 0x0, 0x0, 0xa5, 0xd71,
+    0x3d7, 0x0, 0x119, 0x11d0, 0x0, 0x0, 0x0, 0x2d3,
+    0x53e, 0xf2e, 0x3a1, 0x0, 0xda0, 0x7d4, 0x3fc, 0x0,
+    0x0, 0x102d, 0x8c0, 0xc1d, 0x4f3, 0xd95, 0x0, 0x0,
+    0x0, 0x58c, 0x0, 0x0, 0x0, 0x0, 0x68c, 0x0,
+    0xd06, 0xd8c, 0x0, 0x0, 0x0, 0x85f, 0x0, 0xe48,
+    0x4dc, 0x5bb, 0x888, 0x0, 0xb89, 0xb56, 0x4d5, 0x26c,
+    0xcaa, 0xd0f, 0x402, 0x0, 0x718, 0x0, 0x0, 0x970,
+    0x9e, 0xa9a, 0x951, 0xff8, 0xe46, 0xd9f, 0xc04, 0x904,
+    0x0, 0xf1, 0xe97, 0x5b2, 0x0, 0x8c2, 0xab0, 0x0,
+    0x0, 0x0, 0xb01, 0xdff, 0x213, 0x0, 0x0, 0x7fa,
+    0x1ef, 0x24e, 0x0, 0x0, 0x0, 0xc72, 0x2a5, 0x0,
+    0xa30, 0x5e0, 0xbce, 0x1173, 0xd35, 0x0, 0x875, 0x0,
+    0x0, 0x0, 0xb92, 0x0, 0xd66, 0xe12, 0xdda, 0x1128,
+    0x0, 0x53d, 0xc84, 0xe0, 0x496, 0x0, 0x0, 0x0,
+    0x0, 0x536, 0x7, 0x11e8, 0x42a, 0xa0c, 0xd32, 0x539,
+    0x0, 0x695, 0x0, 0xe52, 0x4da, 0x3e4, 0x75c, 0x0,
+    0xba4, 0x68b, 0x0, 0x0, 0x4f1, 0x4ac, 0x0, 0x0,
+    0x0, 0x115, 0x0, 0xd3d, 0x3ad, 0x0, 0x215, 0xc1b,
+    0x0, 0x0, 0x0, 0xde1, 0x270, 0x482, 0x1a3, 0x8fa,
+    0x0, 0x0, 0x895, 0x0, 0x3d6, 0x701, 0x0, 0x0,
+    0xec9, 0x0, 0x917, 0x0, 0x835, 0x1a, 0x0, 0x9eb,
+    0x0, 0x0, 0x0, 0x0, 0x3ba, 0x3bf, 0x0, 0x0,
+    0x0, 0xef1, 0x0, 0x15b, 0x0, 0xb0d, 0x7f6, 0x29a,
+    0x954, 0xaf9, 0x0, 0x0, 0x0, 0x0, 0x61b, 0x18c,
+    0x1099, 0x494, 0x0, 0x2a0, 0x0, 0x0, 0xa68, 0x1016,
+    0x1001, 0x8c3, 0x825, 0x378, 0x0, 0x0, 0xc6d, 0x0,
+    0x0, 0x41b, 0x3f9, 0x0, 0x0, 0x227, 0x0, 0x6,
+    0x17d, 0x0, 0x1058, 0x91d, 0x0, 0x0, 0x422, 0x0,
+    0x83c, 0x0, 0x0, 0x0, 0x0, 0x10d2, 0xc78, 0xafb,
+    0xdaf, 0x0, 0x458, 0x1102, 0x0, 0xce4, 0xbe8, 0x126,
+    0xa4, 0x0, 0x0, 0xfe, 0x0, 0xd01, 0x36b, 0xe29,
+    0x0, 0x10e0, 0xc2b, 0xc1, 0xe90, 0xdfc, 0x0, 0x0,
+    0xac9, 0x0, 0x70c, 0x0, 0x40e, 0x0, 0x0, 0x94f,
+    0xd52, 0x0, 0x4ce, 0x1191, 0x0, 0xb3d, 0x0, 0xf63,
+    0x0, 0x0, 0x0, 0x8e6, 0x934, 0x11ff, 0x5b3, 0x0,
+    0x119f, 0x7ab, 0x0, 0xd5, 0x0, 0x452, 0x977, 0x0,
+    0x3fa, 0x3d2, 0xb9f, 0x2e5, 0x0, 0x0, 0x10d7, 0x10ee,
+    0x0, 0x0, 0x11a, 0x1115, 0x9d8, 0x5b, 0x6cf, 0x0,
+    0x0, 0x117f, 0xf4f, 0x0, 0x97b, 0x0, 0x874, 0x0,
+    0x0, 0x1139, 0xf9d, 0x554, 0x0, 0xf9, 0x2d, 0x0,
+    0x0, 0xa25, 0x0, 0x7ef, 0x3c0, 0x0, 0x0, 0x10e4,
+    0x1d9, 0x0, 0x0, 0x10da, 0x0, 0x0, 0x1090, 0x462,
+    0x286, 0x0, 0x0, 0x0, 0x0, 0x248, 0xd84, 0x5da,
+    0x423, 0xbcc, 0xdc3, 0x0, 0xc7f, 0x0, 0x0, 0x4ae,
+    0xbdb, 0xbd, 0x60b, 0x0, 0x3d4, 0x0, 0x0, 0x6dc,
+    0xc23, 0x0, 0x0, 0xa88, 0x0, 0x1114, 0x13b, 0x15,
+    0x0, 0x0, 0xfa2, 0x0, 0x28c, 0x45f, 0xf68, 0x0,
+    0x0, 0xd3f, 0x0, 0x0, 0x1202, 0x0, 0x0, 0x5ed,
+    0x0, 0xfc2, 0x0, 0x0, 0x275, 0x8b6, 0x347, 0xc28,
+    0x9c8, 0x92c, 0x516, 0x65a, 0x8db, 0x0, 0x0, 0x0,
+    0x549, 0x88e, 0x0, 0xb38, 0x73d, 0xb1, 0x9a6, 0xe73,
+    0x0, 0x6d5, 0x0, 0x5fa, 0x9e1, 0x736, 0xbd1, 0x0,
+    0x2fd, 0x1043, 0x586, 0xdb8, 0x0, 0xb4b, 0xf6c, 0xc2,
+    0x0, 0x0, 0x0, 0x0, 0xec6, 0x71, 0x0, 0xd5d,
+    0x0, 0x1006, 0x6c, 0x37e, 0xa56, 0x31a, 0xba2, 0x0,
+    0x0, 0xedb, 0x1ee, 0x0, 0xbf4, 0x3c8, 0xdf4, 0x0,
+    0x0, 0xc40, 0x0, 0x0, 0xa92, 0x0, 0x887, 0xf42,
+    0x36c, 0x0, 0x0, 0x0, 0x1053, 0x0, 0x0, 0x1113,
+    0x10b5, 0xfe9, 0x0, 0x5f6, 0x0, 0x0, 0x1132, 0x858,
+    0x4b1, 0x22a, 0x0, 0xe34, 0x460, 0xaec, 0xc3c, 0x0,
+    0x0, 0xed2, 0x0, 0x4bd, 0x0, 0x89, 0x34e, 0x0,
+    0x0, 0x145, 0xf04, 0x0, 0x0, 0x0, 0xeee, 0x0,
+    0x0, 0x0, 0x693, 0x152, 0x9a9, 0x0, 0x11e3, 0x10c8,
+    0x4b0, 0x615, 0x9d1, 0x0, 0x6e2, 0x11c8, 0x6a1, 0x0,
+    0x0, 0x0, 0x0, 0xce7, 0x27f, 0xe1a, 0x10ca, 0x0,
+    0x1b7, 0xced, 0xcb0, 0x755, 0x417, 0x2f0, 0x10c0, 0x0,
+    0x0, 0x11a6, 0x0, 0x11b5, 0xe17, 0x1037, 0xeb5, 0xfc7,
+    0x0, 0x711, 0x14a, 0x11d8, 0xdcb, 0x0, 0x48a, 0x0,
+    0x0, 0xe18, 0x1140, 0x4c, 0x0, 0x0, 0x45, 0xc38,
+    0x955, 0xe3f, 0x0, 0xae5, 0x35a, 0x0, 0x0, 0x601,
+    0x0, 0x82b, 0xe9, 0x84e, 0x0, 0xba5, 0x2ae, 0xc11,
+    0x0, 0x0, 0x816, 0xcd4, 0xd55, 0x1a1, 0x912, 0x61e,
+    0x6cb, 0xc7c, 0x0, 0x1bc, 0x0, 0x0, 0x8ac, 0x0,
+    0x245, 0x754, 0xbb1, 0x0, 0x1ad, 0x421, 0x264, 0x0,
+    0x2b3, 0x0, 0x0, 0x572, 0x0, 0xa8f, 0x0, 0x7b8,
+    0x0, 0x103f, 0xa86, 0xdf6, 0x77e, 0x0, 0x0, 0x96b,
+    0x738, 0x0, 0x0, 0x62e, 0x0, 0x10e8, 0x708, 0xede,
+    0x949, 0xc12, 0x8c8, 0x0, 0x974, 0xf14, 0x1028, 0xa11,
+    0x5a, 0x0, 0x7a6, 0xc22, 0xbb4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x45e, 0xecb, 0xfca, 0x0, 0xb0c, 0x508,
+    0xf9e, 0x94, 0x0, 0x0, 0x0, 0x75e, 0x393, 0x0,
+    0x0, 0x9f8, 0x0, 0x1149, 0xffa, 0xd41, 0x0, 0x0,
+    0xb70, 0x72b, 0x6d0, 0x0, 0x25d, 0x0, 0x67f, 0x1d4,
+    0x0, 0x0, 0x0, 0xf8c, 0x0, 0x0, 0x4a8, 0x0,
+    0x51d, 0x0, 0x0, 0xcd, 0x831, 0x373, 0x28e, 0x8a9,
+    0xeb7, 0x53b, 0x73b, 0x8de, 0x0, 0x0, 0x0, 0x0,
+    0x2c5, 0x0, 0xe98, 0x0, 0x0, 0xf26, 0x108a, 0x0,
+    0x0, 0xc83, 0x0, 0x86b, 0x383, 0x0, 0x510, 0x7ac,
+    0x691, 0x6fc, 0x0, 0x0, 0x0, 0xad0, 0xa5d, 0x0,
+    0x940, 0xb45, 0x0, 0x503, 0x0, 0x234, 0x0, 0xe39,
+    0x0, 0x153, 0x0, 0x399, 0x21e, 0x0, 0x998, 0x505,
+    0x0, 0x0, 0x76a, 0x41a, 0x0, 0x22d, 0x34, 0x379,
+    0x1035, 0x366, 0xf13, 0xc2c, 0x0, 0x929, 0x420, 0x39d,
+    0x0, 0x0, 0x0, 0x3c, 0x3f, 0x361, 0x0, 0x473,
+    0x0, 0x475, 0x398, 0xe60, 0x0, 0x0, 0x0, 0x0,
+    0xfc3, 0x0, 0xa29, 0x0, 0x28b, 0x62c, 0x34b, 0x137,
+    0x0, 0x0, 0x0, 0x0, 0x11e4, 0x0, 0x105b, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf31, 0x70d, 0x2d8,
+    0x36a, 0x938, 0x581, 0x0, 0x0, 0x0, 0xb15, 0x0,
+    0x0, 0x735, 0x928, 0x78f, 0xaf4, 0xbc2, 0x0, 0x787,
+    0xf16, 0x0, 0x0, 0x5f2, 0x10de, 0x0, 0xcd3, 0x0,
+    0x8ff, 0x0, 0xffc, 0x0, 0x0, 0x446, 0x8d2, 0x0,
+    0x0, 0x9a0, 0x39c, 0xc60, 0x0, 0x0, 0x87d, 0x158,
+    0x0, 0x11d2, 0x0, 0x5ad, 0x0, 0x0, 0x2e7, 0x0,
+    0x0, 0x10b4, 0xd33, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x294, 0x0, 0x8d6, 0xddc, 0x0, 0x7fd, 0x80, 0xd6a,
+    0xc24, 0x1c8, 0x0, 0xd27, 0xa39, 0x0, 0x7d3, 0xc00,
+    0x0, 0x10, 0x0, 0x65f, 0x0, 0x110f, 0x0, 0x869,
+    0xf88, 0x0, 0x990, 0x902, 0x720, 0x0, 0x0, 0x0,
+    0x2bc, 0x0, 0x1d1, 0xbc5, 0xfe3, 0xc5a, 0x1059, 0x0,
+    0x472, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0, 0xf65,
+    0x528, 0xa12, 0x0, 0x0, 0x632, 0x716, 0x11d1, 0x90f,
+    0x448, 0x0, 0x0, 0xb06, 0x3c9, 0x0, 0xa7b, 0xf29,
+    0x2fc, 0x52f, 0xceb, 0x0, 0x6e4, 0x0, 0x926, 0x0,
+    0xb49, 0x2b8, 0x0, 0x1bf, 0x0, 0x740, 0x0, 0xb8c,
+    0xb99, 0x0, 0x0, 0x7c2, 0xeaf, 0x86a, 0x0, 0xf6d,
+    0x0, 0x0, 0xf05, 0x10c3, 0x11d5, 0xfe8, 0x0, 0x20f,
+    0x0, 0x0, 0xfe2, 0x0, 0xfb7, 0xd3c, 0xd73, 0x11a3,
+    0x1007, 0x4e8, 0x0, 0x11f0, 0xe3, 0x27b, 0x0, 0x0,
+    0x8e1, 0xdf3, 0x0, 0x0, 0x0, 0xbb0, 0x490, 0x0,
+    0xbe, 0x319, 0x10cf, 0x10c5, 0x0, 0x0, 0x1103, 0x0,
+    0x9fc, 0x0, 0xe6f, 0x0, 0x0, 0x0, 0xf97, 0x111b,
+    0x0, 0xa13, 0xf91, 0xaf5, 0xf59, 0x1022, 0x0, 0x0,
+    0x0, 0xf74, 0x2a7, 0xf02, 0x0, 0xd7e, 0x9d5, 0x105f,
+    0xb82, 0xbf, 0xe6a, 0x0, 0x0, 0x0, 0x8e7, 0x0,
+    0x643, 0x2, 0x0, 0x0, 0x0, 0x0, 0x84, 0x507,
+    0x115b, 0xc56, 0x0, 0xddf, 0x0, 0x824, 0x0, 0x37b,
+    0x7df, 0x0, 0x57, 0x4b5, 0x0, 0xda1, 0xda9, 0xd75,
+    0x585, 0x0, 0x0, 0x216, 0x0, 0xdc6, 0x0, 0x7f4,
+    0x0, 0x0, 0x0, 0x0, 0x111c, 0x0, 0x744, 0x5dd,
+    0xd39, 0x0, 0x0, 0x0, 0x53a, 0x0, 0xb77, 0xeba,
+    0x86, 0x0, 0x0, 0x7ee, 0xac8, 0x0, 0x514, 0x84c,
+    0x0, 0xb78, 0x278, 0x0, 0x0, 0x728, 0x0, 0x0,
+    0x0, 0x272, 0x96d, 0x0, 0xa7d, 0xed9, 0xbfb, 0x427,
+    0x11ec, 0xc74, 0x0, 0x0, 0xeb9, 0x90c, 0x0, 0x34f,
+    0x9f9, 0xbb7, 0x111e, 0x0, 0x0, 0xcba, 0x5db, 0x0,
+    0x1110, 0x0, 0x0, 0x703, 0x48, 0x357, 0xf72, 0xa07,
+    0x1108, 0x0, 0x0, 0xd67, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7b1, 0xb87, 0x9c1, 0x0, 0x935,
+    0xdc9, 0x578, 0x0, 0x509, 0x0, 0x3fb, 0xf48, 0xa1f,
+    0x0, 0x1063, 0x0, 0x6f2, 0x0, 0x0, 0x873, 0x7a5,
+    0xc92, 0xdd2, 0x0, 0xbec, 0x0, 0x3c5, 0x0, 0x1e2,
+    0x20c, 0x5e6, 0xed6, 0x0, 0xed0, 0xb0b, 0x206, 0x232,
+    0x922, 0x1070, 0x0, 0x0, 0x0, 0x0, 0x54f, 0x20b,
+    0x0, 0x0, 0x6f6, 0x63e, 0x9f, 0x0, 0x863, 0x0,
+    0x1089, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe6c, 0x0,
+    0x2f, 0x890, 0x6d1, 0x0, 0x3cf, 0x81b, 0x9b9, 0x0,
+    0x0, 0x1f6, 0x0, 0x2a6, 0x0, 0xd9c, 0x55, 0x0,
+    0x0, 0x812, 0x0, 0x0, 0xde4, 0x88f, 0x1aa, 0x0,
+    0x769, 0x1192, 0xcb7, 0xbaf, 0xdca, 0x0, 0x0, 0x14e,
+    0x0, 0x491, 0xf0a, 0x0, 0x0, 0xc6, 0x11d7, 0x0,
+    0x0, 0x5c6, 0x0, 0x0, 0x9c0, 0x0, 0x0, 0xa97,
+    0x118e, 0x0, 0x830, 0x83e, 0x0, 0x99e, 0x785, 0x5b0,
+    0x65c, 0x8af, 0x0, 0x1172, 0x5d4, 0x0, 0x665, 0x1029,
+    0x7c6, 0x985, 0x218, 0x0, 0x0, 0x0, 0x0, 0x8ad,
+    0xa10, 0xc36, 0x4a5, 0x570, 0xd4d, 0x0, 0xa01, 0x0,
+    0x0, 0x6e5, 0x4e2, 0x900, 0x160, 0x261, 0xe2, 0xb30,
+    0xd5b, 0x443, 0xa82, 0xde2, 0x0, 0xbdf, 0x733, 0x0,
+    0x992, 0xeb, 0x7b3, 0x0, 0x734, 0x0, 0x801, 0x6bf,
+    0x0, 0xa55, 0xd58, 0x0, 0x3e6, 0x0, 0xd80, 0x0,
+    0xdcf, 0x9b7, 0x978, 0x0, 0x0, 0x2fa, 0x4a2, 0x0,
+    0x321, 0x0, 0x182, 0x0, 0x0, 0x80b, 0x0, 0x0,
+    0x9a3, 0x0, 0x0, 0x3a0, 0x512, 0xa7a, 0x10d8, 0xe66,
+    0xc51, 0x310, 0x0, 0x0, 0x0, 0x5cc, 0x49f, 0x0,
+    0x0, 0x0, 0x0, 0xc5e, 0x0, 0xbd4, 0xecd, 0xbb5,
+    0xf52, 0xdad, 0x0, 0x973, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc70, 0x0, 0x7d8, 0x0, 0xd59,
+    0xcfb, 0x0, 0x4d0, 0x342, 0x2ca, 0xe4a, 0xe1b, 0x0,
+    0x0, 0x6c2, 0xd99, 0xef, 0x0, 0x9c9, 0x0, 0x0,
+    0x3e5, 0x0, 0xd1e, 0xb14, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x326, 0xf4a, 0x488, 0x0, 0x0, 0x7e9, 0x0,
+    0x0, 0xeaa, 0xd37, 0x7f9, 0xec4, 0xf69, 0x0, 0x0,
+    0x66a, 0x49, 0x166, 0x0, 0x325, 0x205, 0x0, 0x5c5,
+    0x11b9, 0x0, 0x8e2, 0x5fd, 0x1181, 0x0, 0x0, 0x201,
+    0x0, 0x0, 0x455, 0xbb, 0xc13, 0x0, 0x412, 0x0,
+    0x117c, 0xd87, 0x9d2, 0x8b, 0x0, 0x1a2, 0x0, 0x0,
+    0x76f, 0x0, 0x0, 0xa4e, 0xb72, 0x0, 0x0, 0x0,
+    0x0, 0x1174, 0x6ff, 0x0, 0x372, 0x0, 0x0, 0xa35,
+    0x3b, 0xc48, 0x8f8, 0xec7, 0x4ab, 0x110b, 0x0, 0x118,
+    0x0, 0x29b, 0xf08, 0x0, 0x0, 0x0, 0x0, 0x4f7,
+    0x0, 0x0, 0x11c6, 0x11dc, 0x0, 0x102, 0x0, 0x1161,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x47c, 0x0,
+    0x0, 0x0, 0xe4b, 0x950, 0xbe3, 0x0, 0x0, 0x576,
+};
+
+static const unsigned int slot_matches[] = {
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x0,
+    0x1, 0x1, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1,
+};
+
+static const unsigned int match_list[] = {
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0xb, 0xc, 0xd,
+};
+
+static const unsigned int type_first[] = {
+    0x0, 0x3, 0x6, 0x9, 0xa, 0xb,
+};
+
+static const unsigned int type_matches[] = {
+    0x3, 0x3, 0x3, 0x1, 0x1, 0x0,
+};
+
+static const unsigned int type_list[] = {
+    0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x7, 0x8,
+    0x9, 0xa, 0xe,
+};
+
+const DriverDbIndex driver_db_builtin = {
+    entries, 15,
+    displacements, 2048,
+    slot_keys, slot_first, slot_matches, 8192,
+    match_list, 4611,
+    type_first, type_matches, type_list, 11,
+};
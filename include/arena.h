@@ -0,0 +1,41 @@
+/*
+ * Scan arena header
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// Bump allocator plus string intern table. Everything taken from an arena is
+// released together by arena_destroy(). An arena is used by one thread at a time.
+typedef struct Arena Arena;
+
+// Create an empty arena (NULL if out of memory)
+Arena *arena_create(void);
+
+// Free an arena and everything allocated from it (NULL is ignored)
+void arena_destroy(Arena *arena);
+
+// Allocate zeroed, pointer-aligned memory (NULL if out of memory)
+void *arena_alloc(Arena *arena, size_t size);
+
+// Resize an allocation, in place when it is the most recent one.
+// The old block is not reclaimed until the arena is destroyed.
+void *arena_grow(Arena *arena, void *ptr, size_t old_size, size_t new_size);
+
+// Get the arena's copy of a string; equal strings share one copy.
+// Never returns NULL: "" stands in when out of memory.
+const char *arena_intern(Arena *arena, const char *str);
+
+// Same as arena_intern() for the first len bytes of str
+const char *arena_intern_len(Arena *arena, const char *str, size_t len);
+
+// Intern a formatted string
+const char *arena_printf(Arena *arena, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+
+// Bytes of memory the arena holds
+size_t arena_size(const Arena *arena);
+
+#endif // ARENA_H
@@ -0,0 +1,72 @@
+/*
+ * Privileged helper protocol header
+ */
+
+#ifndef BACKEND_H
+#define BACKEND_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "hardware.h"
+#include "driver.h"
+
+// Socket the helper listens on (created by the systemd socket unit)
+#define BACKEND_SOCKET_DEFAULT "/run/system-drivers.sock"
+
+// polkit action an unprivileged client needs to install through the helper
+#define BACKEND_INSTALL_ACTION "org.archlinux.system-drivers.install"
+
+// polkit action for downloading packages while the user confirms (no prompt)
+#define BACKEND_PREFETCH_ACTION "org.archlinux.system-drivers.prefetch"
+
+// Longest request or reply line
+#define BACKEND_LINE_MAX 4096
+
+// Kinds of reply line during an install
+typedef enum {
+    BACKEND_LINE_OUTPUT,        // A line of the install's output
+    BACKEND_LINE_EXIT,          // The install finished with an exit code
+    BACKEND_LINE_ERROR,         // The helper refused or failed the request
+    BACKEND_LINE_INVALID
+} BackendLineKind;
+
+// Connect to the helper; -1 if it isn't running
+int backend_connect(const char *socket_path);
+
+// Check whether a helper is listening on a socket
+bool backend_available(const char *socket_path);
+
+// Get the helper's scan results into arena. It keeps them warm and only rescans
+// when hardware or packages changed, or when rescan is set.
+// Returns the driver count (*hw_count receives the hardware count), -1 on error.
+int backend_query(const char *socket_path, bool rescan, Arena *arena,
+                  HardwareInfo **hw_list, int *hw_count, DriverInfo **driver_list);
+
+// Ask the helper to install a batch in one transaction, with our sync TTL.
+// Returns the connected socket; its reply lines go through
+// backend_parse_install_line(). -1 on error.
+int backend_install_start(const char *socket_path, DriverInfo **drivers, int count);
+
+// Ask the helper to download a batch's packages into its package cache
+// (pacman -Sw) while the user confirms the install. Replies and cancelling are
+// as for an install; the INSTALL has to wait for its X line. -1 on error.
+int backend_prefetch_start(const char *socket_path, DriverInfo **drivers, int count);
+
+// Classify an install reply line (without its newline). *text points into line.
+BackendLineKind backend_parse_install_line(const char *line, const char **text, int *exit_code);
+
+// Ask a running install to stop (pacman gets SIGINT)
+bool backend_install_cancel(int fd);
+
+// Install a batch through the helper and wait, copying its output to log.
+// Returns true if the transaction succeeded.
+bool backend_install(const char *socket_path, DriverInfo **drivers, int count, FILE *log);
+
+// Helper side: send scan results in reply to a query
+bool backend_send_results(int fd, const HardwareInfo *hw_list, int hw_count,
+                          const DriverInfo *driver_list, int driver_count);
+
+// Helper side: send one formatted reply line (the newline is added)
+bool backend_send_line(int fd, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+#endif // BACKEND_H
@@ -8,28 +8,165 @@
 #include <stdbool.h>
 #include "hardware.h"
 
-// Driver info structure
+// Whether a driver's packages can be installed from the configured repositories
+typedef enum {
+    DRIVER_AVAILABILITY_UNKNOWN,    // No sync database could tell (never synced, unreadable)
+    DRIVER_AVAILABLE,
+    DRIVER_UNAVAILABLE              // A package is in none of the repositories
+} DriverAvailability;
+
+// Driver info structure. Strings are never NULL and live in the arena the
+// driver was detected into, like those of HardwareInfo.
 typedef struct {
-    char name[128];
-    char package[128];
-    char version[32];
-    char description[256];
+    const char *name;
+    const char *package;        // Space-separated package list, also the driver's id
+    const char *version;        // Installed version, or "Not installed"
+    const char *description;
     HardwareType hw_type;
     bool is_installed;
     bool is_recommended;
     bool needs_reboot;
+
+    // From the sync databases (see annotate_driver_availability())
+    DriverAvailability availability;
+    const char *repo_version;   // Repository version of the first package, "" if unknown
+    const char *repository;     // Repository it comes from, "" if unknown
+    unsigned long long download_size;   // Bytes to download for the packages not installed
+    bool update_available;      // Installed, and the repository has a newer version
 } DriverInfo;
 
-// Detect available drivers for hardware
-int detect_drivers(HardwareInfo *hw_list, int hw_count, DriverInfo **driver_list);
+// Steps of an install transaction
+typedef enum {
+    INSTALL_STEP_SYNC,
+    INSTALL_STEP_INSTALL,
+    INSTALL_STEP_INITRAMFS
+} InstallStepKind;
+
+// One external command of an install transaction
+typedef struct {
+    InstallStepKind kind;
+    const char *title;
+    char **argv;        // NULL-terminated, no shell involved
+    bool required;      // false: a failure only produces a warning
+} InstallStep;
+
+// Detect available drivers for hardware; the list and its strings come from arena
+int detect_drivers(Arena *arena, HardwareInfo *hw_list, int hw_count, DriverInfo **driver_list);
+
+// Look the drivers' packages up in the sync databases and fill in availability,
+// repository version, download size and update_available. The index is read
+// once and kept until a database changes. detect_drivers() calls this already;
+// call it again for drivers that come from a cache.
+void annotate_driver_availability(Arena *arena, DriverInfo *drivers, int count);
+
+// Get the first driver of a batch that is not in the repositories (NULL if none).
+// Installing such a batch would fail, so it is never attempted.
+const DriverInfo *find_unavailable_driver(DriverInfo **drivers, int count);
+
+// Copy a driver, interning its strings into another arena
+void copy_driver_info(Arena *arena, DriverInfo *dest, const DriverInfo *src);
+
+// Check whether any device in a hardware list still calls for a driver
+bool driver_matches_hardware(const DriverInfo *driver, const HardwareInfo *hw_list, int hw_count);
 
-// Install a driver
+// Install a driver: a one-driver install_drivers() batch
 bool install_driver(DriverInfo *driver);
 
+// Install several drivers as one transaction: one database sync, one pacman
+// invocation (or libalpm transaction, see package_txn.h) and at most one
+// initramfs rebuild
+bool install_drivers(DriverInfo **drivers, int count);
+
+// Build the commands install_drivers() runs, for callers that run them themselves
+int build_install_plan(DriverInfo **drivers, int count, InstallStep **steps);
+
+// Free an install plan
+void free_install_plan(InstallStep *steps, int count);
+
+// Build the pacman command that downloads a batch's packages into the package
+// cache without installing them (-Sw, against the databases as they are: if
+// the install's sync brings newer versions, it downloads those itself).
+// Free with free_argv().
+char **build_prefetch_argv(DriverInfo **drivers, int count);
+
+// Free an argv built by build_install_plan() or build_prefetch_argv()
+void free_argv(char **argv);
+
+// Delete the partial downloads (<file>.part) an interrupted prefetch left in the
+// package cache: only those of packages (space-separated, as from
+// merge_driver_packages()) and their dependencies, as `pacman -Sp` names them.
+// Returns how many were removed, -1 if the file names could not be listed.
+int remove_partial_downloads(const char *packages);
+
+// Get the package cache directory pacman is pointed at
+void get_package_cache_dir(char *dir, size_t size);
+
+// Merge the packages of several drivers into one space-separated list (caller frees)
+char *merge_driver_packages(DriverInfo **drivers, int count);
+
+// Check whether any driver in a batch needs a reboot
+bool drivers_need_reboot(DriverInfo **drivers, int count);
+
+// Record a successful install transaction
+void mark_drivers_installed(DriverInfo **drivers, int count);
+
 // Check if driver is installed
 bool is_driver_installed(const char *package_name);
 
-// Free driver list
-void free_driver_list(DriverInfo *driver_list, int count);
+// Re-read the installed package snapshot used by is_driver_installed()
+bool refresh_installed_packages(void);
+
+// Override the pacman local database directory (NULL restores the default)
+void set_pacman_db_path(const char *path);
+
+// Get the pacman local database directory
+const char *get_pacman_db_path(void);
+
+// Set the root packages are installed into (NULL restores "/"). Outside "/"
+// the initramfs is not rebuilt.
+void set_install_root(const char *root);
+
+// Get the installation root
+const char *get_install_root(void);
+
+// Override the pacman.conf the repositories are read from (NULL restores the default)
+void set_pacman_conf_path(const char *path);
+
+// Get the pacman.conf the repositories are read from
+const char *get_pacman_conf_path(void);
+
+// Check whether installs need root: always, unless they run in-process
+// (libalpm) into another root
+bool install_requires_root(void);
+
+// Why the last install_drivers() failed: a package_txn_error_name() ("conflict",
+// "signature"...), "permission", or "failed" when pacman only gave an exit code.
+// "" after a success.
+const char *get_install_error(void);
+
+// How long synced package databases count as fresh by default, in seconds
+#define SYNC_TTL_DEFAULT (15 * 60)
+
+// Set how long synced package databases count as fresh: install transactions
+// skip `pacman -Sy` while every database in <dbpath>/sync is younger than
+// this, or this session synced more recently. 0 always syncs.
+void set_sync_ttl(int seconds);
+
+// Get the sync TTL in seconds
+int get_sync_ttl(void);
+
+// Seconds since the package databases were last synced; -1 if never
+long package_sync_age(void);
+
+// Check whether an install transaction has to sync the package databases first
+bool package_sync_needed(void);
+
+// Record a successful package database sync (shared by the whole session)
+void mark_packages_synced(void);
+
+// Called by every mark_packages_synced(), so a forked install can pass the
+// sync on to its parent; NULL for none
+typedef void (*PackagesSyncedFunc)(void *user_data);
+void set_packages_synced_func(PackagesSyncedFunc func, void *user_data);
 
 #endif // DRIVER_H
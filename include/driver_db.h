@@ -0,0 +1,107 @@
+/*
+ * Driver database header
+ *
+ * Maps PCI vendor:device IDs and hardware types to driver packages. The
+ * built-in table is compiled from data/drivers.conf at build time; an
+ * optional system-wide override file in the same format is read at runtime.
+ */
+
+#ifndef DRIVER_DB_H
+#define DRIVER_DB_H
+
+#include <stdbool.h>
+#include "hardware.h"
+
+// System-wide override file, consulted before the built-in table
+#define DRIVER_DB_OVERRIDE_DEFAULT "/etc/system-drivers/drivers.conf"
+
+// Wildcard vendor/device ID
+#define DRIVER_DB_ANY_ID 0xffffu
+
+// Largest device ID range a single entry may cover (ranges are expanded into the index)
+#define DRIVER_DB_MAX_RANGE 0x4000u
+
+// Upper bound on the entries matching one device
+#define DRIVER_DB_MAX_MATCHES 32
+
+// Driver database entry - maps hardware to driver packages
+typedef struct {
+    unsigned int vendor_id;     // DRIVER_DB_ANY_ID: any device of hw_type
+    unsigned int device_first;  // DRIVER_DB_ANY_ID: any device of the vendor
+    unsigned int device_last;
+    HardwareType hw_type;
+    const char *package_name;
+    const char *driver_name;
+    const char *description;
+    bool needs_reboot;
+    bool is_recommended;
+} DriverMapping;
+
+// Entries plus a perfect hash over the (vendor << 16 | device) keys they cover.
+// Vendor-wide entries use the key (vendor << 16 | DRIVER_DB_ANY_ID); type-wide
+// entries are listed per hardware type.
+typedef struct {
+    const DriverMapping *entries;
+    unsigned int entry_count;
+
+    // Hash and displace: bucket = mix(key, 0) % bucket_count,
+    // slot = mix(key, displacements[bucket] + 1) % slot_count
+    const unsigned int *displacements;
+    unsigned int bucket_count;
+    const unsigned int *slot_keys;      // 0xffffffff marks an empty slot
+    const unsigned int *slot_first;     // First index into match_list
+    const unsigned int *slot_matches;   // Number of entries for the key
+    unsigned int slot_count;            // Power of two
+
+    const unsigned int *match_list;     // Entry indices, ascending per key
+    unsigned int match_count;
+
+    const unsigned int *type_first;     // Per HardwareType, into type_list
+    const unsigned int *type_matches;
+    const unsigned int *type_list;
+    unsigned int type_list_count;
+} DriverDbIndex;
+
+// A parsed driver database file (strings point into text)
+typedef struct {
+    DriverMapping *entries;
+    int count;
+    char *text;
+} DriverDbFile;
+
+// Parse a driver database file; errors are reported with file:line on stderr
+bool driver_db_file_load(const char *path, DriverDbFile *file);
+
+// Free a parsed file
+void driver_db_file_free(DriverDbFile *file);
+
+// Build the lookup index for a set of entries (arrays are malloc'ed)
+bool driver_db_index_build(const DriverMapping *entries, unsigned int count, DriverDbIndex *index);
+
+// Free an index created by driver_db_index_build()
+void driver_db_index_free(DriverDbIndex *index);
+
+// Collect the entries of one index matching a device, in file order
+int driver_db_index_lookup(const DriverDbIndex *index, const HardwareInfo *hw,
+                           const DriverMapping **matches, int max_matches);
+
+// Hash used by the index (shared with the table generator)
+unsigned int driver_db_hash(unsigned int key, unsigned int seed);
+
+// Hardware type names used in database files
+const char *driver_db_type_name(HardwareType type);
+
+// Collect all entries matching a device: the override file's first, then the
+// built-in ones no override entry replaces (same match column and type)
+int driver_db_match(const HardwareInfo *hw, const DriverMapping **matches, int max_matches);
+
+// Re-read the override file if it changed; returns false if it exists but can't be parsed
+bool driver_db_reload(void);
+
+// Hash of the built-in entries and the override file's identity, for caches
+unsigned long long driver_db_fingerprint(void);
+
+// Use another override file (NULL restores the default)
+void set_driver_db_override_path(const char *path);
+
+#endif // DRIVER_DB_H
@@ -0,0 +1,73 @@
+/*
+ * Driver list model header - the GListModel behind the GUI's driver list
+ */
+
+#ifndef DRIVER_LIST_H
+#define DRIVER_LIST_H
+
+#include <stdbool.h>
+#include <gio/gio.h>
+#include "driver.h"
+
+// Which drivers the list shows
+typedef struct {
+    bool recommended_only;
+    bool not_installed_only;
+    int hw_type;                // A HardwareType, or -1 for every type
+} DriverListFilter;
+
+// Order of the shown drivers (ties keep detection order)
+typedef enum {
+    DRIVER_LIST_SORT_DETECTION,
+    DRIVER_LIST_SORT_NAME,
+    DRIVER_LIST_SORT_TYPE,
+    DRIVER_LIST_SORT_STATUS     // Installable first, then updates, installed, unavailable
+} DriverListSort;
+
+// One driver of the list, kept across refreshes by its package set. It emits
+// "changed" when the driver data it shows changed.
+#define DRIVER_TYPE_ITEM (driver_item_get_type())
+G_DECLARE_FINAL_TYPE(DriverItem, driver_item, DRIVER, ITEM, GObject)
+
+// The drivers to show, filtered and sorted: a GListModel of DriverItem
+#define DRIVER_TYPE_LIST (driver_list_get_type())
+G_DECLARE_FINAL_TYPE(DriverList, driver_list, DRIVER, LIST, GObject)
+
+// Package set identifying the item's driver
+const char *driver_item_get_key(DriverItem *item);
+
+// The item's current driver data (strings live in the arena of the last update)
+const DriverInfo *driver_item_get_driver(DriverItem *item);
+
+// Whether the driver can be installed: not installed, and not missing from
+// the repositories
+bool driver_item_get_installable(DriverItem *item);
+
+// Selection for batch installs; it is kept while the item is filtered out and
+// dropped once the driver can no longer be installed
+bool driver_item_get_selected(DriverItem *item);
+void driver_item_set_selected(DriverItem *item, bool selected);
+
+// Create an empty list
+DriverList *driver_list_new(void);
+
+// Take over new driver data, matching items by package set. The strings of
+// the previous data must stay valid until this returns, as they are compared.
+// Only the changed part of the shown list is reported through items-changed.
+void driver_list_update(DriverList *list, const DriverInfo *drivers, int count,
+                        int *added, int *changed, int *removed);
+
+// Change which drivers are shown or their order
+void driver_list_set_filter(DriverList *list, const DriverListFilter *filter);
+void driver_list_set_sort(DriverList *list, DriverListSort sort);
+
+// Number of drivers before filtering
+guint driver_list_get_total(DriverList *list);
+
+// Item of a driver by package set, shown or not (NULL if none; not a new reference)
+DriverItem *driver_list_lookup(DriverList *list, const char *package);
+
+// Item by detection order, shown or not (NULL past the end; not a new reference)
+DriverItem *driver_list_get_nth(DriverList *list, guint index);
+
+#endif // DRIVER_LIST_H
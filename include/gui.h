@@ -10,6 +10,10 @@
 // Main window creation
 GtkWidget* create_main_window(void);
 
+// Scan and install through the system helper listening on socket_path
+// instead of in-process (call before create_main_window)
+void gui_set_backend(const char *socket_path);
+
 // Driver list management
 void refresh_driver_list(GtkWidget *list_box);
 void on_refresh_clicked(GtkButton *button, gpointer user_data);
@@ -6,6 +6,10 @@
 #define HARDWARE_H
 
 #include <stdbool.h>
+#include "arena.h"
+
+// Default sysfs mount point used by scan_hardware()
+#define SYSFS_DEFAULT_ROOT "/sys"
 
 // Hardware types
 typedef enum {
@@ -17,18 +21,72 @@ typedef enum {
     HW_UNKNOWN
 } HardwareType;
 
-// Hardware info structure
+// Bus a device sits on (IDs are only comparable within one bus)
+typedef enum {
+    HW_BUS_PCI,
+    HW_BUS_USB
+} HardwareBus;
+
+// Hardware info structure. Strings are never NULL; they live in the arena
+// the device was scanned into (or are string literals), so records copy cheaply.
+// A record stands for a group of identical functions (same IDs, subsystem
+// and class), e.g. the ports of a multi-port NIC or several identical GPUs.
 typedef struct {
     HardwareType type;
-    char vendor[128];
-    char device[128];
-    char pci_id[32];
+    HardwareBus bus;
+    const char *vendor;
+    const char *device;
+    const char *pci_id;            // Bus address of the first function (USB: sysfs interface name)
+    const char *modalias;
+
+    // Functions of the group
+    int count;                     // At least 1
+    const char *addresses;         // Their bus addresses, space-separated, pci_id first
+    int virtual_functions;         // SR-IOV VFs of these functions, folded in (not in addresses)
+
+    // Numeric IDs (zero when the device came from the lspci fallback)
+    unsigned int vendor_id;
+    unsigned int device_id;
+    unsigned int subsys_vendor_id;
+    unsigned int subsys_device_id;
+    unsigned int class_code;       // 0xBBSSPP: base class, subclass, prog-if
 } HardwareInfo;
 
-// Scan system for hardware
-int scan_hardware(HardwareInfo **hw_list);
+// Scan system for hardware (sysfs first, lspci as fallback). Returns the
+// number of groups; the list and its strings are allocated from arena.
+int scan_hardware(Arena *arena, HardwareInfo **hw_list);
+
+// Scan PCI devices below <sysfs_root>/bus/pci/devices, grouped, with SR-IOV
+// virtual functions (those with a physfn link) folded into their parent.
+// Returns -1 if the sysfs tree cannot be read or memory runs out
+int scan_hardware_sysfs(Arena *arena, const char *sysfs_root, HardwareInfo **hw_list);
+
+// Read a single PCI device (e.g. "0000:01:00.0") as a group of one; false if
+// absent, not of interest, or a virtual function
+bool scan_pci_device(Arena *arena, const char *sysfs_root, const char *address, HardwareInfo *hw);
+
+// Scan PCI devices by parsing lspci output, grouping identical lines
+int scan_hardware_lspci(Arena *arena, HardwareInfo **hw_list);
+
+// Check whether two records describe identical functions (same group)
+bool hardware_same_group(const HardwareInfo *a, const HardwareInfo *b);
+
+// Check whether a bus address belongs to a group
+bool hardware_has_address(const HardwareInfo *hw, const char *address);
+
+// Add a function to a group, or remove one (the group keeps pci_id valid).
+// Strings are rebuilt in arena; false when out of memory or not found.
+bool hardware_add_address(Arena *arena, HardwareInfo *hw, const char *address);
+bool hardware_remove_address(Arena *arena, HardwareInfo *hw, const char *address);
+
+// Override the sysfs root used by scan_hardware() (NULL restores the default)
+void set_sysfs_root(const char *sysfs_root);
+
+// Use another pci.ids for device names, and another place for its index
+// ("" for none). NULL restores the defaults. Takes effect on the next lookup.
+void set_pci_ids_path(const char *path, const char *index_path);
 
-// Free hardware list
-void free_hardware_list(HardwareInfo *hw_list, int count);
+// Get the sysfs root used by scan_hardware()
+const char *get_sysfs_root(void);
 
 #endif // HARDWARE_H
@@ -0,0 +1,22 @@
+/*
+ * Hotplug monitoring header - kernel uevents on the GLib main loop
+ */
+
+#ifndef HOTPLUG_H
+#define HOTPLUG_H
+
+#include <glib.h>
+#include <stdbool.h>
+#include "uevent.h"
+
+// Called on the main loop with the PCI/USB add and remove events of a burst,
+// UEVENT_DEBOUNCE_MS after its last event (see UeventQueue)
+typedef void (*HotplugFunc)(const UeventQueue *burst, gpointer user_data);
+
+// Start listening for kernel uevents; false if the netlink socket can't be opened
+bool hotplug_start(HotplugFunc callback, gpointer user_data);
+
+// Stop listening; a burst not handled yet is dropped
+void hotplug_stop(void);
+
+#endif // HOTPLUG_H
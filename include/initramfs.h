@@ -0,0 +1,75 @@
+/*
+ * Initramfs rebuild header
+ */
+
+#ifndef INITRAMFS_H
+#define INITRAMFS_H
+
+#include <stdbool.h>
+#include "driver.h"
+
+// mkinitcpio configuration and kernel module locations (below the initramfs root)
+#define MKINITCPIO_PRESET_DIR "/etc/mkinitcpio.d"
+#define MKINITCPIO_CONFIG "/etc/mkinitcpio.conf"
+#define MKINITCPIO_CONFIG_DROPIN_DIR "/etc/mkinitcpio.conf.d"
+#define KERNEL_MODULES_DIR "/usr/lib/modules"
+
+// Most presets considered; more than this and everything is rebuilt with -P
+#define INITRAMFS_MAX_PRESETS 32
+
+// A preset that needs its images regenerated, and why
+typedef struct {
+    char name[64];                  // Preset name, e.g. "linux-lts"
+    char reason[128];
+} InitramfsPreset;
+
+// Presets an install transaction requires rebuilding
+typedef struct {
+    int count;                      // -1: presets unknown, fall back to mkinitcpio -P
+    int total;                      // Presets found
+    InitramfsPreset presets[INITRAMFS_MAX_PRESETS];
+} InitramfsSelection;
+
+// The pacman local database before a transaction, to tell which packages
+// it added or upgraded (dependencies included)
+typedef struct {
+    char **entries;                 // "<name>-<pkgver>-<pkgrel>", sorted
+    char *names;                    // The block the entries point into
+    int count;                      // -1: the database couldn't be read
+} InitramfsSnapshot;
+
+// Outcome of one preset rebuild
+typedef struct {
+    char preset[64];
+    int exit_code;                  // -1 if mkinitcpio could not be started
+    double seconds;
+    char *output;                   // Merged stdout/stderr (may be NULL)
+} InitramfsResult;
+
+// Record the local database's entries before a transaction (replacing what
+// the snapshot held; start from { NULL, NULL, -1 })
+void initramfs_snapshot_take(InitramfsSnapshot *snapshot);
+
+// Free a snapshot
+void initramfs_snapshot_free(InitramfsSnapshot *snapshot);
+
+// Work out which presets include modules or module configuration from the
+// packages a transaction added or upgraded: the local database entries that
+// are not in the snapshot taken before it. Packages whose file lists can't be
+// read count as touching every preset; without a snapshot the presets are
+// unknown (count -1).
+void initramfs_select_presets(const InitramfsSnapshot *before, InitramfsSelection *selection);
+
+// Rebuild the selected presets in parallel (one mkinitcpio -p per preset, at most
+// one per CPU). Returns the number of results; *results is freed with
+// initramfs_results_free().
+int initramfs_rebuild(const InitramfsSelection *selection, InitramfsResult **results);
+
+// Free rebuild results
+void initramfs_results_free(InitramfsResult *results, int count);
+
+// Look for mkinitcpio configuration and kernel modules below another root
+// (NULL restores "/")
+void set_initramfs_root(const char *root);
+
+#endif // INITRAMFS_H
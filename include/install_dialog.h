@@ -0,0 +1,45 @@
+/*
+ * Install progress dialog header
+ */
+
+#ifndef INSTALL_DIALOG_H
+#define INSTALL_DIALOG_H
+
+#include <gtk/gtk.h>
+#include <stdbool.h>
+#include "driver.h"
+
+// Maximum number of output lines kept in the log view
+#define INSTALL_LOG_MAX_LINES 2000
+
+// Called on the main loop once the user closes a finished install dialog
+typedef void (*InstallFinishedFunc)(bool success, bool cancelled, gpointer user_data);
+
+// Background download of a batch's packages into the package cache, started
+// while the user is still deciding whether to install
+typedef struct InstallPrefetch InstallPrefetch;
+
+// Start downloading a batch's packages (pacman -Sw, in the system helper if
+// set_install_backend() named one); NULL if it couldn't start (always without
+// root and without the helper).
+// Hand the result to run_install_dialog() or install_prefetch_cancel().
+InstallPrefetch *install_prefetch_start(DriverInfo **drivers, int count);
+
+// Discard a prefetch: interrupt the download and delete its partial files once
+// it has stopped (NULL is ignored)
+void install_prefetch_cancel(InstallPrefetch *prefetch);
+
+// Run installs through the system helper listening on socket_path instead of
+// spawning pacman ourselves (NULL restores that); the user authorizes each
+// install through polkit
+void set_install_backend(const char *socket_path);
+
+// Install drivers in a modal dialog that streams command output, shows progress
+// and allows cancelling, without blocking the main loop. The drivers are copied.
+// A prefetch (may be NULL) is taken over: the install waits for it to finish,
+// since pacman holds the database lock, and then finds the packages cached.
+void run_install_dialog(GtkWidget *parent, DriverInfo **drivers, int count,
+                        InstallPrefetch *prefetch,
+                        InstallFinishedFunc callback, gpointer user_data);
+
+#endif // INSTALL_DIALOG_H
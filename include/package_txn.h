@@ -0,0 +1,102 @@
+/*
+ * In-process package transactions (libalpm) header
+ */
+
+#ifndef PACKAGE_TXN_H
+#define PACKAGE_TXN_H
+
+#include <stdbool.h>
+
+// What a transaction reports while it runs
+typedef enum {
+    PACKAGE_TXN_EVENT_DB_SYNC,      // name: repository whose database is refreshed
+    PACKAGE_TXN_EVENT_TARGETS,      // name: "pkg-version ..." to install; current: their
+                                    // count, total: bytes to download
+    PACKAGE_TXN_EVENT_DOWNLOAD,     // name: file; current/total: bytes
+    PACKAGE_TXN_EVENT_INSTALL,      // name: package, action: "installing", "upgrading"...;
+                                    // current/total: package number
+    PACKAGE_TXN_EVENT_HOOK,         // name: hook description; current/total: hook number
+    PACKAGE_TXN_EVENT_MESSAGE       // name: install scriptlet output, or a libalpm warning
+                                    // (action "warning") or error (action "error")
+} PackageTxnEventKind;
+
+typedef struct {
+    PackageTxnEventKind kind;
+    const char *name;
+    const char *action;             // "" unless stated above
+    int percent;                    // Progress of this item, -1 if unknown
+    unsigned long long current;
+    unsigned long long total;
+} PackageTxnEvent;
+
+typedef void (*PackageTxnProgress)(const PackageTxnEvent *event, void *user_data);
+
+// Why a transaction failed
+typedef enum {
+    PACKAGE_TXN_OK,
+    PACKAGE_TXN_ERR_UNSUPPORTED,    // Built without libalpm
+    PACKAGE_TXN_ERR_SETUP,          // Root, database directory or pacman.conf unusable
+    PACKAGE_TXN_ERR_LOCKED,         // Another pacman holds the database lock
+    PACKAGE_TXN_ERR_SYNC,           // A repository database could not be refreshed
+    PACKAGE_TXN_ERR_NOT_FOUND,      // A package is in none of the repositories
+    PACKAGE_TXN_ERR_DEPENDENCY,     // A dependency can't be satisfied
+    PACKAGE_TXN_ERR_CONFLICT,       // Conflicting packages, or files that exist already
+    PACKAGE_TXN_ERR_SIGNATURE,      // Missing, invalid or untrusted signature, bad checksum
+    PACKAGE_TXN_ERR_DOWNLOAD,       // Packages could not be retrieved
+    PACKAGE_TXN_ERR_DISK_SPACE,     // Not enough free space to install
+    PACKAGE_TXN_ERR_INTERRUPTED,    // SIGINT before or during the commit
+    PACKAGE_TXN_ERR_COMMIT          // Anything else while installing
+} PackageTxnError;
+
+// Outcome of a step
+typedef struct {
+    PackageTxnError error;
+    char message[256];              // libalpm's description of the error
+    char *details;                  // One problem per line (the missing packages,
+                                    // conflicts, files...), or NULL
+    int installed;                  // Packages installed or upgraded
+    int up_to_date;                 // Packages skipped as already current (--needed)
+} PackageTxnResult;
+
+// Where a transaction works
+typedef struct {
+    const char *root;               // Installation root ("/")
+    const char *dbpath;             // Database directory, parent of local/ and sync/
+    const char *cachedir;           // Package cache
+    const char *pacman_conf;        // Repositories, their servers and SigLevel
+    PackageTxnProgress progress;    // May be NULL
+    void *user_data;
+} PackageTxnOptions;
+
+// A libalpm handle with the repositories of pacman.conf registered
+typedef struct PackageTxn PackageTxn;
+
+// Whether transactions run in-process (built with make WITH_ALPM=1). If not,
+// installs run pacman instead.
+bool package_txn_supported(void);
+
+// Set up a handle; NULL with result filled in on failure. Until it is
+// closed SIGINT no longer terminates the process: it stops the transaction
+// where libalpm can stop it (see PACKAGE_TXN_ERR_INTERRUPTED).
+PackageTxn *package_txn_open(const PackageTxnOptions *options, PackageTxnResult *result);
+
+// Refresh the repository databases, like pacman -Sy
+bool package_txn_sync(PackageTxn *txn, PackageTxnResult *result);
+
+// Install space-separated packages (or packages providing them) with their
+// dependencies as one transaction, like pacman -S --needed --noconfirm
+// --overwrite '*'. Questions get pacman's default answers; conflicts are not
+// resolved by removing packages.
+bool package_txn_install(PackageTxn *txn, const char *packages, PackageTxnResult *result);
+
+// Release the handle (NULL is ignored), restore the SIGINT handler and
+// raise a SIGINT received meanwhile
+void package_txn_close(PackageTxn *txn);
+
+// Free a result's details and reset it
+void package_txn_result_clear(PackageTxnResult *result);
+
+// Short name of an error ("conflict", "signature"...), for machine-readable output
+const char *package_txn_error_name(PackageTxnError error);
+
+#endif // PACKAGE_TXN_H
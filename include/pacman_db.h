@@ -0,0 +1,34 @@
+/*
+ * Pacman local database reader header
+ */
+
+#ifndef PACMAN_DB_H
+#define PACMAN_DB_H
+
+#include <stdbool.h>
+
+// Default location of the pacman local (installed packages) database
+#define PACMAN_LOCAL_DB_DEFAULT "/var/lib/pacman/local"
+
+// Default package cache (pacman's CacheDir)
+#define PACMAN_CACHE_DIR_DEFAULT "/var/cache/pacman/pkg"
+
+// Snapshot of installed packages: package name -> version
+typedef struct PacmanDb PacmanDb;
+
+// Read every <local_db_path>/*/desc once; returns NULL if the directory can't be read
+PacmanDb *pacman_db_load(const char *local_db_path);
+
+// Look up the installed version of a package (NULL if not installed)
+const char *pacman_db_get_version(const PacmanDb *db, const char *package_name);
+
+// Check whether a package is installed
+bool pacman_db_has_package(const PacmanDb *db, const char *package_name);
+
+// Number of installed packages in the snapshot
+int pacman_db_count(const PacmanDb *db);
+
+// Free a snapshot
+void pacman_db_free(PacmanDb *db);
+
+#endif // PACMAN_DB_H
@@ -0,0 +1,38 @@
+/*
+ * PCI ID database (pci.ids) name lookup header
+ */
+
+#ifndef PCI_IDS_H
+#define PCI_IDS_H
+
+#include <stddef.h>
+
+// Where hwdata installs the database, and where its index is cached
+#define PCI_IDS_DEFAULT_PATH "/usr/share/hwdata/pci.ids"
+#define PCI_IDS_INDEX_DEFAULT_PATH "/var/cache/system-drivers/pci-ids.index"
+
+// A memory-mapped pci.ids with a sorted index of its vendor and device lines.
+// Names are read from the mapping on lookup; the file is never parsed into
+// strings.
+typedef struct PciIds PciIds;
+
+// Map the database at path and load its index from index_path if that still
+// matches the file (size and mtime). Otherwise the index is built with one
+// pass over the file and saved to index_path; NULL or "" only builds it.
+// Returns NULL if the database can't be read.
+PciIds *pci_ids_open(const char *path, const char *index_path);
+
+// Name of a vendor, or of a device of a vendor. Points into the mapping, so it
+// is not NUL-terminated: *len receives its length. NULL if the ID is not listed.
+const char *pci_ids_vendor(const PciIds *ids, unsigned int vendor_id, size_t *len);
+const char *pci_ids_device(const PciIds *ids, unsigned int vendor_id, unsigned int device_id,
+                           size_t *len);
+
+// Number of vendors and devices indexed
+int pci_ids_vendor_count(const PciIds *ids);
+int pci_ids_device_count(const PciIds *ids);
+
+// Unmap the database and free the index (NULL is ignored)
+void pci_ids_close(PciIds *ids);
+
+#endif // PCI_IDS_H
@@ -6,11 +6,21 @@
 #define PRIVILEGE_H
 
 #include <stdbool.h>
+#include <sys/types.h>
 
 // Check if running as root
 bool is_root(void);
 
-// Drop privileges if needed
+// Drop privileges if needed: a root process started through sudo or pkexec
+// becomes the invoking user (exits if that fails half-way)
 void drop_privileges(void);
 
+// Get the uid and pid of the process on the other end of a Unix socket
+bool get_peer_credentials(int fd, uid_t *uid, pid_t *pid);
+
+// Check that the peer of a Unix socket may perform a polkit action: root
+// always may, anyone else is asked through pkcheck (interactively, if the
+// peer's session has an authentication agent)
+bool authorize_peer(int fd, const char *action_id);
+
 #endif // PRIVILEGE_H
@@ -0,0 +1,64 @@
+/*
+ * External command execution header
+ */
+
+#ifndef PROC_H
+#define PROC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+// Captured output kept per stream; anything beyond is read and dropped
+#define PROC_OUTPUT_MAX (16 * 1024 * 1024)
+
+// What to do with a command's stdout/stderr (stdin is always /dev/null)
+typedef enum {
+    PROC_INHERIT = 0,               // Both go where ours go
+    PROC_CAPTURE_STDOUT = 1 << 0,
+    PROC_CAPTURE_STDERR = 1 << 1,
+    PROC_MERGE_STDERR = 1 << 2      // stderr into the stdout pipe (with CAPTURE_STDOUT)
+} ProcFlags;
+
+// Outcome of a finished command
+typedef struct {
+    int status;         // waitpid() status, -1 if it could not be started
+    int exit_code;      // Exit code; 128 + signal if killed; -1 if not started
+    char *out;          // Captured stdout, NUL-terminated (NULL if not captured)
+    size_t out_len;
+    char *err;          // Captured stderr, NUL-terminated (NULL if not captured)
+    size_t err_len;
+    unsigned long long elapsed_us;  // Wall time from start to exit
+} ProcResult;
+
+// One command for proc_run_many()
+typedef struct {
+    char *const *argv;  // NULL-terminated, argv[0] looked up in PATH
+    int flags;          // ProcFlags
+    ProcResult result;
+} ProcJob;
+
+// A started command whose pipes the caller reads itself (e.g. from a main loop)
+typedef struct {
+    pid_t pid;
+    int out_fd;         // Read end of the stdout pipe, -1 if not captured
+    int err_fd;         // Read end of the stderr pipe, -1 if not captured
+} ProcHandle;
+
+// Run a command (no shell) and wait for it; true if it exited with status 0
+bool proc_run(char *const argv[], int flags, ProcResult *result);
+
+// Run independent commands concurrently, at most max_workers at a time.
+// Returns how many exited with status 0.
+int proc_run_many(ProcJob *jobs, int count, int max_workers);
+
+// Start a command without waiting; the caller owns the pipe fds and reaps the pid
+bool proc_spawn(char *const argv[], int flags, ProcHandle *handle);
+
+// Decode a waitpid() status into an exit code (128 + signal if killed)
+int proc_exit_code(int status);
+
+// Free captured output
+void proc_result_free(ProcResult *result);
+
+#endif // PROC_H
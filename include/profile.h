@@ -0,0 +1,83 @@
+/*
+ * Driver profiles header
+ *
+ * A profile records which drivers a machine uses for which hardware, so the
+ * same selection can be applied to other machines. It is a driver database
+ * file (see data/drivers.conf) holding one entry per device and installed
+ * driver: "10de:2684 | gpu-nvidia | reboot,recommended | nvidia-dkms ... | ...".
+ * The match column may be widened by hand ("10de:*", "*") to cover a fleet
+ * with different models.
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "driver.h"
+#include "driver_db.h"
+
+// What applying a profile entry found or did
+typedef enum {
+    PROFILE_NO_HARDWARE,    // No device here matches the entry; skipped
+    PROFILE_NOT_OFFERED,    // Matching hardware, but the driver database here
+                            // doesn't offer the driver for it
+    PROFILE_UNAVAILABLE,    // Not in the configured repositories
+    PROFILE_SATISFIED,      // Installed already
+    PROFILE_PENDING,        // Missing; a dry run stops here
+    PROFILE_INSTALLED,      // Installed by this apply
+    PROFILE_FAILED          // Missing, and the install transaction failed
+} ProfileStatus;
+
+// One profile entry and its outcome
+typedef struct {
+    char match[16];             // Match column as written back: "10de:2684", "*"...
+    const DriverMapping *entry; // The profile line
+    const HardwareInfo *hw;     // First device here it matches, NULL if none
+    DriverInfo *driver;         // The detected driver it selects, NULL if none
+    ProfileStatus status;
+} ProfileItem;
+
+// Outcome of applying a profile
+typedef struct {
+    DriverDbFile file;          // The parsed profile; owns the entries' strings
+    ProfileItem *items;         // One per profile line, in file order
+    int count;
+    int install_count;          // Drivers in the install transaction (0: none ran)
+    bool success;               // Every entry with hardware here is satisfied
+    bool reboot_required;
+    unsigned long long elapsed_us;
+} ProfileReport;
+
+// Runs the install transaction of an apply, like install_drivers()
+typedef bool (*ProfileInstaller)(DriverInfo **drivers, int count, void *user_data);
+
+// How a profile is applied
+typedef struct {
+    bool dry_run;               // Only compute the diff
+    ProfileInstaller install;   // NULL: install_drivers() in this process
+    void *user_data;
+} ProfileApplyOptions;
+
+// Write a profile of the drivers installed for the detected hardware.
+// Returns the number of entries written, or -1 on a write error.
+int profile_write(FILE *out, const HardwareInfo *hw_list, int hw_count,
+                  const DriverInfo *drivers, int driver_count);
+
+// Diff a profile against the detected hardware and drivers (whose installed
+// state comes from the local package database), then install every missing
+// driver as one transaction. A satisfied profile runs no transaction at all:
+// no database sync, no pacman, no initramfs rebuild. Returns false if the
+// profile can't be read or parsed; otherwise see report->success. Free the
+// report with profile_report_free() in both cases.
+bool profile_apply(const char *path, const HardwareInfo *hw_list, int hw_count,
+                   DriverInfo *drivers, int driver_count, const ProfileApplyOptions *options,
+                   ProfileReport *report);
+
+// Free a report
+void profile_report_free(ProfileReport *report);
+
+// Short name of a status ("satisfied", "installed"...), for machine-readable output
+const char *profile_status_name(ProfileStatus status);
+
+#endif // PROFILE_H
@@ -0,0 +1,55 @@
+/*
+ * Scan result cache header
+ */
+
+#ifndef SCAN_CACHE_H
+#define SCAN_CACHE_H
+
+#include <stdbool.h>
+#include "hardware.h"
+#include "driver.h"
+
+// Default cache location
+#define SCAN_CACHE_DEFAULT_PATH "/var/cache/system-drivers/scan.cache"
+
+// Bump whenever the file layout or the cached structures change
+#define SCAN_CACHE_VERSION 3
+
+// Invalidation keys for cached results
+typedef struct {
+    unsigned long long pci_devices;    // Hash of the PCI device addresses and IDs in sysfs
+    unsigned long long pacman_mtime;   // mtime of the pacman local database (ns)
+    unsigned long long driver_db;      // driver_db_fingerprint()
+    char kernel[65];                   // Running kernel release
+} ScanCacheKeys;
+
+// How much of the cache could be reused
+typedef enum {
+    SCAN_CACHE_MISS,            // Nothing usable
+    SCAN_CACHE_HARDWARE_ONLY,   // Hardware list valid, drivers must be re-detected
+    SCAN_CACHE_HIT              // Hardware and drivers valid
+} ScanCacheStatus;
+
+// Compute the current invalidation keys
+void scan_cache_compute_keys(ScanCacheKeys *keys);
+
+// Load the parts of the cache that are still valid for keys into arena
+ScanCacheStatus scan_cache_load(const char *path, const ScanCacheKeys *keys, Arena *arena,
+                                HardwareInfo **hw_list, int *hw_count,
+                                DriverInfo **driver_list, int *driver_count);
+
+// Write results and their keys to the cache (atomically replaces the file)
+bool scan_cache_save(const char *path, const ScanCacheKeys *keys,
+                     const HardwareInfo *hw_list, int hw_count,
+                     const DriverInfo *driver_list, int driver_count);
+
+// Scan hardware and detect drivers, reusing whatever the cache still has valid.
+// Both lists come from arena; destroying it frees the whole result.
+// Returns the driver count; *hw_count receives the hardware count.
+int scan_and_detect_cached(Arena *arena, HardwareInfo **hw_list, int *hw_count,
+                           DriverInfo **driver_list);
+
+// Use another cache file (NULL restores the default, "" disables caching)
+void set_scan_cache_path(const char *path);
+
+#endif // SCAN_CACHE_H
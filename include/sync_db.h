@@ -0,0 +1,57 @@
+/*
+ * Pacman sync database index header
+ */
+
+#ifndef SYNC_DB_H
+#define SYNC_DB_H
+
+#include <stdbool.h>
+
+// pacman's configuration, which lists the repositories in search order
+#define PACMAN_CONF_DEFAULT "/etc/pacman.conf"
+
+// What the repositories know about a package name
+typedef enum {
+    SYNC_DB_FOUND,      // In a repository (by name, or provided by another package)
+    SYNC_DB_MISSING,    // In none of the configured repositories
+    SYNC_DB_UNKNOWN     // Not found, but some repository could not be read
+} SyncDbLookup;
+
+// A repository package. Strings belong to the index and stay valid until the
+// next sync_db_refresh().
+typedef struct {
+    const char *repo;
+    const char *name;           // The package itself (differs from the name looked up for a provider)
+    const char *version;
+    unsigned long long download_size;   // %CSIZE%
+    unsigned long long installed_size;  // %ISIZE%
+} SyncPackage;
+
+// Index of the sync databases (<dbpath>/sync/<repo>.db). A repository is read
+// and decompressed on the first lookup that needs it, then kept until its
+// file changes.
+typedef struct SyncDb SyncDb;
+
+// Open the index of the repositories listed in pacman_conf (all *.db files in
+// sync_dir, alphabetically, if it can't be read). Reads no database yet.
+SyncDb *sync_db_open(const char *sync_dir, const char *pacman_conf);
+
+// Notice synced databases: a repository whose file changed is read again on
+// its next lookup
+void sync_db_refresh(SyncDb *db);
+
+// Look a package up like `pacman -S` does: by name in repository order, then
+// by what packages provide
+SyncDbLookup sync_db_find(SyncDb *db, const char *name, SyncPackage *pkg);
+
+// Number of repositories read so far
+int sync_db_loaded_count(const SyncDb *db);
+
+// Free the index (NULL is ignored)
+void sync_db_free(SyncDb *db);
+
+// Compare two package versions ([epoch:]version[-release]) like vercmp(8):
+// negative if a is older than b, 0 if equal, positive if newer
+int pacman_vercmp(const char *a, const char *b);
+
+#endif // SYNC_DB_H
@@ -0,0 +1,37 @@
+/*
+ * Phase tracing header (Chrome trace-event JSON)
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+
+// Environment variable naming the trace file; --trace <file> does the same
+#define TRACE_ENV "SYSTEM_DRIVERS_TRACE"
+
+// Set once by trace_init(), before any worker thread starts
+extern bool trace_active;
+
+// Start writing a trace to a file (NULL: use $SYSTEM_DRIVERS_TRACE, if set).
+// The file is completed at exit; open it in chrome://tracing or Perfetto.
+bool trace_init(const char *path);
+
+// Finish the trace file (also registered with atexit)
+void trace_shutdown(void);
+
+// Current trace clock in microseconds (never 0)
+unsigned long long trace_now(void);
+
+// Record a span that started at `start` and ends now; `detail_format` (printf-style,
+// may be NULL) becomes the span's "detail" argument. No-op when start is 0.
+void trace_end(unsigned long long start, const char *category, const char *name,
+               const char *detail_format, ...)
+    __attribute__((format(printf, 4, 5)));
+
+// Start a span: a timestamp while tracing, 0 (and no clock read) otherwise
+static inline unsigned long long trace_begin(void) {
+    return trace_active ? trace_now() : 0;
+}
+
+#endif // TRACE_H
@@ -0,0 +1,86 @@
+/*
+ * Kernel uevent (hotplug) header
+ */
+
+#ifndef UEVENT_H
+#define UEVENT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "hardware.h"
+
+// Largest uevent message the kernel sends
+#define UEVENT_BUFFER_SIZE 8192
+
+// Uevent actions we distinguish
+typedef enum {
+    UEVENT_ADD,
+    UEVENT_REMOVE,
+    UEVENT_CHANGE,
+    UEVENT_BIND,
+    UEVENT_UNBIND,
+    UEVENT_OTHER
+} UeventAction;
+
+// The fields of a uevent we use
+typedef struct {
+    UeventAction action;
+    char subsystem[32];
+    char devtype[32];
+    char devpath[256];
+    char pci_slot[32];      // PCI: PCI_SLOT_NAME, e.g. 0000:01:00.0
+    char product[32];       // USB: PRODUCT=vid/pid/bcd (hex, no padding)
+    char interface[16];     // USB interfaces: INTERFACE=class/subclass/protocol (decimal)
+    char modalias[96];
+} Uevent;
+
+// Hotplug events arrive in bursts (a dock brings up a dozen PCI functions at
+// once) and are handled together once the burst has been quiet this long
+#define UEVENT_DEBOUNCE_MS 250
+
+// Events of one burst kept individually; a longer burst is handled by a rescan
+#define UEVENT_QUEUE_SIZE 32
+
+// Hotplug events of the current burst, in arrival order
+typedef struct {
+    Uevent events[UEVENT_QUEUE_SIZE];
+    int count;
+    bool overflow;                  // More events than fit: rescan instead
+    unsigned long long deadline_ms; // Burst is over at this time (monotonic)
+} UeventQueue;
+
+// Parse a kernel uevent message ("action@devpath\0KEY=value\0...")
+bool uevent_parse(const char *buf, size_t len, Uevent *event);
+
+// Open a non-blocking netlink socket subscribed to kernel uevents (-1 on error)
+int uevent_socket_open(void);
+
+// Receive and parse one pending uevent; false if none or not from the kernel
+bool uevent_socket_receive(int fd, Uevent *event);
+
+// Whether an event changes the hardware list: a PCI device or USB interface
+// being added or removed
+bool uevent_is_hotplug(const Uevent *event);
+
+// Queue a hotplug event received at now_ms and restart the debounce;
+// false (and nothing queued) for other events
+bool uevent_queue_add(UeventQueue *queue, const Uevent *event, unsigned long long now_ms);
+
+// Parse a raw uevent message and queue it like uevent_queue_add(); lets
+// tests feed synthetic events through the path kernel events take
+bool uevent_queue_inject(UeventQueue *queue, const char *buf, size_t len,
+                         unsigned long long now_ms);
+
+// Whether the queued burst is over at now_ms and should be handled
+bool uevent_queue_due(const UeventQueue *queue, unsigned long long now_ms);
+
+// Forget the queued burst once it was handled
+void uevent_queue_clear(UeventQueue *queue);
+
+// Bus address used as HardwareInfo.pci_id for the device of an event
+const char *uevent_device_address(const Uevent *event);
+
+// Build the HardwareInfo of a USB interface from its add event (strings go into arena)
+bool uevent_usb_hardware(Arena *arena, const Uevent *event, HardwareInfo *hw);
+
+#endif // UEVENT_H
@@ -0,0 +1,256 @@
+/*
+ * Scan arena implementation
+ *
+ * Memory comes from a list of chunks and is only handed back when the whole
+ * arena is destroyed, so one scan's records and strings are freed in one call.
+ * Interned strings are looked up through an open-addressing table keyed by
+ * FNV-1a, which lets every record of a scan share a single copy of strings
+ * such as vendor names.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "../include/arena.h"
+
+// Default chunk payload; larger requests get a chunk of their own
+#define ARENA_CHUNK_SIZE (16 * 1024)
+
+// Alignment of arena_alloc() results
+#define ARENA_ALIGN sizeof(void *)
+
+typedef struct ArenaChunk {
+    struct ArenaChunk *next;
+    size_t used;
+    size_t size;
+    char *data;
+} ArenaChunk;
+
+struct Arena {
+    ArenaChunk *chunks;         // Newest first; small allocations come from the head
+    size_t total;
+
+    // Intern table of string pointers (NULL = empty), size is a power of two
+    const char **strings;
+    uint32_t *hashes;
+    uint32_t string_mask;
+    uint32_t string_count;
+};
+
+// Create an empty arena
+Arena *arena_create(void) {
+    return calloc(1, sizeof(Arena));
+}
+
+// Free an arena and everything allocated from it
+void arena_destroy(Arena *arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    ArenaChunk *chunk = arena->chunks;
+    while (chunk != NULL) {
+        ArenaChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+
+    free(arena->strings);
+    free(arena->hashes);
+    free(arena);
+}
+
+// Add a chunk with room for at least size bytes
+static ArenaChunk *add_chunk(Arena *arena, size_t size) {
+    bool dedicated = size > ARENA_CHUNK_SIZE / 4;
+    size_t payload = dedicated ? size : ARENA_CHUNK_SIZE;
+
+    ArenaChunk *chunk = malloc(sizeof(ArenaChunk) + payload + ARENA_ALIGN);
+    if (chunk == NULL) {
+        return NULL;
+    }
+
+    chunk->data = (char *)chunk + sizeof(ArenaChunk);
+    chunk->data += (ARENA_ALIGN - (uintptr_t)chunk->data % ARENA_ALIGN) % ARENA_ALIGN;
+    chunk->used = 0;
+    chunk->size = payload;
+    arena->total += sizeof(ArenaChunk) + payload + ARENA_ALIGN;
+
+    // A dedicated chunk goes behind the head, which keeps its free space
+    if (dedicated && arena->chunks != NULL) {
+        chunk->next = arena->chunks->next;
+        arena->chunks->next = chunk;
+    } else {
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    }
+    return chunk;
+}
+
+// Take size bytes at the given alignment
+static void *take(Arena *arena, size_t size, size_t align) {
+    ArenaChunk *chunk = arena->chunks;
+    size_t start = 0;
+
+    if (chunk != NULL) {
+        start = (chunk->used + align - 1) / align * align;
+    }
+    if (chunk == NULL || start + size > chunk->size) {
+        chunk = add_chunk(arena, size);
+        if (chunk == NULL) {
+            return NULL;
+        }
+        start = 0;
+    }
+
+    chunk->used = start + size;
+    return chunk->data + start;
+}
+
+// Allocate zeroed, pointer-aligned memory
+void *arena_alloc(Arena *arena, size_t size) {
+    void *ptr = take(arena, size > 0 ? size : 1, ARENA_ALIGN);
+    if (ptr != NULL) {
+        memset(ptr, 0, size);
+    }
+    return ptr;
+}
+
+// Resize an allocation, in place when it is the most recent one
+void *arena_grow(Arena *arena, void *ptr, size_t old_size, size_t new_size) {
+    if (ptr == NULL) {
+        return arena_alloc(arena, new_size);
+    }
+    if (new_size <= old_size) {
+        return ptr;
+    }
+
+    ArenaChunk *head = arena->chunks;
+    if (head != NULL && (char *)ptr + old_size == head->data + head->used &&
+        (size_t)((char *)ptr - head->data) + new_size <= head->size) {
+        memset((char *)ptr + old_size, 0, new_size - old_size);
+        head->used += new_size - old_size;
+        return ptr;
+    }
+
+    void *grown = arena_alloc(arena, new_size);
+    if (grown != NULL) {
+        memcpy(grown, ptr, old_size);
+    }
+    return grown;
+}
+
+// FNV-1a hash of a string of known length
+static uint32_t hash_string(const char *str, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char)str[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Rebuild the intern table at twice its size
+static bool grow_strings(Arena *arena) {
+    uint32_t slots = arena->strings != NULL ? (arena->string_mask + 1) * 2 : 256;
+    const char **strings = calloc(slots, sizeof(const char *));
+    uint32_t *hashes = calloc(slots, sizeof(uint32_t));
+    if (strings == NULL || hashes == NULL) {
+        free(strings);
+        free(hashes);
+        return false;
+    }
+
+    for (uint32_t i = 0; arena->strings != NULL && i <= arena->string_mask; i++) {
+        if (arena->strings[i] != NULL) {
+            uint32_t slot = arena->hashes[i] & (slots - 1);
+            while (strings[slot] != NULL) {
+                slot = (slot + 1) & (slots - 1);
+            }
+            strings[slot] = arena->strings[i];
+            hashes[slot] = arena->hashes[i];
+        }
+    }
+
+    free(arena->strings);
+    free(arena->hashes);
+    arena->strings = strings;
+    arena->hashes = hashes;
+    arena->string_mask = slots - 1;
+    return true;
+}
+
+// Intern the first len bytes of str
+const char *arena_intern_len(Arena *arena, const char *str, size_t len) {
+    if (arena->string_count * 2 >= (arena->strings != NULL ? arena->string_mask + 1 : 0) &&
+        !grow_strings(arena)) {
+        return "";
+    }
+
+    uint32_t hash = hash_string(str, len);
+    uint32_t slot = hash & arena->string_mask;
+    while (arena->strings[slot] != NULL) {
+        const char *candidate = arena->strings[slot];
+        if (arena->hashes[slot] == hash && strncmp(candidate, str, len) == 0 &&
+            candidate[len] == '\0') {
+            return candidate;
+        }
+        slot = (slot + 1) & arena->string_mask;
+    }
+
+    char *copy = take(arena, len + 1, 1);
+    if (copy == NULL) {
+        return "";
+    }
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+
+    arena->strings[slot] = copy;
+    arena->hashes[slot] = hash;
+    arena->string_count++;
+    return copy;
+}
+
+// Intern a string
+const char *arena_intern(Arena *arena, const char *str) {
+    return arena_intern_len(arena, str, strlen(str));
+}
+
+// Intern a formatted string
+const char *arena_printf(Arena *arena, const char *fmt, ...) {
+    char buf[256];
+    va_list args;
+
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    if (len < 0) {
+        return "";
+    }
+    if ((size_t)len < sizeof(buf)) {
+        return arena_intern_len(arena, buf, len);
+    }
+
+    // Too long for the stack buffer: format again into a heap one
+    char *long_buf = malloc(len + 1);
+    if (long_buf == NULL) {
+        return "";
+    }
+    va_start(args, fmt);
+    vsnprintf(long_buf, len + 1, fmt, args);
+    va_end(args);
+
+    const char *interned = arena_intern_len(arena, long_buf, len);
+    free(long_buf);
+    return interned;
+}
+
+// Bytes of memory the arena holds
+size_t arena_size(const Arena *arena) {
+    size_t slots = arena->strings != NULL ? arena->string_mask + 1 : 0;
+    return arena->total + slots * (sizeof(const char *) + sizeof(uint32_t));
+}
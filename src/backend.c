@@ -0,0 +1,421 @@
+/*
+ * Privileged helper protocol implementation
+ *
+ * Client and helper talk over a Unix stream socket in lines of text. Each
+ * connection carries one request:
+ *
+ *   QUERY                      Scan results (rescanned only if stale)
+ *   SCAN                       Scan results from a fresh scan
+ *   INSTALL\t<pkgs>\t<pkgs>... Install drivers (by package set) in one transaction
+ *   PREFETCH\t<pkgs>\t...      Download their packages into the cache (pacman -Sw)
+ *
+ * The package sets of an INSTALL may be preceded by "ttl=<seconds>", the sync
+ * TTL (see set_sync_ttl()) for that transaction.
+ *
+ * Scan results come back as "OK <devices> <drivers>", one tab-separated
+ * H line per device group and D line per driver, then "END". An install streams
+ * "O <text>" per output line and ends with "X <exit code>"; while it runs
+ * the client may send "CANCEL". A PREFETCH is answered the same way; cancelled
+ * or failed, it leaves no partial downloads. Any request can be answered by
+ * "E <message>"; an INSTALL or PREFETCH while another one runs gets "E busy".
+ * Strings never contain tabs or newlines on the wire (they become spaces).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "../include/backend.h"
+#include "../include/trace.h"
+
+// Most records accepted in one reply
+#define BACKEND_MAX_RECORDS 65536
+
+// Fields of the H and D record lines, including the tag (H is the longer one)
+#define BACKEND_HW_FIELDS 15
+#define BACKEND_DRIVER_FIELDS 14
+
+// Send a whole buffer (no SIGPIPE if the peer went away)
+static bool send_all(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Connect to the helper
+int backend_connect(const char *socket_path) {
+    struct sockaddr_un addr;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        int saved = errno;
+        close(fd);
+        errno = saved;
+        return -1;
+    }
+    return fd;
+}
+
+// Check whether a helper is listening on a socket
+bool backend_available(const char *socket_path) {
+    int fd = backend_connect(socket_path);
+    if (fd < 0) {
+        return false;
+    }
+    close(fd);
+    return true;
+}
+
+// Append a tab and a string field, with tabs and newlines turned into spaces
+static void append_field(char *line, size_t size, size_t *used, const char *value) {
+    if (*used + 1 < size) {
+        line[(*used)++] = '\t';
+    }
+    for (const char *p = value; *p != '\0' && *used + 1 < size; p++) {
+        line[(*used)++] = (*p == '\t' || *p == '\n' || *p == '\r') ? ' ' : *p;
+    }
+    line[*used] = '\0';
+}
+
+// Send one formatted reply line
+bool backend_send_line(int fd, const char *fmt, ...) {
+    char line[BACKEND_LINE_MAX];
+    va_list args;
+
+    va_start(args, fmt);
+    int len = vsnprintf(line, sizeof(line) - 1, fmt, args);
+    va_end(args);
+
+    if (len < 0) {
+        return false;
+    }
+    if ((size_t)len > sizeof(line) - 2) {
+        len = sizeof(line) - 2;
+    }
+    line[len++] = '\n';
+    return send_all(fd, line, len);
+}
+
+// Send scan results in reply to a query
+bool backend_send_results(int fd, const HardwareInfo *hw_list, int hw_count,
+                          const DriverInfo *driver_list, int driver_count) {
+    char line[BACKEND_LINE_MAX];
+    bool ok = backend_send_line(fd, "OK %d %d", hw_count, driver_count);
+
+    for (int i = 0; ok && i < hw_count; i++) {
+        const HardwareInfo *hw = &hw_list[i];
+
+        // The address list of a large group can outgrow a line; it goes last
+        size_t size = BACKEND_LINE_MAX + strlen(hw->addresses);
+        char *hw_line = malloc(size);
+        if (hw_line == NULL) {
+            return false;
+        }
+
+        size_t used = snprintf(hw_line, size, "H\t%d\t%d\t%x\t%x\t%x\t%x\t%x\t%d\t%d",
+                               hw->type, hw->bus, hw->vendor_id, hw->device_id,
+                               hw->subsys_vendor_id, hw->subsys_device_id, hw->class_code,
+                               hw->count, hw->virtual_functions);
+        append_field(hw_line, size - 1, &used, hw->vendor);
+        append_field(hw_line, size - 1, &used, hw->device);
+        append_field(hw_line, size - 1, &used, hw->pci_id);
+        append_field(hw_line, size - 1, &used, hw->modalias);
+        append_field(hw_line, size - 1, &used, hw->addresses);
+        hw_line[used++] = '\n';
+        ok = send_all(fd, hw_line, used);
+        free(hw_line);
+    }
+
+    for (int i = 0; ok && i < driver_count; i++) {
+        const DriverInfo *driver = &driver_list[i];
+        size_t used = snprintf(line, sizeof(line), "D\t%d\t%d\t%d\t%d\t%d\t%d\t%llu", driver->hw_type,
+                               driver->is_installed, driver->is_recommended, driver->needs_reboot,
+                               driver->availability, driver->update_available, driver->download_size);
+        append_field(line, sizeof(line) - 1, &used, driver->name);
+        append_field(line, sizeof(line) - 1, &used, driver->package);
+        append_field(line, sizeof(line) - 1, &used, driver->version);
+        append_field(line, sizeof(line) - 1, &used, driver->description);
+        append_field(line, sizeof(line) - 1, &used, driver->repo_version);
+        append_field(line, sizeof(line) - 1, &used, driver->repository);
+        line[used++] = '\n';
+        ok = send_all(fd, line, used);
+    }
+
+    return ok && backend_send_line(fd, "END");
+}
+
+// Split a line at tabs in place; returns the number of fields
+static int split_fields(char *line, char **fields, int max) {
+    int count = 0;
+    char *p = line;
+
+    while (count < max) {
+        fields[count++] = p;
+        p = strchr(p, '\t');
+        if (p == NULL) {
+            break;
+        }
+        *p++ = '\0';
+    }
+    return count;
+}
+
+// Read one reply line without its newline; false at end of stream
+static bool read_line(FILE *in, char **line, size_t *capacity) {
+    ssize_t len = getline(line, capacity, in);
+    if (len <= 0) {
+        return false;
+    }
+    if ((*line)[len - 1] == '\n') {
+        (*line)[len - 1] = '\0';
+    }
+    return true;
+}
+
+// Parse the records of a query reply into arena
+static int read_results(FILE *in, Arena *arena, HardwareInfo **hw_list, int *hw_count,
+                        DriverInfo **driver_list) {
+    char *line = NULL;
+    size_t capacity = 0;
+    int expected_hw = -1;
+    int expected_drivers = -1;
+    int hw_read = 0;
+    int drivers_read = 0;
+    bool complete = false;
+
+    if (!read_line(in, &line, &capacity)) {
+        fprintf(stderr, "System helper closed the connection\n");
+    } else if (strncmp(line, "E ", 2) == 0) {
+        fprintf(stderr, "System helper: %s\n", line + 2);
+    } else if (sscanf(line, "OK %d %d", &expected_hw, &expected_drivers) != 2 ||
+               expected_hw < 0 || expected_hw > BACKEND_MAX_RECORDS ||
+               expected_drivers < 0 || expected_drivers > BACKEND_MAX_RECORDS) {
+        fprintf(stderr, "System helper sent an invalid reply\n");
+        expected_hw = -1;
+    }
+
+    if (expected_hw >= 0) {
+        *hw_list = arena_alloc(arena, sizeof(HardwareInfo) * (expected_hw > 0 ? expected_hw : 1));
+        *driver_list = arena_alloc(arena, sizeof(DriverInfo) * (expected_drivers > 0 ? expected_drivers : 1));
+    }
+
+    while (expected_hw >= 0 && *hw_list != NULL && *driver_list != NULL &&
+           read_line(in, &line, &capacity)) {
+        // Room for the longest record plus one, so extra fields are noticed
+        char *fields[BACKEND_HW_FIELDS + 1];
+        int count = split_fields(line, fields, BACKEND_HW_FIELDS + 1);
+
+        if (strcmp(fields[0], "END") == 0) {
+            complete = hw_read == expected_hw && drivers_read == expected_drivers;
+            break;
+        } else if (strcmp(fields[0], "H") == 0 && count == BACKEND_HW_FIELDS && hw_read < expected_hw) {
+            HardwareInfo *hw = &(*hw_list)[hw_read++];
+            hw->type = (HardwareType)atoi(fields[1]);
+            hw->bus = (HardwareBus)atoi(fields[2]);
+            hw->vendor_id = strtoul(fields[3], NULL, 16);
+            hw->device_id = strtoul(fields[4], NULL, 16);
+            hw->subsys_vendor_id = strtoul(fields[5], NULL, 16);
+            hw->subsys_device_id = strtoul(fields[6], NULL, 16);
+            hw->class_code = strtoul(fields[7], NULL, 16);
+            hw->count = atoi(fields[8]);
+            hw->virtual_functions = atoi(fields[9]);
+            hw->vendor = arena_intern(arena, fields[10]);
+            hw->device = arena_intern(arena, fields[11]);
+            hw->pci_id = arena_intern(arena, fields[12]);
+            hw->modalias = arena_intern(arena, fields[13]);
+            hw->addresses = arena_intern(arena, fields[14]);
+        } else if (strcmp(fields[0], "D") == 0 && count == BACKEND_DRIVER_FIELDS &&
+                   drivers_read < expected_drivers) {
+            DriverInfo *driver = &(*driver_list)[drivers_read++];
+            driver->hw_type = (HardwareType)atoi(fields[1]);
+            driver->is_installed = atoi(fields[2]) != 0;
+            driver->is_recommended = atoi(fields[3]) != 0;
+            driver->needs_reboot = atoi(fields[4]) != 0;
+            driver->availability = (DriverAvailability)atoi(fields[5]);
+            driver->update_available = atoi(fields[6]) != 0;
+            driver->download_size = strtoull(fields[7], NULL, 10);
+            driver->name = arena_intern(arena, fields[8]);
+            driver->package = arena_intern(arena, fields[9]);
+            driver->version = arena_intern(arena, fields[10]);
+            driver->description = arena_intern(arena, fields[11]);
+            driver->repo_version = arena_intern(arena, fields[12]);
+            driver->repository = arena_intern(arena, fields[13]);
+        } else {
+            fprintf(stderr, "System helper sent an invalid record\n");
+            break;
+        }
+    }
+    free(line);
+
+    if (!complete) {
+        if (expected_hw >= 0) {
+            fprintf(stderr, "Incomplete scan results from the system helper\n");
+        }
+        return -1;
+    }
+    *hw_count = hw_read;
+    return drivers_read;
+}
+
+// Get the helper's scan results into arena
+int backend_query(const char *socket_path, bool rescan, Arena *arena,
+                  HardwareInfo **hw_list, int *hw_count, DriverInfo **driver_list) {
+    unsigned long long span = trace_begin();
+    *hw_list = NULL;
+    *hw_count = 0;
+    *driver_list = NULL;
+
+    int fd = backend_connect(socket_path);
+    if (fd < 0) {
+        fprintf(stderr, "Could not reach the system helper at %s: %s\n", socket_path, strerror(errno));
+        return -1;
+    }
+
+    const char *request = rescan ? "SCAN\n" : "QUERY\n";
+    FILE *in = send_all(fd, request, strlen(request)) ? fdopen(fd, "r") : NULL;
+    if (in == NULL) {
+        close(fd);
+        return -1;
+    }
+
+    int driver_count = read_results(in, arena, hw_list, hw_count, driver_list);
+    fclose(in);
+
+    if (driver_count < 0) {
+        *hw_list = NULL;
+        *hw_count = 0;
+        *driver_list = NULL;
+    }
+    trace_end(span, "backend", rescan ? "Scan" : "Query", "%d devices, %d drivers",
+              *hw_count, driver_count);
+    return driver_count;
+}
+
+// Send a request naming a batch by package sets; returns the connected socket
+static int send_batch_request(const char *socket_path, const char *name, DriverInfo **drivers, int count) {
+    char request[BACKEND_LINE_MAX];
+    size_t used = snprintf(request, sizeof(request), "%s\tttl=%d", name, get_sync_ttl());
+
+    for (int i = 0; i < count; i++) {
+        if (used + strlen(drivers[i]->package) + 3 > sizeof(request)) {
+            fprintf(stderr, "Too many drivers for one request\n");
+            return -1;
+        }
+        append_field(request, sizeof(request), &used, drivers[i]->package);
+    }
+    request[used++] = '\n';
+
+    int fd = backend_connect(socket_path);
+    if (fd < 0) {
+        return -1;
+    }
+    if (!send_all(fd, request, used)) {
+        int saved = errno;
+        close(fd);
+        errno = saved;
+        return -1;
+    }
+    return fd;
+}
+
+// Ask the helper to install a batch in one transaction
+int backend_install_start(const char *socket_path, DriverInfo **drivers, int count) {
+    return send_batch_request(socket_path, "INSTALL", drivers, count);
+}
+
+// Ask the helper to download a batch's packages while the user decides
+int backend_prefetch_start(const char *socket_path, DriverInfo **drivers, int count) {
+    return send_batch_request(socket_path, "PREFETCH", drivers, count);
+}
+
+// Classify an install reply line
+BackendLineKind backend_parse_install_line(const char *line, const char **text, int *exit_code) {
+    *text = "";
+
+    if (line[0] == 'O' && (line[1] == ' ' || line[1] == '\0')) {
+        *text = line[1] != '\0' ? line + 2 : "";
+        return BACKEND_LINE_OUTPUT;
+    }
+    if (line[0] == 'X' && line[1] == ' ' && sscanf(line + 2, "%d", exit_code) == 1) {
+        return BACKEND_LINE_EXIT;
+    }
+    if (line[0] == 'E' && line[1] == ' ') {
+        *text = line + 2;
+        return BACKEND_LINE_ERROR;
+    }
+    return BACKEND_LINE_INVALID;
+}
+
+// Ask a running install to stop
+bool backend_install_cancel(int fd) {
+    return send_all(fd, "CANCEL\n", strlen("CANCEL\n"));
+}
+
+// Install a batch through the helper and wait
+bool backend_install(const char *socket_path, DriverInfo **drivers, int count, FILE *log) {
+    int fd = backend_install_start(socket_path, drivers, count);
+    if (fd < 0) {
+        fprintf(stderr, "Could not reach the system helper at %s: %s\n", socket_path, strerror(errno));
+        return false;
+    }
+
+    FILE *in = fdopen(fd, "r");
+    if (in == NULL) {
+        close(fd);
+        return false;
+    }
+
+    char *line = NULL;
+    size_t capacity = 0;
+    int exit_code = -1;
+    bool finished = false;
+
+    while (!finished && read_line(in, &line, &capacity)) {
+        const char *text;
+        switch (backend_parse_install_line(line, &text, &exit_code)) {
+        case BACKEND_LINE_OUTPUT:
+            fprintf(log, "%s\n", text);
+            break;
+        case BACKEND_LINE_EXIT:
+            finished = true;
+            break;
+        case BACKEND_LINE_ERROR:
+            fprintf(stderr, "System helper: %s\n", text);
+            finished = true;
+            break;
+        case BACKEND_LINE_INVALID:
+            break;
+        }
+    }
+    free(line);
+    fclose(in);
+
+    if (!finished) {
+        fprintf(stderr, "Lost the connection to the system helper\n");
+    }
+    return finished && exit_code == 0;
+}
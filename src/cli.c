@@ -0,0 +1,697 @@
+/*
+ * Command line interface - headless driver queries and installs
+ *
+ * Built as a separate executable that links only the core modules, so
+ * queries need neither GTK nor root.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <unistd.h>
+#include "../include/hardware.h"
+#include "../include/driver.h"
+#include "../include/driver_db.h"
+#include "../include/profile.h"
+#include "../include/scan_cache.h"
+#include "../include/backend.h"
+#include "../include/privilege.h"
+#include "../include/trace.h"
+
+// Exit codes
+#define CLI_EXIT_OK          0
+#define CLI_EXIT_FAILED      1
+#define CLI_EXIT_USAGE       2
+#define CLI_EXIT_UNKNOWN_ID  3
+
+typedef struct {
+    bool list;
+    bool json;
+    bool recommended;
+    bool install;
+    bool dry_run;
+    const char *export_profile; // Profile to write, "-" for stdout
+    const char *apply_profile;  // Profile to apply
+    const char *trace_path;
+    int sync_ttl;       // -1: not given
+    const char *dbpath; // pacman database directory, NULL for the default
+    const char *root;   // Installation root, NULL for /
+    const char *config; // pacman.conf, NULL for the default
+    const char *socket; // System helper socket, NULL to work in-process
+    char **ids;         // Points into argv
+    int id_count;
+} CliOptions;
+
+// Print usage information
+static void print_usage(FILE *out, const char *prog) {
+    fprintf(out,
+            "Usage: %s [--list] [--json] [--recommended]\n"
+            "       %s --install <id>... [--json]\n"
+            "       %s --install --recommended [--json]\n"
+            "       %s --export-profile <file>\n"
+            "       %s --apply-profile <file> [--dry-run] [--json]\n"
+            "\n"
+            "  --list          List detected drivers (default)\n"
+            "  --json          Machine-readable output\n"
+            "  --recommended   Only recommended drivers\n"
+            "  --install       Install the given drivers in one transaction (root only)\n"
+            "  --export-profile <file>\n"
+            "                  Write the installed drivers and their hardware IDs to\n"
+            "                  a profile (- for stdout)\n"
+            "  --apply-profile <file>\n"
+            "                  Install the drivers of a profile that are missing here,\n"
+            "                  in one transaction, and report what changed\n"
+            "  --dry-run       With --apply-profile: only report what would change\n"
+            "  --sync-ttl <s>  Skip the database sync if synced within <s> seconds\n"
+            "                  (default %d, 0 always syncs)\n"
+            "  --dbpath <dir>  Use another pacman database directory (as pacman --dbpath)\n"
+            "  --root <dir>    Install into another root (as pacman --root); the database\n"
+            "                  directory defaults to <dir>/var/lib/pacman\n"
+            "  --config <file> Read the repositories from another pacman.conf\n"
+            "  --socket <path> Scan and install through the system helper listening on\n"
+            "                  <path> (installs then need no root, only polkit consent)\n"
+            "  --trace <file>  Write a Chrome trace of every phase (or set " TRACE_ENV ")\n"
+            "  --help          Show this help message\n"
+            "\n"
+            "A driver id is its first package name, as shown by --list.\n"
+            "Diagnostics go to stderr; stdout only carries the result.\n",
+            prog, prog, prog, prog, prog, SYNC_TTL_DEFAULT);
+}
+
+// Parse the command line; returns false on a usage error
+static bool parse_options(int argc, char *argv[], CliOptions *opts) {
+    memset(opts, 0, sizeof(CliOptions));
+    opts->sync_ttl = -1;
+    opts->ids = calloc(argc, sizeof(char *));
+    if (opts->ids == NULL) {
+        return false;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--list") == 0) {
+            opts->list = true;
+        } else if (strcmp(argv[i], "--json") == 0) {
+            opts->json = true;
+        } else if (strcmp(argv[i], "--recommended") == 0) {
+            opts->recommended = true;
+        } else if (strcmp(argv[i], "--install") == 0) {
+            opts->install = true;
+        } else if (strcmp(argv[i], "--dry-run") == 0) {
+            opts->dry_run = true;
+        } else if (strcmp(argv[i], "--export-profile") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--export-profile needs a file name\n");
+                return false;
+            }
+            opts->export_profile = argv[++i];
+        } else if (strcmp(argv[i], "--apply-profile") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--apply-profile needs a file name\n");
+                return false;
+            }
+            opts->apply_profile = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--trace needs a file name\n");
+                return false;
+            }
+            opts->trace_path = argv[++i];
+        } else if (strcmp(argv[i], "--dbpath") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--dbpath needs a directory\n");
+                return false;
+            }
+            opts->dbpath = argv[++i];
+        } else if (strcmp(argv[i], "--root") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--root needs a directory\n");
+                return false;
+            }
+            opts->root = argv[++i];
+        } else if (strcmp(argv[i], "--config") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--config needs a file name\n");
+                return false;
+            }
+            opts->config = argv[++i];
+        } else if (strcmp(argv[i], "--socket") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "--socket needs a path\n");
+                return false;
+            }
+            opts->socket = argv[++i];
+        } else if (strcmp(argv[i], "--sync-ttl") == 0) {
+            char *end = NULL;
+            long ttl = i + 1 < argc ? strtol(argv[i + 1], &end, 10) : -1;
+            if (end == NULL || end == argv[i + 1] || *end != '\0' || ttl < 0 || ttl > INT_MAX) {
+                fprintf(stderr, "--sync-ttl needs a number of seconds\n");
+                return false;
+            }
+            opts->sync_ttl = (int)ttl;
+            i++;
+        } else if (strncmp(argv[i], "--", 2) == 0) {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return false;
+        } else if (opts->install) {
+            opts->ids[opts->id_count++] = argv[i];
+        } else {
+            fprintf(stderr, "Unexpected argument: %s\n", argv[i]);
+            return false;
+        }
+    }
+
+    if (opts->install && opts->list) {
+        fprintf(stderr, "--install and --list cannot be combined\n");
+        return false;
+    }
+
+    if (opts->install && opts->id_count == 0 && !opts->recommended) {
+        fprintf(stderr, "--install needs driver ids or --recommended\n");
+        return false;
+    }
+
+    int modes = opts->install + (opts->export_profile != NULL) + (opts->apply_profile != NULL);
+    if (modes > 1 || (modes == 1 && opts->list)) {
+        fprintf(stderr, "--install, --export-profile, --apply-profile and --list cannot be combined\n");
+        return false;
+    }
+
+    if (opts->dry_run && opts->apply_profile == NULL) {
+        fprintf(stderr, "--dry-run only applies to --apply-profile\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Driver id: the first package of its package set
+static void driver_id(const DriverInfo *driver, char *id, size_t size) {
+    size_t len = strcspn(driver->package, " ");
+    if (len >= size) {
+        len = size - 1;
+    }
+    memcpy(id, driver->package, len);
+    id[len] = '\0';
+}
+
+// Find a driver by id or by its full package set
+static DriverInfo *find_driver_by_id(DriverInfo *drivers, int count, const char *wanted) {
+    for (int i = 0; i < count; i++) {
+        char id[128];
+        driver_id(&drivers[i], id, sizeof(id));
+        if (strcmp(id, wanted) == 0 || strcmp(drivers[i].package, wanted) == 0) {
+            return &drivers[i];
+        }
+    }
+    return NULL;
+}
+
+// Write the first len bytes of str as a JSON string literal
+static void json_string_len(FILE *out, const char *str, size_t len) {
+    fputc('"', out);
+    for (const unsigned char *p = (const unsigned char *)str; p < (const unsigned char *)str + len; p++) {
+        switch (*p) {
+            case '"':  fputs("\\\"", out); break;
+            case '\\': fputs("\\\\", out); break;
+            case '\n': fputs("\\n", out); break;
+            case '\t': fputs("\\t", out); break;
+            default:
+                if (*p < 0x20) {
+                    fprintf(out, "\\u%04x", *p);
+                } else {
+                    fputc(*p, out);
+                }
+        }
+    }
+    fputc('"', out);
+}
+
+// Write a JSON string literal
+static void json_string(FILE *out, const char *str) {
+    json_string_len(out, str, strlen(str));
+}
+
+// Write the packages of a driver as a JSON array
+static void json_packages(FILE *out, const char *packages) {
+    bool first = true;
+
+    fputc('[', out);
+    for (const char *pkg = packages + strspn(packages, " "); *pkg != '\0';
+         pkg += strspn(pkg, " ")) {
+        size_t len = strcspn(pkg, " ");
+        if (!first) {
+            fputs(", ", out);
+        }
+        json_string_len(out, pkg, len);
+        first = false;
+        pkg += len;
+    }
+    fputc(']', out);
+}
+
+// Write one driver as a JSON object
+static void json_driver(FILE *out, const DriverInfo *driver) {
+    char id[128];
+    driver_id(driver, id, sizeof(id));
+
+    fputs("{\"id\": ", out);
+    json_string(out, id);
+    fputs(", \"name\": ", out);
+    json_string(out, driver->name);
+    fputs(", \"packages\": ", out);
+    json_packages(out, driver->package);
+    fputs(", \"type\": ", out);
+    json_string(out, driver_db_type_name(driver->hw_type));
+    fputs(", \"description\": ", out);
+    json_string(out, driver->description);
+    fprintf(out, ", \"installed\": %s", driver->is_installed ? "true" : "false");
+    fputs(", \"version\": ", out);
+    if (driver->is_installed) {
+        json_string(out, driver->version);
+    } else {
+        fputs("null", out);
+    }
+    fprintf(out, ", \"recommended\": %s, \"needs_reboot\": %s",
+            driver->is_recommended ? "true" : "false",
+            driver->needs_reboot ? "true" : "false");
+    fprintf(out, ", \"available\": %s",
+            driver->availability == DRIVER_AVAILABLE ? "true" :
+            driver->availability == DRIVER_UNAVAILABLE ? "false" : "null");
+    fputs(", \"repository\": ", out);
+    if (driver->repository[0] != '\0') {
+        json_string(out, driver->repository);
+        fputs(", \"repo_version\": ", out);
+        json_string(out, driver->repo_version);
+    } else {
+        fputs("null, \"repo_version\": null", out);
+    }
+    fprintf(out, ", \"update_available\": %s, \"download_size\": %llu}",
+            driver->update_available ? "true" : "false", driver->download_size);
+}
+
+// One-word state of a driver for the table
+static const char *driver_status(const DriverInfo *driver) {
+    if (driver->is_installed) {
+        return driver->update_available ? "update" : "installed";
+    }
+    return driver->availability == DRIVER_UNAVAILABLE ? "unavailable" : "available";
+}
+
+// Write one device as a JSON object
+static void json_hardware(FILE *out, const HardwareInfo *hw) {
+    fputs("{\"address\": ", out);
+    json_string(out, hw->pci_id);
+    fprintf(out, ", \"bus\": \"%s\"", hw->bus == HW_BUS_USB ? "usb" : "pci");
+    fputs(", \"type\": ", out);
+    json_string(out, driver_db_type_name(hw->type));
+    fputs(", \"vendor\": ", out);
+    json_string(out, hw->vendor);
+    fputs(", \"device\": ", out);
+    json_string(out, hw->device);
+    fprintf(out, ", \"vendor_id\": \"%04x\", \"device_id\": \"%04x\"",
+            hw->vendor_id, hw->device_id);
+    fprintf(out, ", \"count\": %d, \"addresses\": [", hw->count);
+
+    // Addresses are space separated, the first being the group's pci_id
+    const char *p = hw->addresses;
+    bool first = true;
+    while (*p != '\0') {
+        size_t len = strcspn(p, " ");
+        if (len > 0) {
+            char address[64];
+            snprintf(address, sizeof(address), "%.*s", (int)len, p);
+            fputs(first ? "" : ", ", out);
+            json_string(out, address);
+            first = false;
+        }
+        p += len;
+        p += strspn(p, " ");
+    }
+    fprintf(out, "], \"virtual_functions\": %d}", hw->virtual_functions);
+}
+
+// Print the detected drivers (and devices, for JSON)
+static void print_list(FILE *out, const CliOptions *opts,
+                       const HardwareInfo *hw_list, int hw_count,
+                       const DriverInfo *drivers, int driver_count) {
+    if (opts->json) {
+        fputs("{\n  \"hardware\": [", out);
+        for (int i = 0; i < hw_count; i++) {
+            fputs(i == 0 ? "\n    " : ",\n    ", out);
+            json_hardware(out, &hw_list[i]);
+        }
+        fputs(hw_count > 0 ? "\n  ],\n  \"drivers\": [" : "],\n  \"drivers\": [", out);
+
+        int shown = 0;
+        for (int i = 0; i < driver_count; i++) {
+            if (opts->recommended && !drivers[i].is_recommended) {
+                continue;
+            }
+            fputs(shown == 0 ? "\n    " : ",\n    ", out);
+            json_driver(out, &drivers[i]);
+            shown++;
+        }
+        fputs(shown > 0 ? "\n  ]\n}\n" : "]\n}\n", out);
+        return;
+    }
+
+    fprintf(out, "%-24s %-11s %-4s %s\n", "ID", "STATUS", "REC", "NAME");
+    for (int i = 0; i < driver_count; i++) {
+        if (opts->recommended && !drivers[i].is_recommended) {
+            continue;
+        }
+        char id[128];
+        driver_id(&drivers[i], id, sizeof(id));
+        fprintf(out, "%-24s %-11s %-4s %s\n", id, driver_status(&drivers[i]),
+                drivers[i].is_recommended ? "yes" : "-",
+                drivers[i].name);
+    }
+}
+
+// Install the requested drivers as one transaction
+static int run_install(FILE *out, const CliOptions *opts, DriverInfo *drivers, int driver_count) {
+    DriverInfo **batch = calloc(driver_count + opts->id_count + 1, sizeof(DriverInfo *));
+    int batch_count = 0;
+    int status = CLI_EXIT_OK;
+
+    if (batch == NULL) {
+        return CLI_EXIT_FAILED;
+    }
+
+    for (int i = 0; i < opts->id_count; i++) {
+        DriverInfo *driver = find_driver_by_id(drivers, driver_count, opts->ids[i]);
+        if (driver == NULL) {
+            fprintf(stderr, "Unknown driver id: %s (see --list)\n", opts->ids[i]);
+            status = CLI_EXIT_UNKNOWN_ID;
+        } else if (!driver->is_installed && driver->availability == DRIVER_UNAVAILABLE) {
+            // The transaction would only fail with "target not found"
+            fprintf(stderr, "Not in the configured repositories: %s (%s)\n", opts->ids[i], driver->package);
+            if (status == CLI_EXIT_OK) {
+                status = CLI_EXIT_FAILED;
+            }
+        } else if (!driver->is_installed) {
+            batch[batch_count++] = driver;
+        }
+    }
+
+    if (opts->id_count == 0) {
+        for (int i = 0; i < driver_count; i++) {
+            if (!drivers[i].is_recommended || drivers[i].is_installed) {
+                continue;
+            }
+            if (drivers[i].availability == DRIVER_UNAVAILABLE) {
+                fprintf(stderr, "Skipping %s: not in the configured repositories\n", drivers[i].package);
+                continue;
+            }
+            batch[batch_count++] = &drivers[i];
+        }
+    }
+
+    // Ids given twice or by id and full package set end up here once
+    int unique = 0;
+    for (int i = 0; i < batch_count; i++) {
+        bool seen = false;
+        for (int j = 0; j < unique; j++) {
+            seen = seen || batch[j] == batch[i];
+        }
+        if (!seen) {
+            batch[unique++] = batch[i];
+        }
+    }
+    batch_count = unique;
+
+    // Unknown or unavailable ids stop the whole transaction before it starts
+    bool attempted = status == CLI_EXIT_OK;
+    bool success = true;
+    if (attempted && batch_count > 0) {
+        success = opts->socket != NULL ? backend_install(opts->socket, batch, batch_count, stdout)
+                                       : install_drivers(batch, batch_count);
+        if (!success) {
+            status = CLI_EXIT_FAILED;
+        }
+    }
+
+    if (opts->json) {
+        fputs("{\"installed\": [", out);
+        for (int i = 0; attempted && success && i < batch_count; i++) {
+            char id[128];
+            driver_id(batch[i], id, sizeof(id));
+            if (i > 0) {
+                fputs(", ", out);
+            }
+            json_string(out, id);
+        }
+        fprintf(out, "], \"success\": %s, \"reboot_required\": %s, \"error\": ",
+                status == CLI_EXIT_OK ? "true" : "false",
+                attempted && success && drivers_need_reboot(batch, batch_count) ? "true" : "false");
+        if (status == CLI_EXIT_OK) {
+            fputs("null", out);
+        } else if (!attempted) {
+            json_string(out, status == CLI_EXIT_UNKNOWN_ID ? "unknown-id" : "not-found");
+        } else {
+            // The helper only reports success or failure
+            json_string(out, opts->socket == NULL && get_install_error()[0] != '\0'
+                             ? get_install_error() : "failed");
+        }
+        fputs("}\n", out);
+    } else if (status == CLI_EXIT_OK) {
+        if (batch_count == 0) {
+            fprintf(out, "Nothing to install.\n");
+        } else {
+            fprintf(out, "Installed %d driver(s).%s\n", batch_count,
+                    drivers_need_reboot(batch, batch_count) ? " A reboot is required." : "");
+        }
+    }
+
+    free(batch);
+    return status;
+}
+
+// Write the installed drivers to a profile
+static int run_export_profile(FILE *out, const CliOptions *opts,
+                              const HardwareInfo *hw_list, int hw_count,
+                              const DriverInfo *drivers, int driver_count) {
+    bool to_stdout = strcmp(opts->export_profile, "-") == 0;
+    FILE *file = to_stdout ? out : fopen(opts->export_profile, "w");
+    if (file == NULL) {
+        perror(opts->export_profile);
+        return CLI_EXIT_FAILED;
+    }
+
+    int written = profile_write(file, hw_list, hw_count, drivers, driver_count);
+    if (!to_stdout && fclose(file) != 0) {
+        written = -1;
+    }
+    if (written < 0) {
+        fprintf(stderr, "Could not write %s\n", opts->export_profile);
+        return CLI_EXIT_FAILED;
+    }
+
+    fprintf(stderr, "Exported %d profile entr%s to %s\n", written, written == 1 ? "y" : "ies",
+            to_stdout ? "stdout" : opts->export_profile);
+    return CLI_EXIT_OK;
+}
+
+// Install a profile's missing drivers through the system helper
+static bool install_through_helper(DriverInfo **drivers, int count, void *user_data) {
+    return backend_install(user_data, drivers, count, stdout);
+}
+
+// Write the ids of the drivers of a report with a status, once each
+static void json_profile_ids(FILE *out, const ProfileReport *report, ProfileStatus status) {
+    int shown = 0;
+    fputc('[', out);
+    for (int i = 0; i < report->count; i++) {
+        const ProfileItem *item = &report->items[i];
+        bool seen = item->status != status;
+        for (int j = 0; j < i && !seen; j++) {
+            seen = report->items[j].status == status && report->items[j].driver == item->driver;
+        }
+        if (seen) {
+            continue;
+        }
+
+        char id[128];
+        driver_id(item->driver, id, sizeof(id));
+        fputs(shown++ > 0 ? ", " : "", out);
+        json_string(out, id);
+    }
+    fputc(']', out);
+}
+
+// Apply a profile and report what changed
+static int run_apply_profile(FILE *out, const CliOptions *opts,
+                             const HardwareInfo *hw_list, int hw_count,
+                             DriverInfo *drivers, int driver_count) {
+    ProfileApplyOptions apply = {
+        .dry_run = opts->dry_run,
+        .install = opts->socket != NULL ? install_through_helper : NULL,
+        .user_data = (void *)opts->socket,
+    };
+    ProfileReport report;
+
+    if (!profile_apply(opts->apply_profile, hw_list, hw_count, drivers, driver_count,
+                       &apply, &report)) {
+        fprintf(stderr, "Could not read profile %s\n", opts->apply_profile);
+        profile_report_free(&report);
+        return CLI_EXIT_FAILED;
+    }
+
+    if (opts->json) {
+        fputs("{\n  \"profile\": ", out);
+        json_string(out, opts->apply_profile);
+        fprintf(out, ",\n  \"dry_run\": %s,\n  \"success\": %s,\n  \"installed\": ",
+                opts->dry_run ? "true" : "false", report.success ? "true" : "false");
+        json_profile_ids(out, &report, PROFILE_INSTALLED);
+        fputs(",\n  \"pending\": ", out);
+        json_profile_ids(out, &report, PROFILE_PENDING);
+        fprintf(out, ",\n  \"reboot_required\": %s,\n  \"elapsed_ms\": %.3f,\n  \"entries\": [",
+                report.reboot_required ? "true" : "false", report.elapsed_us / 1000.0);
+
+        for (int i = 0; i < report.count; i++) {
+            const ProfileItem *item = &report.items[i];
+            fputs(i == 0 ? "\n    {\"match\": " : ",\n    {\"match\": ", out);
+            json_string(out, item->match);
+            fputs(", \"type\": ", out);
+            json_string(out, driver_db_type_name(item->entry->hw_type));
+            fputs(", \"packages\": ", out);
+            json_packages(out, item->entry->package_name);
+            fputs(", \"name\": ", out);
+            json_string(out, item->entry->driver_name);
+            fputs(", \"address\": ", out);
+            if (item->hw != NULL) {
+                json_string(out, item->hw->pci_id);
+            } else {
+                fputs("null", out);
+            }
+            fputs(", \"status\": ", out);
+            json_string(out, profile_status_name(item->status));
+            fputc('}', out);
+        }
+        fputs(report.count > 0 ? "\n  ]\n}\n" : "]\n}\n", out);
+    } else {
+        fprintf(out, "%-16s %-12s %-24s %s\n", "MATCH", "STATUS", "ID", "DEVICE");
+        for (int i = 0; i < report.count; i++) {
+            const ProfileItem *item = &report.items[i];
+            char id[128];
+            size_t len = strcspn(item->entry->package_name, " ");
+            snprintf(id, sizeof(id), "%.*s", (int)len, item->entry->package_name);
+            fprintf(out, "%-16s %-12s %-24s %s\n", item->match, profile_status_name(item->status),
+                    id, item->hw != NULL ? item->hw->device : "-");
+        }
+
+        if (!report.success) {
+            fprintf(out, "Profile not satisfied (see the entries not-offered, unavailable or failed).\n");
+        } else if (report.install_count == 0) {
+            fprintf(out, "Profile satisfied, nothing to install (%.2f ms).\n",
+                    report.elapsed_us / 1000.0);
+        } else if (opts->dry_run) {
+            fprintf(out, "%d driver(s) to install.\n", report.install_count);
+        } else {
+            fprintf(out, "Installed %d driver(s).%s\n", report.install_count,
+                    report.reboot_required ? " A reboot is required." : "");
+        }
+    }
+
+    int status = report.success ? CLI_EXIT_OK : CLI_EXIT_FAILED;
+    profile_report_free(&report);
+    return status;
+}
+
+int main(int argc, char *argv[]) {
+    CliOptions opts;
+
+    if (argc > 1 && (strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-h") == 0)) {
+        print_usage(stdout, argv[0]);
+        return CLI_EXIT_OK;
+    }
+
+    if (!parse_options(argc, argv, &opts)) {
+        print_usage(stderr, argv[0]);
+        free(opts.ids);
+        return CLI_EXIT_USAGE;
+    }
+
+    // Set before the root check: installing into another root may not need it
+    if (opts.root != NULL) {
+        set_install_root(opts.root);
+    }
+    if (opts.config != NULL) {
+        set_pacman_conf_path(opts.config);
+    }
+
+    bool installs = opts.install || (opts.apply_profile != NULL && !opts.dry_run);
+    if (installs && opts.socket == NULL && !is_root() && install_requires_root()) {
+        fprintf(stderr, "Installing drivers requires root privileges (try: sudo %s ...)\n", argv[0]);
+        free(opts.ids);
+        return CLI_EXIT_FAILED;
+    }
+
+    // The core modules and the commands they run report progress on stdout;
+    // send all of that to stderr and keep stdout for the result only
+    FILE *out = NULL;
+    int result_fd = dup(STDOUT_FILENO);
+    if (result_fd >= 0) {
+        out = fdopen(result_fd, "w");
+    }
+    if (out == NULL) {
+        perror("dup stdout");
+        free(opts.ids);
+        return CLI_EXIT_FAILED;
+    }
+    fflush(stdout);
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    trace_init(opts.trace_path);
+    if (opts.sync_ttl >= 0) {
+        set_sync_ttl(opts.sync_ttl);
+    }
+    if (opts.dbpath != NULL || opts.root != NULL) {
+        char local_path[512];
+        if (opts.dbpath != NULL) {
+            snprintf(local_path, sizeof(local_path), "%s/local", opts.dbpath);
+        } else {
+            snprintf(local_path, sizeof(local_path), "%s/var/lib/pacman/local", opts.root);
+        }
+        set_pacman_db_path(local_path);
+    }
+
+    Arena *arena = arena_create();
+    if (arena == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        fclose(out);
+        free(opts.ids);
+        return CLI_EXIT_FAILED;
+    }
+
+    HardwareInfo *hw_list = NULL;
+    DriverInfo *drivers = NULL;
+    int hw_count = 0;
+    int driver_count = opts.socket != NULL
+        ? backend_query(opts.socket, false, arena, &hw_list, &hw_count, &drivers)
+        : scan_and_detect_cached(arena, &hw_list, &hw_count, &drivers);
+
+    int status = CLI_EXIT_OK;
+    if (driver_count < 0) {
+        status = CLI_EXIT_FAILED;
+    } else if (opts.install) {
+        status = run_install(out, &opts, drivers, driver_count);
+    } else if (opts.export_profile != NULL) {
+        status = run_export_profile(out, &opts, hw_list, hw_count, drivers, driver_count);
+    } else if (opts.apply_profile != NULL) {
+        status = run_apply_profile(out, &opts, hw_list, hw_count, drivers, driver_count);
+    } else {
+        print_list(out, &opts, hw_list, hw_count, drivers, driver_count);
+    }
+
+    if (fclose(out) != 0) {
+        status = CLI_EXIT_FAILED;
+    }
+
+    arena_destroy(arena);
+    free(opts.ids);
+    return status;
+}
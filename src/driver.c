@@ -6,277 +6,1223 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <time.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits.h>
 #include <unistd.h>
-#include <sys/wait.h>
+#include <sys/stat.h>
 #include "../include/driver.h"
 #include "../include/hardware.h"
+#include "../include/pacman_db.h"
+#include "../include/sync_db.h"
+#include "../include/driver_db.h"
+#include "../include/trace.h"
+#include "../include/proc.h"
+#include "../include/initramfs.h"
+#include "../include/package_txn.h"
 
-// Driver database - maps hardware types to driver packages
-typedef struct {
-    HardwareType hw_type;
-    const char *vendor_match;  // NULL means any vendor
-    const char *package_name;
-    const char *driver_name;
-    const char *description;
-    bool needs_reboot;
-    bool is_recommended;
-} DriverMapping;
-
-static const DriverMapping driver_db[] = {
-    // NVIDIA drivers - Complete stack with DKMS and 32-bit support
-    {HW_GPU_NVIDIA, NULL, "nvidia-dkms lib32-nvidia-utils nvidia-settings", "NVIDIA Complete Driver",
-     "NVIDIA driver with DKMS modules and 32-bit support", true, true},
-    {HW_GPU_NVIDIA, NULL, "nvidia", "NVIDIA Standard Driver",
-     "Standard NVIDIA proprietary graphics driver", true, false},
-    {HW_GPU_NVIDIA, NULL, "nvidia-lts", "NVIDIA LTS Driver",
-     "NVIDIA driver for LTS kernel", true, false},
-
-    // AMD drivers
-    {HW_GPU_AMD, NULL, "xf86-video-amdgpu", "AMDGPU Driver",
-     "Open source AMD graphics driver", true, true},
-    {HW_GPU_AMD, NULL, "vulkan-radeon", "AMD Vulkan Driver",
-     "Vulkan support for AMD GPUs", false, true},
-    {HW_GPU_AMD, NULL, "mesa", "Mesa 3D Graphics",
-     "Open source 3D graphics library", false, true},
-
-    // Intel drivers
-    {HW_GPU_INTEL, NULL, "xf86-video-intel", "Intel Graphics Driver",
-     "Intel integrated graphics driver", true, true},
-    {HW_GPU_INTEL, NULL, "vulkan-intel", "Intel Vulkan Driver",
-     "Vulkan support for Intel GPUs", false, true},
-    {HW_GPU_INTEL, NULL, "mesa", "Mesa 3D Graphics",
-     "Open source 3D graphics library", false, true},
-
-    // Network drivers (common packages)
-    {HW_NETWORK, NULL, "linux-firmware", "Linux Firmware",
-     "Firmware files for Linux kernel drivers", false, true},
-
-    // Audio drivers
-    {HW_AUDIO, NULL, "sof-firmware", "Sound Open Firmware",
-     "Firmware for modern audio hardware", false, true},
-};
-
-static const int driver_db_size = sizeof(driver_db) / sizeof(DriverMapping);
+// Installed package snapshot, reloaded once per detect_drivers() call
+static PacmanDb *installed_packages = NULL;
+static char pacman_db_path[256] = PACMAN_LOCAL_DB_DEFAULT;
+
+// Repository index, kept across detections; a repository is re-read when synced
+static SyncDb *sync_index = NULL;
+
+// Where transactions install to and which pacman.conf they use
+static char install_root[256] = "/";
+static char pacman_conf_path[256] = PACMAN_CONF_DEFAULT;
+
+// Why the last install transaction failed ("" if it didn't)
+static char install_error[32] = "";
+
+// Sync policy, shared by every install transaction of the session
+static int sync_ttl = SYNC_TTL_DEFAULT;
+static time_t session_synced_at = 0;   // 0: not synced by this process
+static PackagesSyncedFunc synced_func = NULL;
+static void *synced_func_data = NULL;
+
+// Override the pacman local database directory
+void set_pacman_db_path(const char *path) {
+    strncpy(pacman_db_path, path != NULL ? path : PACMAN_LOCAL_DB_DEFAULT,
+            sizeof(pacman_db_path) - 1);
+    pacman_db_path[sizeof(pacman_db_path) - 1] = '\0';
+
+    // Force the next lookup to read the new location
+    pacman_db_free(installed_packages);
+    installed_packages = NULL;
+    sync_db_free(sync_index);
+    sync_index = NULL;
+}
+
+// Get the pacman local database directory
+const char *get_pacman_db_path(void) {
+    return pacman_db_path;
+}
+
+// Set the installation root
+void set_install_root(const char *root) {
+    snprintf(install_root, sizeof(install_root), "%s", root != NULL ? root : "/");
+}
+
+// Get the installation root
+const char *get_install_root(void) {
+    return install_root;
+}
+
+// Set the pacman.conf used for repositories
+void set_pacman_conf_path(const char *path) {
+    snprintf(pacman_conf_path, sizeof(pacman_conf_path), "%s",
+             path != NULL ? path : PACMAN_CONF_DEFAULT);
+
+    // Its repositories may differ
+    sync_db_free(sync_index);
+    sync_index = NULL;
+}
+
+// Get the pacman.conf used for repositories
+const char *get_pacman_conf_path(void) {
+    return pacman_conf_path;
+}
+
+// Check whether installs need root
+bool install_requires_root(void) {
+    return strcmp(install_root, "/") == 0 || !package_txn_supported();
+}
+
+// Get why the last install transaction failed
+const char *get_install_error(void) {
+    return install_error;
+}
+
+// pacman's database directory (the parent of local/ and sync/)
+static void pacman_dbpath(char *dbpath, size_t size) {
+    snprintf(dbpath, size, "%s", pacman_db_path);
+
+    char *slash = strrchr(dbpath, '/');
+    if (slash != NULL && slash != dbpath) {
+        *slash = '\0';
+    }
+}
+
+// Get the package cache directory: the default one, or <dbpath>/pkg when the
+// database directory was moved, so scratch databases don't share the real cache
+void get_package_cache_dir(char *dir, size_t size) {
+    if (strcmp(pacman_db_path, PACMAN_LOCAL_DB_DEFAULT) == 0) {
+        snprintf(dir, size, "%s", PACMAN_CACHE_DIR_DEFAULT);
+        return;
+    }
+
+    pacman_dbpath(dir, size);
+    strncat(dir, "/pkg", size - strlen(dir) - 1);
+}
+
+// Set how long synced package databases count as fresh
+void set_sync_ttl(int seconds) {
+    sync_ttl = seconds > 0 ? seconds : 0;
+}
+
+// Get the sync TTL in seconds
+int get_sync_ttl(void) {
+    return sync_ttl;
+}
+
+// Seconds since the package databases were last synced; -1 if unknown
+long package_sync_age(void) {
+    char sync_dir[320];
+    time_t now = time(NULL);
+    time_t oldest = 0;
+    int db_count = 0;
+
+    pacman_dbpath(sync_dir, sizeof(sync_dir));
+    strncat(sync_dir, "/sync", sizeof(sync_dir) - strlen(sync_dir) - 1);
+
+    // A repository is only as fresh as its oldest database
+    DIR *dir = opendir(sync_dir);
+    if (dir != NULL) {
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != NULL) {
+            size_t len = strlen(entry->d_name);
+            if (len <= 3 || strcmp(entry->d_name + len - 3, ".db") != 0) {
+                continue;
+            }
+
+            char path[640];
+            struct stat st;
+            snprintf(path, sizeof(path), "%s/%s", sync_dir, entry->d_name);
+            if (stat(path, &st) == 0 && (db_count == 0 || st.st_mtime < oldest)) {
+                oldest = st.st_mtime;
+            }
+            db_count++;
+        }
+        closedir(dir);
+    }
+
+    // pacman leaves unchanged databases untouched, so a sync run by this
+    // session counts even when it didn't move any mtime
+    if (session_synced_at > 0 && (db_count == 0 || session_synced_at > oldest)) {
+        oldest = session_synced_at;
+        db_count = 1;
+    }
+
+    if (db_count == 0) {
+        return -1;
+    }
+    return now > oldest ? (long)(now - oldest) : 0;
+}
+
+// Check whether an install transaction has to sync the package databases first
+bool package_sync_needed(void) {
+    long age = package_sync_age();
+    return sync_ttl == 0 || age < 0 || age >= sync_ttl;
+}
+
+// Record a successful package database sync
+void mark_packages_synced(void) {
+    session_synced_at = time(NULL);
+    if (synced_func != NULL) {
+        synced_func(synced_func_data);
+    }
+}
+
+// Set what mark_packages_synced() calls
+void set_packages_synced_func(PackagesSyncedFunc func, void *user_data) {
+    synced_func = func;
+    synced_func_data = user_data;
+}
+
+// Re-read the installed package snapshot
+bool refresh_installed_packages(void) {
+    unsigned long long span = trace_begin();
+    PacmanDb *db = pacman_db_load(pacman_db_path);
+    if (db == NULL) {
+        trace_end(span, "pacman", "Read local database", "%s unreadable", pacman_db_path);
+        return false;
+    }
+    trace_end(span, "pacman", "Read local database", "%d packages", pacman_db_count(db));
+
+    pacman_db_free(installed_packages);
+    installed_packages = db;
+    return true;
+}
 
 // Check if a package (or multiple packages) is installed
 // For multiple packages separated by spaces, checks if ALL are installed
 bool is_driver_installed(const char *package_name) {
-    char packages[256];
-    strncpy(packages, package_name, sizeof(packages) - 1);
-    packages[sizeof(packages) - 1] = '\0';
-
-    // Check each package (space-separated)
-    char *token = strtok(packages, " ");
-    while (token != NULL) {
-        char command[256];
-        snprintf(command, sizeof(command), "pacman -Q %s > /dev/null 2>&1", token);
-        if (system(command) != 0) {
-            // At least one package not installed
-            return false;
+    if (installed_packages == NULL && !refresh_installed_packages()) {
+        return false;
+    }
+
+    // A heap copy: a long package set must not lose its trailing packages
+    char *packages = strdup(package_name);
+    if (packages == NULL) {
+        return false;
+    }
+
+    unsigned long long span = trace_begin();
+
+    // Check each package (space-separated); all of them must be installed
+    bool installed = true;
+    char *saveptr;
+    char *token = strtok_r(packages, " ", &saveptr);
+    while (token != NULL && installed) {
+        installed = pacman_db_has_package(installed_packages, token);
+        token = strtok_r(NULL, " ", &saveptr);
+    }
+    free(packages);
+
+    trace_end(span, "pacman", "Package query", "%s: %s", package_name,
+              installed ? "installed" : "not installed");
+    return installed;
+}
+
+// Get the installed version of the first package in a space-separated list
+static const char *get_installed_version(Arena *arena, const char *package_name) {
+    char first[128];
+    size_t len = strcspn(package_name, " ");
+    if (len >= sizeof(first)) {
+        len = sizeof(first) - 1;
+    }
+    memcpy(first, package_name, len);
+    first[len] = '\0';
+
+    // The snapshot is replaced on refresh, so keep the arena's copy
+    const char *installed = pacman_db_get_version(installed_packages, first);
+    return installed != NULL ? arena_intern(arena, installed) : "";
+}
+
+// Open-addressing hash set of package names. Names are slices of the
+// driver database's package strings, which outlive a detection pass.
+typedef struct {
+    const char **names;
+    unsigned int *lengths;
+    unsigned int mask;
+    unsigned int used;
+} PackageSet;
+
+// Open-addressing hash set of device match keys (0 marks an empty slot)
+typedef struct {
+    unsigned long long *keys;
+    unsigned int mask;
+} DeviceSet;
+
+// FNV-1a hash of a package name slice
+static unsigned int hash_package(const char *name, unsigned int length) {
+    unsigned int hash = 2166136261u;
+    for (unsigned int i = 0; i < length; i++) {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Size a set for at least twice as many slots as expected entries
+static unsigned int set_slots(int expected) {
+    unsigned int slots = 16;
+    while (slots < (unsigned int)expected * 2) {
+        slots <<= 1;
+    }
+    return slots;
+}
+
+// Allocate an empty package set
+static bool package_set_init(PackageSet *set, int expected) {
+    unsigned int slots = set_slots(expected);
+    set->names = calloc(slots, sizeof(const char *));
+    set->lengths = calloc(slots, sizeof(unsigned int));
+    set->mask = slots - 1;
+    set->used = 0;
+    return set->names != NULL && set->lengths != NULL;
+}
+
+// Free a package set
+static void package_set_free(PackageSet *set) {
+    free(set->names);
+    free(set->lengths);
+}
+
+// Find the slot holding a package, or the empty slot where it would go
+static unsigned int package_set_slot(const PackageSet *set, const char *name, unsigned int length) {
+    unsigned int slot = hash_package(name, length) & set->mask;
+    while (set->names[slot] != NULL &&
+           (set->lengths[slot] != length || memcmp(set->names[slot], name, length) != 0)) {
+        slot = (slot + 1) & set->mask;
+    }
+    return slot;
+}
+
+// Double the table once it is half full
+static bool package_set_grow(PackageSet *set) {
+    PackageSet bigger;
+    if (!package_set_init(&bigger, set->mask + 1)) {
+        package_set_free(&bigger);
+        return false;
+    }
+
+    for (unsigned int i = 0; i <= set->mask; i++) {
+        if (set->names[i] != NULL) {
+            unsigned int slot = package_set_slot(&bigger, set->names[i], set->lengths[i]);
+            bigger.names[slot] = set->names[i];
+            bigger.lengths[slot] = set->lengths[i];
         }
-        token = strtok(NULL, " ");
     }
+    bigger.used = set->used;
 
-    // All packages are installed
+    package_set_free(set);
+    *set = bigger;
     return true;
 }
 
+// Add every package of a space-separated list; returns how many were new
+static int package_set_add_all(PackageSet *set, const char *packages) {
+    int added = 0;
+    const char *p = packages;
+
+    while (*p != '\0') {
+        while (*p == ' ') {
+            p++;
+        }
+        const char *name = p;
+        while (*p != '\0' && *p != ' ') {
+            p++;
+        }
+        unsigned int length = p - name;
+        if (length == 0) {
+            continue;
+        }
+
+        if (set->used * 2 >= set->mask + 1 && !package_set_grow(set)) {
+            // Out of memory: treat the package as new rather than drop an option
+            added++;
+            continue;
+        }
+
+        unsigned int slot = package_set_slot(set, name, length);
+        if (set->names[slot] == NULL) {
+            set->names[slot] = name;
+            set->lengths[slot] = length;
+            set->used++;
+            added++;
+        }
+    }
+
+    return added;
+}
+
+// Key of everything driver_db_match() looks at, so equal keys give equal matches
+static unsigned long long device_match_key(const HardwareInfo *hw) {
+    unsigned long long key = 1ull << 63 | (unsigned long long)hw->type << 40;
+
+    // Only PCI devices with numeric IDs match by ID; the rest match by type alone
+    if (hw->bus == HW_BUS_PCI && hw->vendor_id != 0) {
+        key |= (unsigned long long)(hw->vendor_id & 0xffff) << 16 | (hw->device_id & 0xffff);
+    }
+    return key;
+}
+
+// Record a device key; false if an identical device was already seen
+static bool device_set_add(DeviceSet *set, unsigned long long key) {
+    unsigned int slot = (unsigned int)(key ^ key >> 29) * 2654435761u & set->mask;
+    while (set->keys[slot] != 0) {
+        if (set->keys[slot] == key) {
+            return false;
+        }
+        slot = (slot + 1) & set->mask;
+    }
+    set->keys[slot] = key;
+    return true;
+}
+
+// Fill a driver option from a database entry
+static void fill_driver_info(Arena *arena, DriverInfo *driver, const DriverMapping *mapping) {
+    memset(driver, 0, sizeof(DriverInfo));
+
+    // Override entries are freed when the database is reloaded
+    driver->name = arena_intern(arena, mapping->driver_name);
+    driver->package = arena_intern(arena, mapping->package_name);
+    driver->description = arena_intern(arena, mapping->description);
+    driver->hw_type = mapping->hw_type;
+    driver->needs_reboot = mapping->needs_reboot;
+    driver->is_recommended = mapping->is_recommended;
+
+    // Check if installed
+    driver->is_installed = is_driver_installed(mapping->package_name);
+
+    // Get version if installed
+    driver->version = driver->is_installed ? get_installed_version(arena, mapping->package_name) :
+                      "Not installed";
+}
+
+// Copy a driver, interning its strings into another arena
+void copy_driver_info(Arena *arena, DriverInfo *dest, const DriverInfo *src) {
+    *dest = *src;
+    dest->name = arena_intern(arena, src->name);
+    dest->package = arena_intern(arena, src->package);
+    dest->version = arena_intern(arena, src->version);
+    dest->description = arena_intern(arena, src->description);
+    dest->repo_version = arena_intern(arena, src->repo_version);
+    dest->repository = arena_intern(arena, src->repository);
+}
+
+// Look up every package of one driver in the repository index
+static void annotate_driver(Arena *arena, DriverInfo *driver) {
+    driver->availability = DRIVER_AVAILABLE;
+    driver->repo_version = "";
+    driver->repository = "";
+    driver->download_size = 0;
+    driver->update_available = false;
+
+    // A heap copy, so the trailing packages of a long set are looked up too
+    char *packages = strdup(driver->package);
+    if (packages == NULL) {
+        driver->availability = DRIVER_AVAILABILITY_UNKNOWN;
+        return;
+    }
+
+    char *saveptr;
+    bool first = true;
+    for (char *token = strtok_r(packages, " ", &saveptr); token != NULL;
+         token = strtok_r(NULL, " ", &saveptr)) {
+        SyncPackage pkg;
+        SyncDbLookup found = sync_db_find(sync_index, token, &pkg);
+
+        // One missing package fails the whole transaction
+        if (found == SYNC_DB_MISSING) {
+            driver->availability = DRIVER_UNAVAILABLE;
+        } else if (found == SYNC_DB_UNKNOWN && driver->availability == DRIVER_AVAILABLE) {
+            driver->availability = DRIVER_AVAILABILITY_UNKNOWN;
+        }
+
+        if (found == SYNC_DB_FOUND) {
+            if (first) {
+                driver->repo_version = arena_intern(arena, pkg.version);
+                driver->repository = arena_intern(arena, pkg.repo);
+            }
+            if (!pacman_db_has_package(installed_packages, token)) {
+                driver->download_size += pkg.download_size;
+            }
+        }
+        first = false;
+    }
+    free(packages);
+
+    driver->update_available = driver->is_installed && driver->version[0] != '\0' &&
+                               driver->repo_version[0] != '\0' &&
+                               pacman_vercmp(driver->version, driver->repo_version) < 0;
+}
+
+// Annotate drivers with what the sync databases say about their packages
+void annotate_driver_availability(Arena *arena, DriverInfo *drivers, int count) {
+    unsigned long long span = trace_begin();
+
+    if (sync_index == NULL) {
+        char sync_dir[320];
+        pacman_dbpath(sync_dir, sizeof(sync_dir));
+        strncat(sync_dir, "/sync", sizeof(sync_dir) - strlen(sync_dir) - 1);
+        sync_index = sync_db_open(sync_dir, pacman_conf_path);
+    } else {
+        sync_db_refresh(sync_index);
+    }
+
+    // Download sizes only count what isn't installed yet
+    if (installed_packages == NULL) {
+        refresh_installed_packages();
+    }
+
+    int unavailable = 0;
+    for (int i = 0; i < count; i++) {
+        annotate_driver(arena, &drivers[i]);
+        unavailable += drivers[i].availability == DRIVER_UNAVAILABLE;
+    }
+
+    trace_end(span, "detect", "Check repositories", "%d drivers, %d unavailable, %d repositories read",
+              count, unavailable, sync_db_loaded_count(sync_index));
+}
+
+// Get the first driver of a batch that is not in the repositories
+const DriverInfo *find_unavailable_driver(DriverInfo **drivers, int count) {
+    for (int i = 0; i < count; i++) {
+        if (drivers[i]->availability == DRIVER_UNAVAILABLE) {
+            return drivers[i];
+        }
+    }
+    return NULL;
+}
+
 // Detect available drivers for hardware
-int detect_drivers(HardwareInfo *hw_list, int hw_count, DriverInfo **driver_list) {
+int detect_drivers(Arena *arena, HardwareInfo *hw_list, int hw_count, DriverInfo **driver_list) {
     int count = 0;
     int capacity = 20;
+    int unique_devices = 0;
+    unsigned long long span = trace_begin();
+
+    // Read the installed packages once for the whole detection pass
+    if (!refresh_installed_packages()) {
+        fprintf(stderr, "WARNING: Could not read %s, treating all drivers as not installed\n",
+                pacman_db_path);
+    }
 
-    *driver_list = malloc(sizeof(DriverInfo) * capacity);
+    // Pick up changes to the system-wide driver database override
+    driver_db_reload();
+
+    *driver_list = arena_alloc(arena, sizeof(DriverInfo) * capacity);
     if (*driver_list == NULL) {
         return 0;
     }
 
-    // Track which packages we've already added (avoid duplicates)
-    char **added_packages = malloc(sizeof(char*) * capacity);
-    if (added_packages == NULL) {
-        free(*driver_list);
+    // Packages already offered by an earlier option, and devices already matched
+    PackageSet offered;
+    DeviceSet seen_devices;
+    unsigned int device_slots = set_slots(hw_count);
+    seen_devices.keys = calloc(device_slots, sizeof(unsigned long long));
+    seen_devices.mask = device_slots - 1;
+    if (!package_set_init(&offered, 64) || seen_devices.keys == NULL) {
+        package_set_free(&offered);
+        free(seen_devices.keys);
         *driver_list = NULL;
         return 0;
     }
 
-    // Scan through all hardware
+    // Scan through all hardware, once per device group
+    int device_count = 0;
     for (int i = 0; i < hw_count; i++) {
         HardwareInfo *hw = &hw_list[i];
+        device_count += hw->count;
 
-        // Find matching drivers in database
-        for (int j = 0; j < driver_db_size; j++) {
-            const DriverMapping *mapping = &driver_db[j];
-
-            // Check if hardware type matches
-            if (mapping->hw_type != hw->type) {
-                continue;
-            }
+        // Identical devices (e.g. several of the same card) match the same entries
+        if (!device_set_add(&seen_devices, device_match_key(hw))) {
+            continue;
+        }
+        unique_devices++;
 
-            // Check if vendor matches (if specified)
-            if (mapping->vendor_match != NULL &&
-                strstr(hw->vendor, mapping->vendor_match) == NULL) {
-                continue;
-            }
+        // Find matching drivers in database
+        const DriverMapping *matches[DRIVER_DB_MAX_MATCHES];
+        int match_count = driver_db_match(hw, matches, DRIVER_DB_MAX_MATCHES);
 
-            // Check if already added
-            bool already_added = false;
-            for (int k = 0; k < count; k++) {
-                if (strcmp(added_packages[k], mapping->package_name) == 0) {
-                    already_added = true;
-                    break;
-                }
-            }
+        for (int j = 0; j < match_count; j++) {
+            const DriverMapping *mapping = matches[j];
 
-            if (already_added) {
+            // Skip options whose packages are all offered already (same list in
+            // any order, or a subset of an earlier option)
+            if (package_set_add_all(&offered, mapping->package_name) == 0) {
                 continue;
             }
 
-            // Resize arrays if needed
+            // Resize list if needed (the old block stays in the arena)
             if (count >= capacity) {
-                capacity *= 2;
-                DriverInfo *new_list = realloc(*driver_list, sizeof(DriverInfo) * capacity);
-                char **new_packages = realloc(added_packages, sizeof(char*) * capacity);
+                DriverInfo *new_list = arena_grow(arena, *driver_list, sizeof(DriverInfo) * capacity,
+                                                  sizeof(DriverInfo) * capacity * 2);
 
-                if (new_list == NULL || new_packages == NULL) {
-                    free(*driver_list);
-                    free(added_packages);
+                if (new_list == NULL) {
+                    package_set_free(&offered);
+                    free(seen_devices.keys);
                     *driver_list = NULL;
                     return 0;
                 }
 
                 *driver_list = new_list;
-                added_packages = new_packages;
-            }
-
-            // Create driver info
-            DriverInfo driver;
-            memset(&driver, 0, sizeof(DriverInfo));
-
-            strncpy(driver.name, mapping->driver_name, sizeof(driver.name) - 1);
-            strncpy(driver.package, mapping->package_name, sizeof(driver.package) - 1);
-            strncpy(driver.description, mapping->description, sizeof(driver.description) - 1);
-            driver.hw_type = mapping->hw_type;
-            driver.needs_reboot = mapping->needs_reboot;
-            driver.is_recommended = mapping->is_recommended;
-
-            // Check if installed
-            driver.is_installed = is_driver_installed(mapping->package_name);
-
-            // Get version if installed
-            if (driver.is_installed) {
-                char command[256];
-                snprintf(command, sizeof(command),
-                        "pacman -Q %s 2>/dev/null | awk '{print $2}'",
-                        mapping->package_name);
-
-                FILE *fp = popen(command, "r");
-                if (fp != NULL) {
-                    if (fgets(driver.version, sizeof(driver.version), fp) != NULL) {
-                        driver.version[strcspn(driver.version, "\n")] = 0;
-                    }
-                    pclose(fp);
-                }
-            } else {
-                strncpy(driver.version, "Not installed", sizeof(driver.version) - 1);
+                capacity *= 2;
             }
 
-            (*driver_list)[count] = driver;
-            added_packages[count] = (char*)mapping->package_name;
+            fill_driver_info(arena, &(*driver_list)[count], mapping);
             count++;
         }
     }
 
-    free(added_packages);
+    package_set_free(&offered);
+    free(seen_devices.keys);
+
+    annotate_driver_availability(arena, *driver_list, count);
 
     printf("Driver detection complete: found %d drivers\n", count);
+    trace_end(span, "detect", "Detect drivers", "%d devices in %d groups (%d unique), %d drivers",
+              device_count, hw_count, unique_devices, count);
 
     return count;
 }
 
-// Install a driver
-bool install_driver(DriverInfo *driver) {
-    printf("\n=== Installing Driver ===\n");
-    printf("Driver: %s\n", driver->name);
-    printf("Package: %s\n", driver->package);
+// Check whether any device in a hardware list still calls for a driver
+bool driver_matches_hardware(const DriverInfo *driver, const HardwareInfo *hw_list, int hw_count) {
+    for (int i = 0; i < hw_count; i++) {
+        const DriverMapping *matches[DRIVER_DB_MAX_MATCHES];
+        int match_count = driver_db_match(&hw_list[i], matches, DRIVER_DB_MAX_MATCHES);
+
+        for (int j = 0; j < match_count; j++) {
+            if (strcmp(matches[j]->package_name, driver->package) == 0) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Merge the packages of several drivers into one space-separated list without duplicates
+char *merge_driver_packages(DriverInfo **drivers, int count) {
+    size_t size = 1;
+    for (int i = 0; i < count; i++) {
+        size += strlen(drivers[i]->package) + 1;
+    }
+
+    char *merged = malloc(size);
+    if (merged == NULL) {
+        return NULL;
+    }
+    merged[0] = '\0';
+
+    for (int i = 0; i < count; i++) {
+        // Tokenized in a heap copy, so no package of a long set gets cut off
+        char *packages = strdup(drivers[i]->package);
+        if (packages == NULL) {
+            free(merged);
+            return NULL;
+        }
+
+        char *saveptr;
+        char *token = strtok_r(packages, " ", &saveptr);
+        while (token != NULL) {
+            // Look for the token as a whole word in what we have so far
+            bool duplicate = false;
+            size_t token_len = strlen(token);
+            for (const char *pos = strstr(merged, token); pos != NULL; pos = strstr(pos + 1, token)) {
+                if ((pos == merged || pos[-1] == ' ') &&
+                    (pos[token_len] == ' ' || pos[token_len] == '\0')) {
+                    duplicate = true;
+                    break;
+                }
+            }
+
+            if (!duplicate) {
+                if (merged[0] != '\0') {
+                    strcat(merged, " ");
+                }
+                strcat(merged, token);
+            }
+            token = strtok_r(NULL, " ", &saveptr);
+        }
+        free(packages);
+    }
+
+    return merged;
+}
+
+// Build a NULL-terminated argv from a fixed prefix plus space-separated packages
+static char **build_argv(const char *const prefix[], const char *packages) {
+    int prefix_count = 0;
+    while (prefix[prefix_count] != NULL) {
+        prefix_count++;
+    }
+
+    int package_count = 0;
+    for (const char *p = packages; p != NULL && *p != '\0'; ) {
+        p += strspn(p, " ");
+        if (*p != '\0') {
+            package_count++;
+            p += strcspn(p, " ");
+        }
+    }
+
+    char **argv = calloc(prefix_count + package_count + 1, sizeof(char *));
+    if (argv == NULL) {
+        return NULL;
+    }
+
+    int argc = 0;
+    for (int i = 0; i < prefix_count; i++) {
+        argv[argc++] = strdup(prefix[i]);
+    }
+    for (const char *p = packages; p != NULL && *p != '\0'; ) {
+        p += strspn(p, " ");
+        size_t len = strcspn(p, " ");
+        if (len > 0) {
+            argv[argc++] = strndup(p, len);
+        }
+        p += len;
+    }
+
+    for (int i = 0; i < argc; i++) {
+        if (argv[i] == NULL) {
+            for (int j = 0; j < argc; j++) {
+                free(argv[j]);
+            }
+            free(argv);
+            return NULL;
+        }
+    }
+
+    return argv;
+}
+
+// Build a pacman argv, pointing it at the root, database directory and
+// pacman.conf in use if those were moved (e.g. a fixture):
+// pacman [--root <dir>] [--dbpath <dir> --cachedir <dir>] [--config <file>] <args...> [packages]
+static char **build_pacman_argv(const char *const args[], const char *packages) {
+    const char *prefix[20];
+    char dbpath[256];
+    char cache_dir[300];
+    int n = 0;
+
+    prefix[n++] = "pacman";
+    if (strcmp(install_root, "/") != 0) {
+        prefix[n++] = "--root";
+        prefix[n++] = install_root;
+    }
+    if (strcmp(pacman_db_path, PACMAN_LOCAL_DB_DEFAULT) != 0) {
+        pacman_dbpath(dbpath, sizeof(dbpath));
+        get_package_cache_dir(cache_dir, sizeof(cache_dir));
+        prefix[n++] = "--dbpath";
+        prefix[n++] = dbpath;
+        prefix[n++] = "--cachedir";
+        prefix[n++] = cache_dir;
+    }
+    if (strcmp(pacman_conf_path, PACMAN_CONF_DEFAULT) != 0) {
+        prefix[n++] = "--config";
+        prefix[n++] = pacman_conf_path;
+    }
+    for (int i = 0; args[i] != NULL && n < 19; i++) {
+        prefix[n++] = args[i];
+    }
+    prefix[n] = NULL;
+
+    return build_argv(prefix, packages);
+}
+
+// Build the commands of an install transaction
+int build_install_plan(DriverInfo **drivers, int count, InstallStep **steps) {
+    static const char *const sync_cmd[] = {"-Sy", "--noconfirm", NULL};
+    // --overwrite handles file conflicts with files not owned by any package
+    static const char *const install_cmd[] = {"-S", "--noconfirm", "--needed",
+                                              "--overwrite", "*", NULL};
+    static const char *const initramfs_cmd[] = {"mkinitcpio", "-P", NULL};
+
+    *steps = NULL;
+
+    char *packages = merge_driver_packages(drivers, count);
+    if (packages == NULL) {
+        return 0;
+    }
+
+    InstallStep *plan = calloc(3, sizeof(InstallStep));
+    if (plan == NULL) {
+        free(packages);
+        return 0;
+    }
+
+    int step_count = 0;
+
+    // Databases synced within the TTL (by anyone) are used as they are
+    if (package_sync_needed()) {
+        plan[step_count].kind = INSTALL_STEP_SYNC;
+        plan[step_count].title = "Syncing package database";
+        plan[step_count].argv = build_pacman_argv(sync_cmd, NULL);
+        plan[step_count].required = false;
+        step_count++;
+    }
+
+    plan[step_count].kind = INSTALL_STEP_INSTALL;
+    plan[step_count].title = "Installing packages";
+    plan[step_count].argv = build_pacman_argv(install_cmd, packages);
+    plan[step_count].required = true;
+    step_count++;
+
+    // Kernel module drivers need the initramfs rebuilt, once for the whole
+    // batch; another root's kernel is not the running one's business
+    if (drivers_need_reboot(drivers, count) && strcmp(install_root, "/") == 0) {
+        plan[step_count].kind = INSTALL_STEP_INITRAMFS;
+        plan[step_count].title = "Rebuilding kernel initramfs";
+        plan[step_count].argv = build_argv(initramfs_cmd, NULL);
+        plan[step_count].required = false;
+        step_count++;
+    }
+
+    free(packages);
+
+    for (int i = 0; i < step_count; i++) {
+        if (plan[i].argv == NULL) {
+            free_install_plan(plan, step_count);
+            return 0;
+        }
+    }
+
+    *steps = plan;
+    return step_count;
+}
+
+// Free an install plan
+void free_install_plan(InstallStep *steps, int count) {
+    if (steps == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        free_argv(steps[i].argv);
+    }
+    free(steps);
+}
+
+// Build the command that downloads a batch's packages into the package cache
+// without installing them
+char **build_prefetch_argv(DriverInfo **drivers, int count) {
+    // Never -Syw: the user has not confirmed yet, so nothing may be synced
+    static const char *const fetch_cmd[] = {"-Sw", "--noconfirm", "--needed", NULL};
+
+    char *packages = merge_driver_packages(drivers, count);
+    if (packages == NULL) {
+        return NULL;
+    }
+
+    char **argv = build_pacman_argv(fetch_cmd, packages);
+    free(packages);
+    return argv;
+}
+
+// Free an argv built by build_install_plan() or build_prefetch_argv()
+void free_argv(char **argv) {
+    for (int i = 0; argv != NULL && argv[i] != NULL; i++) {
+        free(argv[i]);
+    }
+    free(argv);
+}
+
+// Delete the partial downloads an interrupted prefetch of packages left in the
+// package cache
+int remove_partial_downloads(const char *packages) {
+    // The targets' file names, dependencies included, as the download named them
+    static const char *const print_cmd[] = {"-Sp", "--print-format", "%f", NULL};
+
+    char **argv = build_pacman_argv(print_cmd, packages);
+    if (argv == NULL) {
+        return -1;
+    }
+    ProcResult result;
+    bool listed = proc_run(argv, PROC_CAPTURE_STDOUT, &result);
+    free_argv(argv);
+    if (!listed || result.out == NULL) {
+        proc_result_free(&result);
+        return -1;
+    }
+
+    char cache_dir[300];
+    int removed = 0;
+    get_package_cache_dir(cache_dir, sizeof(cache_dir));
+    int dir_fd = open(cache_dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir_fd < 0) {
+        proc_result_free(&result);
+        return 0;
+    }
+
+    char *saveptr;
+    for (char *file = strtok_r(result.out, "\n", &saveptr); file != NULL;
+         file = strtok_r(NULL, "\n", &saveptr)) {
+        char part[NAME_MAX + 1];
+        if (strchr(file, '/') != NULL || snprintf(part, sizeof(part), "%s.part", file) >= (int)sizeof(part)) {
+            continue;
+        }
+        if (unlinkat(dir_fd, part, 0) == 0) {
+            removed++;
+        }
+    }
+    close(dir_fd);
+    proc_result_free(&result);
+
+    return removed;
+}
+
+// Check whether any driver in a batch needs a reboot
+bool drivers_need_reboot(DriverInfo **drivers, int count) {
+    for (int i = 0; i < count; i++) {
+        if (drivers[i]->needs_reboot) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Record a successful install transaction
+void mark_drivers_installed(DriverInfo **drivers, int count) {
+    for (int i = 0; i < count; i++) {
+        drivers[i]->is_installed = true;
+    }
+
+    // The installed package snapshot is stale now
+    refresh_installed_packages();
+}
+
+// Print an argv the way it would be typed in a shell
+static void print_command(FILE *out, char *const argv[]) {
+    for (int i = 0; argv[i] != NULL; i++) {
+        fprintf(out, i == 0 ? "%s" : " %s", argv[i]);
+    }
+    fprintf(out, "\n");
+}
+
+// Rebuild the initramfs presets that include something the install step
+// installed (the local database compared with the snapshot taken before it).
+// Falls back to the step's own command (mkinitcpio -P) when the presets can't
+// be worked out. Returns the first non-zero mkinitcpio exit code, or 0.
+static int run_initramfs_step(const InitramfsSnapshot *before, const InstallStep *step) {
+    InitramfsSelection selection;
+    initramfs_select_presets(before, &selection);
+
+    if (selection.count < 0) {
+        printf("Executing: ");
+        print_command(stdout, step->argv);
+        printf("-----------------------------------\n");
+        fflush(stdout);
+
+        ProcResult proc_result;
+        proc_run(step->argv, PROC_INHERIT, &proc_result);
+        return proc_result.exit_code;
+    }
+
+    if (selection.count == 0) {
+        printf("No initramfs preset includes the installed modules (%d checked), skipping\n",
+               selection.total);
+        printf("-----------------------------------\n");
+        return 0;
+    }
+
+    for (int i = 0; i < selection.count; i++) {
+        printf("Preset %s: %s\n", selection.presets[i].name, selection.presets[i].reason);
+    }
+    printf("Executing: mkinitcpio -p <preset> for %d of %d presets\n",
+           selection.count, selection.total);
+    printf("-----------------------------------\n");
+    fflush(stdout);
+
+    // Presets run side by side, so their output is printed once each finishes
+    InitramfsResult *results;
+    int rebuilt = initramfs_rebuild(&selection, &results);
+    int result = rebuilt == selection.count ? 0 : -1;
+
+    for (int i = 0; i < rebuilt; i++) {
+        if (results[i].output != NULL) {
+            fputs(results[i].output, stdout);
+        }
+        printf("%s: %.1f s, exit code %d\n", results[i].preset, results[i].seconds,
+               results[i].exit_code);
+        if (results[i].exit_code != 0 && result == 0) {
+            result = results[i].exit_code;
+        }
+    }
+    initramfs_results_free(results, rebuilt);
+
+    return result;
+}
+
+// Print libalpm progress the way pacman prints it without a terminal, so
+// readers of pacman's output (the install dialog) follow along as well
+static void print_package_event(const PackageTxnEvent *event, void *user_data) {
+    (void)user_data;  // Unused
+
+    switch (event->kind) {
+    case PACKAGE_TXN_EVENT_DB_SYNC:
+        printf(" synchronizing %s...\n", event->name);
+        break;
+    case PACKAGE_TXN_EVENT_TARGETS:
+        printf("\nPackages (%llu) %s\n\n", event->current, event->name);
+        printf("Total Download Size:   %.2f MiB\n\n", event->total / (1024.0 * 1024.0));
+        break;
+    case PACKAGE_TXN_EVENT_DOWNLOAD:
+        if (event->percent == 0) {
+            printf(" %s downloading...\n", event->name);
+        }
+        break;
+    case PACKAGE_TXN_EVENT_INSTALL:
+        if (event->percent == 0) {
+            printf("%s %s...\n", event->action, event->name);
+        }
+        break;
+    case PACKAGE_TXN_EVENT_HOOK:
+        printf("Running hook %llu/%llu: %s\n", event->current, event->total, event->name);
+        break;
+    case PACKAGE_TXN_EVENT_MESSAGE:
+        if (event->action[0] != '\0') {
+            fprintf(stderr, "%s: %s\n", event->action, event->name);
+        } else {
+            printf("%s\n", event->name);
+        }
+        break;
+    }
+    fflush(stdout);
+}
+
+// Run the sync or install step of a plan through libalpm. The handle is
+// opened by the first step and shared with the next, so the databases are
+// loaded once per transaction. Returns 0 on success, like an exit code.
+static int run_package_step(PackageTxn **txn, DriverInfo **drivers, int count,
+                            const InstallStep *step, PackageTxnResult *result) {
+    printf("In-process (libalpm): root %s, config %s\n", install_root, pacman_conf_path);
+    printf("-----------------------------------\n");
+    fflush(stdout);
+
+    if (*txn == NULL) {
+        char dbpath[256];
+        char cache_dir[300];
+        pacman_dbpath(dbpath, sizeof(dbpath));
+        get_package_cache_dir(cache_dir, sizeof(cache_dir));
+
+        package_txn_result_clear(result);
+        PackageTxnOptions options = {
+            .root = install_root,
+            .dbpath = dbpath,
+            .cachedir = cache_dir,
+            .pacman_conf = pacman_conf_path,
+            .progress = print_package_event,
+            .user_data = NULL,
+        };
+        *txn = package_txn_open(&options, result);
+        if (*txn == NULL) {
+            return -1;
+        }
+    }
+
+    if (step->kind == INSTALL_STEP_SYNC) {
+        return package_txn_sync(*txn, result) ? 0 : -1;
+    }
+
+    char *packages = merge_driver_packages(drivers, count);
+    if (packages == NULL) {
+        snprintf(result->message, sizeof(result->message), "out of memory");
+        result->error = PACKAGE_TXN_ERR_SETUP;
+        return -1;
+    }
+    bool installed = package_txn_install(*txn, packages, result);
+    free(packages);
+
+    if (installed && result->installed == 0) {
+        printf(" there is nothing to do\n");
+    }
+    return installed ? 0 : -1;
+}
+
+// Print why libalpm failed, with the packages, conflicts or files involved
+static void print_package_error(const PackageTxnResult *result) {
+    fprintf(stderr, "ERROR: %s (%s)\n", result->message, package_txn_error_name(result->error));
+    for (const char *line = result->details; line != NULL && *line != '\0'; ) {
+        size_t len = strcspn(line, "\n");
+        fprintf(stderr, "  - %.*s\n", (int)len, line);
+        line += len + (line[len] == '\n');
+    }
+}
+
+// Install several drivers in a single transaction
+bool install_drivers(DriverInfo **drivers, int count) {
+    if (count <= 0) {
+        return true;
+    }
+
+    printf("\n=== Installing Drivers ===\n");
+    for (int i = 0; i < count; i++) {
+        printf("Driver: %s\n", drivers[i]->name);
+        printf("Package: %s\n", drivers[i]->package);
+    }
     printf("========================\n\n");
+    install_error[0] = '\0';
 
-    // Verify we're running as root
-    if (geteuid() != 0) {
+    // Verify we're running as root (an in-process install into another root
+    // only needs write access to it)
+    if (geteuid() != 0 && install_requires_root()) {
         fprintf(stderr, "ERROR: Not running as root! Cannot install drivers.\n");
         fprintf(stderr, "Current UID: %d (should be 0)\n", geteuid());
+        snprintf(install_error, sizeof(install_error), "permission");
         return false;
     }
 
-    printf("Root privileges confirmed (UID: %d)\n", geteuid());
+    if (geteuid() == 0) {
+        printf("Root privileges confirmed (UID: %d)\n", geteuid());
+    } else {
+        printf("Installing into %s as UID %d\n", install_root, geteuid());
+    }
 
-    // First, sync the database
-    printf("\nSyncing package database...\n");
-    fflush(stdout);
-    int sync_result = system("pacman -Sy --noconfirm");
-    if (sync_result != 0) {
-        fprintf(stderr, "WARNING: Database sync failed (exit code: %d)\n", sync_result);
-        fprintf(stderr, "Continuing anyway...\n");
+    // pacman would only fail with "target not found"
+    const DriverInfo *unavailable = find_unavailable_driver(drivers, count);
+    if (unavailable != NULL) {
+        fprintf(stderr, "ERROR: %s (%s) is not in the configured repositories, not installing\n",
+                unavailable->name, unavailable->package);
+        snprintf(install_error, sizeof(install_error), "%s",
+                 package_txn_error_name(PACKAGE_TXN_ERR_NOT_FOUND));
+        return false;
     }
 
-    // Build pacman install command with --overwrite to handle file conflicts
-    char command[512];
-    snprintf(command, sizeof(command),
-            "pacman -S --noconfirm --needed --overwrite '*' %s",
-            driver->package);
+    InstallStep *steps;
+    int step_count = build_install_plan(drivers, count, &steps);
+    if (step_count == 0) {
+        fprintf(stderr, "ERROR: Out of memory\n");
+        snprintf(install_error, sizeof(install_error), "failed");
+        return false;
+    }
 
-    printf("\nExecuting: %s\n", command);
-    printf("-----------------------------------\n");
-    fflush(stdout);
+    bool success = true;
 
-    int result = system(command);
+    // With libalpm the package steps run in this process
+    bool in_process = package_txn_supported();
+    PackageTxn *txn = NULL;
+    PackageTxnResult txn_result;
+    memset(&txn_result, 0, sizeof(txn_result));
 
-    printf("-----------------------------------\n");
-    printf("Command exit code: %d\n", result);
+    // The local database before the install step, to find what it installed
+    InitramfsSnapshot before = { NULL, NULL, -1 };
 
-    if (result == 0) {
-        driver->is_installed = true;
-        printf("\n✓ Successfully installed %s\n", driver->package);
+    if (steps[0].kind != INSTALL_STEP_SYNC) {
+        printf("\nPackage databases synced %ld min ago (TTL %d min), skipping sync\n",
+               package_sync_age() / 60, sync_ttl / 60);
+    }
 
-        // If this is a driver that needs reboot (kernel modules), rebuild initramfs
-        if (driver->needs_reboot) {
-            printf("\n=== Rebuilding Kernel Initramfs ===\n");
-            printf("Running: mkinitcpio -P\n");
-            printf("This may take a minute...\n");
+    for (int i = 0; i < step_count && success; i++) {
+        InstallStep *step = &steps[i];
+
+        printf("\n=== %s ===\n", step->title);
+
+        if (step->kind == INSTALL_STEP_INSTALL) {
+            initramfs_snapshot_take(&before);
+        }
+
+        unsigned long long span = trace_begin();
+        int result;
+        if (step->kind == INSTALL_STEP_INITRAMFS) {
+            // Release the package database first; a SIGINT held back during
+            // the commit is delivered here, before mkinitcpio starts
+            package_txn_close(txn);
+            txn = NULL;
+            result = run_initramfs_step(&before, step);
+        } else if (in_process) {
+            result = run_package_step(&txn, drivers, count, step, &txn_result);
+        } else {
+            printf("Executing: ");
+            print_command(stdout, step->argv);
             printf("-----------------------------------\n");
             fflush(stdout);
 
-            int mkinit_result = system("mkinitcpio -P");
+            // Output goes straight to our terminal
+            ProcResult proc_result;
+            proc_run(step->argv, PROC_INHERIT, &proc_result);
+            result = proc_result.exit_code;
+        }
+        trace_end(span, "install", step->title, "%s: exit %d",
+                  in_process && step->kind != INSTALL_STEP_INITRAMFS ? "libalpm" : step->argv[0],
+                  result);
+
+        printf("-----------------------------------\n");
+        printf("Command exit code: %d\n", result);
 
-            printf("-----------------------------------\n");
-            if (mkinit_result == 0) {
+        if (result == 0) {
+            if (step->kind == INSTALL_STEP_SYNC) {
+                mark_packages_synced();
+            } else if (step->kind == INSTALL_STEP_INSTALL) {
+                mark_drivers_installed(drivers, count);
+                printf("\n✓ Successfully installed the selected drivers\n");
+            } else if (step->kind == INSTALL_STEP_INITRAMFS) {
                 printf("✓ Kernel initramfs rebuilt successfully\n\n");
-            } else {
-                fprintf(stderr, "⚠ Warning: mkinitcpio failed (exit code: %d)\n", mkinit_result);
-                fprintf(stderr, "You may need to run manually: sudo mkinitcpio -P\n\n");
-                // Don't fail the installation, just warn
             }
+            continue;
         }
 
-        return true;
-    } else {
-        // Decode the exit code
-        int actual_exit = WEXITSTATUS(result);
-        fprintf(stderr, "\n✗ Failed to install %s\n", driver->package);
-        fprintf(stderr, "System return code: %d\n", result);
-        fprintf(stderr, "Actual exit status: %d\n", actual_exit);
-        fprintf(stderr, "\nPossible reasons:\n");
-        fprintf(stderr, "  - Package '%s' not found in repositories\n", driver->package);
-        fprintf(stderr, "  - Network connection issue\n");
-        fprintf(stderr, "  - Package database out of sync\n");
-        fprintf(stderr, "  - Conflicting packages\n");
-        fprintf(stderr, "\nTry manually: sudo pacman -S %s\n\n", driver->package);
-        return false;
+        switch (step->kind) {
+        case INSTALL_STEP_SYNC:
+            if (in_process) {
+                print_package_error(&txn_result);
+            }
+            fprintf(stderr, "WARNING: Database sync failed (exit code: %d)\n", result);
+            fprintf(stderr, "Continuing anyway...\n");
+            break;
+        case INSTALL_STEP_INITRAMFS:
+            fprintf(stderr, "⚠ Warning: mkinitcpio failed (exit code: %d)\n", result);
+            fprintf(stderr, "You may need to run manually: sudo mkinitcpio -P\n\n");
+            // Don't fail the installation, just warn
+            break;
+        case INSTALL_STEP_INSTALL:
+            fprintf(stderr, "\n✗ Failed to install the selected drivers\n");
+            success = false;
+            if (in_process) {
+                print_package_error(&txn_result);
+                snprintf(install_error, sizeof(install_error), "%s",
+                         package_txn_error_name(txn_result.error));
+                break;
+            }
+            snprintf(install_error, sizeof(install_error), "failed");
+            fprintf(stderr, "Exit status: %d%s\n", result,
+                    result < 0 ? " (could not be started)" : result > 128 ? " (killed by a signal)" : "");
+            fprintf(stderr, "\nPossible reasons:\n");
+            fprintf(stderr, "  - Package not found in repositories\n");
+            fprintf(stderr, "  - Network connection issue\n");
+            fprintf(stderr, "  - Package database out of sync\n");
+            fprintf(stderr, "  - Conflicting packages\n");
+            fprintf(stderr, "\nTry manually: sudo ");
+            print_command(stderr, step->argv);
+            fprintf(stderr, "\n");
+            break;
+        }
     }
+
+    package_txn_result_clear(&txn_result);
+    package_txn_close(txn);
+    initramfs_snapshot_free(&before);
+    free_install_plan(steps, step_count);
+    return success;
 }
 
-// Free driver list
-void free_driver_list(DriverInfo *driver_list, int count) {
-    if (driver_list != NULL) {
-        free(driver_list);
-    }
+// Install a driver as a one-element batch
+bool install_driver(DriverInfo *driver) {
+    return install_drivers(&driver, 1);
 }
@@ -0,0 +1,145 @@
+/*
+ * Driver database implementation
+ *
+ * Combines the built-in table generated from data/drivers.conf with the
+ * optional system-wide override file.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "../include/driver_db.h"
+
+// Generated from data/drivers.conf by tools/gen_driver_table.c
+extern const DriverDbIndex driver_db_builtin;
+
+// Override file state
+static char override_path[256] = DRIVER_DB_OVERRIDE_DEFAULT;
+static DriverDbFile override_file;
+static DriverDbIndex override_index;
+static bool override_loaded = false;
+static struct timespec override_mtime;
+static off_t override_size = -1;
+
+// Drop the loaded override entries
+static void unload_override(void) {
+    if (override_loaded) {
+        driver_db_index_free(&override_index);
+        driver_db_file_free(&override_file);
+        override_loaded = false;
+    }
+}
+
+// Re-read the override file if it changed
+bool driver_db_reload(void) {
+    struct stat st;
+    if (stat(override_path, &st) != 0) {
+        // No override file is the normal case
+        unload_override();
+        override_size = -1;
+        return true;
+    }
+
+    if (st.st_size == override_size &&
+        st.st_mtim.tv_sec == override_mtime.tv_sec &&
+        st.st_mtim.tv_nsec == override_mtime.tv_nsec) {
+        return true;
+    }
+
+    override_mtime = st.st_mtim;
+    override_size = st.st_size;
+    unload_override();
+
+    if (!driver_db_file_load(override_path, &override_file)) {
+        fprintf(stderr, "Ignoring driver database override %s\n", override_path);
+        return false;
+    }
+
+    if (!driver_db_index_build(override_file.entries, override_file.count, &override_index)) {
+        driver_db_file_free(&override_file);
+        return false;
+    }
+
+    override_loaded = true;
+    printf("Loaded %d driver database overrides from %s\n", override_file.count, override_path);
+
+    return true;
+}
+
+// Use another override file
+void set_driver_db_override_path(const char *path) {
+    strncpy(override_path, path != NULL ? path : DRIVER_DB_OVERRIDE_DEFAULT,
+            sizeof(override_path) - 1);
+    override_path[sizeof(override_path) - 1] = '\0';
+
+    unload_override();
+    override_size = -1;
+}
+
+// Whether two entries have the same match column and type
+static bool same_match(const DriverMapping *a, const DriverMapping *b) {
+    return a->vendor_id == b->vendor_id && a->device_first == b->device_first &&
+           a->device_last == b->device_last && a->hw_type == b->hw_type;
+}
+
+// Collect all entries matching a device, override file first
+int driver_db_match(const HardwareInfo *hw, const DriverMapping **matches, int max_matches) {
+    int count = 0;
+
+    if (override_loaded) {
+        count = driver_db_index_lookup(&override_index, hw, matches, max_matches);
+    }
+    int override_count = count;
+
+    count += driver_db_index_lookup(&driver_db_builtin, hw, matches + count, max_matches - count);
+
+    // An override entry replaces the built-in ones with its match and type
+    int kept = override_count;
+    for (int i = override_count; i < count; i++) {
+        bool replaced = false;
+        for (int j = 0; j < override_count && !replaced; j++) {
+            replaced = same_match(matches[j], matches[i]);
+        }
+        if (!replaced) {
+            matches[kept++] = matches[i];
+        }
+    }
+
+    return kept;
+}
+
+// FNV-1a over a string, continuing from hash
+static unsigned long long fingerprint_string(unsigned long long hash, const char *str) {
+    for (; *str; str++) {
+        hash ^= (unsigned char)*str;
+        hash *= 1099511628211ull;
+    }
+    return hash * 1099511628211ull;
+}
+
+// Hash of the built-in entries and the override file's identity
+unsigned long long driver_db_fingerprint(void) {
+    unsigned long long hash = 14695981039346656037ull;
+
+    for (unsigned int i = 0; i < driver_db_builtin.entry_count; i++) {
+        const DriverMapping *entry = &driver_db_builtin.entries[i];
+        hash = fingerprint_string(hash, entry->package_name);
+        hash = fingerprint_string(hash, entry->driver_name);
+        hash = fingerprint_string(hash, entry->description);
+        hash ^= (unsigned long long)entry->vendor_id << 32 | entry->device_first << 16 | entry->device_last;
+        hash ^= (unsigned long long)entry->hw_type << 2 | entry->needs_reboot << 1 | entry->is_recommended;
+        hash *= 1099511628211ull;
+    }
+
+    hash = fingerprint_string(hash, override_path);
+
+    struct stat st;
+    if (stat(override_path, &st) == 0) {
+        hash ^= (unsigned long long)st.st_mtim.tv_sec * 1000000000ull + st.st_mtim.tv_nsec;
+        hash *= 1099511628211ull;
+        hash ^= (unsigned long long)st.st_size;
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
@@ -0,0 +1,591 @@
+/*
+ * Driver database file parser and index
+ *
+ * Shared by the runtime (override file) and tools/gen_driver_table.c,
+ * which compiles data/drivers.conf into the built-in table.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "../include/driver_db.h"
+
+#define EMPTY_SLOT 0xffffffffu
+
+// Largest displacement tried per bucket before growing the table
+#define MAX_DISPLACEMENT 0x10000u
+
+static const char *type_names[] = {
+    [HW_GPU_NVIDIA] = "gpu-nvidia",
+    [HW_GPU_AMD] = "gpu-amd",
+    [HW_GPU_INTEL] = "gpu-intel",
+    [HW_NETWORK] = "network",
+    [HW_AUDIO] = "audio",
+    [HW_UNKNOWN] = "unknown",
+};
+
+#define TYPE_COUNT ((int)(sizeof(type_names) / sizeof(type_names[0])))
+
+// Hardware type names used in database files
+const char *driver_db_type_name(HardwareType type) {
+    if ((int)type < 0 || (int)type >= TYPE_COUNT) {
+        return "unknown";
+    }
+    return type_names[type];
+}
+
+// Hash used by the index (a murmur3-style finalizer)
+unsigned int driver_db_hash(unsigned int key, unsigned int seed) {
+    unsigned int h = key ^ (seed * 0x9e3779b9u);
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// Strip leading and trailing whitespace in place
+static char *trim(char *str) {
+    while (isspace((unsigned char)*str)) {
+        str++;
+    }
+
+    char *end = str + strlen(str);
+    while (end > str && isspace((unsigned char)end[-1])) {
+        end--;
+    }
+    *end = '\0';
+
+    return str;
+}
+
+// Parse a 16-bit hexadecimal ID
+static bool parse_id(const char *str, unsigned int *id) {
+    char *end;
+    unsigned long value = strtoul(str, &end, 16);
+    if (end == str || *end != '\0' || value >= DRIVER_DB_ANY_ID) {
+        return false;
+    }
+    *id = (unsigned int)value;
+    return true;
+}
+
+// Parse the match column: "*", "VVVV:*", "VVVV:DDDD" or "VVVV:DDDD-DDDD"
+static bool parse_match(char *match, DriverMapping *entry) {
+    if (strcmp(match, "*") == 0) {
+        entry->vendor_id = DRIVER_DB_ANY_ID;
+        entry->device_first = DRIVER_DB_ANY_ID;
+        entry->device_last = DRIVER_DB_ANY_ID;
+        return true;
+    }
+
+    char *colon = strchr(match, ':');
+    if (colon == NULL) {
+        return false;
+    }
+    *colon = '\0';
+
+    if (!parse_id(match, &entry->vendor_id)) {
+        return false;
+    }
+
+    char *device = colon + 1;
+    if (strcmp(device, "*") == 0) {
+        entry->device_first = DRIVER_DB_ANY_ID;
+        entry->device_last = DRIVER_DB_ANY_ID;
+        return true;
+    }
+
+    char *dash = strchr(device, '-');
+    if (dash != NULL) {
+        *dash = '\0';
+        if (!parse_id(device, &entry->device_first) || !parse_id(dash + 1, &entry->device_last)) {
+            return false;
+        }
+    } else {
+        if (!parse_id(device, &entry->device_first)) {
+            return false;
+        }
+        entry->device_last = entry->device_first;
+    }
+
+    return entry->device_first <= entry->device_last &&
+           entry->device_last - entry->device_first < DRIVER_DB_MAX_RANGE;
+}
+
+// Parse the flags column
+static bool parse_flags(char *flags, DriverMapping *entry) {
+    if (strcmp(flags, "-") == 0) {
+        return true;
+    }
+
+    char *saveptr;
+    for (char *flag = strtok_r(flags, ",", &saveptr); flag != NULL;
+         flag = strtok_r(NULL, ",", &saveptr)) {
+        flag = trim(flag);
+        if (strcmp(flag, "reboot") == 0) {
+            entry->needs_reboot = true;
+        } else if (strcmp(flag, "recommended") == 0) {
+            entry->is_recommended = true;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Parse one non-comment line into an entry
+static bool parse_entry(char *line, DriverMapping *entry) {
+    char *fields[6];
+    int field_count = 0;
+
+    char *pos = line;
+    while (field_count < 6) {
+        fields[field_count++] = pos;
+        char *bar = strchr(pos, '|');
+        if (bar == NULL) {
+            break;
+        }
+        *bar = '\0';
+        pos = bar + 1;
+    }
+
+    // The description is the last column and may not contain '|'
+    if (field_count != 6 || strchr(pos, '|') != NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < field_count; i++) {
+        fields[i] = trim(fields[i]);
+        if (fields[i][0] == '\0') {
+            return false;
+        }
+    }
+
+    memset(entry, 0, sizeof(DriverMapping));
+
+    if (!parse_match(fields[0], entry)) {
+        return false;
+    }
+
+    entry->hw_type = HW_UNKNOWN;
+    bool type_found = false;
+    for (int i = 0; i < TYPE_COUNT; i++) {
+        if (strcmp(fields[1], type_names[i]) == 0) {
+            entry->hw_type = (HardwareType)i;
+            type_found = true;
+            break;
+        }
+    }
+    if (!type_found || !parse_flags(fields[2], entry)) {
+        return false;
+    }
+
+    entry->package_name = fields[3];
+    entry->driver_name = fields[4];
+    entry->description = fields[5];
+
+    return true;
+}
+
+// Parse a driver database file
+bool driver_db_file_load(const char *path, DriverDbFile *file) {
+    memset(file, 0, sizeof(DriverDbFile));
+
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return false;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    rewind(fp);
+    if (size < 0) {
+        fclose(fp);
+        return false;
+    }
+
+    file->text = malloc(size + 1);
+    if (file->text == NULL) {
+        fclose(fp);
+        return false;
+    }
+
+    size_t len = fread(file->text, 1, size, fp);
+    fclose(fp);
+    file->text[len] = '\0';
+
+    // One entry per line at most
+    int max_entries = 1;
+    for (size_t i = 0; i < len; i++) {
+        if (file->text[i] == '\n') {
+            max_entries++;
+        }
+    }
+
+    file->entries = malloc(sizeof(DriverMapping) * max_entries);
+    if (file->entries == NULL) {
+        driver_db_file_free(file);
+        return false;
+    }
+
+    bool ok = true;
+    int line_number = 0;
+    char *line = file->text;
+    while (line != NULL) {
+        char *newline = strchr(line, '\n');
+        if (newline != NULL) {
+            *newline = '\0';
+        }
+        line_number++;
+
+        char *content = trim(line);
+        if (content[0] != '\0' && content[0] != '#') {
+            if (parse_entry(content, &file->entries[file->count])) {
+                file->count++;
+            } else {
+                fprintf(stderr, "%s:%d: invalid driver database entry\n", path, line_number);
+                ok = false;
+            }
+        }
+
+        line = newline != NULL ? newline + 1 : NULL;
+    }
+
+    if (!ok) {
+        driver_db_file_free(file);
+    }
+
+    return ok;
+}
+
+// Free a parsed file
+void driver_db_file_free(DriverDbFile *file) {
+    free(file->entries);
+    free(file->text);
+    memset(file, 0, sizeof(DriverDbFile));
+}
+
+// A key covered by an entry
+typedef struct {
+    unsigned int key;
+    unsigned int entry;
+} KeyEntry;
+
+static int compare_key_entries(const void *a, const void *b) {
+    const KeyEntry *ka = a;
+    const KeyEntry *kb = b;
+    if (ka->key != kb->key) {
+        return ka->key < kb->key ? -1 : 1;
+    }
+    return ka->entry < kb->entry ? -1 : (ka->entry > kb->entry);
+}
+
+// Bucket order for the displacement search: biggest buckets first
+typedef struct {
+    unsigned int bucket;
+    unsigned int size;
+} BucketSize;
+
+static int compare_bucket_sizes(const void *a, const void *b) {
+    const BucketSize *ba = a;
+    const BucketSize *bb = b;
+    if (ba->size != bb->size) {
+        return ba->size > bb->size ? -1 : 1;
+    }
+    return ba->bucket < bb->bucket ? -1 : (ba->bucket > bb->bucket);
+}
+
+// Find a displacement for every bucket so that all keys land in distinct slots
+static bool place_keys(const unsigned int *keys, unsigned int key_count,
+                       unsigned int bucket_count, unsigned int slot_count,
+                       unsigned int *displacements, unsigned int *slot_of_key) {
+    unsigned int *bucket_of_key = malloc(sizeof(unsigned int) * key_count);
+    BucketSize *order = calloc(bucket_count, sizeof(BucketSize));
+    bool *used = calloc(slot_count, sizeof(bool));
+    bool ok = bucket_of_key != NULL && order != NULL && used != NULL;
+
+    for (unsigned int b = 0; ok && b < bucket_count; b++) {
+        order[b].bucket = b;
+    }
+    for (unsigned int k = 0; ok && k < key_count; k++) {
+        bucket_of_key[k] = driver_db_hash(keys[k], 0) & (bucket_count - 1);
+        order[bucket_of_key[k]].size++;
+    }
+    if (ok) {
+        qsort(order, bucket_count, sizeof(BucketSize), compare_bucket_sizes);
+    }
+
+    for (unsigned int i = 0; ok && i < bucket_count && order[i].size > 0; i++) {
+        unsigned int bucket = order[i].bucket;
+        bool placed = false;
+
+        for (unsigned int d = 0; d < MAX_DISPLACEMENT && !placed; d++) {
+            placed = true;
+
+            // Tentatively claim slots, rolling back on the first collision
+            for (unsigned int k = 0; k < key_count; k++) {
+                if (bucket_of_key[k] != bucket) {
+                    continue;
+                }
+                unsigned int slot = driver_db_hash(keys[k], d + 1) & (slot_count - 1);
+                if (used[slot]) {
+                    for (unsigned int j = 0; j < k; j++) {
+                        if (bucket_of_key[j] == bucket) {
+                            used[slot_of_key[j]] = false;
+                        }
+                    }
+                    placed = false;
+                    break;
+                }
+                used[slot] = true;
+                slot_of_key[k] = slot;
+            }
+
+            if (placed) {
+                displacements[bucket] = d;
+            }
+        }
+
+        ok = placed;
+    }
+
+    free(bucket_of_key);
+    free(order);
+    free(used);
+    return ok;
+}
+
+// Build the lookup index for a set of entries
+bool driver_db_index_build(const DriverMapping *entries, unsigned int count, DriverDbIndex *index) {
+    memset(index, 0, sizeof(DriverDbIndex));
+    index->entries = entries;
+    index->entry_count = count;
+
+    // Expand every entry into the keys it covers
+    size_t pair_count = 0;
+    unsigned int type_total = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        if (entries[i].vendor_id == DRIVER_DB_ANY_ID) {
+            type_total++;
+        } else if (entries[i].device_first == DRIVER_DB_ANY_ID) {
+            pair_count++;
+        } else {
+            pair_count += entries[i].device_last - entries[i].device_first + 1;
+        }
+    }
+
+    KeyEntry *pairs = malloc(sizeof(KeyEntry) * (pair_count + 1));
+    unsigned int *type_first = calloc(TYPE_COUNT, sizeof(unsigned int));
+    unsigned int *type_matches = calloc(TYPE_COUNT, sizeof(unsigned int));
+    unsigned int *type_list = malloc(sizeof(unsigned int) * (type_total + 1));
+    if (pairs == NULL || type_first == NULL || type_matches == NULL || type_list == NULL) {
+        free(pairs);
+        free(type_first);
+        free(type_matches);
+        free(type_list);
+        return false;
+    }
+
+    size_t p = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        const DriverMapping *entry = &entries[i];
+        if (entry->vendor_id == DRIVER_DB_ANY_ID) {
+            type_matches[entry->hw_type]++;
+        } else if (entry->device_first == DRIVER_DB_ANY_ID) {
+            pairs[p].key = entry->vendor_id << 16 | DRIVER_DB_ANY_ID;
+            pairs[p++].entry = i;
+        } else {
+            for (unsigned int d = entry->device_first; d <= entry->device_last; d++) {
+                pairs[p].key = entry->vendor_id << 16 | d;
+                pairs[p++].entry = i;
+            }
+        }
+    }
+
+    // Type-wide entries, grouped per type in file order
+    unsigned int offset = 0;
+    for (int t = 0; t < TYPE_COUNT; t++) {
+        type_first[t] = offset;
+        offset += type_matches[t];
+        type_matches[t] = 0;
+    }
+    for (unsigned int i = 0; i < count; i++) {
+        if (entries[i].vendor_id == DRIVER_DB_ANY_ID) {
+            HardwareType t = entries[i].hw_type;
+            type_list[type_first[t] + type_matches[t]++] = i;
+        }
+    }
+
+    index->type_first = type_first;
+    index->type_matches = type_matches;
+    index->type_list = type_list;
+    index->type_list_count = type_total;
+
+    // Group the pairs by key
+    qsort(pairs, pair_count, sizeof(KeyEntry), compare_key_entries);
+
+    unsigned int key_count = 0;
+    for (size_t i = 0; i < pair_count; i++) {
+        if (i == 0 || pairs[i].key != pairs[i - 1].key) {
+            key_count++;
+        }
+    }
+
+    unsigned int *keys = malloc(sizeof(unsigned int) * (key_count + 1));
+    unsigned int *key_first = malloc(sizeof(unsigned int) * (key_count + 1));
+    unsigned int *key_matches = calloc(key_count + 1, sizeof(unsigned int));
+    unsigned int *match_list = malloc(sizeof(unsigned int) * (pair_count + 1));
+    bool ok = keys != NULL && key_first != NULL && key_matches != NULL && match_list != NULL;
+
+    unsigned int k = 0;
+    for (size_t i = 0; ok && i < pair_count; i++) {
+        if (i == 0 || pairs[i].key != pairs[i - 1].key) {
+            keys[k] = pairs[i].key;
+            key_first[k] = (unsigned int)i;
+            k++;
+        }
+        key_matches[k - 1]++;
+        match_list[i] = pairs[i].entry;
+    }
+    free(pairs);
+
+    index->match_list = match_list;
+    index->match_count = (unsigned int)pair_count;
+
+    // Perfect hash over the keys: ~4 keys per bucket, load factor <= 0.8
+    unsigned int bucket_count = 1;
+    while (bucket_count * 4 < key_count) {
+        bucket_count *= 2;
+    }
+    unsigned int slot_count = 1;
+    while (slot_count * 4 < key_count * 5) {
+        slot_count *= 2;
+    }
+
+    unsigned int *displacements = NULL;
+    unsigned int *slot_of_key = malloc(sizeof(unsigned int) * (key_count + 1));
+    ok = ok && slot_of_key != NULL;
+
+    while (ok) {
+        free(displacements);
+        displacements = calloc(bucket_count, sizeof(unsigned int));
+        if (displacements == NULL) {
+            ok = false;
+            break;
+        }
+        if (place_keys(keys, key_count, bucket_count, slot_count, displacements, slot_of_key)) {
+            break;
+        }
+        // Unlucky: retry with more room
+        slot_count *= 2;
+    }
+
+    unsigned int *slot_keys = ok ? malloc(sizeof(unsigned int) * slot_count) : NULL;
+    unsigned int *slot_first = ok ? calloc(slot_count, sizeof(unsigned int)) : NULL;
+    unsigned int *slot_matches = ok ? calloc(slot_count, sizeof(unsigned int)) : NULL;
+    ok = ok && slot_keys != NULL && slot_first != NULL && slot_matches != NULL;
+
+    if (ok) {
+        memset(slot_keys, 0xff, sizeof(unsigned int) * slot_count);
+        for (unsigned int i = 0; i < key_count; i++) {
+            unsigned int slot = slot_of_key[i];
+            slot_keys[slot] = keys[i];
+            slot_first[slot] = key_first[i];
+            slot_matches[slot] = key_matches[i];
+        }
+    }
+
+    free(keys);
+    free(key_first);
+    free(key_matches);
+    free(slot_of_key);
+
+    index->displacements = displacements;
+    index->bucket_count = bucket_count;
+    index->slot_keys = slot_keys;
+    index->slot_first = slot_first;
+    index->slot_matches = slot_matches;
+    index->slot_count = slot_count;
+
+    if (!ok) {
+        driver_db_index_free(index);
+    }
+
+    return ok;
+}
+
+// Free an index created by driver_db_index_build()
+void driver_db_index_free(DriverDbIndex *index) {
+    free((void *)index->displacements);
+    free((void *)index->slot_keys);
+    free((void *)index->slot_first);
+    free((void *)index->slot_matches);
+    free((void *)index->match_list);
+    free((void *)index->type_first);
+    free((void *)index->type_matches);
+    free((void *)index->type_list);
+    memset(index, 0, sizeof(DriverDbIndex));
+}
+
+// Find the entry list for a key (O(1): two hashes and one comparison)
+static const unsigned int *lookup_key(const DriverDbIndex *index, unsigned int key,
+                                      unsigned int *matches) {
+    *matches = 0;
+    if (index->slot_count == 0 || index->bucket_count == 0) {
+        return NULL;
+    }
+
+    unsigned int bucket = driver_db_hash(key, 0) & (index->bucket_count - 1);
+    unsigned int slot = driver_db_hash(key, index->displacements[bucket] + 1) & (index->slot_count - 1);
+    if (index->slot_keys[slot] != key) {
+        return NULL;
+    }
+
+    *matches = index->slot_matches[slot];
+    return &index->match_list[index->slot_first[slot]];
+}
+
+// Collect the entries of one index matching a device, in file order
+int driver_db_index_lookup(const DriverDbIndex *index, const HardwareInfo *hw,
+                           const DriverMapping **matches, int max_matches) {
+    const unsigned int *lists[3] = {NULL, NULL, NULL};
+    unsigned int lengths[3] = {0, 0, 0};
+    unsigned int positions[3] = {0, 0, 0};
+
+    // Entries use PCI IDs; devices from the lspci fallback have no IDs at all.
+    // Both only match type-wide entries.
+    if (hw->bus == HW_BUS_PCI && hw->vendor_id != 0) {
+        lists[0] = lookup_key(index, hw->vendor_id << 16 | hw->device_id, &lengths[0]);
+        lists[1] = lookup_key(index, hw->vendor_id << 16 | DRIVER_DB_ANY_ID, &lengths[1]);
+    }
+    if ((int)hw->type >= 0 && (int)hw->type < TYPE_COUNT && index->type_matches != NULL) {
+        lists[2] = &index->type_list[index->type_first[hw->type]];
+        lengths[2] = index->type_matches[hw->type];
+    }
+
+    // Merge the three ascending lists, keeping entries of the device's type
+    int count = 0;
+    while (count < max_matches) {
+        int best = -1;
+        for (int l = 0; l < 3; l++) {
+            if (positions[l] < lengths[l] &&
+                (best < 0 || lists[l][positions[l]] < lists[best][positions[best]])) {
+                best = l;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+
+        const DriverMapping *entry = &index->entries[lists[best][positions[best]++]];
+        if (entry->hw_type == hw->type) {
+            matches[count++] = entry;
+        }
+    }
+
+    return count;
+}
@@ -0,0 +1,330 @@
+/*
+ * Driver list model implementation
+ *
+ * Every detected driver has a DriverItem, kept across refreshes by its
+ * package set. The model shows the items that pass the filter, in the chosen
+ * order; a refresh, filter or sort change reports only the part of that list
+ * that differs, so a bound GtkListBox keeps the rows around it.
+ */
+
+#include <string.h>
+#include "../include/driver_list.h"
+
+struct _DriverItem {
+    GObject parent_instance;
+    char *key;
+    DriverInfo driver;          // Copy; strings point into the caller's arena
+    char *name_key;             // Collation key of driver.name, for sorting
+    guint order;                // Position in detection order
+    bool selected;
+};
+
+enum {
+    ITEM_CHANGED,
+    ITEM_SIGNAL_COUNT
+};
+
+static guint item_signals[ITEM_SIGNAL_COUNT];
+
+G_DEFINE_TYPE(DriverItem, driver_item, G_TYPE_OBJECT)
+
+// Free an item's strings
+static void driver_item_finalize(GObject *object) {
+    DriverItem *item = DRIVER_ITEM(object);
+    g_free(item->key);
+    g_free(item->name_key);
+    G_OBJECT_CLASS(driver_item_parent_class)->finalize(object);
+}
+
+static void driver_item_class_init(DriverItemClass *klass) {
+    G_OBJECT_CLASS(klass)->finalize = driver_item_finalize;
+    item_signals[ITEM_CHANGED] = g_signal_new("changed", G_TYPE_FROM_CLASS(klass), G_SIGNAL_RUN_LAST,
+                                              0, NULL, NULL, NULL, G_TYPE_NONE, 0);
+}
+
+static void driver_item_init(DriverItem *item) {
+    (void)item;  // Unused
+}
+
+// Package set identifying the item's driver
+const char *driver_item_get_key(DriverItem *item) {
+    return item->key;
+}
+
+// The item's current driver data
+const DriverInfo *driver_item_get_driver(DriverItem *item) {
+    return &item->driver;
+}
+
+// Whether the driver can be installed
+bool driver_item_get_installable(DriverItem *item) {
+    return !item->driver.is_installed && item->driver.availability != DRIVER_UNAVAILABLE;
+}
+
+// Selection for batch installs
+bool driver_item_get_selected(DriverItem *item) {
+    return item->selected;
+}
+
+void driver_item_set_selected(DriverItem *item, bool selected) {
+    item->selected = selected;
+}
+
+struct _DriverList {
+    GObject parent_instance;
+    GPtrArray *items;           // Every item, in detection order
+    GHashTable *by_key;         // Package set -> item (not owned)
+    GPtrArray *shown;           // Items passing the filter, sorted
+    DriverListFilter filter;
+    DriverListSort sort;
+};
+
+static void driver_list_model_init(GListModelInterface *iface);
+
+G_DEFINE_TYPE_WITH_CODE(DriverList, driver_list, G_TYPE_OBJECT,
+                        G_IMPLEMENT_INTERFACE(G_TYPE_LIST_MODEL, driver_list_model_init))
+
+// GListModel: type of the items
+static GType driver_list_get_item_type(GListModel *model) {
+    (void)model;  // Unused
+    return DRIVER_TYPE_ITEM;
+}
+
+// GListModel: number of shown items
+static guint driver_list_get_n_items(GListModel *model) {
+    return DRIVER_LIST(model)->shown->len;
+}
+
+// GListModel: a shown item (new reference)
+static gpointer driver_list_get_item(GListModel *model, guint position) {
+    DriverList *list = DRIVER_LIST(model);
+    return position < list->shown->len ? g_object_ref(g_ptr_array_index(list->shown, position)) : NULL;
+}
+
+static void driver_list_model_init(GListModelInterface *iface) {
+    iface->get_item_type = driver_list_get_item_type;
+    iface->get_n_items = driver_list_get_n_items;
+    iface->get_item = driver_list_get_item;
+}
+
+// Free the item arrays
+static void driver_list_finalize(GObject *object) {
+    DriverList *list = DRIVER_LIST(object);
+    g_hash_table_destroy(list->by_key);
+    g_ptr_array_unref(list->shown);
+    g_ptr_array_unref(list->items);
+    G_OBJECT_CLASS(driver_list_parent_class)->finalize(object);
+}
+
+static void driver_list_class_init(DriverListClass *klass) {
+    G_OBJECT_CLASS(klass)->finalize = driver_list_finalize;
+}
+
+static void driver_list_init(DriverList *list) {
+    list->items = g_ptr_array_new_with_free_func(g_object_unref);
+    list->shown = g_ptr_array_new_with_free_func(g_object_unref);
+    list->by_key = g_hash_table_new(g_str_hash, g_str_equal);
+    list->filter.hw_type = -1;
+    list->sort = DRIVER_LIST_SORT_DETECTION;
+}
+
+// Create an empty list
+DriverList *driver_list_new(void) {
+    return g_object_new(DRIVER_TYPE_LIST, NULL);
+}
+
+// Check whether two versions of a driver look the same in the list
+static bool driver_info_equal(const DriverInfo *a, const DriverInfo *b) {
+    return a->hw_type == b->hw_type &&
+           a->is_installed == b->is_installed &&
+           a->is_recommended == b->is_recommended &&
+           a->needs_reboot == b->needs_reboot &&
+           a->availability == b->availability &&
+           a->update_available == b->update_available &&
+           a->download_size == b->download_size &&
+           strcmp(a->name, b->name) == 0 &&
+           strcmp(a->description, b->description) == 0 &&
+           strcmp(a->version, b->version) == 0 &&
+           strcmp(a->repo_version, b->repo_version) == 0 &&
+           strcmp(a->repository, b->repository) == 0;
+}
+
+// Check an item against the filter
+static bool item_matches(const DriverList *list, const DriverItem *item) {
+    const DriverInfo *driver = &item->driver;
+
+    if (list->filter.recommended_only && !driver->is_recommended) {
+        return false;
+    }
+    if (list->filter.not_installed_only && driver->is_installed) {
+        return false;
+    }
+    return list->filter.hw_type < 0 || (int)driver->hw_type == list->filter.hw_type;
+}
+
+// Rank for DRIVER_LIST_SORT_STATUS
+static int status_rank(const DriverInfo *driver) {
+    if (!driver->is_installed) {
+        return driver->availability == DRIVER_UNAVAILABLE ? 3 : 0;
+    }
+    return driver->update_available ? 1 : 2;
+}
+
+// Order two items by the list's sort key, then by detection order
+static gint compare_items(gconstpointer a, gconstpointer b, gpointer user_data) {
+    const DriverItem *one = *(DriverItem *const *)a;
+    const DriverItem *two = *(DriverItem *const *)b;
+    const DriverList *list = user_data;
+    int result = 0;
+
+    switch (list->sort) {
+    case DRIVER_LIST_SORT_NAME:
+        result = strcmp(one->name_key, two->name_key);
+        break;
+    case DRIVER_LIST_SORT_TYPE:
+        result = (int)one->driver.hw_type - (int)two->driver.hw_type;
+        break;
+    case DRIVER_LIST_SORT_STATUS:
+        result = status_rank(&one->driver) - status_rank(&two->driver);
+        break;
+    case DRIVER_LIST_SORT_DETECTION:
+        break;
+    }
+
+    if (result != 0) {
+        return result;
+    }
+    return (one->order > two->order) - (one->order < two->order);
+}
+
+// Filter and sort again, then report the changed range: the shown lists
+// before and after share a prefix and a suffix in the common cases (a driver
+// installed, a device plugged in), so rows outside the range are kept
+static void update_shown(DriverList *list) {
+    GPtrArray *shown = g_ptr_array_new_full(list->items->len, g_object_unref);
+
+    for (guint i = 0; i < list->items->len; i++) {
+        DriverItem *item = g_ptr_array_index(list->items, i);
+        if (item_matches(list, item)) {
+            g_ptr_array_add(shown, g_object_ref(item));
+        }
+    }
+    if (list->sort != DRIVER_LIST_SORT_DETECTION) {
+        g_ptr_array_sort_with_data(shown, compare_items, list);
+    }
+
+    // The old list still holds its items, so no address can have been reused
+    GPtrArray *old = list->shown;
+    guint prefix = 0;
+    while (prefix < old->len && prefix < shown->len &&
+           g_ptr_array_index(old, prefix) == g_ptr_array_index(shown, prefix)) {
+        prefix++;
+    }
+    guint suffix = 0;
+    while (suffix < old->len - prefix && suffix < shown->len - prefix &&
+           g_ptr_array_index(old, old->len - 1 - suffix) == g_ptr_array_index(shown, shown->len - 1 - suffix)) {
+        suffix++;
+    }
+
+    guint removed = old->len - prefix - suffix;
+    guint added = shown->len - prefix - suffix;
+    list->shown = shown;
+    if (removed > 0 || added > 0) {
+        g_list_model_items_changed(G_LIST_MODEL(list), prefix, removed, added);
+    }
+    g_ptr_array_unref(old);
+}
+
+// Take over new driver data, matching items by package set
+void driver_list_update(DriverList *list, const DriverInfo *drivers, int count,
+                        int *added, int *changed, int *removed) {
+    GPtrArray *items = g_ptr_array_new_full(count > 0 ? count : 0, g_object_unref);
+    GPtrArray *changed_items = g_ptr_array_new();
+
+    *added = 0;
+    *changed = 0;
+    *removed = 0;
+
+    // Items not seen again keep G_MAXUINT
+    for (guint i = 0; i < list->items->len; i++) {
+        ((DriverItem *)g_ptr_array_index(list->items, i))->order = G_MAXUINT;
+    }
+
+    for (int i = 0; i < count; i++) {
+        DriverItem *item = g_hash_table_lookup(list->by_key, drivers[i].package);
+
+        if (item == NULL) {
+            item = g_object_new(DRIVER_TYPE_ITEM, NULL);
+            item->key = g_strdup(drivers[i].package);
+            item->driver = drivers[i];
+            item->name_key = g_utf8_collate_key(drivers[i].name, -1);
+            g_hash_table_insert(list->by_key, item->key, item);
+            (*added)++;
+        } else if (item->order != G_MAXUINT) {
+            continue;   // Listed twice
+        } else {
+            if (!driver_info_equal(&item->driver, &drivers[i])) {
+                if (strcmp(item->driver.name, drivers[i].name) != 0) {
+                    g_free(item->name_key);
+                    item->name_key = g_utf8_collate_key(drivers[i].name, -1);
+                }
+                g_ptr_array_add(changed_items, item);
+                (*changed)++;
+            }
+            item->driver = drivers[i];
+            g_object_ref(item);
+        }
+        if (!driver_item_get_installable(item)) {
+            item->selected = false;
+        }
+        item->order = items->len;
+        g_ptr_array_add(items, item);
+    }
+
+    for (guint i = 0; i < list->items->len; i++) {
+        DriverItem *item = g_ptr_array_index(list->items, i);
+        if (item->order == G_MAXUINT) {
+            g_hash_table_remove(list->by_key, item->key);
+            (*removed)++;
+        }
+    }
+
+    g_ptr_array_unref(list->items);
+    list->items = items;
+    update_shown(list);
+
+    // Rows of items still shown redraw themselves
+    for (guint i = 0; i < changed_items->len; i++) {
+        g_signal_emit(g_ptr_array_index(changed_items, i), item_signals[ITEM_CHANGED], 0);
+    }
+    g_ptr_array_free(changed_items, TRUE);
+}
+
+// Change which drivers are shown
+void driver_list_set_filter(DriverList *list, const DriverListFilter *filter) {
+    list->filter = *filter;
+    update_shown(list);
+}
+
+// Change the order of the shown drivers
+void driver_list_set_sort(DriverList *list, DriverListSort sort) {
+    if (list->sort != sort) {
+        list->sort = sort;
+        update_shown(list);
+    }
+}
+
+// Number of drivers before filtering
+guint driver_list_get_total(DriverList *list) {
+    return list->items->len;
+}
+
+// Item of a driver by package set
+DriverItem *driver_list_lookup(DriverList *list, const char *package) {
+    return g_hash_table_lookup(list->by_key, package);
+}
+
+// Item by detection order
+DriverItem *driver_list_get_nth(DriverList *list, guint index) {
+    return index < list->items->len ? g_ptr_array_index(list->items, index) : NULL;
+}
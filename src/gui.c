@@ -5,57 +5,191 @@
 #include <gtk/gtk.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "../include/gui.h"
 #include "../include/driver.h"
 #include "../include/hardware.h"
+#include "../include/install_dialog.h"
+#include "../include/scan_cache.h"
+#include "../include/hotplug.h"
+#include "../include/trace.h"
+#include "../include/proc.h"
+#include "../include/backend.h"
+#include "../include/driver_list.h"
 
 // Global variables for UI elements
 static GtkWidget *driver_list_box = NULL;
 static GtkWidget *main_window_ref = NULL;
 static GtkWidget *status_bar = NULL;
+static Arena *current_arena = NULL;     // Holds current_hw and current_drivers
+static HardwareInfo *current_hw = NULL;
+static int current_hw_count = 0;
 static DriverInfo *current_drivers = NULL;
 static int driver_count = 0;
+static GtkWidget *install_selected_btn = NULL;
+static const char *backend_socket = NULL;  // System helper, NULL to scan in-process
 
-// Structure to pass driver info to button callbacks
+// The drivers shown, filtered and sorted; driver_list_box is bound to it
+static DriverList *driver_model = NULL;
+static GtkAdjustment *driver_list_adjustment = NULL;   // Vertical scrolling of the list
+static guint fill_rows_source = 0;
+
+// Shown while the list has no rows
+static GtkWidget *placeholder_spinner = NULL;
+static GtkWidget *placeholder_label = NULL;
+
+// Filter and sort controls
+static GtkWidget *type_filter_combo = NULL;
+static GtkWidget *recommended_filter_check = NULL;
+static GtkWidget *not_installed_filter_check = NULL;
+static GtkWidget *sort_combo = NULL;
+
+// Hardware types offered by the type filter, after "All hardware"
+static const struct {
+    HardwareType type;
+    const char *label;
+} type_filters[] = {
+    { HW_GPU_NVIDIA, "NVIDIA graphics" },
+    { HW_GPU_AMD,    "AMD graphics" },
+    { HW_GPU_INTEL,  "Intel graphics" },
+    { HW_NETWORK,    "Network" },
+    { HW_AUDIO,      "Audio" },
+    { HW_UNKNOWN,    "Other" },
+};
+
+// Sort orders, in DriverListSort order
+static const char *const sort_labels[] = { "Detection order", "Name", "Hardware type", "Status" };
+
+// Height of a row whose widgets aren't built yet, close to a built one
+#define DRIVER_ROW_HEIGHT 72
+
+// Key of the per-row data attached to each driver row
+#define DRIVER_ROW_DATA "driver-row"
+
+// Per-row state, owned by the row widget and freed with it. Rows are created
+// empty for every shown driver; their widgets are built once they scroll
+// into view (see fill_visible_rows()).
 typedef struct {
-    int driver_index;
-} DriverButtonData;
+    DriverItem *item;           // The driver shown (reference held)
+    GtkWidget *row;
+    GtkWidget *check;           // NULL until the row is filled
+    GtkWidget *label;
+    GtkWidget *button;
+} DriverRow;
+
+// Background scan state: at most one worker runs, later requests are coalesced
+static bool scan_in_progress = false;
+static bool scan_pending = false;
+
+// An install runs from its confirmation until its dialog closes. Scans wait
+// for it: its end replaces the installed package snapshot a scan reads.
+static bool install_in_progress = false;
+
+static void on_hotplug_burst(const UeventQueue *burst, gpointer user_data);
+static void update_install_buttons(void);
 
 // Helper function to update status bar
 static void update_status(const char *message) {
     if (status_bar != NULL) {
         gtk_label_set_text(GTK_LABEL(status_bar), message);
-        // Force GUI to update
-        while (gtk_events_pending()) {
-            gtk_main_iteration();
+    }
+}
+
+// Install dialog closed (main loop)
+static void on_install_finished(bool success, bool cancelled, gpointer user_data) {
+    bool needs_reboot = GPOINTER_TO_INT(user_data);
+
+    if (success) {
+        update_status("Installation complete.");
+
+        // Check if reboot needed
+        if (needs_reboot) {
+            show_reboot_dialog(main_window_ref);
         }
+    } else if (cancelled) {
+        update_status("Installation cancelled.");
+    } else {
+        update_status("Installation failed. See the installation log for details.");
+    }
+
+    // Refresh the list (some packages may have been installed even on failure);
+    // this also runs any scan requested meanwhile
+    install_in_progress = false;
+    scan_pending = false;
+    refresh_driver_list(driver_list_box);
+}
+
+// The install was called off before it started: run a scan that waited for it
+static void end_install(void) {
+    install_in_progress = false;
+    update_install_buttons();
+    if (scan_pending) {
+        scan_pending = false;
+        refresh_driver_list(driver_list_box);
     }
 }
 
+// Whether an install may start now
+static bool installs_allowed(void) {
+    return !scan_in_progress && !install_in_progress;
+}
+
+// Start installing a batch of drivers in the progress dialog
+static void start_install(DriverInfo **drivers, int count, InstallPrefetch *prefetch) {
+    update_status("Installing...");
+    run_install_dialog(main_window_ref, drivers, count, prefetch, on_install_finished,
+                       GINT_TO_POINTER(drivers_need_reboot(drivers, count)));
+}
+
+// Scan and install through the system helper
+void gui_set_backend(const char *socket_path) {
+    backend_socket = socket_path;
+    set_install_backend(socket_path);
+}
+
 // Callback for window close
 static void on_window_destroy(GtkWidget *widget, gpointer data) {
     (void)widget;  // Unused
     (void)data;    // Unused
 
     // Cleanup
-    if (current_drivers != NULL) {
-        free_driver_list(current_drivers, driver_count);
+    hotplug_stop();
+    if (fill_rows_source != 0) {
+        g_source_remove(fill_rows_source);
+        fill_rows_source = 0;
     }
+    // Rows are destroyed after this handler; their items keep pointing into
+    // the arena, so no row may be filled any more
+    driver_list_box = NULL;
+    arena_destroy(current_arena);
+    current_arena = NULL;
     gtk_main_quit();
 }
 
+// Find a driver in the current list by its package set
+static int find_driver(const char *package) {
+    for (int i = 0; i < driver_count; i++) {
+        if (strcmp(current_drivers[i].package, package) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 // Callback for individual driver install button
 static void on_driver_install_clicked(GtkButton *button, gpointer user_data) {
     (void)button;  // Unused
 
-    DriverButtonData *data = (DriverButtonData *)user_data;
-    int driver_idx = data->driver_index;
+    DriverRow *row_data = (DriverRow *)user_data;
+    int driver_idx = find_driver(driver_item_get_key(row_data->item));
 
-    if (driver_idx < 0 || driver_idx >= driver_count) {
+    if (driver_idx < 0 || !driver_item_get_installable(row_data->item) || !installs_allowed()) {
         return;
     }
 
     DriverInfo *driver = &current_drivers[driver_idx];
+    install_in_progress = true;
+    update_install_buttons();
 
     // Show confirmation (only for non-installed drivers)
     char confirm_msg[512];
@@ -63,6 +197,9 @@ static void on_driver_install_clicked(GtkButton *button, gpointer user_data) {
             "Install %s?\n\nPackage: %s\n%s",
             driver->name, driver->package, driver->description);
 
+    // Download while the user reads the question
+    InstallPrefetch *prefetch = install_prefetch_start(&driver, 1);
+
     GtkWidget *confirm_dialog = gtk_message_dialog_new(GTK_WINDOW(main_window_ref),
                                                        GTK_DIALOG_DESTROY_WITH_PARENT,
                                                        GTK_MESSAGE_QUESTION,
@@ -72,52 +209,368 @@ static void on_driver_install_clicked(GtkButton *button, gpointer user_data) {
     gtk_widget_destroy(confirm_dialog);
 
     if (response != GTK_RESPONSE_YES) {
+        install_prefetch_cancel(prefetch);
         update_status("Installation cancelled.");
+        end_install();
         return;
     }
 
-    // Update status bar
-    char status_msg[256];
-    snprintf(status_msg, sizeof(status_msg), "Installing %s...", driver->name);
-    update_status(status_msg);
+    start_install(&driver, 1, prefetch);
+}
 
-    // Install the driver
-    printf("Installing %s...\n", driver->name);
-    bool success = install_driver(driver);
+// Enable "Install Selected" only while something is selected
+static void update_install_selected_button(void) {
+    bool any_selected = false;
+    for (guint i = 0; i < driver_list_get_total(driver_model); i++) {
+        if (driver_item_get_selected(driver_list_get_nth(driver_model, i))) {
+            any_selected = true;
+            break;
+        }
+    }
 
-    if (success) {
-        snprintf(status_msg, sizeof(status_msg), "Successfully installed %s!", driver->name);
-        update_status(status_msg);
+    if (install_selected_btn != NULL) {
+        gtk_widget_set_sensitive(install_selected_btn, any_selected && installs_allowed());
+    }
+}
 
-        // Check if reboot needed
-        if (driver->needs_reboot) {
-            show_reboot_dialog(main_window_ref);
-        } else {
-            GtkWidget *success_dialog = gtk_message_dialog_new(GTK_WINDOW(main_window_ref),
-                                                               GTK_DIALOG_DESTROY_WITH_PARENT,
-                                                               GTK_MESSAGE_INFO,
-                                                               GTK_BUTTONS_OK,
-                                                               "Successfully installed %s!",
-                                                               driver->name);
-            gtk_dialog_run(GTK_DIALOG(success_dialog));
-            gtk_widget_destroy(success_dialog);
+// Callback for a driver's selection checkbox
+static void on_driver_selection_toggled(GtkToggleButton *toggle, gpointer user_data) {
+    DriverRow *row_data = (DriverRow *)user_data;
+
+    driver_item_set_selected(row_data->item, gtk_toggle_button_get_active(toggle));
+    update_install_selected_button();
+}
+
+// Callback for the "Install Selected" button
+static void on_install_selected_clicked(GtkButton *button, gpointer user_data) {
+    (void)button;     // Unused
+    (void)user_data;  // Unused
+
+    if (!installs_allowed()) {
+        return;
+    }
+
+    DriverInfo **batch = g_new(DriverInfo *, driver_count);
+    int batch_count = 0;
+    GString *summary = g_string_new(NULL);
+
+    // Selected drivers hidden by the filter are included; the question lists them
+    for (int i = 0; i < driver_count; i++) {
+        DriverItem *item = driver_list_lookup(driver_model, current_drivers[i].package);
+        if (item != NULL && driver_item_get_selected(item)) {
+            batch[batch_count++] = &current_drivers[i];
+            g_string_append_printf(summary, "\n%s (%s)", current_drivers[i].name,
+                                   current_drivers[i].package);
         }
+    }
 
-        // Refresh the list
-        refresh_driver_list(driver_list_box);
-        update_status("Ready.");
+    if (batch_count == 0) {
+        g_string_free(summary, TRUE);
+        g_free(batch);
+        return;
+    }
+
+    install_in_progress = true;
+    update_install_buttons();
+
+    // Download while the user reads the question
+    InstallPrefetch *prefetch = install_prefetch_start(batch, batch_count);
+
+    GtkWidget *confirm_dialog = gtk_message_dialog_new(GTK_WINDOW(main_window_ref),
+                                                       GTK_DIALOG_DESTROY_WITH_PARENT,
+                                                       GTK_MESSAGE_QUESTION,
+                                                       GTK_BUTTONS_YES_NO,
+                                                       "Install %d drivers?\n%s",
+                                                       batch_count, summary->str);
+    int response = gtk_dialog_run(GTK_DIALOG(confirm_dialog));
+    gtk_widget_destroy(confirm_dialog);
+    g_string_free(summary, TRUE);
+
+    if (response != GTK_RESPONSE_YES) {
+        install_prefetch_cancel(prefetch);
+        update_status("Installation cancelled.");
+        g_free(batch);
+        end_install();
+        return;
+    }
+
+    start_install(batch, batch_count, prefetch);
+    g_free(batch);
+}
+
+// Row data destroy notify
+static void driver_row_free(gpointer data) {
+    DriverRow *row_data = (DriverRow *)data;
+    g_object_unref(row_data->item);
+    g_free(row_data);
+}
+
+// Bring a filled row in line with its driver
+static void update_driver_row(DriverRow *row_data) {
+    const DriverInfo *driver = driver_item_get_driver(row_data->item);
+    // pacman could only fail on a driver the repositories don't have
+    bool installable = driver_item_get_installable(row_data->item);
+
+    gtk_toggle_button_set_active(GTK_TOGGLE_BUTTON(row_data->check),
+                                 driver_item_get_selected(row_data->item));
+    gtk_button_set_label(GTK_BUTTON(row_data->button),
+                         driver->is_installed ? "Installed" : installable ? "Install" : "Unavailable");
+    gtk_widget_set_sensitive(row_data->check, installable);
+    gtk_widget_set_sensitive(row_data->button, installable && installs_allowed());
+
+    GString *info_text = g_string_new(NULL);
+    char *part = g_markup_printf_escaped("<b>%s</b> (%s)\n<small>%s</small>",
+                                         driver->name, driver->package, driver->description);
+    g_string_append(info_text, part);
+    g_free(part);
+    if (driver->is_installed && driver->version[0] != '\0') {
+        part = g_markup_printf_escaped("\n<small>Installed version: %s</small>", driver->version);
+        g_string_append(info_text, part);
+        g_free(part);
+    }
+    if (driver->update_available) {
+        // Installing it alone would be a partial upgrade
+        part = g_markup_printf_escaped("\n<small>Update available: %s in %s "
+                                       "(comes with a full system upgrade)</small>",
+                                       driver->repo_version, driver->repository);
+        g_string_append(info_text, part);
+        g_free(part);
+    } else if (!driver->is_installed && driver->availability == DRIVER_UNAVAILABLE) {
+        g_string_append(info_text, "\n<small><b>Not in the configured repositories</b></small>");
+    } else if (!driver->is_installed && driver->repo_version[0] != '\0') {
+        char *size = g_format_size(driver->download_size);
+        part = g_markup_printf_escaped("\n<small>Version %s from %s, %s to download</small>",
+                                       driver->repo_version, driver->repository, size);
+        g_string_append(info_text, part);
+        g_free(part);
+        g_free(size);
+    }
+    if (driver->is_recommended) {
+        g_string_append(info_text, "\n<small><b>Recommended</b></small>");
+    }
+    gtk_label_set_markup(GTK_LABEL(row_data->label), info_text->str);
+    g_string_free(info_text, TRUE);
+}
+
+// Bring a row's buttons in line with the scan and install state (gtk_container_foreach)
+static void update_row_buttons(GtkWidget *row, gpointer user_data) {
+    (void)user_data;  // Unused
+
+    DriverRow *row_data = g_object_get_data(G_OBJECT(row), DRIVER_ROW_DATA);
+    if (row_data != NULL && row_data->label != NULL) {
+        update_driver_row(row_data);
+    }
+}
+
+// A scan or install started or ended: Install buttons work only between them
+static void update_install_buttons(void) {
+    if (driver_list_box != NULL) {
+        gtk_container_foreach(GTK_CONTAINER(driver_list_box), update_row_buttons, NULL);
+    }
+    update_install_selected_button();
+}
+
+// Build the widgets of a row that scrolled into view
+static void fill_driver_row(DriverRow *row_data) {
+    GtkWidget *hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
+
+    // Selection checkbox for batch installs
+    row_data->check = gtk_check_button_new();
+    gtk_box_pack_start(GTK_BOX(hbox), row_data->check, FALSE, FALSE, 5);
+
+    // Driver info
+    row_data->label = gtk_label_new(NULL);
+    gtk_label_set_xalign(GTK_LABEL(row_data->label), 0.0);
+    gtk_box_pack_start(GTK_BOX(hbox), row_data->label, TRUE, TRUE, 5);
+
+    // Install/Installed button
+    row_data->button = gtk_button_new_with_label("Install");
+    g_signal_connect(row_data->button, "clicked", G_CALLBACK(on_driver_install_clicked), row_data);
+    gtk_widget_set_size_request(row_data->button, 100, -1);
+    gtk_box_pack_start(GTK_BOX(hbox), row_data->button, FALSE, FALSE, 5);
+
+    // Connected after the first update, which restores the item's selection
+    update_driver_row(row_data);
+    g_signal_connect(row_data->check, "toggled", G_CALLBACK(on_driver_selection_toggled), row_data);
+
+    gtk_container_add(GTK_CONTAINER(row_data->row), hbox);
+    gtk_widget_set_size_request(row_data->row, -1, -1);
+    gtk_widget_show_all(hbox);
+}
+
+// A driver's data changed (row as user data)
+static void on_driver_item_changed(DriverItem *item, gpointer user_data) {
+    (void)item;  // Unused
+
+    DriverRow *row_data = g_object_get_data(G_OBJECT(user_data), DRIVER_ROW_DATA);
+    if (row_data->label != NULL) {
+        update_driver_row(row_data);
+    }
+}
+
+// Create the row for a shown item (gtk_list_box_bind_model). It stays an
+// empty placeholder of about the right height until fill_visible_rows()
+// finds it in view, so the cost of a refresh doesn't grow with the catalog.
+static GtkWidget *create_driver_row(gpointer item, gpointer user_data) {
+    (void)user_data;  // Unused
+
+    DriverRow *row_data = g_new0(DriverRow, 1);
+    row_data->item = g_object_ref(item);
+    row_data->row = gtk_list_box_row_new();
+    gtk_widget_set_size_request(row_data->row, -1, DRIVER_ROW_HEIGHT);
+    gtk_widget_show(row_data->row);
+
+    g_object_set_data_full(G_OBJECT(row_data->row), DRIVER_ROW_DATA, row_data, driver_row_free);
+    g_signal_connect_object(item, "changed", G_CALLBACK(on_driver_item_changed), row_data->row, 0);
+
+    return row_data->row;
+}
+
+// Fill the rows in view, plus a page above and below (idle, after layout)
+static gboolean fill_visible_rows(gpointer user_data) {
+    (void)user_data;  // Unused
+
+    fill_rows_source = 0;
+    if (driver_list_box == NULL) {
+        return G_SOURCE_REMOVE;
+    }
+
+    unsigned long long span = trace_begin();
+    double page = gtk_adjustment_get_page_size(driver_list_adjustment);
+    double top = gtk_adjustment_get_value(driver_list_adjustment) - page;
+    double bottom = gtk_adjustment_get_value(driver_list_adjustment) + 2 * page;
+    int filled = 0;
+
+    GtkListBoxRow *row = gtk_list_box_get_row_at_y(GTK_LIST_BOX(driver_list_box), MAX((int)top, 0));
+    int index = row != NULL ? gtk_list_box_row_get_index(row) : 0;
+
+    while ((row = gtk_list_box_get_row_at_index(GTK_LIST_BOX(driver_list_box), index++)) != NULL) {
+        GtkAllocation allocation;
+        gtk_widget_get_allocation(GTK_WIDGET(row), &allocation);
+
+        // Not laid out yet (the next layout schedules another pass), or below the view
+        if (allocation.height <= 1 || allocation.y > bottom) {
+            break;
+        }
+
+        DriverRow *row_data = g_object_get_data(G_OBJECT(row), DRIVER_ROW_DATA);
+        if (row_data != NULL && row_data->label == NULL) {
+            fill_driver_row(row_data);
+            filled++;
+        }
+    }
+
+    if (filled > 0) {
+        trace_end(span, "gui", "Fill driver rows", "%d rows", filled);
+    }
+    return G_SOURCE_REMOVE;
+}
+
+// Fill the rows in view once GTK has laid the list out
+static void schedule_fill_visible_rows(void) {
+    if (fill_rows_source == 0) {
+        // Below the redraw priority, so row positions are up to date
+        fill_rows_source = g_idle_add(fill_visible_rows, NULL);
+    }
+}
+
+// The list scrolled, or its size changed
+static void on_driver_list_scrolled(GtkAdjustment *adjustment, gpointer user_data) {
+    (void)adjustment;  // Unused
+    (void)user_data;   // Unused
+    schedule_fill_visible_rows();
+}
+
+// Create the widget shown while the list has no rows
+static GtkWidget *create_list_placeholder(void) {
+    GtkWidget *hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
+
+    placeholder_spinner = gtk_spinner_new();
+    gtk_box_pack_start(GTK_BOX(hbox), placeholder_spinner, FALSE, FALSE, 5);
+    placeholder_label = gtk_label_new(NULL);
+    gtk_box_pack_start(GTK_BOX(hbox), placeholder_label, FALSE, FALSE, 5);
+
+    gtk_widget_show_all(hbox);
+    gtk_widget_hide(placeholder_spinner);
+    return hbox;
+}
+
+// Show a message in place of the rows, optionally with a spinner
+static void set_list_placeholder(const char *message, bool busy) {
+    gtk_label_set_text(GTK_LABEL(placeholder_label), message);
+    gtk_widget_set_visible(placeholder_spinner, busy);
+    if (busy) {
+        gtk_spinner_start(GTK_SPINNER(placeholder_spinner));
     } else {
-        snprintf(status_msg, sizeof(status_msg), "Failed to install %s", driver->name);
-        update_status(status_msg);
+        gtk_spinner_stop(GTK_SPINNER(placeholder_spinner));
+    }
+}
 
-        char error_msg[256];
-        snprintf(error_msg, sizeof(error_msg),
-                "Failed to install %s\n\nCheck terminal output for details.",
-                driver->name);
-        show_error_dialog(main_window_ref, error_msg);
+// Explain an empty list (shown only while no driver passes the filter)
+static void update_list_placeholder(void) {
+    if (scan_in_progress && driver_list_get_total(driver_model) == 0) {
+        set_list_placeholder("Scanning hardware and installed drivers...", true);
+    } else if (current_hw_count <= 0) {
+        set_list_placeholder("No hardware detected or scan failed.", false);
+    } else if (driver_list_get_total(driver_model) == 0) {
+        set_list_placeholder("No additional drivers needed. System is up to date!", false);
+    } else {
+        set_list_placeholder("No drivers match the filter.", false);
     }
 }
 
+// The shown drivers changed: new rows are empty until filled
+static void on_shown_drivers_changed(GListModel *model, guint position, guint removed,
+                                     guint added, gpointer user_data) {
+    (void)model;      // Unused
+    (void)position;   // Unused
+    (void)removed;    // Unused
+    (void)added;      // Unused
+    (void)user_data;  // Unused
+    schedule_fill_visible_rows();
+}
+
+// A filter control changed
+static void on_filter_changed(GtkWidget *widget, gpointer user_data) {
+    (void)widget;     // Unused
+    (void)user_data;  // Unused
+
+    DriverListFilter filter;
+    int type_index = gtk_combo_box_get_active(GTK_COMBO_BOX(type_filter_combo));
+
+    filter.recommended_only = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(recommended_filter_check));
+    filter.not_installed_only = gtk_toggle_button_get_active(GTK_TOGGLE_BUTTON(not_installed_filter_check));
+    filter.hw_type = type_index > 0 ? (int)type_filters[type_index - 1].type : -1;
+
+    driver_list_set_filter(driver_model, &filter);
+    update_list_placeholder();
+}
+
+// The sort order changed
+static void on_sort_changed(GtkComboBox *combo, gpointer user_data) {
+    (void)user_data;  // Unused
+
+    int sort = gtk_combo_box_get_active(combo);
+    if (sort >= 0) {
+        driver_list_set_sort(driver_model, (DriverListSort)sort);
+    }
+}
+
+// Hand the current driver data to the model (main loop): items are matched
+// by package set, so only added, removed or changed drivers touch rows
+static void sync_driver_list(void) {
+    int added = 0, changed = 0, removed = 0;
+    unsigned long long span = trace_begin();
+
+    driver_list_update(driver_model, current_drivers, driver_count, &added, &changed, &removed);
+    update_list_placeholder();
+    update_install_selected_button();
+
+    printf("Driver list updated: %d added, %d changed, %d removed\n", added, changed, removed);
+    trace_end(span, "gui", "Update driver list", "%d added, %d changed, %d removed",
+              added, changed, removed);
+}
+
 // Create the main window
 GtkWidget* create_main_window(void) {
     // Create main window
@@ -150,10 +603,47 @@ GtkWidget* create_main_window(void) {
     g_signal_connect(refresh_btn, "clicked", G_CALLBACK(on_refresh_clicked), NULL);
     gtk_box_pack_start(GTK_BOX(toolbar), refresh_btn, FALSE, FALSE, 5);
 
+    install_selected_btn = gtk_button_new_with_label("Install Selected");
+    gtk_widget_set_sensitive(install_selected_btn, FALSE);
+    g_signal_connect(install_selected_btn, "clicked", G_CALLBACK(on_install_selected_clicked), NULL);
+    gtk_box_pack_start(GTK_BOX(toolbar), install_selected_btn, FALSE, FALSE, 5);
+
     // Add spacer
     GtkWidget *spacer = gtk_label_new("");
     gtk_box_pack_start(GTK_BOX(toolbar), spacer, TRUE, TRUE, 0);
 
+    // Filter and sort controls; they only change what the model shows
+    driver_model = driver_list_new();
+
+    GtkWidget *filter_bar = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    gtk_box_pack_start(GTK_BOX(vbox), filter_bar, FALSE, FALSE, 0);
+
+    type_filter_combo = gtk_combo_box_text_new();
+    gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(type_filter_combo), "All hardware");
+    for (size_t i = 0; i < G_N_ELEMENTS(type_filters); i++) {
+        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(type_filter_combo), type_filters[i].label);
+    }
+    gtk_combo_box_set_active(GTK_COMBO_BOX(type_filter_combo), 0);
+    g_signal_connect(type_filter_combo, "changed", G_CALLBACK(on_filter_changed), NULL);
+    gtk_box_pack_start(GTK_BOX(filter_bar), type_filter_combo, FALSE, FALSE, 5);
+
+    recommended_filter_check = gtk_check_button_new_with_label("Recommended only");
+    g_signal_connect(recommended_filter_check, "toggled", G_CALLBACK(on_filter_changed), NULL);
+    gtk_box_pack_start(GTK_BOX(filter_bar), recommended_filter_check, FALSE, FALSE, 5);
+
+    not_installed_filter_check = gtk_check_button_new_with_label("Not installed only");
+    g_signal_connect(not_installed_filter_check, "toggled", G_CALLBACK(on_filter_changed), NULL);
+    gtk_box_pack_start(GTK_BOX(filter_bar), not_installed_filter_check, FALSE, FALSE, 5);
+
+    sort_combo = gtk_combo_box_text_new();
+    for (size_t i = 0; i < G_N_ELEMENTS(sort_labels); i++) {
+        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(sort_combo), sort_labels[i]);
+    }
+    gtk_combo_box_set_active(GTK_COMBO_BOX(sort_combo), DRIVER_LIST_SORT_DETECTION);
+    g_signal_connect(sort_combo, "changed", G_CALLBACK(on_sort_changed), NULL);
+    gtk_box_pack_end(GTK_BOX(filter_bar), sort_combo, FALSE, FALSE, 5);
+    gtk_box_pack_end(GTK_BOX(filter_bar), gtk_label_new("Sort by:"), FALSE, FALSE, 0);
+
     // Create scrolled window for driver list
     GtkWidget *scrolled = gtk_scrolled_window_new(NULL, NULL);
     gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scrolled),
@@ -161,108 +651,397 @@ GtkWidget* create_main_window(void) {
                                    GTK_POLICY_AUTOMATIC);
     gtk_box_pack_start(GTK_BOX(vbox), scrolled, TRUE, TRUE, 0);
 
-    // Create list box for drivers
+    // Create list box for drivers, one row per shown model item
     driver_list_box = gtk_list_box_new();
+    gtk_list_box_bind_model(GTK_LIST_BOX(driver_list_box), G_LIST_MODEL(driver_model),
+                            create_driver_row, NULL, NULL);
+    gtk_list_box_set_placeholder(GTK_LIST_BOX(driver_list_box), create_list_placeholder());
     gtk_container_add(GTK_CONTAINER(scrolled), driver_list_box);
 
+    // Rows are filled in once the list is laid out, and again after scrolling
+    g_signal_connect_after(driver_model, "items-changed", G_CALLBACK(on_shown_drivers_changed), NULL);
+    driver_list_adjustment = gtk_scrolled_window_get_vadjustment(GTK_SCROLLED_WINDOW(scrolled));
+    g_signal_connect(driver_list_adjustment, "value-changed", G_CALLBACK(on_driver_list_scrolled), NULL);
+    g_signal_connect(driver_list_adjustment, "changed", G_CALLBACK(on_driver_list_scrolled), NULL);
+
     // Create status bar
     status_bar = gtk_label_new("Ready. Click 'Refresh Drivers' to scan for available drivers.");
     gtk_label_set_xalign(GTK_LABEL(status_bar), 0.0);
     gtk_box_pack_start(GTK_BOX(vbox), status_bar, FALSE, FALSE, 5);
 
+    // Follow hotplugged devices (eGPU docks, USB/PCI NICs) without rescanning
+    if (!hotplug_start(on_hotplug_burst, NULL)) {
+        fprintf(stderr, "Hotplug monitoring unavailable, use 'Refresh Drivers' after hardware changes\n");
+    }
+
     // Initial scan
     refresh_driver_list(driver_list_box);
 
     return window;
 }
 
+// Result of a background scan, handed from the worker to the main loop
+typedef struct {
+    Arena *arena;               // Holds both lists
+    HardwareInfo *hw_list;
+    int hw_count;
+    DriverInfo *drivers;
+    int driver_count;
+} ScanResult;
+
+static void start_background_scan(void);
+
+// Free a scan result that never made it into the UI
+static void scan_result_free(gpointer data) {
+    ScanResult *result = (ScanResult *)data;
+    arena_destroy(result->arena);
+    g_free(result);
+}
+
+// Worker thread: hardware scan and driver detection (runs pacman/lspci lookups)
+static void scan_thread_func(GTask *task, gpointer source_object,
+                             gpointer task_data, GCancellable *cancellable) {
+    (void)source_object;  // Unused
+    (void)task_data;      // Unused
+    (void)cancellable;    // Unused
+
+    ScanResult *result = g_new0(ScanResult, 1);
+    unsigned long long span = trace_begin();
+
+    // Reuses whatever part of the on-disk cache (or the helper's warm state) is still valid
+    result->arena = arena_create();
+    if (result->arena != NULL && backend_socket != NULL) {
+        result->driver_count = backend_query(backend_socket, false, result->arena, &result->hw_list,
+                                             &result->hw_count, &result->drivers);
+        if (result->driver_count < 0) {
+            result->driver_count = 0;
+        }
+    } else if (result->arena != NULL) {
+        result->driver_count = scan_and_detect_cached(result->arena, &result->hw_list,
+                                                      &result->hw_count, &result->drivers);
+    }
+    trace_end(span, "gui", "Background scan", "%d devices, %d drivers",
+              result->hw_count, result->driver_count);
+
+    g_task_return_pointer(task, result, scan_result_free);
+}
+
+// Take over the data of a finished scan and show it (main loop)
+static void populate_driver_list(ScanResult *result) {
+    // The rows keep showing the old data until the new data is in place
+    Arena *old_arena = current_arena;
+
+    current_arena = result->arena;
+    current_hw = result->hw_list;
+    current_hw_count = result->hw_count;
+    current_drivers = result->drivers;
+    driver_count = result->driver_count;
+    result->arena = NULL;
+    result->hw_list = NULL;
+    result->hw_count = 0;
+    result->drivers = NULL;
+
+    sync_driver_list();
+
+    // The model compared the old data against the new; nothing refers to it now
+    arena_destroy(old_arena);
+}
+
+// Scan finished callback (main loop)
+static void on_scan_finished(GObject *source_object, GAsyncResult *res, gpointer user_data) {
+    (void)source_object;  // Unused
+    (void)user_data;      // Unused
+
+    ScanResult *result = g_task_propagate_pointer(G_TASK(res), NULL);
+    scan_in_progress = false;
+
+    // A refresh was requested while this scan ran; its data may already be stale
+    if (scan_pending) {
+        scan_pending = false;
+        scan_result_free(result);
+        start_background_scan();
+        return;
+    }
+
+    populate_driver_list(result);
+    scan_result_free(result);
+    update_install_buttons();
+
+    update_status("Ready.");
+}
+
+// Start the scan worker
+static void start_background_scan(void) {
+    scan_in_progress = true;
+    update_install_buttons();
+
+    GTask *task = g_task_new(NULL, NULL, on_scan_finished, NULL);
+    g_task_run_in_thread(task, scan_thread_func);
+    g_object_unref(task);
+}
+
 // Refresh the driver list
 void refresh_driver_list(GtkWidget *list_box) {
-    // Clear existing items
-    GList *children = gtk_container_get_children(GTK_CONTAINER(list_box));
-    for (GList *iter = children; iter != NULL; iter = g_list_next(iter)) {
-        gtk_widget_destroy(GTK_WIDGET(iter->data));
+    (void)list_box;  // The list box follows driver_model
+
+    if (scan_in_progress || install_in_progress) {
+        // Coalesce: run exactly one more scan once the current one (or the
+        // install) finishes
+        scan_pending = true;
+        return;
     }
-    g_list_free(children);
 
-    // Free old driver data
-    if (current_drivers != NULL) {
-        free_driver_list(current_drivers, driver_count);
-        current_drivers = NULL;
+    // Existing rows stay visible while scanning and are diffed afterwards
+    update_status("Scanning...");
+
+    start_background_scan();
+    update_list_placeholder();
+}
+
+// Find the device group holding a bus address
+static int find_hardware(const char *address) {
+    for (int i = 0; i < current_hw_count; i++) {
+        if (hardware_has_address(&current_hw[i], address)) {
+            return i;
+        }
     }
+    return -1;
+}
 
-    // Scan hardware
-    HardwareInfo *hw_list = NULL;
-    int hw_count = scan_hardware(&hw_list);
+// Drivers for the device groups a hotplug burst added, detected on a worker
+// thread like a scan (it reads the package and driver databases)
+typedef struct {
+    HardwareInfo *hw_list;      // Copies; their strings stay in current_arena
+    int hw_count;
+    Arena *arena;               // Holds drivers
+    DriverInfo *drivers;
+    int driver_count;
+} HotplugDetection;
 
-    if (hw_count <= 0) {
-        GtkWidget *row = gtk_list_box_row_new();
-        GtkWidget *label = gtk_label_new("No hardware detected or scan failed.");
-        gtk_container_add(GTK_CONTAINER(row), label);
-        gtk_list_box_insert(GTK_LIST_BOX(list_box), row, -1);
-        gtk_widget_show_all(list_box);
+// Free a hotplug detection
+static void hotplug_detection_free(gpointer data) {
+    HotplugDetection *detection = (HotplugDetection *)data;
+    if (detection->arena != NULL) {
+        arena_destroy(detection->arena);
+    }
+    g_free(detection->hw_list);
+    g_free(detection);
+}
+
+// Worker thread: detect drivers for the new device groups alone
+static void hotplug_thread_func(GTask *task, gpointer source_object,
+                                gpointer task_data, GCancellable *cancellable) {
+    (void)source_object;  // Unused
+    (void)cancellable;    // Unused
+
+    HotplugDetection *detection = (HotplugDetection *)task_data;
+    detection->arena = arena_create();
+    if (detection->arena != NULL) {
+        detection->driver_count = detect_drivers(detection->arena, detection->hw_list,
+                                                 detection->hw_count, &detection->drivers);
+    }
+    g_task_return_boolean(task, TRUE);
+}
+
+// Append the detected drivers not already listed for other devices. They are
+// copied into the current arena and freed with it on the next refresh.
+static void add_hotplugged_drivers(const DriverInfo *new_drivers, int new_count) {
+    DriverInfo *grown = arena_grow(current_arena, current_drivers, sizeof(DriverInfo) * driver_count,
+                                   sizeof(DriverInfo) * (driver_count + MAX(new_count, 1)));
+    if (grown == NULL) {
+        fprintf(stderr, "Out of memory while adding hotplugged drivers\n");
         return;
     }
+    current_drivers = grown;
 
-    // Detect drivers
-    driver_count = detect_drivers(hw_list, hw_count, &current_drivers);
-    free_hardware_list(hw_list, hw_count);
+    for (int i = 0; i < new_count; i++) {
+        bool listed = false;
+        for (int j = 0; j < driver_count; j++) {
+            if (strcmp(current_drivers[j].package, new_drivers[i].package) == 0) {
+                listed = true;
+                break;
+            }
+        }
+        if (!listed) {
+            copy_driver_info(current_arena, &current_drivers[driver_count++], &new_drivers[i]);
+        }
+    }
+}
+
+// Detection for a burst finished (main loop)
+static void on_hotplug_detected(GObject *source_object, GAsyncResult *res, gpointer user_data) {
+    (void)source_object;  // Unused
+    (void)user_data;      // Unused
+
+    HotplugDetection *detection = g_task_get_task_data(G_TASK(res));
+    scan_in_progress = false;
+
+    // Devices changed again meanwhile (or an install asked for a scan): rescan
+    if (scan_pending) {
+        scan_pending = false;
+        start_background_scan();
+        return;
+    }
 
-    if (driver_count <= 0) {
-        GtkWidget *row = gtk_list_box_row_new();
-        GtkWidget *label = gtk_label_new("No additional drivers needed. System is up to date!");
-        gtk_container_add(GTK_CONTAINER(row), label);
-        gtk_list_box_insert(GTK_LIST_BOX(list_box), row, -1);
-        gtk_widget_show_all(list_box);
+    add_hotplugged_drivers(detection->drivers, detection->driver_count);
+    sync_driver_list();
+    update_install_buttons();
+}
+
+// Detect drivers for the new device groups of a burst (given by an address
+// each) in the background; installs wait for it like for a scan
+static void start_hotplug_detection(GPtrArray *added) {
+    HotplugDetection *detection = g_new0(HotplugDetection, 1);
+    detection->hw_list = g_new(HardwareInfo, MAX(added->len, 1));
+    for (guint i = 0; i < added->len; i++) {
+        int index = find_hardware(g_ptr_array_index(added, i));
+        if (index >= 0) {
+            detection->hw_list[detection->hw_count++] = current_hw[index];
+        }
+    }
+    if (detection->hw_count == 0) {
+        hotplug_detection_free(detection);
         return;
     }
 
-    // Add drivers to list
+    scan_in_progress = true;
+    update_install_buttons();
+
+    GTask *task = g_task_new(NULL, NULL, on_hotplug_detected, NULL);
+    g_task_set_task_data(task, detection, hotplug_detection_free);
+    g_task_run_in_thread(task, hotplug_thread_func);
+    g_object_unref(task);
+}
+
+// A device appeared that belongs to no known group: list it as its own group.
+// Its drivers come from start_hotplug_detection().
+static bool add_hotplugged_device(const HardwareInfo *hw) {
+    HardwareInfo *grown_hw = arena_grow(current_arena, current_hw,
+                                        sizeof(HardwareInfo) * current_hw_count,
+                                        sizeof(HardwareInfo) * (current_hw_count + 1));
+    if (grown_hw == NULL) {
+        fprintf(stderr, "Out of memory while adding hotplugged device\n");
+        return false;
+    }
+    current_hw = grown_hw;
+    current_hw[current_hw_count++] = *hw;
+    return true;
+}
+
+// A device went away: drop it and the drivers no remaining device needs
+static void remove_hotplugged_device(int hw_index) {
+    HardwareInfo removed = current_hw[hw_index];
+
+    memmove(&current_hw[hw_index], &current_hw[hw_index + 1],
+            sizeof(HardwareInfo) * (current_hw_count - hw_index - 1));
+    current_hw_count--;
+
+    int kept = 0;
     for (int i = 0; i < driver_count; i++) {
-        GtkWidget *row = gtk_list_box_row_new();
-        GtkWidget *hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
-        gtk_container_add(GTK_CONTAINER(row), hbox);
-
-        // Driver info
-        char info_text[512];
-        snprintf(info_text, sizeof(info_text),
-                "<b>%s</b> (%s)\n<small>%s</small>%s",
-                current_drivers[i].name,
-                current_drivers[i].package,
-                current_drivers[i].description,
-                current_drivers[i].is_recommended ? "\n<small><b>Recommended</b></small>" : "");
-
-        GtkWidget *label = gtk_label_new(NULL);
-        gtk_label_set_markup(GTK_LABEL(label), info_text);
-        gtk_label_set_xalign(GTK_LABEL(label), 0.0);
-        gtk_box_pack_start(GTK_BOX(hbox), label, TRUE, TRUE, 5);
-
-        // Install/Installed button
-        GtkWidget *install_btn;
-
-        if (current_drivers[i].is_installed) {
-            // Already installed - show disabled "Installed" button
-            install_btn = gtk_button_new_with_label("Installed");
-            gtk_widget_set_sensitive(install_btn, FALSE);  // Disable the button
-            gtk_widget_set_size_request(install_btn, 100, -1);
-        } else {
-            // Not installed - show clickable "Install" button
-            DriverButtonData *btn_data = malloc(sizeof(DriverButtonData));
-            btn_data->driver_index = i;
+        if (driver_matches_hardware(&current_drivers[i], &removed, 1) &&
+            !driver_matches_hardware(&current_drivers[i], current_hw, current_hw_count)) {
+            continue;
+        }
+        current_drivers[kept++] = current_drivers[i];
+    }
+    driver_count = kept;
+}
+
+// Apply one add or remove event to the current lists; false if it changed
+// nothing. The address of a new group that needs detection goes to added.
+static bool apply_hotplug_event(const Uevent *event, GPtrArray *added, char *status_msg, size_t size) {
+    const char *address = uevent_device_address(event);
+    int existing = find_hardware(address);
 
-            install_btn = gtk_button_new_with_label("Install");
-            g_signal_connect(install_btn, "clicked", G_CALLBACK(on_driver_install_clicked), btn_data);
-            gtk_widget_set_size_request(install_btn, 100, -1);
+    if (event->action == UEVENT_ADD && existing < 0) {
+        // Before the first scan has finished there is no arena yet
+        if (current_arena == NULL && (current_arena = arena_create()) == NULL) {
+            return false;
         }
 
-        gtk_box_pack_start(GTK_BOX(hbox), install_btn, FALSE, FALSE, 5);
+        HardwareInfo hw;
+        bool relevant = event->pci_slot[0] != '\0' ?
+                        scan_pci_device(current_arena, get_sysfs_root(), event->pci_slot, &hw) :
+                        uevent_usb_hardware(current_arena, event, &hw);
+        if (!relevant) {
+            return false;
+        }
+
+        // Another function of an existing group needs no detection of its own
+        int group = -1;
+        for (int i = 0; i < current_hw_count && group < 0; i++) {
+            if (hardware_same_group(&current_hw[i], &hw)) {
+                group = i;
+            }
+        }
+        if (group >= 0) {
+            if (!hardware_add_address(current_arena, &current_hw[group], hw.pci_id)) {
+                return false;
+            }
+        } else {
+            if (!add_hotplugged_device(&hw)) {
+                return false;
+            }
+            g_ptr_array_add(added, (gpointer)hw.pci_id);
+        }
+        snprintf(status_msg, size, "Device added: %s %s (%s)", hw.vendor, hw.device, hw.pci_id);
+    } else if (event->action == UEVENT_REMOVE && existing >= 0) {
+        HardwareInfo *group = &current_hw[existing];
+        bool last = group->count == 1;
 
-        gtk_list_box_insert(GTK_LIST_BOX(list_box), row, -1);
+        // The drivers stay while any function of the group is left
+        if (!last && !hardware_remove_address(current_arena, group, address)) {
+            return false;
+        }
+        snprintf(status_msg, size, "Device removed: %s %s (%s)", group->vendor, group->device,
+                 address);
+        if (last) {
+            remove_hotplugged_device(existing);
+        }
+    } else {
+        return false;
     }
 
-    gtk_widget_show_all(list_box);
+    return true;
 }
 
+// A burst of PCI/USB add and remove events has settled (main loop)
+static void on_hotplug_burst(const UeventQueue *burst, gpointer user_data) {
+    (void)user_data;  // Unused
+
+    // A running scan (or detection) may have missed these devices, an install
+    // is about to replace the package snapshot, and a burst too long to follow
+    // one by one is cheaper to rescan: in every case one more scan, deferred
+    // by refresh_driver_list() until the scan or install is done
+    if (scan_in_progress || install_in_progress || burst->overflow) {
+        refresh_driver_list(driver_list_box);
+        return;
+    }
+
+    char status_msg[256];
+    int changed = 0;
+    GPtrArray *added = g_ptr_array_new();
+    for (int i = 0; i < burst->count; i++) {
+        if (apply_hotplug_event(&burst->events[i], added, status_msg, sizeof(status_msg))) {
+            changed++;
+        }
+    }
+    if (added->len > 0) {
+        start_hotplug_detection(added);
+    }
+    g_ptr_array_unref(added);
+    if (changed == 0) {
+        return;
+    }
+
+    // The list is diffed once for the whole burst (and again once the new
+    // groups' drivers are detected)
+    sync_driver_list();
+    if (changed > 1) {
+        snprintf(status_msg, sizeof(status_msg), "%d devices added or removed.", changed);
+    }
+    update_status(status_msg);
+}
 
 // Refresh button callback
 void on_refresh_clicked(GtkButton *button, gpointer user_data) {
@@ -284,7 +1063,8 @@ void show_reboot_dialog(GtkWidget *parent) {
     gtk_widget_destroy(dialog);
 
     if (response == GTK_RESPONSE_YES) {
-        system("systemctl reboot");
+        static char *const reboot_argv[] = {"systemctl", "reboot", NULL};
+        proc_run(reboot_argv, PROC_INHERIT, NULL);
     }
 }
 
@@ -6,38 +6,95 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include "../include/hardware.h"
+#include "../include/pci_ids.h"
+#include "../include/trace.h"
+#include "../include/proc.h"
+
+// PCI base classes and subclasses we care about (see the PCI Code and ID Assignment spec)
+#define PCI_BASE_CLASS_NETWORK   0x02
+#define PCI_BASE_CLASS_DISPLAY   0x03
+#define PCI_CLASS_MULTIMEDIA_AUDIO 0x0401
+#define PCI_CLASS_AUDIO_DEVICE     0x0403
+
+// PCI vendor IDs
+#define PCI_VENDOR_NVIDIA  0x10de
+#define PCI_VENDOR_AMD_ATI 0x1002
+#define PCI_VENDOR_AMD     0x1022
+#define PCI_VENDOR_INTEL   0x8086
+
+// Longest PCI bus address kept for an SR-IOV parent ("0000:3b:00.0", wider domains)
+#define PCI_ADDRESS_MAX 32
+
+// Known vendor names for devices found through sysfs, when pci.ids lacks them
+typedef struct {
+    unsigned int id;
+    const char *name;
+} PciVendorName;
+
+static const PciVendorName vendor_names[] = {
+    {PCI_VENDOR_NVIDIA,  "NVIDIA"},
+    {PCI_VENDOR_AMD_ATI, "AMD"},
+    {PCI_VENDOR_AMD,     "AMD"},
+    {PCI_VENDOR_INTEL,   "Intel"},
+    {0x10ec, "Realtek"},
+    {0x14e4, "Broadcom"},
+    {0x168c, "Qualcomm Atheros"},
+    {0x17cb, "Qualcomm"},
+    {0x14c3, "MediaTek"},
+    {0x15b3, "Mellanox"},
+    {0x1969, "Qualcomm Atheros"},
+    {0x1102, "Creative Labs"},
+};
+
+static char sysfs_root_override[256] = "";
+
+// pci.ids, opened on the first name lookup (names of cached scans need none)
+static char pci_ids_path[256] = PCI_IDS_DEFAULT_PATH;
+static char pci_ids_index_path[256] = PCI_IDS_INDEX_DEFAULT_PATH;
+static PciIds *pci_ids = NULL;
+static bool pci_ids_tried = false;
 
 // Parse lspci output line
-static bool parse_pci_line(const char *line, HardwareInfo *hw) {
+static bool parse_pci_line(Arena *arena, const char *line, HardwareInfo *hw) {
     // Example line: "01:00.0 VGA compatible controller: NVIDIA Corporation Device 1234"
     char *vga_pos = strstr(line, "VGA compatible controller:");
     char *network_pos = strstr(line, "Network controller:");
     char *ethernet_pos = strstr(line, "Ethernet controller:");
     char *audio_pos = strstr(line, "Audio device:");
 
+    // NVIDIA laptop GPUs show up as "3D controller", some others as "Display controller"
+    if (vga_pos == NULL) {
+        vga_pos = strstr(line, "3D controller:");
+    }
+    if (vga_pos == NULL) {
+        vga_pos = strstr(line, "Display controller:");
+    }
+
     if (vga_pos) {
-        vga_pos += strlen("VGA compatible controller:");
+        vga_pos = strchr(vga_pos, ':') + 1;
         while (*vga_pos == ' ') vga_pos++;
 
         // Determine vendor
         if (strstr(vga_pos, "NVIDIA") || strstr(vga_pos, "nVidia")) {
             hw->type = HW_GPU_NVIDIA;
-            strncpy(hw->vendor, "NVIDIA", sizeof(hw->vendor) - 1);
+            hw->vendor = "NVIDIA";
         } else if (strstr(vga_pos, "AMD") || strstr(vga_pos, "ATI")) {
             hw->type = HW_GPU_AMD;
-            strncpy(hw->vendor, "AMD", sizeof(hw->vendor) - 1);
+            hw->vendor = "AMD";
         } else if (strstr(vga_pos, "Intel")) {
             hw->type = HW_GPU_INTEL;
-            strncpy(hw->vendor, "Intel", sizeof(hw->vendor) - 1);
+            hw->vendor = "Intel";
         } else {
             hw->type = HW_UNKNOWN;
-            strncpy(hw->vendor, "Unknown", sizeof(hw->vendor) - 1);
+            hw->vendor = "Unknown";
         }
 
-        strncpy(hw->device, vga_pos, sizeof(hw->device) - 1);
-        // Trim newline
-        hw->device[strcspn(hw->device, "\n")] = 0;
+        // Up to the newline
+        hw->device = arena_intern_len(arena, vga_pos, strcspn(vga_pos, "\n"));
 
         return true;
     } else if (network_pos || ethernet_pos) {
@@ -46,17 +103,11 @@ static bool parse_pci_line(const char *line, HardwareInfo *hw) {
                                    ethernet_pos + strlen("Ethernet controller:");
         while (*start == ' ') start++;
 
-        strncpy(hw->device, start, sizeof(hw->device) - 1);
-        hw->device[strcspn(hw->device, "\n")] = 0;
+        hw->device = arena_intern_len(arena, start, strcspn(start, "\n"));
 
         // Extract vendor
         char *colon = strchr(start, ':');
-        if (colon && colon - start < sizeof(hw->vendor)) {
-            strncpy(hw->vendor, start, colon - start);
-            hw->vendor[colon - start] = '\0';
-        } else {
-            strncpy(hw->vendor, "Unknown", sizeof(hw->vendor) - 1);
-        }
+        hw->vendor = colon != NULL ? arena_intern_len(arena, start, colon - start) : "Unknown";
 
         return true;
     } else if (audio_pos) {
@@ -64,84 +115,626 @@ static bool parse_pci_line(const char *line, HardwareInfo *hw) {
         audio_pos += strlen("Audio device:");
         while (*audio_pos == ' ') audio_pos++;
 
-        strncpy(hw->device, audio_pos, sizeof(hw->device) - 1);
-        hw->device[strcspn(hw->device, "\n")] = 0;
+        hw->device = arena_intern_len(arena, audio_pos, strcspn(audio_pos, "\n"));
 
         // Extract vendor
         char *colon = strchr(audio_pos, ':');
-        if (colon && colon - audio_pos < sizeof(hw->vendor)) {
-            strncpy(hw->vendor, audio_pos, colon - audio_pos);
-            hw->vendor[colon - audio_pos] = '\0';
-        } else {
-            strncpy(hw->vendor, "Unknown", sizeof(hw->vendor) - 1);
+        hw->vendor = colon != NULL ? arena_intern_len(arena, audio_pos, colon - audio_pos) : "Unknown";
+
+        return true;
+    }
+
+    return false;
+}
+
+// Read a sysfs attribute into buf, stripping the trailing newline
+static bool read_sysfs_attr(const char *dev_path, const char *attr, char *buf, size_t size) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", dev_path, attr);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    ssize_t len = read(fd, buf, size - 1);
+    close(fd);
+
+    if (len <= 0) {
+        return false;
+    }
+
+    buf[len] = '\0';
+    buf[strcspn(buf, "\n")] = '\0';
+    return true;
+}
+
+// Read a hexadecimal sysfs attribute such as "0x10de"
+static bool read_sysfs_hex(const char *dev_path, const char *attr, unsigned int *value) {
+    char buf[32];
+    if (!read_sysfs_attr(dev_path, attr, buf, sizeof(buf))) {
+        return false;
+    }
+
+    char *end;
+    unsigned long parsed = strtoul(buf, &end, 16);
+    if (end == buf) {
+        return false;
+    }
+
+    *value = (unsigned int)parsed;
+    return true;
+}
+
+// Name a device by its PCI IDs: from pci.ids, else the built-in vendor names
+// and the bare IDs. Only the names of listed groups are looked up.
+static void set_device_names(Arena *arena, HardwareInfo *hw) {
+    if (!pci_ids_tried) {
+        pci_ids_tried = true;
+        pci_ids = pci_ids_open(pci_ids_path, pci_ids_index_path);
+    }
+
+    const char *name = NULL;
+    size_t len = 0;
+
+    if (pci_ids != NULL && (name = pci_ids_vendor(pci_ids, hw->vendor_id, &len)) != NULL) {
+        hw->vendor = arena_intern_len(arena, name, len);
+    } else {
+        hw->vendor = NULL;
+        for (size_t i = 0; i < sizeof(vendor_names) / sizeof(vendor_names[0]); i++) {
+            if (vendor_names[i].id == hw->vendor_id) {
+                hw->vendor = vendor_names[i].name;
+                break;
+            }
+        }
+        if (hw->vendor == NULL) {
+            hw->vendor = arena_printf(arena, "Vendor %04x", hw->vendor_id);
         }
+    }
+
+    if (pci_ids != NULL && (name = pci_ids_device(pci_ids, hw->vendor_id, hw->device_id, &len)) != NULL) {
+        hw->device = arena_intern_len(arena, name, len);
+    } else {
+        hw->device = arena_printf(arena, "Device %04x", hw->device_id);
+    }
+
+    // Out of memory: never leave a name NULL
+    if (hw->vendor == NULL) {
+        hw->vendor = "";
+    }
+    if (hw->device == NULL) {
+        hw->device = "";
+    }
+}
 
+// Classify a device by its numeric PCI class code and vendor ID
+static bool classify_pci_device(HardwareInfo *hw) {
+    unsigned int base_class = hw->class_code >> 16;
+    unsigned int class_id = hw->class_code >> 8;
+
+    if (base_class == PCI_BASE_CLASS_DISPLAY) {
+        switch (hw->vendor_id) {
+        case PCI_VENDOR_NVIDIA:
+            hw->type = HW_GPU_NVIDIA;
+            break;
+        case PCI_VENDOR_AMD_ATI:
+        case PCI_VENDOR_AMD:
+            hw->type = HW_GPU_AMD;
+            break;
+        case PCI_VENDOR_INTEL:
+            hw->type = HW_GPU_INTEL;
+            break;
+        default:
+            hw->type = HW_UNKNOWN;
+            break;
+        }
+        return true;
+    } else if (base_class == PCI_BASE_CLASS_NETWORK) {
+        hw->type = HW_NETWORK;
+        return true;
+    } else if (class_id == PCI_CLASS_MULTIMEDIA_AUDIO || class_id == PCI_CLASS_AUDIO_DEVICE) {
+        hw->type = HW_AUDIO;
         return true;
     }
 
     return false;
 }
 
-// Scan system for hardware
-int scan_hardware(HardwareInfo **hw_list) {
-    FILE *fp;
-    char line[512];
-    int count = 0;
-    int capacity = 10;
+// Read one PCI device directory from sysfs; names are left empty
+static bool read_pci_device(Arena *arena, const char *dev_path, const char *address,
+                            HardwareInfo *hw) {
+    memset(hw, 0, sizeof(HardwareInfo));
+
+    // The class attribute is enough to reject the bridges and controllers we ignore
+    if (!read_sysfs_hex(dev_path, "class", &hw->class_code)) {
+        return false;
+    }
+    if (!read_sysfs_hex(dev_path, "vendor", &hw->vendor_id)) {
+        return false;
+    }
+    if (!classify_pci_device(hw)) {
+        return false;
+    }
+
+    read_sysfs_hex(dev_path, "device", &hw->device_id);
+    read_sysfs_hex(dev_path, "subsystem_vendor", &hw->subsys_vendor_id);
+    read_sysfs_hex(dev_path, "subsystem_device", &hw->subsys_device_id);
+
+    char modalias[256];
+    hw->modalias = read_sysfs_attr(dev_path, "modalias", modalias, sizeof(modalias)) ?
+                   arena_intern(arena, modalias) : "";
+
+    hw->pci_id = arena_intern(arena, address);
+    hw->vendor = "";
+    hw->device = "";
+    hw->count = 1;
+    hw->addresses = hw->pci_id;
+
+    return true;
+}
+
+// Get the parent of an SR-IOV virtual function from its physfn link; false
+// for any other device, or if the parent's name doesn't fit in size
+static bool read_physfn(const char *dev_path, char *parent, size_t size) {
+    char path[512];
+    char target[256];
+    snprintf(path, sizeof(path), "%s/physfn", dev_path);
+
+    ssize_t len = readlink(path, target, sizeof(target) - 1);
+    if (len <= 0) {
+        return false;
+    }
+    target[len] = '\0';
+
+    const char *name = strrchr(target, '/');
+    name = name != NULL ? name + 1 : target;
+    size_t name_len = strlen(name);
+    if (name_len == 0 || name_len >= size) {
+        return false;
+    }
+    memcpy(parent, name, name_len + 1);
+    return true;
+}
+
+// Read a single PCI device
+bool scan_pci_device(Arena *arena, const char *sysfs_root, const char *address, HardwareInfo *hw) {
+    char dev_path[512];
+    char parent[PCI_ADDRESS_MAX];
+    snprintf(dev_path, sizeof(dev_path), "%s/bus/pci/devices/%s", sysfs_root, address);
+
+    // A virtual function only counts through its parent's group
+    if (read_physfn(dev_path, parent, sizeof(parent))) {
+        return false;
+    }
+    if (!read_pci_device(arena, dev_path, address, hw)) {
+        return false;
+    }
+
+    set_device_names(arena, hw);
+    return true;
+}
+
+// Check whether two records describe identical functions
+bool hardware_same_group(const HardwareInfo *a, const HardwareInfo *b) {
+    if (a->type != b->type || a->bus != b->bus) {
+        return false;
+    }
+    if (a->vendor_id != 0 || b->vendor_id != 0) {
+        return a->vendor_id == b->vendor_id && a->device_id == b->device_id &&
+               a->subsys_vendor_id == b->subsys_vendor_id &&
+               a->subsys_device_id == b->subsys_device_id && a->class_code == b->class_code;
+    }
+
+    // No numeric IDs (lspci fallback): identical descriptions
+    return strcmp(a->vendor, b->vendor) == 0 && strcmp(a->device, b->device) == 0;
+}
+
+// FNV-1a step over a number
+static unsigned int hash_add(unsigned int hash, unsigned int value) {
+    for (int i = 0; i < 4; i++) {
+        hash = (hash ^ ((value >> (i * 8)) & 0xff)) * 16777619u;
+    }
+    return hash;
+}
+
+// FNV-1a step over a string
+static unsigned int hash_add_string(unsigned int hash, const char *str) {
+    for (; *str != '\0'; str++) {
+        hash = (hash ^ (unsigned char)*str) * 16777619u;
+    }
+    return hash;
+}
+
+// Hash of what hardware_same_group() compares
+static unsigned int group_hash(const HardwareInfo *hw) {
+    unsigned int hash = 2166136261u;
+    hash = hash_add(hash, hw->type);
+    hash = hash_add(hash, hw->bus);
+    if (hw->vendor_id == 0) {
+        return hash_add_string(hash_add_string(hash, hw->vendor), hw->device);
+    }
+    hash = hash_add(hash, hw->vendor_id);
+    hash = hash_add(hash, hw->device_id);
+    hash = hash_add(hash, hw->subsys_vendor_id);
+    hash = hash_add(hash, hw->subsys_device_id);
+    return hash_add(hash, hw->class_code);
+}
+
+// Smallest power of two with room for count entries at most half full
+static unsigned int table_slots(int count) {
+    unsigned int slots = 16;
+    while (slots < (unsigned int)count * 2) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+// Order functions by bus address (fixed-width hex, so strcmp() suffices)
+static int compare_address(const void *a, const void *b) {
+    return strcmp(((const HardwareInfo *)a)->pci_id, ((const HardwareInfo *)b)->pci_id);
+}
+
+// Group scanned functions (one record each) by hardware_same_group(), in
+// bus address order, and count the virtual functions of each group from
+// their parents' addresses. Sorts devices; writes one exactly sized list to arena.
+static int group_devices(Arena *arena, HardwareInfo *devices, int count,
+                         char (*vf_parents)[PCI_ADDRESS_MAX], int vf_count, HardwareInfo **hw_list) {
+    unsigned int slots = table_slots(count);
+    unsigned int mask = slots - 1;
+    int *table = calloc(slots, sizeof(int));         // Group index + 1, 0 = empty
+    int *group_of = malloc(sizeof(int) * (count + 1));
+    int *firsts = malloc(sizeof(int) * (count + 1));  // First function of each group
+    int *sizes = calloc(count + 1, sizeof(int));
+    size_t *lengths = calloc(count + 1, sizeof(size_t));   // Of each group's address list
+    char **cursors = malloc(sizeof(char *) * (count + 1));
+    int groups = 0;
+
+    *hw_list = NULL;
+    qsort(devices, count, sizeof(HardwareInfo), compare_address);
+    if (table == NULL || group_of == NULL || firsts == NULL || sizes == NULL || lengths == NULL ||
+        cursors == NULL) {
+        groups = -1;
+        goto out;
+    }
+
+    for (int i = 0; i < count; i++) {
+        unsigned int slot = group_hash(&devices[i]) & mask;
+        while (table[slot] != 0 && !hardware_same_group(&devices[firsts[table[slot] - 1]], &devices[i])) {
+            slot = (slot + 1) & mask;
+        }
+        if (table[slot] == 0) {
+            firsts[groups] = i;
+            table[slot] = ++groups;
+        }
+        group_of[i] = table[slot] - 1;
+        sizes[group_of[i]]++;
+        lengths[group_of[i]] += strlen(devices[i].pci_id) + 1;
+    }
 
-    *hw_list = malloc(sizeof(HardwareInfo) * capacity);
+    *hw_list = arena_alloc(arena, sizeof(HardwareInfo) * (groups > 0 ? groups : 1));
     if (*hw_list == NULL) {
-        return 0;
+        groups = -1;
+        goto out;
+    }
+
+    // Groups of one keep their address string; the others get a list filled in order
+    for (int g = 0; g < groups; g++) {
+        HardwareInfo *hw = &(*hw_list)[g];
+        *hw = devices[firsts[g]];
+        hw->count = sizes[g];
+        hw->virtual_functions = 0;
+
+        char *list = sizes[g] > 1 ? arena_alloc(arena, lengths[g]) : NULL;
+        if (sizes[g] > 1 && list == NULL) {
+            *hw_list = NULL;
+            groups = -1;
+            goto out;
+        }
+        if (list != NULL) {
+            list[0] = '\0';
+            hw->addresses = list;
+        }
+        cursors[g] = list;
+    }
+    for (int i = 0; i < count; i++) {
+        char *cursor = cursors[group_of[i]];
+        if (cursor != NULL) {
+            size_t len = strlen(devices[i].pci_id);
+            if (cursor != (*hw_list)[group_of[i]].addresses) {
+                *cursor++ = ' ';
+            }
+            memcpy(cursor, devices[i].pci_id, len + 1);
+            cursors[group_of[i]] = cursor + len;
+        }
+    }
+
+    // Virtual functions go to the group of their parent; the table is reused,
+    // now keyed by address. VFs of functions we ignore are dropped with them.
+    memset(table, 0, sizeof(int) * slots);
+    for (int i = 0; i < count && vf_count > 0; i++) {
+        unsigned int slot = hash_add_string(2166136261u, devices[i].pci_id) & mask;
+        while (table[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = i + 1;
+    }
+    for (int v = 0; v < vf_count; v++) {
+        unsigned int slot = hash_add_string(2166136261u, vf_parents[v]) & mask;
+        while (table[slot] != 0 && strcmp(devices[table[slot] - 1].pci_id, vf_parents[v]) != 0) {
+            slot = (slot + 1) & mask;
+        }
+        if (table[slot] != 0) {
+            (*hw_list)[group_of[table[slot] - 1]].virtual_functions++;
+        }
+    }
+
+out:
+    free(table);
+    free(group_of);
+    free(firsts);
+    free(sizes);
+    free(lengths);
+    free(cursors);
+    return groups;
+}
+
+// Scan PCI devices through sysfs
+int scan_hardware_sysfs(Arena *arena, const char *sysfs_root, HardwareInfo **hw_list) {
+    char devices_path[256];
+    int entries = 0;
+    int seen = 0;
+    int count = 0;
+    int vf_count = 0;
+    unsigned long long span = trace_begin();
+
+    *hw_list = NULL;
+
+    snprintf(devices_path, sizeof(devices_path), "%s/bus/pci/devices", sysfs_root);
+    DIR *dir = opendir(devices_path);
+    if (dir == NULL) {
+        trace_end(span, "scan", "sysfs scan", "%s not readable", devices_path);
+        return -1;
+    }
+
+    // Size the scratch lists once from the number of entries
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        entries += entry->d_name[0] != '.';
+    }
+    rewinddir(dir);
+
+    HardwareInfo *devices = malloc(sizeof(HardwareInfo) * (entries + 1));
+    char (*vf_parents)[PCI_ADDRESS_MAX] = malloc(PCI_ADDRESS_MAX * (entries + 1));
+    if (devices == NULL || vf_parents == NULL) {
+        free(devices);
+        free(vf_parents);
+        closedir(dir);
+        trace_end(span, "scan", "sysfs scan", "out of memory for %d entries", entries);
+        return -1;
+    }
+
+    // Devices added since the count are left for the next scan
+    while (seen < entries && (entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        seen++;
+
+        char dev_path[512];
+        snprintf(dev_path, sizeof(dev_path), "%s/%s", devices_path, entry->d_name);
+
+        // Virtual functions are only counted, without reading their attributes
+        if (read_physfn(dev_path, vf_parents[vf_count], PCI_ADDRESS_MAX)) {
+            vf_count++;
+            continue;
+        }
+
+        if (read_pci_device(arena, dev_path, entry->d_name, &devices[count])) {
+            count++;
+        }
+    }
+
+    closedir(dir);
+
+    int groups = group_devices(arena, devices, count, vf_parents, vf_count, hw_list);
+    free(devices);
+    free(vf_parents);
+    if (groups < 0) {
+        trace_end(span, "scan", "sysfs scan", "out of memory grouping %d devices", count);
+        return -1;
+    }
+
+    // One lookup per group, not per function
+    for (int i = 0; i < groups; i++) {
+        set_device_names(arena, &(*hw_list)[i]);
+    }
+
+    trace_end(span, "scan", "sysfs scan", "%d devices in %d groups, %d virtual functions",
+              count, groups, vf_count);
+    return groups;
+}
+
+// Check whether a bus address belongs to a group
+bool hardware_has_address(const HardwareInfo *hw, const char *address) {
+    size_t len = strlen(address);
+
+    for (const char *p = hw->addresses; *p != '\0'; ) {
+        size_t token = strcspn(p, " ");
+        if (token == len && strncmp(p, address, len) == 0) {
+            return true;
+        }
+        p += token;
+        p += *p == ' ';
+    }
+    return false;
+}
+
+// Add a function to a group
+bool hardware_add_address(Arena *arena, HardwareInfo *hw, const char *address) {
+    if (hardware_has_address(hw, address)) {
+        return true;
     }
 
+    // arena_printf() falls back to "" when out of memory, never a valid list
+    const char *addresses = arena_printf(arena, "%s %s", hw->addresses, address);
+    if (addresses[0] == '\0') {
+        return false;
+    }
+    hw->addresses = addresses;
+    hw->count++;
+    return true;
+}
+
+// Remove a function from a group
+bool hardware_remove_address(Arena *arena, HardwareInfo *hw, const char *address) {
+    size_t len = strlen(address);
+    char *kept = arena_alloc(arena, strlen(hw->addresses) + 1);
+    char *out = kept;
+    bool found = false;
+
+    if (kept == NULL) {
+        return false;
+    }
+
+    for (const char *p = hw->addresses; *p != '\0'; ) {
+        size_t token = strcspn(p, " ");
+        if (!found && token == len && strncmp(p, address, len) == 0) {
+            found = true;
+        } else {
+            if (out != kept) {
+                *out++ = ' ';
+            }
+            memcpy(out, p, token);
+            out += token;
+        }
+        p += token;
+        p += *p == ' ';
+    }
+    *out = '\0';
+
+    if (!found) {
+        return false;
+    }
+
+    // The group is left untouched unless the new first address could be
+    // interned ("" stands in for it when out of memory)
+    const char *first = hw->pci_id;
+    if (hw->count > 1) {
+        first = arena_intern_len(arena, kept, strcspn(kept, " "));
+        if (first[0] == '\0') {
+            return false;
+        }
+    }
+
+    hw->addresses = kept;
+    hw->pci_id = first;
+    hw->count--;
+    return true;
+}
+
+// Override the sysfs root used by scan_hardware()
+void set_sysfs_root(const char *sysfs_root) {
+    if (sysfs_root == NULL) {
+        sysfs_root_override[0] = '\0';
+        return;
+    }
+
+    strncpy(sysfs_root_override, sysfs_root, sizeof(sysfs_root_override) - 1);
+    sysfs_root_override[sizeof(sysfs_root_override) - 1] = '\0';
+}
+
+// Use another pci.ids and index location
+void set_pci_ids_path(const char *path, const char *index_path) {
+    snprintf(pci_ids_path, sizeof(pci_ids_path), "%s", path != NULL ? path : PCI_IDS_DEFAULT_PATH);
+    snprintf(pci_ids_index_path, sizeof(pci_ids_index_path), "%s",
+             index_path != NULL ? index_path : PCI_IDS_INDEX_DEFAULT_PATH);
+
+    pci_ids_close(pci_ids);
+    pci_ids = NULL;
+    pci_ids_tried = false;
+}
+
+// Get the sysfs root used by scan_hardware()
+const char *get_sysfs_root(void) {
+    return sysfs_root_override[0] != '\0' ? sysfs_root_override : SYSFS_DEFAULT_ROOT;
+}
+
+// Scan system for hardware
+int scan_hardware(Arena *arena, HardwareInfo **hw_list) {
+    const char *root = get_sysfs_root();
+
+    int count = scan_hardware_sysfs(arena, root, hw_list);
+    if (count < 0) {
+        // No sysfs (containers, chroots without /sys) or no memory: fall back to lspci
+        fprintf(stderr, "sysfs PCI scan under %s failed, falling back to lspci\n", root);
+        return scan_hardware_lspci(arena, hw_list);
+    }
+
+    int functions = 0;
+    for (int i = 0; i < count; i++) {
+        functions += (*hw_list)[i].count;
+    }
+    printf("Hardware scan complete: found %d devices in %d groups\n", functions, count);
+
+    return count;
+}
+
+// Scan system for hardware using lspci
+int scan_hardware_lspci(Arena *arena, HardwareInfo **hw_list) {
+    static char *const lspci_argv[] = {"lspci", NULL};
+    ProcResult result;
+    int count = 0;
+    int capacity = 1;
+    unsigned long long span = trace_begin();
+
+    *hw_list = NULL;
+
     // Run lspci command
-    fp = popen("lspci", "r");
-    if (fp == NULL) {
+    if (!proc_run(lspci_argv, PROC_CAPTURE_STDOUT, &result)) {
         fprintf(stderr, "Failed to run lspci command\n");
-        free(*hw_list);
-        *hw_list = NULL;
+        proc_result_free(&result);
+        return 0;
+    }
+
+    // One scratch record per line at most
+    for (const char *p = result.out; *p != '\0'; p++) {
+        capacity += *p == '\n';
+    }
+    HardwareInfo *devices = malloc(sizeof(HardwareInfo) * capacity);
+    if (devices == NULL) {
+        proc_result_free(&result);
         return 0;
     }
 
     // Parse output
-    while (fgets(line, sizeof(line), fp) != NULL) {
+    char *saveptr;
+    for (char *line = strtok_r(result.out, "\n", &saveptr); line != NULL;
+         line = strtok_r(NULL, "\n", &saveptr)) {
         HardwareInfo hw;
         memset(&hw, 0, sizeof(HardwareInfo));
 
-        if (parse_pci_line(line, &hw)) {
-            // Resize array if needed
-            if (count >= capacity) {
-                capacity *= 2;
-                HardwareInfo *new_list = realloc(*hw_list, sizeof(HardwareInfo) * capacity);
-                if (new_list == NULL) {
-                    free_hardware_list(*hw_list, count);
-                    *hw_list = NULL;
-                    pclose(fp);
-                    return 0;
-                }
-                *hw_list = new_list;
-            }
-
-            // Extract PCI ID from line
-            char pci_id[32] = {0};
-            if (sscanf(line, "%31s", pci_id) == 1) {
-                strncpy(hw.pci_id, pci_id, sizeof(hw.pci_id) - 1);
-            }
+        if (parse_pci_line(arena, line, &hw) && count < capacity) {
+            // PCI ID is the first word of the line
+            hw.pci_id = arena_intern_len(arena, line, strcspn(line, " \t"));
+            hw.modalias = "";
+            hw.count = 1;
+            hw.addresses = hw.pci_id;
 
-            (*hw_list)[count++] = hw;
+            devices[count++] = hw;
         }
     }
 
-    pclose(fp);
+    proc_result_free(&result);
 
-    printf("Hardware scan complete: found %d devices\n", count);
+    // lspci shows no physfn: virtual functions stay groups of their own
+    int groups = group_devices(arena, devices, count, NULL, 0, hw_list);
+    free(devices);
+    if (groups < 0) {
+        return 0;
+    }
 
-    return count;
-}
+    printf("Hardware scan complete: found %d devices in %d groups\n", count, groups);
+    trace_end(span, "scan", "lspci scan", "%d devices in %d groups", count, groups);
 
-// Free hardware list
-void free_hardware_list(HardwareInfo *hw_list, int count) {
-    if (hw_list != NULL) {
-        free(hw_list);
-    }
+    return groups;
 }
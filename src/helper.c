@@ -0,0 +1,833 @@
+/*
+ * System helper - privileged backend for unprivileged clients
+ *
+ * Runs as root (normally started by systemd on the first connection to its
+ * socket) and serves scans and installs over the protocol in backend.c, so
+ * the GUI never needs root. Scan results stay warm between connections and
+ * are only recomputed when hardware, packages or the driver database change.
+ * Installs, and the package downloads the GUI starts while the user confirms
+ * one, are authorized per request through polkit.
+ *
+ * One poll loop serves every connection: requests are read without blocking,
+ * each against its own deadline, and at most one job (install or download)
+ * runs at a time in a child (which also waits for polkit) whose output the
+ * loop forwards.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <time.h>
+#include "../include/backend.h"
+#include "../include/hardware.h"
+#include "../include/driver.h"
+#include "../include/scan_cache.h"
+#include "../include/privilege.h"
+#include "../include/proc.h"
+#include "../include/trace.h"
+
+// First file descriptor passed by systemd socket activation
+#define SD_LISTEN_FDS_START 3
+
+// Connections served at once; more wait in the listen backlog
+#define HELPER_MAX_CLIENTS 16
+
+// How long a connection gets to send its request, in milliseconds
+#define REQUEST_TIMEOUT_MS 5000
+
+// How long a reply may wait for a client that does not read, in seconds
+#define REPLY_TIMEOUT 5
+
+// How long a job may wait for polkit (e.g. a password prompt), in milliseconds
+#define AUTHORIZE_TIMEOUT_MS (2 * 60 * 1000)
+
+// Reports of a job's child on its status pipe
+#define JOB_REPORT_AUTHORIZED 'A'   // polkit allowed it; output and X line follow
+#define JOB_REPORT_SYNCED 'S'       // The package databases were synced
+
+typedef struct {
+    const char *socket_path;
+    int idle_timeout;       // Seconds without a connection before exiting, 0: never
+    const char *trace_path;
+} HelperOptions;
+
+// Scan results kept between connections
+typedef struct {
+    Arena *arena;
+    HardwareInfo *hw_list;
+    int hw_count;
+    DriverInfo *drivers;
+    int driver_count;
+    ScanCacheKeys keys;
+    bool valid;
+} HelperState;
+
+// A connection whose request line is still arriving
+typedef struct {
+    int fd;                         // -1: free slot
+    char request[BACKEND_LINE_MAX];
+    size_t used;
+    long long deadline;             // now_ms() by which the request must be complete
+} HelperClient;
+
+// What a client can ask the helper to run, one job at a time
+typedef enum {
+    JOB_INSTALL,                    // install_drivers()
+    JOB_PREFETCH                    // pacman -Sw while the user confirms an install
+} JobKind;
+
+// Per kind: name in messages, polkit action, reply when polkit says no
+static const struct {
+    const char *name;
+    const char *action;
+    const char *denied;
+} job_kinds[] = {
+    [JOB_INSTALL] = { "Install", BACKEND_INSTALL_ACTION, "Not authorized to install drivers" },
+    [JOB_PREFETCH] = { "Download", BACKEND_PREFETCH_ACTION, "Not authorized to download packages" },
+};
+
+// The running job
+typedef struct {
+    pid_t pid;                      // 0: none
+    JobKind kind;
+    int client;                     // -1 once the client went away
+    int output;                     // Merged stdout/stderr of the child, -1 at its end
+    int status;                     // Reports of the child (JOB_REPORT_*), -1 at its end
+    char buf[BACKEND_LINE_MAX];
+    size_t used;
+    bool authorized;
+    bool cancelled;
+    long long deadline;             // now_ms() by which polkit must have answered
+    unsigned long long span;
+} HelperJob;
+
+// Everything the event loop owns
+typedef struct {
+    int listen_fd;
+    HelperState state;
+    HelperClient clients[HELPER_MAX_CLIENTS];
+    HelperJob job;
+} HelperServer;
+
+// Fixed slots of the poll set; the connections follow
+enum { POLL_LISTENER, POLL_JOB_OUTPUT, POLL_JOB_STATUS, POLL_JOB_CLIENT, POLL_CLIENTS };
+
+static volatile sig_atomic_t stop_requested = 0;
+
+// SIGTERM/SIGINT: leave the event loop (once a running job is done)
+static void on_stop_signal(int sig) {
+    (void)sig;  // Unused
+    stop_requested = 1;
+}
+
+// SIGINT in a download's child: pacman stops, the child cleans up after it
+static void on_prefetch_interrupt(int sig) {
+    (void)sig;  // Unused
+}
+
+// Print usage information
+static void print_usage(FILE *out, const char *prog) {
+    fprintf(out,
+            "Usage: %s [--socket <path>] [--idle-timeout <s>] [--trace <file>]\n"
+            "\n"
+            "  --socket <path>       Listen on <path> (default " BACKEND_SOCKET_DEFAULT ");\n"
+            "                        ignored when started through systemd socket activation\n"
+            "  --idle-timeout <s>    Exit after <s> seconds without a client (default 0: never)\n"
+            "  --trace <file>        Write a Chrome trace of every phase\n"
+            "  --help                Show this help message\n",
+            prog);
+}
+
+// Parse the command line; returns false on a usage error
+static bool parse_options(int argc, char *argv[], HelperOptions *opts) {
+    opts->socket_path = BACKEND_SOCKET_DEFAULT;
+    opts->idle_timeout = 0;
+    opts->trace_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Unknown option or missing value: %s\n", argv[i]);
+            return false;
+        }
+        if (strcmp(argv[i], "--socket") == 0) {
+            opts->socket_path = argv[++i];
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            opts->trace_path = argv[++i];
+        } else if (strcmp(argv[i], "--idle-timeout") == 0) {
+            char *end = NULL;
+            long timeout = strtol(argv[i + 1], &end, 10);
+            if (end == argv[i + 1] || *end != '\0' || timeout < 0 || timeout > INT_MAX / 1000) {
+                fprintf(stderr, "--idle-timeout needs a number of seconds\n");
+                return false;
+            }
+            opts->idle_timeout = (int)timeout;
+            i++;
+        } else {
+            fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Get the listening socket passed by systemd, -1 if not socket-activated
+static int activated_socket(void) {
+    const char *pid = getenv("LISTEN_PID");
+    const char *fds = getenv("LISTEN_FDS");
+
+    if (pid == NULL || fds == NULL || atol(pid) != (long)getpid() || atoi(fds) < 1) {
+        return -1;
+    }
+    unsetenv("LISTEN_PID");
+    unsetenv("LISTEN_FDS");
+    unsetenv("LISTEN_FDNAMES");
+    return SD_LISTEN_FDS_START;
+}
+
+// Create the listening socket ourselves (anyone may connect; installs are
+// authorized per request)
+static int listen_on(const char *path) {
+    struct sockaddr_un addr;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket path too long: %s\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+
+    unlink(path);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || chmod(path, 0666) != 0 ||
+        listen(fd, 16) != 0) {
+        fprintf(stderr, "Could not listen on %s: %s\n", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Bring the scan results up to date; rescan forces a fresh scan
+static bool update_results(HelperState *state, bool rescan) {
+    ScanCacheKeys keys;
+    scan_cache_compute_keys(&keys);
+
+    // Still warm; only the repositories may have been synced meanwhile
+    if (state->valid && !rescan && memcmp(&keys, &state->keys, sizeof(keys)) == 0) {
+        annotate_driver_availability(state->arena, state->drivers, state->driver_count);
+        return true;
+    }
+
+    Arena *arena = arena_create();
+    if (arena == NULL) {
+        return false;
+    }
+
+    // An explicit rescan must not be answered from the disk cache either
+    if (rescan) {
+        set_scan_cache_path("");
+    }
+    HardwareInfo *hw_list = NULL;
+    DriverInfo *drivers = NULL;
+    int hw_count = 0;
+    int driver_count = scan_and_detect_cached(arena, &hw_list, &hw_count, &drivers);
+    if (rescan) {
+        set_scan_cache_path(NULL);
+    }
+
+    if (state->arena != NULL) {
+        arena_destroy(state->arena);
+    }
+    state->arena = arena;
+    state->hw_list = hw_list;
+    state->hw_count = hw_count;
+    state->drivers = drivers;
+    state->driver_count = driver_count;
+    state->keys = keys;
+    state->valid = true;
+    return true;
+}
+
+// Monotonic clock in milliseconds
+static long long now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+// Close a connection and free its slot
+static void drop_client(HelperClient *client) {
+    close(client->fd);
+    client->fd = -1;
+    client->used = 0;
+}
+
+// Read what has arrived of the request line, without consuming anything after
+// it (a CANCEL may follow). Returns 1 once the line is complete, 0 if more is
+// to come, -1 if the client went away or the line is too long.
+static int read_request(HelperClient *client) {
+    while (client->used + 1 < sizeof(client->request)) {
+        char *line = client->request + client->used;
+        ssize_t n = recv(client->fd, line, sizeof(client->request) - 1 - client->used, MSG_PEEK);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return 0;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+
+        char *newline = memchr(line, '\n', n);
+        size_t take = newline != NULL ? (size_t)(newline - line) + 1 : (size_t)n;
+        if (recv(client->fd, line, take, 0) != (ssize_t)take) {
+            return -1;
+        }
+        client->used += take;
+        if (newline != NULL) {
+            client->request[client->used - 1] = '\0';
+            return 1;
+        }
+    }
+    return -1;
+}
+
+// Find a driver by its exact package set
+static DriverInfo *find_driver(HelperState *state, const char *package) {
+    for (int i = 0; i < state->driver_count; i++) {
+        if (strcmp(state->drivers[i].package, package) == 0) {
+            return &state->drivers[i];
+        }
+    }
+    return NULL;
+}
+
+// Send a chunk of job output as O lines; keeps an unfinished last line in buf
+static bool forward_output(int client, char *buf, size_t *used) {
+    char *start = buf;
+    char *newline;
+    bool ok = true;
+
+    while ((newline = memchr(start, '\n', *used - (start - buf))) != NULL) {
+        *newline = '\0';
+        ok = backend_send_line(client, "O %s", start) && ok;
+        start = newline + 1;
+    }
+
+    *used -= start - buf;
+    memmove(buf, start, *used);
+
+    // A line longer than the buffer goes out in pieces
+    if (*used == BACKEND_LINE_MAX - 1) {
+        buf[*used] = '\0';
+        ok = backend_send_line(client, "O %s", buf) && ok;
+        *used = 0;
+    }
+    return ok;
+}
+
+// Tell the helper something on the status pipe (JOB_REPORT_*)
+static void report_to_helper(int fd, char report) {
+    while (write(fd, &report, 1) < 0 && errno == EINTR) {
+    }
+}
+
+// Pass a sync on to the helper, whose later installs may then skip theirs
+static void report_synced(void *user_data) {
+    report_to_helper(*(int *)user_data, JOB_REPORT_SYNCED);
+}
+
+// Download a batch's packages into the cache; an interrupted or failed download
+// leaves no partial files of them behind. Returns pacman's exit code.
+static int run_prefetch(DriverInfo **batch, int count) {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_prefetch_interrupt;
+    sigaction(SIGINT, &action, NULL);
+
+    char **argv = build_prefetch_argv(batch, count);
+    char *packages = merge_driver_packages(batch, count);
+    if (argv == NULL || packages == NULL) {
+        free_argv(argv);
+        free(packages);
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    ProcResult result;
+    proc_run(argv, PROC_INHERIT, &result);
+    int exit_code = result.exit_code >= 0 ? result.exit_code : 127;
+    if (exit_code != 0) {
+        remove_partial_downloads(packages);
+    }
+
+    proc_result_free(&result);
+    free_argv(argv);
+    free(packages);
+    return exit_code;
+}
+
+// Start a job in a child whose output is streamed to the client. Returns true
+// if the job took over the connection; otherwise the client has been sent an
+// error.
+static bool start_job(HelperServer *server, int client, JobKind kind, char *request) {
+    HelperState *state = &server->state;
+    HelperJob *job = &server->job;
+
+    if (job->pid != 0) {
+        backend_send_line(client, "E busy");
+        return false;
+    }
+    if (!update_results(state, false)) {
+        backend_send_line(client, "E Out of memory");
+        return false;
+    }
+
+    DriverInfo *batch[state->driver_count + 1];
+    int count = 0;
+    int ttl = -1;
+    for (char *package = strtok(request, "\t"); package != NULL; package = strtok(NULL, "\t")) {
+        // The client's sync TTL (package names never contain '=')
+        if (count == 0 && ttl < 0 && strncmp(package, "ttl=", 4) == 0) {
+            char *end = NULL;
+            long seconds = strtol(package + 4, &end, 10);
+            if (end == package + 4 || *end != '\0' || seconds < 0 || seconds > INT_MAX) {
+                backend_send_line(client, "E Bad sync TTL: %s", package + 4);
+                return false;
+            }
+            ttl = (int)seconds;
+            continue;
+        }
+
+        DriverInfo *driver = find_driver(state, package);
+        if (driver == NULL) {
+            backend_send_line(client, "E Unknown driver: %s", package);
+            return false;
+        }
+        if (count < state->driver_count) {
+            batch[count++] = driver;
+        }
+    }
+    if (count == 0) {
+        backend_send_line(client, "E No drivers given");
+        return false;
+    }
+
+    int output[2];
+    int status[2];
+    if (pipe2(output, O_CLOEXEC) != 0) {
+        backend_send_line(client, "E Could not start: %s", strerror(errno));
+        return false;
+    }
+    if (pipe2(status, O_CLOEXEC) != 0) {
+        backend_send_line(client, "E Could not start: %s", strerror(errno));
+        close(output[0]);
+        close(output[1]);
+        return false;
+    }
+
+    printf("%s for %d driver(s) started by a client\n", job_kinds[kind].name, count);
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        backend_send_line(client, "E Could not start: %s", strerror(errno));
+        close(output[0]);
+        close(output[1]);
+        close(status[0]);
+        close(status[1]);
+        return false;
+    }
+    if (pid == 0) {
+        // Other connections must see their end when the helper closes them
+        close(server->listen_fd);
+        for (int i = 0; i < HELPER_MAX_CLIENTS; i++) {
+            if (server->clients[i].fd >= 0) {
+                close(server->clients[i].fd);
+            }
+        }
+        close(output[0]);
+        close(status[0]);
+
+        // Own process group, so a cancel reaches pacman and mkinitcpio too.
+        // An in-process (libalpm) install holds the SIGINT back until the
+        // transaction is stopped and the database unlocked (package_txn.h).
+        setpgid(0, 0);
+        signal(SIGTERM, SIG_DFL);
+        signal(SIGINT, SIG_DFL);
+
+        // polkit may ask for a password; only this child waits for it
+        if (!authorize_peer(client, job_kinds[kind].action)) {
+            _exit(1);
+        }
+        report_to_helper(status[1], JOB_REPORT_AUTHORIZED);
+        close(client);
+        set_packages_synced_func(report_synced, &status[1]);
+        if (ttl >= 0) {
+            set_sync_ttl(ttl);
+        }
+
+        dup2(output[1], STDOUT_FILENO);
+        dup2(output[1], STDERR_FILENO);
+        setvbuf(stdout, NULL, _IOLBF, 0);
+        int exit_code = kind == JOB_PREFETCH ? run_prefetch(batch, count)
+                                             : install_drivers(batch, count) ? 0 : 1;
+        fflush(stdout);
+        _exit(exit_code);
+    }
+    setpgid(pid, pid);
+    close(output[1]);
+    close(status[1]);
+
+    job->pid = pid;
+    job->kind = kind;
+    job->client = client;
+    job->output = output[0];
+    job->status = status[0];
+    job->used = 0;
+    job->authorized = false;
+    job->cancelled = false;
+    job->deadline = now_ms() + AUTHORIZE_TIMEOUT_MS;
+    job->span = trace_begin();
+    return true;
+}
+
+// Interrupt the job (its process group, so pacman and mkinitcpio too)
+static void cancel_job(HelperJob *job, const char *reason) {
+    if (!job->cancelled) {
+        printf("%s %s\n", job_kinds[job->kind].name, reason);
+        kill(-job->pid, SIGINT);
+        job->cancelled = true;
+    }
+}
+
+// Stop talking to the job's client; a job nobody follows is cancelled
+static void drop_job_client(HelperJob *job) {
+    close(job->client);
+    job->client = -1;
+    cancel_job(job, "cancelled: the client went away");
+}
+
+// Forward what the job printed
+static void read_job_output(HelperJob *job) {
+    ssize_t n = read(job->output, job->buf + job->used, sizeof(job->buf) - 1 - job->used);
+    if (n < 0 && errno == EINTR) {
+        return;
+    }
+    if (n <= 0) {
+        close(job->output);
+        job->output = -1;
+        return;
+    }
+
+    job->used += n;
+    if (job->client < 0) {
+        job->used = 0;
+    } else if (!forward_output(job->client, job->buf, &job->used)) {
+        drop_job_client(job);
+    }
+}
+
+// Take the job's reports (JOB_REPORT_*)
+static void read_job_status(HelperJob *job) {
+    char reports[16];
+    ssize_t n = read(job->status, reports, sizeof(reports));
+    if (n < 0 && errno == EINTR) {
+        return;
+    }
+    if (n <= 0) {
+        close(job->status);
+        job->status = -1;
+        return;
+    }
+
+    for (ssize_t i = 0; i < n; i++) {
+        if (reports[i] == JOB_REPORT_AUTHORIZED) {
+            job->authorized = true;
+        } else if (reports[i] == JOB_REPORT_SYNCED) {
+            mark_packages_synced();
+        }
+    }
+}
+
+// CANCEL, or the client went away: interrupt the transaction
+static void read_job_client(HelperJob *job) {
+    char request_buf[64];
+    ssize_t n = recv(job->client, request_buf, sizeof(request_buf), 0);
+    if (n < 0 && (errno == EINTR || errno == EAGAIN)) {
+        return;
+    }
+    if (n <= 0) {
+        drop_job_client(job);
+    } else if (memmem(request_buf, n, "CANCEL", 6) != NULL) {
+        cancel_job(job, "cancelled by the client");
+    }
+}
+
+// Reap the job once it has closed its pipes and report how it ended
+static void finish_job(HelperServer *server) {
+    HelperJob *job = &server->job;
+
+    int status = 0;
+    while (waitpid(job->pid, &status, 0) < 0 && errno == EINTR) {
+    }
+    int exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    if (job->client >= 0) {
+        if (job->used > 0) {
+            job->buf[job->used] = '\0';
+            backend_send_line(job->client, "O %s", job->buf);
+        }
+        if (job->authorized) {
+            backend_send_line(job->client, "X %d", exit_code);
+        } else {
+            backend_send_line(job->client, "E %s", job_kinds[job->kind].denied);
+        }
+        close(job->client);
+    }
+    trace_end(job->span, "helper", job_kinds[job->kind].name, "exit %d", exit_code);
+
+    if (!job->authorized) {
+        printf("%s not authorized\n", job_kinds[job->kind].name);
+    } else {
+        printf("%s finished with exit code %d\n", job_kinds[job->kind].name, exit_code);
+    }
+
+    // The child's bookkeeping (installed flags, package snapshot) stayed there
+    if (job->authorized && job->kind == JOB_INSTALL) {
+        refresh_installed_packages();
+        server->state.valid = false;
+    }
+    job->pid = 0;
+    job->client = -1;
+}
+
+// Answer a complete request; a job keeps the connection, anything else closes it
+static void serve_request(HelperServer *server, int client, char *request) {
+    // Replies go out blocking, but a client that stops reading is given up on
+    int flags = fcntl(client, F_GETFL);
+    fcntl(client, F_SETFL, flags & ~O_NONBLOCK);
+    struct timeval timeout = { REPLY_TIMEOUT, 0 };
+    setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    unsigned long long span = trace_begin();
+    if (strcmp(request, "QUERY") == 0 || strcmp(request, "SCAN") == 0) {
+        if (update_results(&server->state, strcmp(request, "SCAN") == 0)) {
+            backend_send_results(client, server->state.hw_list, server->state.hw_count,
+                                 server->state.drivers, server->state.driver_count);
+        } else {
+            backend_send_line(client, "E Scan failed");
+        }
+    } else if (strncmp(request, "INSTALL\t", 8) == 0 || strncmp(request, "PREFETCH\t", 9) == 0) {
+        JobKind kind = request[0] == 'I' ? JOB_INSTALL : JOB_PREFETCH;
+        if (start_job(server, client, kind, strchr(request, '\t') + 1)) {
+            trace_end(span, "helper", "Request", "%.16s", request);
+            return;
+        }
+    } else {
+        backend_send_line(client, "E Unknown request");
+    }
+    trace_end(span, "helper", "Request", "%.16s", request);
+    close(client);
+}
+
+// Take a new connection into a free slot
+static void accept_client(HelperServer *server) {
+    int fd = accept4(server->listen_fd, NULL, NULL, SOCK_CLOEXEC | SOCK_NONBLOCK);
+    if (fd < 0) {
+        return;
+    }
+    for (int i = 0; i < HELPER_MAX_CLIENTS; i++) {
+        if (server->clients[i].fd < 0) {
+            server->clients[i].fd = fd;
+            server->clients[i].used = 0;
+            server->clients[i].deadline = now_ms() + REQUEST_TIMEOUT_MS;
+            return;
+        }
+    }
+    close(fd);
+}
+
+// Serve connections until stopped (after the running job) or idle
+static void serve(HelperServer *server, int idle_timeout) {
+    HelperJob *job = &server->job;
+    long long idle_since = now_ms();
+
+    while (!stop_requested || job->pid != 0) {
+        struct pollfd fds[POLL_CLIENTS + HELPER_MAX_CLIENTS];
+        long long wake = -1;
+        bool active = job->pid != 0;
+        bool slot_free = false;
+
+        for (int i = 0; i < HELPER_MAX_CLIENTS; i++) {
+            HelperClient *client = &server->clients[i];
+            fds[POLL_CLIENTS + i] = (struct pollfd){ .fd = client->fd, .events = POLLIN };
+            if (client->fd < 0) {
+                slot_free = true;
+                continue;
+            }
+            active = true;
+            if (wake < 0 || client->deadline < wake) {
+                wake = client->deadline;
+            }
+        }
+
+        // With every slot taken, further connections wait in the backlog
+        fds[POLL_LISTENER] = (struct pollfd){
+            .fd = stop_requested || !slot_free ? -1 : server->listen_fd, .events = POLLIN
+        };
+        fds[POLL_JOB_OUTPUT] = (struct pollfd){ .fd = job->pid != 0 ? job->output : -1, .events = POLLIN };
+        fds[POLL_JOB_STATUS] = (struct pollfd){ .fd = job->pid != 0 ? job->status : -1, .events = POLLIN };
+        fds[POLL_JOB_CLIENT] = (struct pollfd){ .fd = job->pid != 0 ? job->client : -1, .events = POLLIN };
+
+        if (job->pid != 0 && !job->authorized && !job->cancelled && (wake < 0 || job->deadline < wake)) {
+            wake = job->deadline;
+        }
+        if (!active && idle_timeout > 0) {
+            wake = idle_since + (long long)idle_timeout * 1000;
+        }
+
+        long long now = now_ms();
+        int timeout = wake < 0 ? -1 : wake <= now ? 0 : (int)(wake - now < INT_MAX ? wake - now : INT_MAX);
+        int ready = poll(fds, POLL_CLIENTS + HELPER_MAX_CLIENTS, timeout);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("poll");
+            break;
+        }
+        now = now_ms();
+        if (ready == 0 && !active && idle_timeout > 0 && now >= idle_since + (long long)idle_timeout * 1000) {
+            printf("Idle for %d s, exiting\n", idle_timeout);
+            break;
+        }
+
+        if (job->pid != 0) {
+            if (fds[POLL_JOB_OUTPUT].revents != 0) {
+                read_job_output(job);
+            }
+            if (fds[POLL_JOB_STATUS].revents != 0) {
+                read_job_status(job);
+            }
+            if (fds[POLL_JOB_CLIENT].revents != 0 && job->client >= 0) {
+                read_job_client(job);
+            }
+            if (!job->authorized && now >= job->deadline) {
+                cancel_job(job, "cancelled: not authorized in time");
+            }
+            if (job->output < 0 && job->status < 0) {
+                finish_job(server);
+            }
+        }
+
+        // Each connection has its own deadline for the request line
+        for (int i = 0; i < HELPER_MAX_CLIENTS; i++) {
+            HelperClient *client = &server->clients[i];
+            if (client->fd < 0) {
+                continue;
+            }
+            int state = fds[POLL_CLIENTS + i].revents != 0 ? read_request(client) : 0;
+            if (state > 0) {
+                int fd = client->fd;
+                client->fd = -1;
+                serve_request(server, fd, client->request);
+            } else if (state < 0 || now >= client->deadline) {
+                drop_client(client);
+            }
+        }
+
+        if (fds[POLL_LISTENER].revents != 0) {
+            accept_client(server);
+        }
+        if (active || ready > 0) {
+            idle_since = now;
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    HelperOptions opts;
+
+    if (argc > 1 && (strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-h") == 0)) {
+        print_usage(stdout, argv[0]);
+        return 0;
+    }
+    if (!parse_options(argc, argv, &opts)) {
+        print_usage(stderr, argv[0]);
+        return 2;
+    }
+    if (!is_root()) {
+        fprintf(stderr, "The system helper must run as root\n");
+        return 1;
+    }
+
+    // Log lines reach the journal as they happen
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    trace_init(opts.trace_path);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_stop_signal;
+    sigaction(SIGTERM, &action, NULL);
+    sigaction(SIGINT, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    bool activated = true;
+    int listen_fd = activated_socket();
+    if (listen_fd < 0) {
+        activated = false;
+        listen_fd = listen_on(opts.socket_path);
+        if (listen_fd < 0) {
+            return 1;
+        }
+    }
+    printf("System helper listening on %s\n", activated ? "the activated socket" : opts.socket_path);
+
+    HelperServer server;
+    memset(&server, 0, sizeof(server));
+    server.listen_fd = listen_fd;
+    for (int i = 0; i < HELPER_MAX_CLIENTS; i++) {
+        server.clients[i].fd = -1;
+    }
+    server.job.client = -1;
+    server.job.output = -1;
+    server.job.status = -1;
+
+    serve(&server, opts.idle_timeout);
+
+    // systemd owns an activated socket and keeps listening for the next start
+    if (!activated) {
+        unlink(opts.socket_path);
+    }
+    for (int i = 0; i < HELPER_MAX_CLIENTS; i++) {
+        if (server.clients[i].fd >= 0) {
+            close(server.clients[i].fd);
+        }
+    }
+    close(listen_fd);
+    if (server.state.arena != NULL) {
+        arena_destroy(server.state.arena);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Hotplug monitoring implementation
+ *
+ * Events go into a UeventQueue (uevent.c) and a timer hands the burst to
+ * the callback once it has been quiet for UEVENT_DEBOUNCE_MS.
+ */
+
+#include <glib.h>
+#include <glib-unix.h>
+#include <unistd.h>
+#include "../include/hotplug.h"
+
+static int uevent_fd = -1;
+static guint uevent_source_id = 0;
+static guint debounce_source_id = 0;
+static UeventQueue queue;
+static HotplugFunc hotplug_callback = NULL;
+static gpointer hotplug_user_data = NULL;
+
+// Monotonic clock in milliseconds
+static unsigned long long monotonic_ms(void) {
+    return (unsigned long long)(g_get_monotonic_time() / 1000);
+}
+
+// The debounce timer fired: hand over the burst if no event came meanwhile
+static gboolean on_debounce_timeout(gpointer user_data) {
+    (void)user_data;  // Unused
+
+    unsigned long long now = monotonic_ms();
+    if (!uevent_queue_due(&queue, now)) {
+        // Events after the timer was armed moved the deadline
+        debounce_source_id = g_timeout_add((guint)(queue.deadline_ms - now),
+                                           on_debounce_timeout, NULL);
+        return G_SOURCE_REMOVE;
+    }
+
+    debounce_source_id = 0;
+    if (hotplug_callback != NULL) {
+        hotplug_callback(&queue, hotplug_user_data);
+    }
+    uevent_queue_clear(&queue);
+    return G_SOURCE_REMOVE;
+}
+
+// The netlink socket is readable
+static gboolean on_uevent_ready(gint fd, GIOCondition condition, gpointer user_data) {
+    (void)condition;  // Unused
+    (void)user_data;  // Unused
+
+    Uevent event;
+    bool queued = false;
+    while (uevent_socket_receive(fd, &event)) {
+        queued = uevent_queue_add(&queue, &event, monotonic_ms()) || queued;
+    }
+
+    // One timer per burst; it re-arms itself while events keep coming
+    if (queued && debounce_source_id == 0) {
+        debounce_source_id = g_timeout_add(UEVENT_DEBOUNCE_MS, on_debounce_timeout, NULL);
+    }
+
+    return G_SOURCE_CONTINUE;
+}
+
+// Start listening for kernel uevents
+bool hotplug_start(HotplugFunc callback, gpointer user_data) {
+    hotplug_callback = callback;
+    hotplug_user_data = user_data;
+
+    if (uevent_fd >= 0) {
+        return true;
+    }
+
+    uevent_fd = uevent_socket_open();
+    if (uevent_fd < 0) {
+        return false;
+    }
+
+    uevent_source_id = g_unix_fd_add(uevent_fd, G_IO_IN, on_uevent_ready, NULL);
+    return true;
+}
+
+// Stop listening
+void hotplug_stop(void) {
+    if (uevent_source_id != 0) {
+        g_source_remove(uevent_source_id);
+        uevent_source_id = 0;
+    }
+    if (debounce_source_id != 0) {
+        g_source_remove(debounce_source_id);
+        debounce_source_id = 0;
+    }
+    if (uevent_fd >= 0) {
+        close(uevent_fd);
+        uevent_fd = -1;
+    }
+    uevent_queue_clear(&queue);
+    hotplug_callback = NULL;
+    hotplug_user_data = NULL;
+}
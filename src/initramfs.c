@@ -0,0 +1,721 @@
+/*
+ * Initramfs rebuild implementation
+ *
+ * Rather than `mkinitcpio -P`, which regenerates every image of every preset
+ * one after another, only the presets whose images can contain something an
+ * install transaction changed are rebuilt, side by side:
+ *
+ *   - a preset's kernel is the module directory whose pkgbase file names the
+ *     kernel package of the preset's ALL_kver image;
+ *   - the packages a transaction installed are the local database entries it
+ *     added (new versions of upgraded packages included), so dependencies
+ *     count as much as the packages asked for;
+ *   - the kernel modules a package installs come from its file list in the
+ *     pacman local database; DKMS packages build for every kernel;
+ *   - an image contains a module when its mkinitcpio.conf lists the module in
+ *     MODULES, or when the kms hook is enabled and the module is a DRM driver;
+ *     modprobe.d configuration lands in every image built with the modconf hook.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <unistd.h>
+#include "../include/initramfs.h"
+#include "../include/proc.h"
+#include "../include/trace.h"
+
+// Kernel module directories looked at when matching presets to kernels
+#define INITRAMFS_MAX_KERNELS 32
+
+// A kernel module installed by the batch
+typedef struct {
+    char kernel[96];        // Module directory name, "" for every kernel
+    char name[64];          // Dashes normalised to underscores
+    bool drm;               // DRM driver, pulled in by the kms hook
+} BatchModule;
+
+// What the packages of a batch can put into initramfs images
+typedef struct {
+    BatchModule *modules;
+    int module_count;
+    int module_capacity;
+    bool modprobe_config;   // Some package ships modprobe.d configuration
+    char unknown[64];       // First package whose contents couldn't be read
+} BatchFootprint;
+
+// One mkinitcpio preset
+typedef struct {
+    char name[64];
+    char kernel[96];        // Module directory of its kernel, "" if not found
+    char config[256];       // mkinitcpio.conf it builds with
+} Preset;
+
+// A kernel module directory and the kernel package it belongs to
+typedef struct {
+    char dir[96];
+    char pkgbase[64];
+} KernelDir;
+
+static char initramfs_root[256] = "";
+
+// Look for mkinitcpio configuration and kernel modules below another root
+void set_initramfs_root(const char *root) {
+    strncpy(initramfs_root, root != NULL ? root : "", sizeof(initramfs_root) - 1);
+    initramfs_root[sizeof(initramfs_root) - 1] = '\0';
+
+    // "/" and "" mean the same; paths below always start with a slash
+    size_t len = strlen(initramfs_root);
+    if (len > 0 && initramfs_root[len - 1] == '/') {
+        initramfs_root[len - 1] = '\0';
+    }
+}
+
+// Read a whole file, NUL-terminated (caller frees); NULL if unreadable
+static char *read_file(const char *path) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    size_t len = 0;
+    size_t capacity = 4096;
+    char *data = malloc(capacity);
+    ssize_t n = 0;
+
+    while (data != NULL) {
+        if (capacity - len < 2) {
+            char *grown = realloc(data, capacity * 2);
+            if (grown == NULL) {
+                free(data);
+                data = NULL;
+                break;
+            }
+            data = grown;
+            capacity *= 2;
+        }
+        n = read(fd, data + len, capacity - len - 1);
+        if (n <= 0) {
+            break;
+        }
+        len += n;
+    }
+    close(fd);
+
+    if (data == NULL || n < 0) {
+        free(data);
+        return NULL;
+    }
+    data[len] = '\0';
+    return data;
+}
+
+// Value of a shell assignment NAME="value" (quotes stripped); false if absent
+static bool shell_value(const char *text, const char *name, char *value, size_t size) {
+    size_t name_len = strlen(name);
+
+    for (const char *line = text; *line != '\0'; ) {
+        const char *p = line + strspn(line, " \t");
+        const char *next = strchr(line, '\n');
+        line = next != NULL ? next + 1 : p + strlen(p);
+        if (strncmp(p, name, name_len) != 0 || p[name_len] != '=') {
+            continue;
+        }
+
+        const char *start = p + name_len + 1;
+        size_t len = strcspn(start, "\n");
+        if (len > 0 && (*start == '"' || *start == '\'')) {
+            char quote = *start++;
+            const char *end = memchr(start, quote, len - 1);
+            len = end != NULL ? (size_t)(end - start) : len - 1;
+        }
+        if (len >= size) {
+            len = size - 1;
+        }
+        memcpy(value, start, len);
+        value[len] = '\0';
+        return true;
+    }
+    return false;
+}
+
+// Kernel module name from a file name or path: ".../nvidia-drm.ko.zst" -> "nvidia_drm"
+static void module_name(const char *file, size_t len, char *name, size_t size) {
+    const char *slash = memrchr(file, '/', len);
+    if (slash != NULL) {
+        len -= slash + 1 - file;
+        file = slash + 1;
+    }
+
+    const char *ko = strstr(file, ".ko");
+    if (ko != NULL && (size_t)(ko - file) < len) {
+        len = ko - file;
+    }
+    while (len > 0 && file[len - 1] == '?') {
+        len--;   // Optional MODULES entry
+    }
+    if (len >= size) {
+        len = size - 1;
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        name[i] = file[i] == '-' ? '_' : file[i];
+    }
+    name[len] = '\0';
+}
+
+// Append a word to a space-separated list
+static void append_word(char *list, size_t size, const char *word) {
+    size_t used = strlen(list);
+    snprintf(list + used, size - used, used > 0 ? " %s" : "%s", word);
+}
+
+// Check a space-separated list for a word
+static bool has_word(const char *list, const char *word) {
+    size_t len = strlen(word);
+    for (const char *p = list; (p = strstr(p, word)) != NULL; p += len) {
+        if ((p == list || p[-1] == ' ') && (p[len] == ' ' || p[len] == '\0')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Collect the words of NAME=(...) and NAME+=(...) arrays in a shell config,
+// optionally as module names
+static void parse_array(const char *text, const char *name, bool modules, char *words, size_t size) {
+    size_t name_len = strlen(name);
+    const char *p = text;
+
+    while (*p != '\0') {
+        p += strspn(p, " \t");
+        if (strncmp(p, name, name_len) == 0) {
+            const char *q = p + name_len;
+            bool append = *q == '+';
+            q += append;
+            if (q[0] == '=' && q[1] == '(') {
+                if (!append) {
+                    words[0] = '\0';
+                }
+
+                // Words up to the closing parenthesis, which may be lines away
+                for (q += 2; *q != '\0' && *q != ')'; ) {
+                    if (*q == '#') {
+                        q += strcspn(q, "\n");
+                    } else if (isspace((unsigned char)*q)) {
+                        q++;
+                    } else {
+                        char word[128];
+                        size_t n = 0;
+                        for (; *q != '\0' && *q != ')' && !isspace((unsigned char)*q); q++) {
+                            if (*q != '"' && *q != '\'' && n < sizeof(word) - 1) {
+                                word[n++] = *q;
+                            }
+                        }
+                        word[n] = '\0';
+                        if (n > 0 && modules) {
+                            char normalised[128];
+                            module_name(word, n, normalised, sizeof(normalised));
+                            append_word(words, size, normalised);
+                        } else if (n > 0) {
+                            append_word(words, size, word);
+                        }
+                    }
+                }
+                p = q;
+            }
+        }
+
+        p += strcspn(p, "\n");
+        if (*p == '\n') {
+            p++;
+        }
+    }
+}
+
+// Map kernel module directories to their kernel packages
+static int load_kernel_dirs(KernelDir *kernels, int max) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s%s", initramfs_root, KERNEL_MODULES_DIR);
+
+    DIR *dir = opendir(path);
+    if (dir == NULL) {
+        return 0;
+    }
+
+    int count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL && count < max) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+
+        char pkgbase_path[PATH_MAX];
+        if (snprintf(pkgbase_path, sizeof(pkgbase_path), "%s/%s/pkgbase", path,
+                     entry->d_name) >= (int)sizeof(pkgbase_path)) {
+            continue;
+        }
+        char *pkgbase = read_file(pkgbase_path);
+        if (pkgbase == NULL) {
+            continue;
+        }
+
+        // A shortened name could match another preset's kernel: leave it out
+        pkgbase[strcspn(pkgbase, "\n")] = '\0';
+        KernelDir *kernel = &kernels[count];
+        if (snprintf(kernel->dir, sizeof(kernel->dir), "%s", entry->d_name) < (int)sizeof(kernel->dir) &&
+            snprintf(kernel->pkgbase, sizeof(kernel->pkgbase), "%s", pkgbase) < (int)sizeof(kernel->pkgbase)) {
+            count++;
+        }
+        free(pkgbase);
+    }
+    closedir(dir);
+
+    return count;
+}
+
+// scandir() filter for preset files
+static int is_preset_file(const struct dirent *entry) {
+    size_t len = strlen(entry->d_name);
+    return entry->d_name[0] != '.' && len > strlen(".preset") &&
+           strcmp(entry->d_name + len - strlen(".preset"), ".preset") == 0;
+}
+
+// Read the presets in name order; -1 if there are none or too many to handle
+static int load_presets(Preset *presets, int max) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s%s", initramfs_root, MKINITCPIO_PRESET_DIR);
+
+    struct dirent **entries = NULL;
+    int count = scandir(path, &entries, is_preset_file, alphasort);
+    if (count <= 0 || count > max) {
+        for (int i = 0; i < count; i++) {
+            free(entries[i]);
+        }
+        free(entries);
+        return -1;
+    }
+
+    KernelDir kernels[INITRAMFS_MAX_KERNELS];
+    int kernel_count = load_kernel_dirs(kernels, INITRAMFS_MAX_KERNELS);
+
+    for (int i = 0; i < count; i++) {
+        Preset *preset = &presets[i];
+        memset(preset, 0, sizeof(Preset));
+        int len = (int)(strlen(entries[i]->d_name) - strlen(".preset"));
+
+        // mkinitcpio -p can't be given a shortened name: rebuild everything
+        if (len >= (int)sizeof(preset->name)) {
+            for (int j = i; j < count; j++) {
+                free(entries[j]);
+            }
+            free(entries);
+            return -1;
+        }
+        snprintf(preset->name, sizeof(preset->name), "%.*s", len, entries[i]->d_name);
+        snprintf(preset->config, sizeof(preset->config), "%s", MKINITCPIO_CONFIG);
+
+        char preset_path[PATH_MAX];
+        snprintf(preset_path, sizeof(preset_path), "%s/%s", path, entries[i]->d_name);
+        char *text = read_file(preset_path);
+        free(entries[i]);
+
+        // The kernel package is named by the image: /boot/vmlinuz-<pkgbase>.
+        // A name too long for any kernel directory matches none ("").
+        char kver[256] = "";
+        char pkgbase[64];
+        memcpy(pkgbase, preset->name, sizeof(pkgbase));
+        if (text != NULL) {
+            if (shell_value(text, "ALL_kver", kver, sizeof(kver))) {
+                const char *image = strrchr(kver, '/');
+                image = image != NULL ? image + 1 : kver;
+                if (strncmp(image, "vmlinuz-", strlen("vmlinuz-")) == 0 &&
+                    snprintf(pkgbase, sizeof(pkgbase), "%s", image + strlen("vmlinuz-")) >= (int)sizeof(pkgbase)) {
+                    pkgbase[0] = '\0';
+                }
+            }
+            shell_value(text, "ALL_config", preset->config, sizeof(preset->config));
+            free(text);
+        }
+
+        for (int k = 0; k < kernel_count && pkgbase[0] != '\0'; k++) {
+            if (strcmp(kernels[k].pkgbase, pkgbase) == 0) {
+                snprintf(preset->kernel, sizeof(preset->kernel), "%s", kernels[k].dir);
+                break;
+            }
+        }
+    }
+    free(entries);
+
+    return count;
+}
+
+// Record a module installed by the batch
+static void add_module(BatchFootprint *footprint, const char *kernel, size_t kernel_len,
+                       const char *file, size_t file_len, bool drm) {
+    if (footprint->module_count >= footprint->module_capacity) {
+        int capacity = footprint->module_capacity > 0 ? footprint->module_capacity * 2 : 16;
+        BatchModule *grown = realloc(footprint->modules, sizeof(BatchModule) * capacity);
+        if (grown == NULL) {
+            snprintf(footprint->unknown, sizeof(footprint->unknown), "(out of memory)");
+            return;
+        }
+        footprint->modules = grown;
+        footprint->module_capacity = capacity;
+    }
+
+    BatchModule *module = &footprint->modules[footprint->module_count++];
+    snprintf(module->kernel, sizeof(module->kernel), "%.*s", (int)kernel_len, kernel);
+    module_name(file, file_len, module->name, sizeof(module->name));
+    module->drm = drm;
+}
+
+// Record the modules a DKMS source tree builds (for every kernel)
+static bool add_dkms_modules(BatchFootprint *footprint, const char *conf_path) {
+    char path[768];
+    snprintf(path, sizeof(path), "%s/%s", initramfs_root, conf_path);
+
+    char *text = read_file(path);
+    if (text == NULL) {
+        return false;
+    }
+
+    bool drm = strstr(text, "drivers/gpu") != NULL;
+    int found = 0;
+    for (const char *p = strstr(text, "BUILT_MODULE_NAME["); p != NULL;
+         p = strstr(p + 1, "BUILT_MODULE_NAME[")) {
+        if (p != text && p[-1] != '\n' && p[-1] != ' ' && p[-1] != '\t') {
+            continue;
+        }
+        const char *value = strstr(p, "]=");
+        if (value == NULL) {
+            continue;
+        }
+        value += 2;
+        value += strspn(value, "\"'");
+        add_module(footprint, "", 0, value, strcspn(value, "\"'\n"), drm);
+        found++;
+    }
+
+    // Without BUILT_MODULE_NAME the module is named after the package
+    char package[64];
+    if (found == 0 && shell_value(text, "PACKAGE_NAME", package, sizeof(package))) {
+        add_module(footprint, "", 0, package, strlen(package), drm);
+        found++;
+    }
+
+    free(text);
+    return found > 0;
+}
+
+// qsort()/bsearch() comparison of entry names
+static int compare_entries(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// Read the entries of the pacman local database, sorted, into one block of
+// names; false if unreadable
+static bool list_local_entries(InitramfsSnapshot *list) {
+    list->entries = NULL;
+    list->names = NULL;
+    list->count = -1;
+
+    DIR *dir = opendir(get_pacman_db_path());
+    if (dir == NULL) {
+        return false;
+    }
+
+    // Offsets first: the block moves while it grows
+    size_t *offsets = NULL;
+    size_t used = 0;
+    size_t size = 0;
+    int count = 0;
+    int capacity = 0;
+    bool ok = true;
+    struct dirent *entry;
+    while (ok && (entry = readdir(dir)) != NULL) {
+        // Package entries are directories; ALPM_DB_VERSION is not
+        if (entry->d_name[0] == '.' || (entry->d_type != DT_DIR && entry->d_type != DT_UNKNOWN)) {
+            continue;
+        }
+
+        size_t len = strlen(entry->d_name) + 1;
+        if (count == capacity) {
+            capacity = capacity > 0 ? capacity * 2 : 1024;
+            size_t *grown = realloc(offsets, sizeof(size_t) * capacity);
+            ok = grown != NULL;
+            offsets = ok ? grown : offsets;
+        }
+        if (ok && used + len > size) {
+            size = size > 0 ? size * 2 : 32768;
+            size = size < used + len ? used + len : size;
+            char *grown = realloc(list->names, size);
+            ok = grown != NULL;
+            list->names = ok ? grown : list->names;
+        }
+        if (ok) {
+            memcpy(list->names + used, entry->d_name, len);
+            offsets[count++] = used;
+            used += len;
+        }
+    }
+    closedir(dir);
+
+    list->entries = ok ? malloc(sizeof(char *) * (count + 1)) : NULL;
+    if (list->entries == NULL) {
+        free(offsets);
+        free(list->names);
+        list->names = NULL;
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        list->entries[i] = list->names + offsets[i];
+    }
+    free(offsets);
+
+    qsort(list->entries, count, sizeof(char *), compare_entries);
+    list->count = count;
+    return true;
+}
+
+// Record the local database's entries before a transaction
+void initramfs_snapshot_take(InitramfsSnapshot *snapshot) {
+    initramfs_snapshot_free(snapshot);
+    list_local_entries(snapshot);
+}
+
+// Free a snapshot
+void initramfs_snapshot_free(InitramfsSnapshot *snapshot) {
+    free(snapshot->entries);
+    free(snapshot->names);
+    snapshot->entries = NULL;
+    snapshot->names = NULL;
+    snapshot->count = -1;
+}
+
+// Record what an installed package (its local database entry) can put into
+// an initramfs
+static void add_package(BatchFootprint *footprint, const char *entry) {
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s/%s/files", get_pacman_db_path(), entry);
+    char *files = read_file(path);
+    if (files == NULL) {
+        if (footprint->unknown[0] == '\0') {
+            snprintf(footprint->unknown, sizeof(footprint->unknown), "%s", entry);
+        }
+        return;
+    }
+
+    static const char modules_prefix[] = "usr/lib/modules/";
+    const char *section = strstr(files, "%FILES%\n");
+    const char *line = section != NULL ? section + strlen("%FILES%\n") : "";
+
+    while (*line != '\0' && *line != '\n' && *line != '%') {
+        size_t len = strcspn(line, "\n");
+
+        if ((strncmp(line, "usr/lib/modprobe.d/", 19) == 0 || strncmp(line, "etc/modprobe.d/", 15) == 0) &&
+            line[len - 1] != '/') {
+            footprint->modprobe_config = true;
+        } else if (strncmp(line, modules_prefix, strlen(modules_prefix)) == 0 &&
+                   memmem(line, len, ".ko", 3) != NULL) {
+            const char *kernel = line + strlen(modules_prefix);
+            size_t kernel_len = strcspn(kernel, "/\n");
+
+            // Old-style extramodules-<flavour> directories aren't tied to one version
+            if (strncmp(kernel, "extramodules-", strlen("extramodules-")) == 0) {
+                kernel_len = 0;
+            }
+            add_module(footprint, kernel, kernel_len, line, len,
+                       memmem(line, len, "/drivers/gpu/", 13) != NULL);
+        } else if (strncmp(line, "usr/src/", 8) == 0 && len > 10 &&
+                   strncmp(line + len - 10, "/dkms.conf", 10) == 0) {
+            char conf[512];
+            snprintf(conf, sizeof(conf), "%.*s", (int)len, line);
+            if (!add_dkms_modules(footprint, conf) && footprint->unknown[0] == '\0') {
+                snprintf(footprint->unknown, sizeof(footprint->unknown), "%s", entry);
+            }
+        }
+
+        line += len + (line[len] == '\n');
+    }
+
+    free(files);
+}
+
+// Append a config file's MODULES and HOOKS to what was parsed so far
+static bool parse_config(const char *path, char *modules, size_t modules_size,
+                         char *hooks, size_t hooks_size) {
+    char *text = read_file(path);
+    if (text == NULL) {
+        return false;
+    }
+    parse_array(text, "MODULES", true, modules, modules_size);
+    parse_array(text, "HOOKS", false, hooks, hooks_size);
+    free(text);
+    return true;
+}
+
+// Decide whether a preset's images change; fills reason if so
+static bool preset_needs_rebuild(const Preset *preset, const BatchFootprint *footprint,
+                                 char *reason, size_t size) {
+    char modules[2048] = "";
+    char hooks[1024] = "";
+    char path[768];
+
+    if (footprint->unknown[0] != '\0') {
+        snprintf(reason, size, "contents of %s unknown", footprint->unknown);
+        return true;
+    }
+
+    snprintf(path, sizeof(path), "%s%s", initramfs_root, preset->config);
+    if (!parse_config(path, modules, sizeof(modules), hooks, sizeof(hooks))) {
+        snprintf(reason, size, "%s unreadable", preset->config);
+        return true;
+    }
+
+    // Drop-in files only extend the default configuration, in name order
+    if (strcmp(preset->config, MKINITCPIO_CONFIG) == 0) {
+        struct dirent **dropins = NULL;
+        snprintf(path, sizeof(path), "%s%s", initramfs_root, MKINITCPIO_CONFIG_DROPIN_DIR);
+        int count = scandir(path, &dropins, NULL, alphasort);
+        for (int i = 0; i < count; i++) {
+            size_t len = strlen(dropins[i]->d_name);
+            if (len > 5 && strcmp(dropins[i]->d_name + len - 5, ".conf") == 0) {
+                char dropin[1024];
+                snprintf(dropin, sizeof(dropin), "%s/%s", path, dropins[i]->d_name);
+                parse_config(dropin, modules, sizeof(modules), hooks, sizeof(hooks));
+            }
+            free(dropins[i]);
+        }
+        free(dropins);
+    }
+
+    if (footprint->modprobe_config && has_word(hooks, "modconf")) {
+        snprintf(reason, size, "module configuration (modconf hook)");
+        return true;
+    }
+
+    for (int i = 0; i < footprint->module_count; i++) {
+        const BatchModule *module = &footprint->modules[i];
+        if (module->kernel[0] != '\0' && preset->kernel[0] != '\0' &&
+            strcmp(module->kernel, preset->kernel) != 0) {
+            continue;
+        }
+
+        if (has_word(modules, module->name)) {
+            snprintf(reason, size, "%s in MODULES", module->name);
+            return true;
+        }
+        if (module->drm && has_word(hooks, "kms")) {
+            snprintf(reason, size, "%s (kms hook)", module->name);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Work out which presets the packages a transaction installed require rebuilding
+void initramfs_select_presets(const InitramfsSnapshot *before, InitramfsSelection *selection) {
+    unsigned long long span = trace_begin();
+    Preset presets[INITRAMFS_MAX_PRESETS];
+
+    memset(selection, 0, sizeof(InitramfsSelection));
+    selection->total = load_presets(presets, INITRAMFS_MAX_PRESETS);
+    if (selection->total < 0) {
+        selection->count = -1;
+        trace_end(span, "initramfs", "Select presets", "presets unknown");
+        return;
+    }
+
+    // What the transaction installed: entries it added to the local database
+    InitramfsSnapshot after;
+    if (before->count < 0 || !list_local_entries(&after)) {
+        selection->count = -1;
+        trace_end(span, "initramfs", "Select presets", "installed packages unknown");
+        return;
+    }
+
+    BatchFootprint footprint;
+    memset(&footprint, 0, sizeof(footprint));
+
+    int installed = 0;
+    for (int i = 0; i < after.count; i++) {
+        if (before->count == 0 || bsearch(&after.entries[i], before->entries, before->count,
+                                          sizeof(char *), compare_entries) == NULL) {
+            add_package(&footprint, after.entries[i]);
+            installed++;
+        }
+    }
+    initramfs_snapshot_free(&after);
+
+    for (int i = 0; i < selection->total; i++) {
+        InitramfsPreset *selected = &selection->presets[selection->count];
+        if (preset_needs_rebuild(&presets[i], &footprint, selected->reason, sizeof(selected->reason))) {
+            snprintf(selected->name, sizeof(selected->name), "%s", presets[i].name);
+            selection->count++;
+        }
+    }
+
+    free(footprint.modules);
+    trace_end(span, "initramfs", "Select presets", "%d of %d presets for %d packages",
+              selection->count, selection->total, installed);
+}
+
+// Rebuild the selected presets in parallel
+int initramfs_rebuild(const InitramfsSelection *selection, InitramfsResult **results) {
+    int count = selection->count;
+    *results = NULL;
+    if (count <= 0) {
+        return 0;
+    }
+
+    ProcJob *jobs = calloc(count, sizeof(ProcJob));
+    char *(*argvs)[4] = calloc(count, sizeof(*argvs));
+    InitramfsResult *rebuilt = calloc(count, sizeof(InitramfsResult));
+    if (jobs == NULL || argvs == NULL || rebuilt == NULL) {
+        free(jobs);
+        free(argvs);
+        free(rebuilt);
+        return 0;
+    }
+
+    for (int i = 0; i < count; i++) {
+        argvs[i][0] = "mkinitcpio";
+        argvs[i][1] = "-p";
+        argvs[i][2] = (char *)selection->presets[i].name;
+        argvs[i][3] = NULL;
+        jobs[i].argv = argvs[i];
+        jobs[i].flags = PROC_CAPTURE_STDOUT | PROC_MERGE_STDERR;
+    }
+
+    // Each preset writes its own images, so they can be built side by side
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    proc_run_many(jobs, count, cpus > 0 ? (int)cpus : 1);
+
+    for (int i = 0; i < count; i++) {
+        snprintf(rebuilt[i].preset, sizeof(rebuilt[i].preset), "%s", selection->presets[i].name);
+        rebuilt[i].exit_code = jobs[i].result.exit_code;
+        rebuilt[i].seconds = jobs[i].result.elapsed_us / 1e6;
+        rebuilt[i].output = jobs[i].result.out;
+        jobs[i].result.out = NULL;
+        proc_result_free(&jobs[i].result);
+    }
+
+    free(jobs);
+    free(argvs);
+    *results = rebuilt;
+    return count;
+}
+
+// Free rebuild results
+void initramfs_results_free(InitramfsResult *results, int count) {
+    for (int i = 0; results != NULL && i < count; i++) {
+        free(results[i].output);
+    }
+    free(results);
+}
@@ -0,0 +1,975 @@
+/*
+ * Install progress dialog implementation
+ *
+ * Runs the steps of an install plan one after another (spawned through
+ * proc_spawn(), watched from the main loop), streaming their output into a
+ * log view and turning pacman's messages into a progress bar with an ETA.
+ * The initramfs step rebuilds only the affected presets, in parallel on a
+ * worker thread, and logs each preset's output once it is done.
+ *
+ * Package downloads can start before the dialog: install_prefetch_start()
+ * runs pacman -Sw while the confirmation is open (in the system helper if
+ * one is used), and the dialog waits for it before building its plan, so
+ * the install step reads a warm cache.
+ *
+ * With the system helper (set_install_backend()) the whole transaction runs
+ * there instead: its framed output arrives on the socket, and the step
+ * headers install_drivers() prints move the progress bar along the plan.
+ */
+
+#include <gtk/gtk.h>
+#include <glib-unix.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../include/install_dialog.h"
+#include "../include/trace.h"
+#include "../include/proc.h"
+#include "../include/initramfs.h"
+#include "../include/backend.h"
+#include "../include/privilege.h"
+
+// Share of the progress bar given to each kind of step
+static const double step_weights[] = {
+    [INSTALL_STEP_SYNC] = 0.10,
+    [INSTALL_STEP_INSTALL] = 0.75,
+    [INSTALL_STEP_INITRAMFS] = 0.15,
+};
+
+typedef struct {
+    GtkWidget *dialog;
+    GtkWidget *step_label;
+    GtkWidget *progress_bar;
+    GtkWidget *eta_label;
+    GtkWidget *log_view;
+    GtkWidget *close_btn;
+    GtkTextBuffer *log_buffer;
+    GtkTextMark *log_end;
+    int log_lines;
+
+    // Private copies of the drivers being installed; a refresh may free the
+    // originals while the dialog is open, so their strings live in arena
+    Arena *arena;
+    DriverInfo *drivers;
+    DriverInfo **driver_ptrs;
+    int driver_count;
+
+    InstallStep *steps;
+    int step_count;
+    int current_step;
+    InitramfsSnapshot packages_before;  // Local database before the install step
+    double total_weight;
+    double done_weight;
+
+    // Current step's process: merged stdout/stderr pipe and exit status
+    GPid pid;
+    int output_fd;
+    guint output_watch;
+    GString *partial_line;
+    bool output_done;
+    bool exited;
+    int exit_status;
+    gint64 start_time;
+    unsigned long long step_span;
+
+    // Progress parsed from the current step's output
+    double step_fraction;
+    int total_packages;
+    int downloaded_packages;
+    int installed_packages;
+    int images_started;
+    int images_done;
+
+    bool running;
+    bool success;
+    bool cancelled;
+    bool remote;            // The system helper runs the steps, output_fd is its socket
+
+    // Download started at confirmation that has to finish first (NULL if none)
+    InstallPrefetch *prefetch;
+
+    InstallFinishedFunc callback;
+    gpointer user_data;
+} InstallJob;
+
+struct InstallPrefetch {
+    bool running;           // Still downloading
+    bool remote;            // The system helper downloads, replying on socket
+    GPid pid;               // Local pacman, 0 once it has exited
+    int socket;
+    GString *partial_line;  // Unfinished reply line from the helper
+    int exit_code;
+    char *packages;         // What it downloads (merge_driver_packages()), for the cleanup
+    bool cancelled;         // Discard the download once it has stopped
+    gint64 start_time;
+    unsigned long long span;
+    InstallJob *job;        // Install dialog waiting for the download
+};
+
+// Presets rebuilt by the initramfs worker thread
+typedef struct {
+    InitramfsSelection selection;
+    InitramfsResult *results;
+    int result_count;
+} InitramfsTask;
+
+// System helper installs go through (NULL: run the steps ourselves)
+static const char *install_backend = NULL;
+
+static void start_step(InstallJob *job);
+static void show_step(InstallJob *job);
+
+// Append a line to the log, dropping the oldest line past the limit
+static void append_log_line(InstallJob *job, const char *line) {
+    GtkTextIter end;
+    gtk_text_buffer_get_end_iter(job->log_buffer, &end);
+    gtk_text_buffer_insert(job->log_buffer, &end, line, -1);
+    gtk_text_buffer_insert(job->log_buffer, &end, "\n", 1);
+    job->log_lines++;
+
+    if (job->log_lines > INSTALL_LOG_MAX_LINES) {
+        GtkTextIter first, second;
+        gtk_text_buffer_get_iter_at_line(job->log_buffer, &first, 0);
+        gtk_text_buffer_get_iter_at_line(job->log_buffer, &second, 1);
+        gtk_text_buffer_delete(job->log_buffer, &first, &second);
+        job->log_lines--;
+    }
+
+    gtk_text_view_scroll_mark_onscreen(GTK_TEXT_VIEW(job->log_view), job->log_end);
+}
+
+// Turn a line of pacman/mkinitcpio output into step progress
+static void parse_progress_line(InstallJob *job, const char *line) {
+    InstallStepKind kind = job->steps[job->current_step].kind;
+    int current, total;
+
+    if (kind == INSTALL_STEP_INSTALL) {
+        if (sscanf(line, "Packages (%d)", &total) == 1 && total > 0) {
+            job->total_packages = total;
+        } else if (strstr(line, " downloading...") != NULL) {
+            job->downloaded_packages++;
+        } else if (g_str_has_prefix(line, "installing ") || g_str_has_prefix(line, "upgrading ") ||
+                   g_str_has_prefix(line, "reinstalling ")) {
+            // Anything not downloaded by now came from the package cache
+            job->downloaded_packages = job->total_packages;
+            job->installed_packages++;
+        } else if (sscanf(line, "(%d/%d)", &current, &total) == 2 && total > 0) {
+            // Progress bar format, used when pacman thinks it has a terminal
+            job->step_fraction = (double)current / total;
+            return;
+        }
+
+        if (job->total_packages > 0) {
+            double fraction = (double)(job->downloaded_packages + job->installed_packages) /
+                              (2.0 * job->total_packages);
+            job->step_fraction = MIN(fraction, 1.0);
+        }
+    } else if (kind == INSTALL_STEP_INITRAMFS) {
+        if (strstr(line, "Building image from preset") != NULL) {
+            job->images_started++;
+        } else if (strstr(line, "Image generation successful") != NULL) {
+            job->images_done++;
+        }
+        // The number of presets isn't announced, assume one more is coming
+        job->step_fraction = (double)job->images_done / (job->images_started + 1);
+    }
+}
+
+// Refresh the progress bar and ETA
+static void update_progress(InstallJob *job) {
+    double weight = job->current_step < job->step_count ?
+                    step_weights[job->steps[job->current_step].kind] : 0.0;
+    double fraction = (job->done_weight + weight * job->step_fraction) / job->total_weight;
+    fraction = CLAMP(fraction, 0.0, 1.0);
+
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(job->progress_bar), fraction);
+
+    char text[64];
+    snprintf(text, sizeof(text), "%d%%", (int)(fraction * 100));
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(job->progress_bar), text);
+
+    // Only estimate once there is enough progress to extrapolate from
+    if (fraction > 0.02 && fraction < 1.0) {
+        double elapsed = (g_get_monotonic_time() - job->start_time) / (double)G_USEC_PER_SEC;
+        int remaining = (int)(elapsed * (1.0 - fraction) / fraction);
+        snprintf(text, sizeof(text), "About %d:%02d remaining", remaining / 60, remaining % 60);
+        gtk_label_set_text(GTK_LABEL(job->eta_label), text);
+    } else {
+        gtk_label_set_text(GTK_LABEL(job->eta_label), "");
+    }
+}
+
+// All steps done, failed or cancelled: let the user read the log and close
+static void finish_job(InstallJob *job, bool success) {
+    job->running = false;
+    job->success = success;
+
+    if (success) {
+        job->done_weight = job->total_weight;
+        job->step_fraction = 0.0;
+        update_progress(job);
+        gtk_label_set_text(GTK_LABEL(job->step_label), "Installation complete.");
+    } else if (job->cancelled) {
+        gtk_label_set_text(GTK_LABEL(job->step_label), "Installation cancelled.");
+    } else {
+        gtk_label_set_text(GTK_LABEL(job->step_label), "Installation failed. See the log below.");
+    }
+
+    gtk_label_set_text(GTK_LABEL(job->eta_label), "");
+    gtk_button_set_label(GTK_BUTTON(job->close_btn), "Close");
+}
+
+// Move on after the current step ended, or stop if it had to succeed
+static void advance_step(InstallJob *job, bool ok) {
+    InstallStep *step = &job->steps[job->current_step];
+
+    // pacman may have finished the commit despite a cancel request
+    if (ok && step->kind == INSTALL_STEP_SYNC) {
+        mark_packages_synced();
+    } else if (ok && step->kind == INSTALL_STEP_INSTALL) {
+        mark_drivers_installed(job->driver_ptrs, job->driver_count);
+    }
+
+    if (job->cancelled) {
+        append_log_line(job, "Cancelled by user.");
+        finish_job(job, false);
+        return;
+    }
+
+    if (!ok && step->required) {
+        append_log_line(job, "ERROR: the step failed, stopping.");
+        finish_job(job, false);
+        return;
+    } else if (!ok) {
+        append_log_line(job, "WARNING: the step failed, continuing anyway.");
+    }
+
+    job->done_weight += step_weights[step->kind];
+    job->current_step++;
+
+    if (job->current_step < job->step_count) {
+        start_step(job);
+    } else {
+        finish_job(job, true);
+    }
+}
+
+// A step's output has ended and its process exited
+static void on_step_finished(InstallJob *job) {
+    InstallStep *step = &job->steps[job->current_step];
+    bool ok = proc_exit_code(job->exit_status) == 0;
+
+    trace_end(job->step_span, "install", step->title, "%s: %s", step->argv[0],
+              ok ? "ok" : "failed");
+    g_spawn_close_pid(job->pid);
+    job->pid = 0;
+
+    advance_step(job, ok);
+}
+
+// The helper's connection closed after (or without) the transaction's exit code
+static void on_remote_finished(InstallJob *job) {
+    bool ok = job->exited && job->exit_status == 0;
+
+    if (!job->exited) {
+        append_log_line(job, "Lost the connection to the system helper.");
+    }
+    trace_end(job->step_span, "install", "System helper", "%s", ok ? "ok" : "failed");
+
+    // Whatever the helper installed is in the local database now
+    if (ok) {
+        mark_drivers_installed(job->driver_ptrs, job->driver_count);
+    }
+
+    if (job->cancelled) {
+        append_log_line(job, "Cancelled by user.");
+    }
+    finish_job(job, ok && !job->cancelled);
+}
+
+// The step's process exited (its output may still be pending)
+static void on_child_exited(GPid pid, gint status, gpointer user_data) {
+    (void)pid;  // Unused
+
+    InstallJob *job = (InstallJob *)user_data;
+    job->exited = true;
+    job->exit_status = status;
+
+    if (job->output_done) {
+        on_step_finished(job);
+    }
+}
+
+// Follow the helper to the step whose "=== title ===" header it printed
+static void follow_step_header(InstallJob *job, const char *text) {
+    for (int i = job->current_step + 1; i < job->step_count; i++) {
+        char *header = g_strdup_printf("=== %s ===", job->steps[i].title);
+        bool match = strcmp(text, header) == 0;
+        g_free(header);
+
+        if (match) {
+            for (; job->current_step < i; job->current_step++) {
+                job->done_weight += step_weights[job->steps[job->current_step].kind];
+            }
+            show_step(job);
+            return;
+        }
+    }
+}
+
+// Unwrap a line from the helper; returns the output text to show, or NULL
+static const char *handle_remote_line(InstallJob *job, const char *line) {
+    const char *text;
+    int exit_code;
+
+    switch (backend_parse_install_line(line, &text, &exit_code)) {
+    case BACKEND_LINE_OUTPUT:
+        follow_step_header(job, text);
+        return text;
+    case BACKEND_LINE_EXIT:
+        job->exited = true;
+        job->exit_status = exit_code;
+        return NULL;
+    case BACKEND_LINE_ERROR: {
+        job->exited = true;
+        job->exit_status = -1;
+        char *message = g_strdup_printf("ERROR: %s", text);
+        append_log_line(job, message);
+        g_free(message);
+        return NULL;
+    }
+    case BACKEND_LINE_INVALID:
+        break;
+    }
+    return NULL;
+}
+
+// Show one complete line of output
+static void handle_output_line(InstallJob *job, const char *line) {
+    if (job->remote && (line = handle_remote_line(job, line)) == NULL) {
+        return;
+    }
+
+    char *valid = g_utf8_make_valid(line, -1);
+    g_strchomp(valid);
+    append_log_line(job, valid);
+    parse_progress_line(job, valid);
+    g_free(valid);
+}
+
+// Output is available on the step's pipe (main loop)
+static gboolean on_output_ready(gint fd, GIOCondition condition, gpointer user_data) {
+    (void)condition;  // Unused, read() tells us everything
+
+    InstallJob *job = (InstallJob *)user_data;
+    char buffer[4096];
+    ssize_t n;
+
+    while ((n = read(fd, buffer, sizeof(buffer))) > 0) {
+        g_string_append_len(job->partial_line, buffer, n);
+    }
+
+    // Hand over every complete line
+    char *start = job->partial_line->str;
+    char *newline;
+    while ((newline = strchr(start, '\n')) != NULL) {
+        *newline = '\0';
+        handle_output_line(job, start);
+        start = newline + 1;
+    }
+    g_string_erase(job->partial_line, 0, start - job->partial_line->str);
+    update_progress(job);
+
+    if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+        return G_SOURCE_CONTINUE;
+    }
+
+    // End of output
+    if (job->partial_line->len > 0) {
+        handle_output_line(job, job->partial_line->str);
+        g_string_truncate(job->partial_line, 0);
+    }
+    close(job->output_fd);
+    job->output_fd = -1;
+    job->output_watch = 0;
+    job->output_done = true;
+
+    if (job->remote) {
+        on_remote_finished(job);
+    } else if (job->exited) {
+        on_step_finished(job);
+    }
+    return G_SOURCE_REMOVE;
+}
+
+// Worker thread: run mkinitcpio for the selected presets
+static void initramfs_thread_func(GTask *task, gpointer source_object,
+                                  gpointer task_data, GCancellable *cancellable) {
+    (void)source_object;  // Unused
+    (void)cancellable;    // Unused, a half-written image is worse than waiting
+
+    InitramfsTask *rebuild = (InitramfsTask *)task_data;
+    rebuild->result_count = initramfs_rebuild(&rebuild->selection, &rebuild->results);
+    g_task_return_boolean(task, TRUE);
+}
+
+// Presets rebuilt (main loop): log their output and move on
+static void on_initramfs_finished(GObject *source_object, GAsyncResult *res, gpointer user_data) {
+    (void)source_object;  // Unused
+
+    InstallJob *job = (InstallJob *)user_data;
+    InstallStep *step = &job->steps[job->current_step];
+    InitramfsTask *rebuild = g_task_get_task_data(G_TASK(res));
+    bool ok = rebuild->result_count == rebuild->selection.count;
+
+    for (int i = 0; i < rebuild->result_count; i++) {
+        InitramfsResult *result = &rebuild->results[i];
+        char **lines = g_strsplit(result->output != NULL ? result->output : "", "\n", -1);
+        for (int l = 0; lines[l] != NULL; l++) {
+            if (lines[l][0] != '\0') {
+                handle_output_line(job, lines[l]);
+            }
+        }
+        g_strfreev(lines);
+
+        char *summary = g_strdup_printf("%s: %.1f s, exit code %d", result->preset,
+                                        result->seconds, result->exit_code);
+        append_log_line(job, summary);
+        g_free(summary);
+        ok = ok && result->exit_code == 0;
+    }
+
+    trace_end(job->step_span, "install", step->title, "%d presets: %s",
+              rebuild->selection.count, ok ? "ok" : "failed");
+    advance_step(job, ok);
+}
+
+// Free the initramfs worker's data
+static void initramfs_task_free(gpointer data) {
+    InitramfsTask *rebuild = (InitramfsTask *)data;
+    initramfs_results_free(rebuild->results, rebuild->result_count);
+    g_free(rebuild);
+}
+
+// Start rebuilding only the presets the installed packages affect.
+// Returns false when they can't be worked out and mkinitcpio -P should run.
+static bool start_initramfs_step(InstallJob *job) {
+    InstallStep *step = &job->steps[job->current_step];
+    InitramfsTask *rebuild = g_new0(InitramfsTask, 1);
+
+    job->step_span = trace_begin();
+    initramfs_select_presets(&job->packages_before, &rebuild->selection);
+
+    if (rebuild->selection.count < 0) {
+        g_free(rebuild);
+        return false;
+    }
+
+    if (rebuild->selection.count == 0) {
+        char *message = g_strdup_printf("No initramfs preset includes the installed modules "
+                                        "(%d checked), skipping.", rebuild->selection.total);
+        append_log_line(job, message);
+        g_free(message);
+        g_free(rebuild);
+
+        trace_end(job->step_span, "install", step->title, "no presets");
+        advance_step(job, true);
+        return true;
+    }
+
+    for (int i = 0; i < rebuild->selection.count; i++) {
+        char *header = g_strdup_printf("$ mkinitcpio -p %s    # %s", rebuild->selection.presets[i].name,
+                                       rebuild->selection.presets[i].reason);
+        append_log_line(job, header);
+        g_free(header);
+    }
+
+    // No pid to signal while this runs, so a cancel request waits for it
+    GTask *task = g_task_new(NULL, NULL, on_initramfs_finished, job);
+    g_task_set_task_data(task, rebuild, initramfs_task_free);
+    g_task_run_in_thread(task, initramfs_thread_func);
+    g_object_unref(task);
+    update_progress(job);
+    return true;
+}
+
+// Show the current step and reset its progress
+static void show_step(InstallJob *job) {
+    InstallStep *step = &job->steps[job->current_step];
+
+    job->step_fraction = 0.0;
+    job->total_packages = 0;
+    job->downloaded_packages = 0;
+    job->installed_packages = 0;
+    job->images_started = 0;
+    job->images_done = 0;
+
+    char title[128];
+    snprintf(title, sizeof(title), "%s (step %d of %d)...", step->title,
+             job->current_step + 1, job->step_count);
+    gtk_label_set_text(GTK_LABEL(job->step_label), title);
+}
+
+// Spawn the current step and start streaming its output
+static void start_step(InstallJob *job) {
+    InstallStep *step = &job->steps[job->current_step];
+
+    show_step(job);
+
+    if (step->kind == INSTALL_STEP_INITRAMFS && start_initramfs_step(job)) {
+        return;
+    }
+
+    if (step->kind == INSTALL_STEP_INSTALL) {
+        initramfs_snapshot_take(&job->packages_before);
+    }
+
+    char *command = g_strjoinv(" ", step->argv);
+    char *header = g_strdup_printf("$ %s", command);
+    append_log_line(job, header);
+    g_free(header);
+    g_free(command);
+
+    ProcHandle handle;
+    job->step_span = trace_begin();
+    if (!proc_spawn(step->argv, PROC_CAPTURE_STDOUT | PROC_MERGE_STDERR, &handle)) {
+        char *message = g_strdup_printf("Failed to start %s: %s", step->argv[0], g_strerror(errno));
+        append_log_line(job, message);
+        g_free(message);
+
+        trace_end(job->step_span, "install", step->title, "%s: not started", step->argv[0]);
+        advance_step(job, false);
+        return;
+    }
+
+    job->pid = handle.pid;
+    job->output_fd = handle.out_fd;
+    job->output_done = false;
+    job->exited = false;
+    g_unix_set_fd_nonblocking(job->output_fd, TRUE, NULL);
+    job->output_watch = g_unix_fd_add(job->output_fd, G_IO_IN | G_IO_HUP | G_IO_ERR,
+                                      on_output_ready, job);
+    g_child_watch_add(job->pid, on_child_exited, job);
+    update_progress(job);
+}
+
+// Hand the whole transaction to the system helper and stream its output
+static void start_remote_install(InstallJob *job) {
+    job->remote = true;
+    show_step(job);
+    append_log_line(job, "Installing through the system helper...");
+
+    job->step_span = trace_begin();
+    int fd = backend_install_start(install_backend, job->driver_ptrs, job->driver_count);
+    if (fd < 0) {
+        char *message = g_strdup_printf("Could not reach the system helper at %s: %s",
+                                        install_backend, g_strerror(errno));
+        append_log_line(job, message);
+        g_free(message);
+        trace_end(job->step_span, "install", "System helper", "not reached");
+        finish_job(job, false);
+        return;
+    }
+
+    job->output_fd = fd;
+    job->output_done = false;
+    job->exited = false;
+    g_unix_set_fd_nonblocking(job->output_fd, TRUE, NULL);
+    job->output_watch = g_unix_fd_add(job->output_fd, G_IO_IN | G_IO_HUP | G_IO_ERR,
+                                      on_output_ready, job);
+    update_progress(job);
+}
+
+// Plan the install steps and start the first (after any prefetch)
+static void begin_install(InstallJob *job) {
+    if (job->cancelled) {
+        append_log_line(job, "Cancelled by user.");
+        finish_job(job, false);
+        return;
+    }
+
+    const DriverInfo *unavailable = find_unavailable_driver(job->driver_ptrs, job->driver_count);
+    if (unavailable != NULL) {
+        char *message = g_strdup_printf("ERROR: %s (%s) is not in the configured repositories.",
+                                        unavailable->name, unavailable->package);
+        append_log_line(job, message);
+        g_free(message);
+        finish_job(job, false);
+        return;
+    }
+
+    // Planned only now, so the sync decision counts from the user's confirmation
+    job->step_count = build_install_plan(job->driver_ptrs, job->driver_count, &job->steps);
+    for (int i = 0; i < job->step_count; i++) {
+        job->total_weight += step_weights[job->steps[i].kind];
+    }
+
+    if (job->step_count == 0) {
+        append_log_line(job, "ERROR: could not prepare the install commands.");
+        finish_job(job, false);
+        return;
+    }
+
+    // The plan has no sync step while the databases are fresh
+    if (job->steps[0].kind != INSTALL_STEP_SYNC) {
+        char *message = g_strdup_printf("Package databases synced %ld min ago (TTL %d min), skipping sync.",
+                                        package_sync_age() / 60, get_sync_ttl() / 60);
+        append_log_line(job, message);
+        g_free(message);
+    }
+
+    // The plan still names the helper's steps for the progress bar
+    if (install_backend != NULL) {
+        start_remote_install(job);
+    } else {
+        start_step(job);
+    }
+}
+
+// Tell how the prefetch went; a failed one only means the install downloads more
+static void log_prefetch_result(InstallJob *job, const InstallPrefetch *prefetch) {
+    double seconds = (g_get_monotonic_time() - prefetch->start_time) / (double)G_USEC_PER_SEC;
+    char *message;
+
+    if (prefetch->exit_code == 0) {
+        message = g_strdup_printf("Packages downloaded in the background (%.1f s).", seconds);
+    } else {
+        message = g_strdup_printf("Background download failed (exit code %d), "
+                                  "the install step will download instead.", prefetch->exit_code);
+    }
+    append_log_line(job, message);
+    g_free(message);
+}
+
+// Free a prefetch that has stopped
+static void prefetch_free(InstallPrefetch *prefetch) {
+    if (prefetch->partial_line != NULL) {
+        g_string_free(prefetch->partial_line, TRUE);
+    }
+    free(prefetch->packages);
+    g_free(prefetch);
+}
+
+// Stop a running download (pacman removes its lock on SIGINT)
+static void prefetch_interrupt(InstallPrefetch *prefetch) {
+    if (prefetch->remote) {
+        backend_install_cancel(prefetch->socket);
+    } else {
+        kill(prefetch->pid, SIGINT);
+    }
+}
+
+// The download stopped: hand over to the waiting install, or discard it
+static void on_prefetch_finished(InstallPrefetch *prefetch) {
+    prefetch->running = false;
+    trace_end(prefetch->span, "install", "Prefetch packages", "%s: exit %d",
+              prefetch->remote ? "helper" : "pacman", prefetch->exit_code);
+
+    // The helper deletes the partial files of its own downloads
+    InstallJob *job = prefetch->job;
+    if (!prefetch->remote && (prefetch->cancelled || (job != NULL && job->cancelled))) {
+        remove_partial_downloads(prefetch->packages);
+    }
+
+    if (prefetch->cancelled) {
+        prefetch_free(prefetch);
+    } else if (job != NULL) {
+        job->prefetch = NULL;
+        log_prefetch_result(job, prefetch);
+        prefetch_free(prefetch);
+        begin_install(job);
+    }
+    // Otherwise the confirmation is still open and its answer decides
+}
+
+// The prefetch's pacman exited
+static void on_prefetch_exited(GPid pid, gint status, gpointer user_data) {
+    InstallPrefetch *prefetch = (InstallPrefetch *)user_data;
+
+    prefetch->exit_code = proc_exit_code(status);
+    g_spawn_close_pid(pid);
+    prefetch->pid = 0;
+    on_prefetch_finished(prefetch);
+}
+
+// Reply lines of a download in the helper: its pacman output goes to our
+// terminal like a local one's, and the helper closes the socket after X or E
+static gboolean on_prefetch_reply(gint fd, GIOCondition condition, gpointer user_data) {
+    (void)condition;  // Unused, read() tells us everything
+
+    InstallPrefetch *prefetch = (InstallPrefetch *)user_data;
+    char buffer[4096];
+    ssize_t n;
+
+    while ((n = read(fd, buffer, sizeof(buffer))) > 0) {
+        g_string_append_len(prefetch->partial_line, buffer, n);
+    }
+
+    char *start = prefetch->partial_line->str;
+    char *newline;
+    while ((newline = strchr(start, '\n')) != NULL) {
+        const char *text;
+        int exit_code;
+
+        *newline = '\0';
+        switch (backend_parse_install_line(start, &text, &exit_code)) {
+        case BACKEND_LINE_OUTPUT:
+            printf("%s\n", text);
+            break;
+        case BACKEND_LINE_EXIT:
+            prefetch->exit_code = exit_code;
+            break;
+        case BACKEND_LINE_ERROR:
+            fprintf(stderr, "Package download through the system helper: %s\n", text);
+            break;
+        case BACKEND_LINE_INVALID:
+            break;
+        }
+        start = newline + 1;
+    }
+    g_string_erase(prefetch->partial_line, 0, start - prefetch->partial_line->str);
+
+    if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+        return G_SOURCE_CONTINUE;
+    }
+
+    close(fd);
+    prefetch->socket = -1;
+    on_prefetch_finished(prefetch);
+    return G_SOURCE_REMOVE;
+}
+
+// Ask the system helper to download; NULL if it can't be reached
+static InstallPrefetch *prefetch_start_remote(DriverInfo **drivers, int count) {
+    unsigned long long span = trace_begin();
+    int fd = backend_prefetch_start(install_backend, drivers, count);
+    if (fd < 0) {
+        trace_end(span, "install", "Prefetch packages", "helper not reached");
+        return NULL;
+    }
+
+    InstallPrefetch *prefetch = g_new0(InstallPrefetch, 1);
+    prefetch->running = true;
+    prefetch->remote = true;
+    prefetch->socket = fd;
+    prefetch->partial_line = g_string_new(NULL);
+    prefetch->exit_code = -1;  // Until the helper's X line
+    prefetch->start_time = g_get_monotonic_time();
+    prefetch->span = span;
+    g_unix_set_fd_nonblocking(fd, TRUE, NULL);
+    g_unix_fd_add(fd, G_IO_IN | G_IO_HUP | G_IO_ERR, on_prefetch_reply, prefetch);
+    return prefetch;
+}
+
+// Start downloading a batch's packages while the user decides
+InstallPrefetch *install_prefetch_start(DriverInfo **drivers, int count) {
+    if (install_backend != NULL) {
+        return prefetch_start_remote(drivers, count);
+    }
+
+    // pacman -Sw needs root
+    if (!is_root()) {
+        return NULL;
+    }
+
+    char **argv = build_prefetch_argv(drivers, count);
+    char *packages = merge_driver_packages(drivers, count);
+    if (argv == NULL || packages == NULL) {
+        free_argv(argv);
+        free(packages);
+        return NULL;
+    }
+
+    // Its output goes to our terminal; the install log reports the outcome
+    ProcHandle handle;
+    InstallPrefetch *prefetch = NULL;
+    unsigned long long span = trace_begin();
+    if (proc_spawn(argv, PROC_INHERIT, &handle)) {
+        prefetch = g_new0(InstallPrefetch, 1);
+        prefetch->running = true;
+        prefetch->pid = handle.pid;
+        prefetch->socket = -1;
+        prefetch->packages = packages;
+        prefetch->start_time = g_get_monotonic_time();
+        prefetch->span = span;
+        g_child_watch_add(prefetch->pid, on_prefetch_exited, prefetch);
+    } else {
+        free(packages);
+    }
+
+    free_argv(argv);
+    return prefetch;
+}
+
+// Discard a prefetch the user declined
+void install_prefetch_cancel(InstallPrefetch *prefetch) {
+    if (prefetch == NULL) {
+        return;
+    }
+
+    if (prefetch->running) {
+        // The partial files go once the download has stopped
+        prefetch->cancelled = true;
+        prefetch_interrupt(prefetch);
+        return;
+    }
+
+    // Finished downloads stay in the cache like any other; only leftovers go
+    // (the helper has already deleted those of its downloads)
+    if (!prefetch->remote && prefetch->exit_code != 0) {
+        remove_partial_downloads(prefetch->packages);
+    }
+    prefetch_free(prefetch);
+}
+
+// Install through the system helper
+void set_install_backend(const char *socket_path) {
+    install_backend = socket_path;
+}
+
+// Free a finished job
+static void install_job_free(InstallJob *job) {
+    free_install_plan(job->steps, job->step_count);
+    initramfs_snapshot_free(&job->packages_before);
+    g_string_free(job->partial_line, TRUE);
+    g_free(job->driver_ptrs);
+    g_free(job->drivers);
+    arena_destroy(job->arena);
+    g_free(job);
+}
+
+// Cancel/Close button, and window close (see on_dialog_delete)
+static void on_dialog_response(GtkDialog *dialog, gint response_id, gpointer user_data) {
+    (void)dialog;       // Unused
+    (void)response_id;  // Cancel and window close are handled the same way
+
+    InstallJob *job = (InstallJob *)user_data;
+
+    if (job->running) {
+        if (!job->cancelled && job->remote && job->output_fd >= 0) {
+            // The helper interrupts its pacman the same way
+            job->cancelled = true;
+            gtk_label_set_text(GTK_LABEL(job->step_label), "Cancelling...");
+            backend_install_cancel(job->output_fd);
+        } else if (!job->cancelled && job->pid > 0 && !job->exited) {
+            // pacman handles SIGINT by releasing its lock; it won't abort mid-commit
+            job->cancelled = true;
+            gtk_label_set_text(GTK_LABEL(job->step_label), "Cancelling...");
+            kill(job->pid, SIGINT);
+        } else if (!job->cancelled && job->prefetch != NULL) {
+            // Still downloading: stop it, its partial files go once it exited
+            job->cancelled = true;
+            gtk_label_set_text(GTK_LABEL(job->step_label), "Cancelling...");
+            prefetch_interrupt(job->prefetch);
+        }
+        return;
+    }
+
+    gtk_widget_destroy(job->dialog);
+
+    if (job->callback != NULL) {
+        job->callback(job->success, job->cancelled, job->user_data);
+    }
+    install_job_free(job);
+}
+
+// Window close: a cancel request like the Cancel button. Returning TRUE
+// keeps GtkDialog from destroying the window while the install still writes
+// to it; on_dialog_response() destroys it once the job has finished.
+static gboolean on_dialog_delete(GtkWidget *widget, GdkEvent *event, gpointer user_data) {
+    (void)event;  // Unused
+
+    on_dialog_response(GTK_DIALOG(widget), GTK_RESPONSE_DELETE_EVENT, user_data);
+    return TRUE;
+}
+
+// Install drivers in a modal, non-blocking progress dialog
+void run_install_dialog(GtkWidget *parent, DriverInfo **drivers, int count,
+                        InstallPrefetch *prefetch,
+                        InstallFinishedFunc callback, gpointer user_data) {
+    InstallJob *job = g_new0(InstallJob, 1);
+    job->output_fd = -1;
+    job->packages_before.count = -1;
+    job->partial_line = g_string_new(NULL);
+    job->callback = callback;
+    job->user_data = user_data;
+
+    // Out of memory aborts, as it does for the g_new() calls around it
+    job->arena = arena_create();
+    if (job->arena == NULL) {
+        g_error("Out of memory");
+    }
+
+    job->driver_count = count;
+    job->drivers = g_new(DriverInfo, count);
+    job->driver_ptrs = g_new(DriverInfo *, count);
+    for (int i = 0; i < count; i++) {
+        copy_driver_info(job->arena, &job->drivers[i], drivers[i]);
+        job->driver_ptrs[i] = &job->drivers[i];
+    }
+
+    // Build the dialog
+    job->dialog = gtk_dialog_new();
+    gtk_window_set_title(GTK_WINDOW(job->dialog), "Installing Drivers");
+    gtk_window_set_transient_for(GTK_WINDOW(job->dialog), GTK_WINDOW(parent));
+    gtk_window_set_modal(GTK_WINDOW(job->dialog), TRUE);
+    gtk_window_set_default_size(GTK_WINDOW(job->dialog), 700, 450);
+
+    GtkWidget *content = gtk_dialog_get_content_area(GTK_DIALOG(job->dialog));
+    gtk_box_set_spacing(GTK_BOX(content), 5);
+    gtk_container_set_border_width(GTK_CONTAINER(content), 10);
+
+    job->step_label = gtk_label_new("Preparing...");
+    gtk_label_set_xalign(GTK_LABEL(job->step_label), 0.0);
+    gtk_box_pack_start(GTK_BOX(content), job->step_label, FALSE, FALSE, 0);
+
+    job->progress_bar = gtk_progress_bar_new();
+    gtk_progress_bar_set_show_text(GTK_PROGRESS_BAR(job->progress_bar), TRUE);
+    gtk_box_pack_start(GTK_BOX(content), job->progress_bar, FALSE, FALSE, 0);
+
+    job->eta_label = gtk_label_new("");
+    gtk_label_set_xalign(GTK_LABEL(job->eta_label), 1.0);
+    gtk_box_pack_start(GTK_BOX(content), job->eta_label, FALSE, FALSE, 0);
+
+    GtkWidget *scrolled = gtk_scrolled_window_new(NULL, NULL);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(scrolled),
+                                   GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    gtk_box_pack_start(GTK_BOX(content), scrolled, TRUE, TRUE, 0);
+
+    job->log_view = gtk_text_view_new();
+    gtk_text_view_set_editable(GTK_TEXT_VIEW(job->log_view), FALSE);
+    gtk_text_view_set_cursor_visible(GTK_TEXT_VIEW(job->log_view), FALSE);
+    gtk_text_view_set_monospace(GTK_TEXT_VIEW(job->log_view), TRUE);
+    gtk_container_add(GTK_CONTAINER(scrolled), job->log_view);
+
+    job->log_buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(job->log_view));
+    GtkTextIter end;
+    gtk_text_buffer_get_end_iter(job->log_buffer, &end);
+    job->log_end = gtk_text_buffer_create_mark(job->log_buffer, NULL, &end, FALSE);
+
+    job->close_btn = gtk_dialog_add_button(GTK_DIALOG(job->dialog), "Cancel", GTK_RESPONSE_CANCEL);
+    g_signal_connect(job->dialog, "response", G_CALLBACK(on_dialog_response), job);
+    g_signal_connect(job->dialog, "delete-event", G_CALLBACK(on_dialog_delete), job);
+
+    gtk_widget_show_all(job->dialog);
+
+    job->start_time = g_get_monotonic_time();
+    job->running = true;
+
+    if (prefetch != NULL && prefetch->running) {
+        job->prefetch = prefetch;
+        prefetch->job = job;
+        gtk_label_set_text(GTK_LABEL(job->step_label), "Finishing package download...");
+        append_log_line(job, "Waiting for the package download started at confirmation...");
+        return;
+    }
+
+    if (prefetch != NULL) {
+        log_prefetch_result(job, prefetch);
+        prefetch_free(prefetch);
+    }
+    begin_install(job);
+}
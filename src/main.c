@@ -5,15 +5,118 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <gtk/gtk.h>
 #include "../include/gui.h"
 #include "../include/privilege.h"
+#include "../include/trace.h"
+#include "../include/driver.h"
+#include "../include/backend.h"
+
+// Name of the headless command line executable, installed next to this one
+#define CLI_EXECUTABLE "system-drivers-cli"
+
+// Check whether the arguments ask for the command line interface
+static bool wants_cli(int argc, char *argv[]) {
+    static const char *cli_options[] = { "--list", "--json", "--install", "--recommended", "--help",
+                                         "--export-profile", "--apply-profile" };
+
+    for (int i = 1; i < argc; i++) {
+        for (size_t j = 0; j < sizeof(cli_options) / sizeof(cli_options[0]); j++) {
+            if (strcmp(argv[i], cli_options[j]) == 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Hand the arguments to the CLI executable (no GTK, no privilege escalation)
+static int exec_cli(int argc, char *argv[]) {
+    char *cli_args[argc + 1];
+    char path[PATH_MAX];
+
+    cli_args[0] = CLI_EXECUTABLE;
+    for (int i = 1; i < argc; i++) {
+        cli_args[i] = argv[i];
+    }
+    cli_args[argc] = NULL;
+
+    // Prefer the copy next to this executable, then $PATH
+    ssize_t len = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (len > 0) {
+        path[len] = '\0';
+        char *slash = strrchr(path, '/');
+        if (slash != NULL && (size_t)(slash - path) + sizeof("/" CLI_EXECUTABLE) <= sizeof(path)) {
+            strcpy(slash + 1, CLI_EXECUTABLE);
+            execv(path, cli_args);
+        }
+    }
+    execvp(CLI_EXECUTABLE, cli_args);
+
+    fprintf(stderr, "Error: could not run %s\n", CLI_EXECUTABLE);
+    return 1;
+}
+
+// Get the file given with --trace <file> (NULL if absent)
+static const char *trace_option(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--trace") == 0) {
+            return argv[i + 1];
+        }
+    }
+    return NULL;
+}
+
+// Get the helper socket given with --socket <path> (the default if absent)
+static const char *socket_option(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--socket") == 0) {
+            return argv[i + 1];
+        }
+    }
+    return BACKEND_SOCKET_DEFAULT;
+}
+
+// Apply --sync-ttl <seconds>; false if its value is not a number of seconds
+static bool apply_sync_ttl_option(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--sync-ttl") != 0) {
+            continue;
+        }
+
+        char *end = NULL;
+        long ttl = i + 1 < argc ? strtol(argv[i + 1], &end, 10) : -1;
+        if (end == NULL || end == argv[i + 1] || *end != '\0' || ttl < 0 || ttl > INT_MAX) {
+            fprintf(stderr, "--sync-ttl needs a number of seconds\n");
+            return false;
+        }
+        set_sync_ttl((int)ttl);
+    }
+    return true;
+}
 
 int main(int argc, char *argv[]) {
+    // Headless queries and installs never touch GTK
+    if (wants_cli(argc, argv)) {
+        return exec_cli(argc, argv);
+    }
+
+    // With the system helper running the GUI needs no privileges at all:
+    // scans come warm from the helper and installs are authorized one by one
+    const char *socket_path = socket_option(argc, argv);
+    bool use_backend = backend_available(socket_path);
+    if (use_backend) {
+        // Started through sudo or pkexec out of habit: become the user again
+        drop_privileges();
+        use_backend = !is_root();
+    }
+
     // Check if running with root privileges
-    if (geteuid() != 0) {
+    if (!use_backend && !is_root()) {
         printf("System Drivers requires root privileges.\n");
         printf("Attempting to escalate privileges...\n");
 
@@ -51,7 +154,20 @@ int main(int argc, char *argv[]) {
         return 1;
     }
 
-    printf("System Drivers starting with root privileges...\n");
+    if (use_backend) {
+        printf("System Drivers starting unprivileged, using the system helper at %s\n", socket_path);
+        gui_set_backend(socket_path);
+    } else {
+        printf("System Drivers starting with root privileges...\n");
+    }
+
+    // Chrome trace of every phase; the option survives pkexec, the variable does not
+    trace_init(trace_option(argc, argv));
+
+    // How long a package database sync is reused by the installs of this session
+    if (!apply_sync_ttl_option(argc, argv)) {
+        return 1;
+    }
 
     // Initialize GTK
     gtk_init(&argc, &argv);
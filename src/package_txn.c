@@ -0,0 +1,895 @@
+/*
+ * In-process package transactions (libalpm) implementation
+ *
+ * With HAVE_ALPM (make WITH_ALPM=1) the sync and install steps run through
+ * libalpm in this process: the databases are loaded once per transaction
+ * instead of once per pacman run, and failures come back as libalpm error
+ * codes with the packages, conflicts and files involved. Without it every
+ * entry point reports PACKAGE_TXN_ERR_UNSUPPORTED and installs run pacman.
+ *
+ * pacman.conf is read for what libalpm itself doesn't parse: the repositories
+ * in order, their servers (with Include and $repo/$arch), SigLevel,
+ * Architecture, ParallelDownloads, GPGDir, HookDir, IgnorePkg, IgnoreGroup,
+ * NoUpgrade and NoExtract.
+ *
+ * A SIGINT while the handle is open (the helper's CANCEL, Ctrl-C) is held
+ * back the way pacman does it: before the commit the transaction is
+ * released, during it alpm_trans_interrupt() stops it between packages, and
+ * the signal is raised again once the database lock is gone.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/utsname.h>
+#ifdef HAVE_ALPM
+#include <alpm.h>
+#endif
+#include "../include/package_txn.h"
+#include "../include/trace.h"
+
+// Short name of an error
+const char *package_txn_error_name(PackageTxnError error) {
+    switch (error) {
+    case PACKAGE_TXN_OK:              return "ok";
+    case PACKAGE_TXN_ERR_UNSUPPORTED: return "unsupported";
+    case PACKAGE_TXN_ERR_SETUP:       return "setup";
+    case PACKAGE_TXN_ERR_LOCKED:      return "locked";
+    case PACKAGE_TXN_ERR_SYNC:        return "sync";
+    case PACKAGE_TXN_ERR_NOT_FOUND:   return "not-found";
+    case PACKAGE_TXN_ERR_DEPENDENCY:  return "dependency";
+    case PACKAGE_TXN_ERR_CONFLICT:    return "conflict";
+    case PACKAGE_TXN_ERR_SIGNATURE:   return "signature";
+    case PACKAGE_TXN_ERR_DOWNLOAD:    return "download";
+    case PACKAGE_TXN_ERR_DISK_SPACE:  return "disk-space";
+    case PACKAGE_TXN_ERR_INTERRUPTED: return "interrupted";
+    case PACKAGE_TXN_ERR_COMMIT:      return "commit";
+    }
+    return "unknown";
+}
+
+// Free a result's details and reset it
+void package_txn_result_clear(PackageTxnResult *result) {
+    free(result->details);
+    memset(result, 0, sizeof(PackageTxnResult));
+}
+
+#ifdef HAVE_ALPM
+
+// Deepest Include chain followed in pacman.conf
+#define CONF_INCLUDE_DEPTH 10
+
+struct PackageTxn {
+    alpm_handle_t *handle;
+    PackageTxnProgress progress;
+    void *user_data;
+    char root[256];
+    struct sigaction saved_sigint;  // Restored by package_txn_close()
+};
+
+// Set by SIGINT while a handle is open
+static volatile sig_atomic_t interrupted = 0;
+
+// The handle whose transaction is being committed, NULL outside a commit
+static alpm_handle_t *volatile committing = NULL;
+
+// A repository section of pacman.conf while it is read
+typedef struct {
+    char name[64];
+    int siglevel;
+    bool has_siglevel;
+    alpm_list_t *servers;       // Owned strings
+} ConfRepo;
+
+// State of reading pacman.conf
+typedef struct {
+    PackageTxn *txn;
+    bool in_options;
+    bool in_repo;
+    ConfRepo repo;
+    int default_siglevel;
+    alpm_list_t *architectures; // Owned strings
+    bool has_hookdir;           // HookDir given: no default hook directory
+    PackageTxnResult *result;
+} ConfState;
+
+// Whether transactions run in-process
+bool package_txn_supported(void) {
+    return true;
+}
+
+// SIGINT: remember it, and stop a running commit at the next safe point
+static void on_interrupt(int sig) {
+    (void)sig;  // Unused
+
+    interrupted = 1;
+    if (committing != NULL) {
+        alpm_trans_interrupt(committing);
+    }
+}
+
+// Free a list of owned strings
+static void free_string_list(alpm_list_t **list) {
+    alpm_list_free_inner(*list, free);
+    alpm_list_free(*list);
+    *list = NULL;
+}
+
+// Record a failure
+static void set_error(PackageTxnResult *result, PackageTxnError error, const char *fmt, ...) {
+    va_list args;
+    result->error = error;
+    va_start(args, fmt);
+    vsnprintf(result->message, sizeof(result->message), fmt, args);
+    va_end(args);
+}
+
+// Check for a SIGINT, failing the step if there was one
+static bool check_interrupted(PackageTxnResult *result) {
+    if (!interrupted) {
+        return false;
+    }
+    set_error(result, PACKAGE_TXN_ERR_INTERRUPTED, "interrupted");
+    return true;
+}
+
+// Append one line to a result's details
+static void add_detail(PackageTxnResult *result, const char *fmt, ...) {
+    char line[512];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+
+    size_t used = result->details != NULL ? strlen(result->details) : 0;
+    char *grown = realloc(result->details, used + strlen(line) + 2);
+    if (grown == NULL) {
+        return;
+    }
+    snprintf(grown + used, strlen(line) + 2, "%s\n", line);
+    result->details = grown;
+}
+
+// Map a libalpm error to what the caller can act on
+static PackageTxnError classify(alpm_errno_t err, PackageTxnError fallback) {
+    switch (err) {
+    case ALPM_ERR_HANDLE_LOCK:
+        return PACKAGE_TXN_ERR_LOCKED;
+    case ALPM_ERR_PKG_NOT_FOUND:
+    case ALPM_ERR_DB_NOT_FOUND:
+        return PACKAGE_TXN_ERR_NOT_FOUND;
+    case ALPM_ERR_UNSATISFIED_DEPS:
+        return PACKAGE_TXN_ERR_DEPENDENCY;
+    case ALPM_ERR_CONFLICTING_DEPS:
+    case ALPM_ERR_FILE_CONFLICTS:
+        return PACKAGE_TXN_ERR_CONFLICT;
+    case ALPM_ERR_SIG_MISSING:
+    case ALPM_ERR_SIG_INVALID:
+    case ALPM_ERR_DB_INVALID_SIG:
+    case ALPM_ERR_PKG_INVALID_SIG:
+    case ALPM_ERR_PKG_INVALID_CHECKSUM:
+    case ALPM_ERR_PKG_INVALID:
+    case ALPM_ERR_GPGME:
+        return PACKAGE_TXN_ERR_SIGNATURE;
+    case ALPM_ERR_RETRIEVE:
+    case ALPM_ERR_SERVER_NONE:
+    case ALPM_ERR_SERVER_BAD_URL:
+    case ALPM_ERR_EXTERNAL_DOWNLOAD:
+        return PACKAGE_TXN_ERR_DOWNLOAD;
+    case ALPM_ERR_DISK_SPACE:
+        return PACKAGE_TXN_ERR_DISK_SPACE;
+    default:
+        return fallback;
+    }
+}
+
+// Record the handle's last error
+static void set_alpm_error(PackageTxn *txn, PackageTxnResult *result, PackageTxnError fallback,
+                           const char *what) {
+    alpm_errno_t err = alpm_errno(txn->handle);
+    set_error(result, classify(err, fallback), "%s: %s", what, alpm_strerror(err));
+}
+
+// Pass an event to the caller
+static void emit(PackageTxn *txn, PackageTxnEventKind kind, const char *name, const char *action,
+                 int percent, unsigned long long current, unsigned long long total) {
+    if (txn->progress == NULL) {
+        return;
+    }
+
+    PackageTxnEvent event = { kind, name != NULL ? name : "", action != NULL ? action : "",
+                              percent, current, total };
+    txn->progress(&event, txn->user_data);
+}
+
+// libalpm event callback: hooks and install scriptlet output
+static void on_event(void *ctx, alpm_event_t *event) {
+    PackageTxn *txn = ctx;
+
+    switch (event->type) {
+    case ALPM_EVENT_HOOK_RUN_START: {
+        alpm_event_hook_run_t *hook = &event->hook_run;
+        emit(txn, PACKAGE_TXN_EVENT_HOOK, hook->desc != NULL ? hook->desc : hook->name, "",
+             -1, hook->position, hook->total);
+        break;
+    }
+    case ALPM_EVENT_SCRIPTLET_INFO:
+        emit(txn, PACKAGE_TXN_EVENT_MESSAGE, event->scriptlet_info.line, "", -1, 0, 0);
+        break;
+    default:
+        break;
+    }
+}
+
+// libalpm progress callback: one event when a package starts and one when done
+static void on_progress(void *ctx, alpm_progress_t progress, const char *pkg, int percent,
+                        size_t howmany, size_t current) {
+    PackageTxn *txn = ctx;
+    const char *action;
+
+    switch (progress) {
+    case ALPM_PROGRESS_ADD_START:       action = "installing"; break;
+    case ALPM_PROGRESS_UPGRADE_START:   action = "upgrading"; break;
+    case ALPM_PROGRESS_DOWNGRADE_START: action = "downgrading"; break;
+    case ALPM_PROGRESS_REINSTALL_START: action = "reinstalling"; break;
+    default:
+        return;     // Conflict and disk space checks, key lookups
+    }
+
+    if (percent == 0 || percent == 100) {
+        emit(txn, PACKAGE_TXN_EVENT_INSTALL, pkg, action, percent, current, howmany);
+    }
+}
+
+// libalpm download callback, for databases and packages alike
+static void on_download(void *ctx, const char *filename, alpm_download_event_type_t event,
+                        void *data) {
+    PackageTxn *txn = ctx;
+
+    switch (event) {
+    case ALPM_DOWNLOAD_INIT:
+        emit(txn, PACKAGE_TXN_EVENT_DOWNLOAD, filename, "", 0, 0, 0);
+        break;
+    case ALPM_DOWNLOAD_PROGRESS: {
+        alpm_download_event_progress_t *progress = data;
+        int percent = progress->total > 0 ? (int)(progress->downloaded * 100 / progress->total) : -1;
+        emit(txn, PACKAGE_TXN_EVENT_DOWNLOAD, filename, "", percent,
+             progress->downloaded, progress->total > 0 ? progress->total : 0);
+        break;
+    }
+    case ALPM_DOWNLOAD_COMPLETED: {
+        alpm_download_event_completed_t *completed = data;
+        if (completed->result >= 0) {
+            emit(txn, PACKAGE_TXN_EVENT_DOWNLOAD, filename, "", 100,
+                 completed->total, completed->total);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// libalpm log callback: warnings and errors only
+static void on_log(void *ctx, alpm_loglevel_t level, const char *fmt, va_list args) {
+    PackageTxn *txn = ctx;
+    char line[512];
+
+    if (level != ALPM_LOG_ERROR && level != ALPM_LOG_WARNING) {
+        return;
+    }
+
+    vsnprintf(line, sizeof(line), fmt, args);
+    line[strcspn(line, "\n")] = '\0';
+    emit(txn, PACKAGE_TXN_EVENT_MESSAGE, line, level == ALPM_LOG_ERROR ? "error" : "warning",
+         -1, 0, 0);
+}
+
+// libalpm question callback: pacman's --noconfirm answers
+static void on_question(void *ctx, alpm_question_t *question) {
+    (void)ctx;  // Unused
+
+    switch (question->type) {
+    case ALPM_QUESTION_INSTALL_IGNOREPKG:
+        question->install_ignorepkg.install = 0;
+        break;
+    case ALPM_QUESTION_REPLACE_PKG:
+        question->replace.replace = 1;
+        break;
+    case ALPM_QUESTION_CONFLICT_PKG:
+        question->conflict.remove = 0;      // Fails with ALPM_ERR_CONFLICTING_DEPS
+        break;
+    case ALPM_QUESTION_CORRUPTED_PKG:
+        question->corrupted.remove = 1;
+        break;
+    case ALPM_QUESTION_REMOVE_PKGS:
+        question->remove_pkgs.skip = 0;
+        break;
+    case ALPM_QUESTION_SELECT_PROVIDER:
+        question->select_provider.use_index = 0;
+        break;
+    case ALPM_QUESTION_IMPORT_KEY:
+        question->import_key.import = 1;
+        break;
+    default:
+        break;
+    }
+}
+
+// Apply a SigLevel value (see pacman.conf(5)) on top of level
+static int parse_siglevel(const char *value, int level) {
+    char copy[256];
+    snprintf(copy, sizeof(copy), "%s", value);
+
+    char *saveptr;
+    for (char *token = strtok_r(copy, " \t", &saveptr); token != NULL;
+         token = strtok_r(NULL, " \t", &saveptr)) {
+        bool package = true;
+        bool database = true;
+        if (strncmp(token, "Package", 7) == 0) {
+            database = false;
+            token += 7;
+        } else if (strncmp(token, "Database", 8) == 0) {
+            package = false;
+            token += 8;
+        }
+
+        int required = (package ? ALPM_SIG_PACKAGE : 0) | (database ? ALPM_SIG_DATABASE : 0);
+        int optional = (package ? ALPM_SIG_PACKAGE_OPTIONAL : 0) |
+                       (database ? ALPM_SIG_DATABASE_OPTIONAL : 0);
+        int trust = (package ? ALPM_SIG_PACKAGE_MARGINAL_OK | ALPM_SIG_PACKAGE_UNKNOWN_OK : 0) |
+                    (database ? ALPM_SIG_DATABASE_MARGINAL_OK | ALPM_SIG_DATABASE_UNKNOWN_OK : 0);
+
+        if (strcmp(token, "Never") == 0) {
+            level &= ~(required | optional);
+        } else if (strcmp(token, "Optional") == 0) {
+            level |= required | optional;
+        } else if (strcmp(token, "Required") == 0) {
+            level = (level | required) & ~optional;
+        } else if (strcmp(token, "TrustedOnly") == 0) {
+            level &= ~trust;
+        } else if (strcmp(token, "TrustAll") == 0) {
+            level |= trust;
+        }
+    }
+
+    return level;
+}
+
+// Expand $repo and $arch in a server URL
+static char *expand_server(const char *url, const char *repo, const char *arch) {
+    size_t size = strlen(url) + 1;
+    for (const char *p = strchr(url, '$'); p != NULL; p = strchr(p + 1, '$')) {
+        size += strlen(repo) + strlen(arch);
+    }
+
+    char *expanded = malloc(size);
+    if (expanded == NULL) {
+        return NULL;
+    }
+
+    char *out = expanded;
+    for (const char *p = url; *p != '\0'; ) {
+        if (strncmp(p, "$repo", 5) == 0) {
+            out += sprintf(out, "%s", repo);
+            p += 5;
+        } else if (strncmp(p, "$arch", 5) == 0) {
+            out += sprintf(out, "%s", arch);
+            p += 5;
+        } else {
+            *out++ = *p++;
+        }
+    }
+    *out = '\0';
+    return expanded;
+}
+
+// Register the repository section just read
+static bool flush_repo(ConfState *state) {
+    ConfRepo *repo = &state->repo;
+    bool ok = true;
+
+    if (!state->in_repo) {
+        return true;
+    }
+    state->in_repo = false;
+
+    alpm_db_t *db = alpm_register_syncdb(state->txn->handle, repo->name,
+                                         repo->has_siglevel ? repo->siglevel : (int)ALPM_SIG_USE_DEFAULT);
+    if (db == NULL) {
+        set_alpm_error(state->txn, state->result, PACKAGE_TXN_ERR_SETUP, repo->name);
+        ok = false;
+    } else {
+        alpm_db_set_usage(db, ALPM_DB_USAGE_ALL);
+
+        const char *arch = state->architectures != NULL ? state->architectures->data : "any";
+        for (alpm_list_t *i = repo->servers; i != NULL; i = alpm_list_next(i)) {
+            char *url = expand_server(i->data, repo->name, arch);
+            if (url != NULL) {
+                alpm_db_add_server(db, url);
+                free(url);
+            }
+        }
+    }
+
+    free_string_list(&repo->servers);
+    return ok;
+}
+
+static bool read_conf(ConfState *state, const char *path, int depth);
+
+// Pass every space-separated word of a value to a libalpm list option
+static bool add_words(ConfState *state, const char *key, const char *value,
+                      int (*add)(alpm_handle_t *, const char *)) {
+    char *copy = strdup(value);
+    if (copy == NULL) {
+        set_error(state->result, PACKAGE_TXN_ERR_SETUP, "%s: out of memory", key);
+        return false;
+    }
+
+    char *saveptr;
+    for (char *word = strtok_r(copy, " \t", &saveptr); word != NULL;
+         word = strtok_r(NULL, " \t", &saveptr)) {
+        add(state->txn->handle, word);
+    }
+    free(copy);
+    return true;
+}
+
+// Handle one "Key = Value" line of pacman.conf
+static bool handle_directive(ConfState *state, const char *key, const char *value, int depth) {
+    alpm_handle_t *handle = state->txn->handle;
+
+    if (strcmp(key, "Include") == 0) {
+        return depth >= CONF_INCLUDE_DEPTH || read_conf(state, value, depth + 1);
+    }
+
+    if (state->in_repo) {
+        if (strcmp(key, "Server") == 0) {
+            state->repo.servers = alpm_list_add(state->repo.servers, strdup(value));
+        } else if (strcmp(key, "SigLevel") == 0) {
+            state->repo.siglevel = parse_siglevel(value, state->default_siglevel);
+            state->repo.has_siglevel = true;
+        }
+        return true;
+    }
+    if (!state->in_options) {
+        return true;
+    }
+
+    if (strcmp(key, "SigLevel") == 0) {
+        state->default_siglevel = parse_siglevel(value, state->default_siglevel);
+        alpm_option_set_default_siglevel(handle, state->default_siglevel);
+    } else if (strcmp(key, "Architecture") == 0) {
+        char copy[256];
+        snprintf(copy, sizeof(copy), "%s", value);
+        char *saveptr;
+        for (char *arch = strtok_r(copy, " \t", &saveptr); arch != NULL;
+             arch = strtok_r(NULL, " \t", &saveptr)) {
+            struct utsname uts;
+            if (strcmp(arch, "auto") == 0 && uname(&uts) == 0) {
+                arch = uts.machine;
+            }
+            alpm_option_add_architecture(handle, arch);
+            state->architectures = alpm_list_add(state->architectures, strdup(arch));
+        }
+    } else if (strcmp(key, "ParallelDownloads") == 0) {
+        int count = atoi(value);
+        if (count > 0) {
+            alpm_option_set_parallel_downloads(handle, count);
+        }
+    } else if (strcmp(key, "GPGDir") == 0) {
+        alpm_option_set_gpgdir(handle, value);
+    } else if (strcmp(key, "HookDir") == 0) {
+        alpm_option_add_hookdir(handle, value);
+        state->has_hookdir = true;
+    } else if (strcmp(key, "IgnorePkg") == 0) {
+        return add_words(state, key, value, alpm_option_add_ignorepkg);
+    } else if (strcmp(key, "IgnoreGroup") == 0) {
+        return add_words(state, key, value, alpm_option_add_ignoregroup);
+    } else if (strcmp(key, "NoUpgrade") == 0) {
+        return add_words(state, key, value, alpm_option_add_noupgrade);
+    } else if (strcmp(key, "NoExtract") == 0) {
+        return add_words(state, key, value, alpm_option_add_noextract);
+    }
+    return true;
+}
+
+// Read pacman.conf (or a file it includes)
+static bool read_conf(ConfState *state, const char *path, int depth) {
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        set_error(state->result, PACKAGE_TXN_ERR_SETUP, "%s: cannot be read", path);
+        return false;
+    }
+
+    char line[1024];
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), fp) != NULL) {
+        line[strcspn(line, "#\r\n")] = '\0';
+        char *start = line + strspn(line, " \t");
+        size_t len = strlen(start);
+        while (len > 0 && isspace((unsigned char)start[len - 1])) {
+            start[--len] = '\0';
+        }
+        if (len == 0) {
+            continue;
+        }
+
+        if (start[0] == '[' && start[len - 1] == ']') {
+            ok = flush_repo(state);
+            start[len - 1] = '\0';
+            start++;
+            state->in_options = strcmp(start, "options") == 0;
+            if (!state->in_options) {
+                memset(&state->repo, 0, sizeof(ConfRepo));
+                snprintf(state->repo.name, sizeof(state->repo.name), "%s", start);
+                state->in_repo = true;
+            }
+            continue;
+        }
+
+        char *value = strchr(start, '=');
+        if (value == NULL) {
+            continue;   // Flags such as Color or CheckSpace
+        }
+        char *key_end = value;
+        while (key_end > start && isspace((unsigned char)key_end[-1])) {
+            key_end--;
+        }
+        *key_end = '\0';
+        value += 1 + strspn(value + 1, " \t");
+
+        ok = handle_directive(state, start, value, depth);
+    }
+
+    fclose(fp);
+    return ok;
+}
+
+// Set up a handle
+PackageTxn *package_txn_open(const PackageTxnOptions *options, PackageTxnResult *result) {
+    unsigned long long span = trace_begin();
+    memset(result, 0, sizeof(PackageTxnResult));
+
+    PackageTxn *txn = calloc(1, sizeof(PackageTxn));
+    if (txn == NULL) {
+        set_error(result, PACKAGE_TXN_ERR_SETUP, "out of memory");
+        return NULL;
+    }
+    txn->progress = options->progress;
+    txn->user_data = options->user_data;
+    snprintf(txn->root, sizeof(txn->root), "%s", options->root);
+
+    alpm_errno_t err;
+    txn->handle = alpm_initialize(options->root, options->dbpath, &err);
+    if (txn->handle == NULL) {
+        set_error(result, classify(err, PACKAGE_TXN_ERR_SETUP), "%s: %s", options->dbpath,
+                  alpm_strerror(err));
+        free(txn);
+        trace_end(span, "install", "Open libalpm", "%s", result->message);
+        return NULL;
+    }
+
+    // Hold SIGINT back until the handle is released
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_interrupt;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    interrupted = 0;
+    sigaction(SIGINT, &action, &txn->saved_sigint);
+
+    alpm_option_set_eventcb(txn->handle, on_event, txn);
+    alpm_option_set_progresscb(txn->handle, on_progress, txn);
+    alpm_option_set_dlcb(txn->handle, on_download, txn);
+    alpm_option_set_logcb(txn->handle, on_log, txn);
+    alpm_option_set_questioncb(txn->handle, on_question, txn);
+    alpm_option_add_cachedir(txn->handle, options->cachedir);
+    // Like pacman --overwrite '*': files no package owns are replaced
+    alpm_option_add_overwrite_file(txn->handle, "*");
+
+    // pacman's defaults: the host's keyring, hooks and log of the root. Hooks
+    // run chrooted into it, and libalpm adds <root>/usr/share/libalpm/hooks.
+    const char *prefix = strcmp(txn->root, "/") == 0 ? "" : txn->root;
+    char path[512];
+    alpm_option_set_gpgdir(txn->handle, "/etc/pacman.d/gnupg/");
+    snprintf(path, sizeof(path), "%s/var/log", prefix);
+    if (access(path, W_OK) == 0) {
+        strncat(path, "/pacman.log", sizeof(path) - strlen(path) - 1);
+        alpm_option_set_logfile(txn->handle, path);
+    }
+
+    ConfState state;
+    memset(&state, 0, sizeof(state));
+    state.txn = txn;
+    state.result = result;
+    state.default_siglevel = ALPM_SIG_PACKAGE | ALPM_SIG_DATABASE | ALPM_SIG_DATABASE_OPTIONAL;
+    alpm_option_set_default_siglevel(txn->handle, state.default_siglevel);
+
+    bool ok = read_conf(&state, options->pacman_conf, 0) && flush_repo(&state);
+    if (ok && !state.has_hookdir) {
+        // Like pacman, HookDir replaces the default rather than adding to it
+        snprintf(path, sizeof(path), "%s/etc/pacman.d/hooks/", prefix);
+        alpm_option_add_hookdir(txn->handle, path);
+    }
+    free_string_list(&state.repo.servers);
+    free_string_list(&state.architectures);
+    if (!ok) {
+        package_txn_close(txn);
+        trace_end(span, "install", "Open libalpm", "%s", result->message);
+        return NULL;
+    }
+
+    trace_end(span, "install", "Open libalpm", "%d repositories",
+              (int)alpm_list_count(alpm_get_syncdbs(txn->handle)));
+    return txn;
+}
+
+// Refresh the repository databases
+bool package_txn_sync(PackageTxn *txn, PackageTxnResult *result) {
+    package_txn_result_clear(result);
+    if (check_interrupted(result)) {
+        return false;
+    }
+
+    alpm_list_t *dbs = alpm_get_syncdbs(txn->handle);
+    for (alpm_list_t *i = dbs; i != NULL; i = alpm_list_next(i)) {
+        emit(txn, PACKAGE_TXN_EVENT_DB_SYNC, alpm_db_get_name(i->data), "", -1, 0, 0);
+    }
+
+    if (alpm_db_update(txn->handle, dbs, 0) < 0) {
+        set_alpm_error(txn, result, PACKAGE_TXN_ERR_SYNC, "failed to synchronize databases");
+        if (result->error == PACKAGE_TXN_ERR_NOT_FOUND) {
+            result->error = PACKAGE_TXN_ERR_SYNC;
+        }
+        return false;
+    }
+    return !check_interrupted(result);
+}
+
+// Find a package by name, then by what packages provide, in repository order
+static alpm_pkg_t *find_sync_package(PackageTxn *txn, const char *name) {
+    alpm_list_t *dbs = alpm_get_syncdbs(txn->handle);
+
+    for (alpm_list_t *i = dbs; i != NULL; i = alpm_list_next(i)) {
+        alpm_pkg_t *pkg = alpm_db_get_pkg(i->data, name);
+        if (pkg != NULL) {
+            return pkg;
+        }
+    }
+    return alpm_find_dbs_satisfier(txn->handle, dbs, name);
+}
+
+// Describe why the transaction could not be prepared, then free the list
+static void describe_prepare_failure(alpm_errno_t err, alpm_list_t *data, PackageTxnResult *result) {
+    for (alpm_list_t *i = data; i != NULL; i = alpm_list_next(i)) {
+        if (err == ALPM_ERR_UNSATISFIED_DEPS) {
+            alpm_depmissing_t *miss = i->data;
+            char *dep = alpm_dep_compute_string(miss->depend);
+            add_detail(result, "%s: requires %s", miss->target, dep != NULL ? dep : "?");
+            free(dep);
+        } else if (err == ALPM_ERR_CONFLICTING_DEPS) {
+            alpm_conflict_t *conflict = i->data;
+            add_detail(result, "%s and %s are in conflict",
+                       alpm_pkg_get_name(conflict->package1), alpm_pkg_get_name(conflict->package2));
+        } else if (err == ALPM_ERR_PKG_INVALID_ARCH) {
+            add_detail(result, "%s: not for this architecture", (const char *)i->data);
+        }
+    }
+
+    if (err == ALPM_ERR_UNSATISFIED_DEPS) {
+        alpm_list_free_inner(data, (alpm_list_fn_free)alpm_depmissing_free);
+    } else if (err == ALPM_ERR_CONFLICTING_DEPS) {
+        alpm_list_free_inner(data, (alpm_list_fn_free)alpm_conflict_free);
+    } else {
+        alpm_list_free_inner(data, free);
+    }
+    alpm_list_free(data);
+}
+
+// Describe why the transaction could not be committed, then free the list
+static void describe_commit_failure(alpm_errno_t err, alpm_list_t *data, PackageTxnResult *result) {
+    for (alpm_list_t *i = data; i != NULL; i = alpm_list_next(i)) {
+        if (err == ALPM_ERR_FILE_CONFLICTS) {
+            alpm_fileconflict_t *conflict = i->data;
+            if (conflict->type == ALPM_FILECONFLICT_TARGET) {
+                add_detail(result, "%s: %s exists in both %s and %s", conflict->target,
+                           conflict->file, conflict->target, conflict->ctarget);
+            } else {
+                add_detail(result, "%s: %s exists in filesystem%s%s", conflict->target,
+                           conflict->file, conflict->ctarget[0] != '\0' ? " (owned by " : "",
+                           conflict->ctarget[0] != '\0' ? conflict->ctarget : "");
+            }
+        } else if (err == ALPM_ERR_PKG_INVALID || err == ALPM_ERR_PKG_INVALID_CHECKSUM ||
+                   err == ALPM_ERR_PKG_INVALID_SIG) {
+            add_detail(result, "%s is invalid or corrupted", (const char *)i->data);
+        }
+    }
+
+    if (err == ALPM_ERR_FILE_CONFLICTS) {
+        alpm_list_free_inner(data, (alpm_list_fn_free)alpm_fileconflict_free);
+    } else {
+        alpm_list_free_inner(data, free);
+    }
+    alpm_list_free(data);
+}
+
+// Report the packages about to be installed and their download size
+static void emit_targets(PackageTxn *txn) {
+    alpm_list_t *add = alpm_trans_get_add(txn->handle);
+    unsigned long long download = 0;
+    size_t size = 1;
+
+    for (alpm_list_t *i = add; i != NULL; i = alpm_list_next(i)) {
+        size += strlen(alpm_pkg_get_name(i->data)) + strlen(alpm_pkg_get_version(i->data)) + 2;
+        download += alpm_pkg_download_size(i->data);
+    }
+
+    char *names = malloc(size);
+    if (names == NULL) {
+        return;
+    }
+    char *out = names;
+    *out = '\0';
+    for (alpm_list_t *i = add; i != NULL; i = alpm_list_next(i)) {
+        out += sprintf(out, "%s%s-%s", out == names ? "" : " ",
+                       alpm_pkg_get_name(i->data), alpm_pkg_get_version(i->data));
+    }
+
+    emit(txn, PACKAGE_TXN_EVENT_TARGETS, names, "", -1, alpm_list_count(add), download);
+    free(names);
+}
+
+// Install packages as one transaction
+bool package_txn_install(PackageTxn *txn, const char *packages, PackageTxnResult *result) {
+    alpm_db_t *localdb = alpm_get_localdb(txn->handle);
+    package_txn_result_clear(result);
+    if (check_interrupted(result)) {
+        return false;
+    }
+
+    if (alpm_trans_init(txn->handle, ALPM_TRANS_FLAG_NEEDED) != 0) {
+        set_alpm_error(txn, result, PACKAGE_TXN_ERR_SETUP, "failed to init transaction");
+        return false;
+    }
+
+    char name[256];
+    int missing = 0;
+    for (const char *p = packages + strspn(packages, " "); *p != '\0'; p += strspn(p, " ")) {
+        size_t len = strcspn(p, " ");
+        snprintf(name, sizeof(name), "%.*s", (int)len, p);
+        p += len;
+
+        alpm_pkg_t *pkg = find_sync_package(txn, name);
+        if (pkg == NULL) {
+            add_detail(result, "target not found: %s", name);
+            missing++;
+            continue;
+        }
+
+        // --needed: a current package is left alone
+        alpm_pkg_t *local = alpm_db_get_pkg(localdb, alpm_pkg_get_name(pkg));
+        if (local != NULL && alpm_pkg_vercmp(alpm_pkg_get_version(local), alpm_pkg_get_version(pkg)) == 0) {
+            result->up_to_date++;
+            continue;
+        }
+
+        if (alpm_add_pkg(txn->handle, pkg) != 0 && alpm_errno(txn->handle) != ALPM_ERR_TRANS_DUP_TARGET) {
+            set_alpm_error(txn, result, PACKAGE_TXN_ERR_COMMIT, name);
+            alpm_trans_release(txn->handle);
+            return false;
+        }
+    }
+
+    if (missing > 0) {
+        set_error(result, PACKAGE_TXN_ERR_NOT_FOUND, "%d target%s not found in the repositories",
+                  missing, missing == 1 ? "" : "s");
+        alpm_trans_release(txn->handle);
+        return false;
+    }
+    if (alpm_trans_get_add(txn->handle) == NULL) {
+        alpm_trans_release(txn->handle);
+        return true;    // There is nothing to do
+    }
+
+    alpm_list_t *data = NULL;
+    if (alpm_trans_prepare(txn->handle, &data) != 0) {
+        alpm_errno_t err = alpm_errno(txn->handle);
+        set_alpm_error(txn, result, PACKAGE_TXN_ERR_DEPENDENCY, "failed to prepare transaction");
+        describe_prepare_failure(err, data, result);
+        alpm_trans_release(txn->handle);
+        return false;
+    }
+
+    // Prepared: dependencies are resolved, the full target list is known
+    emit_targets(txn);
+    int target_count = (int)alpm_list_count(alpm_trans_get_add(txn->handle));
+
+    // Last point where an interrupt leaves the system untouched
+    if (check_interrupted(result)) {
+        alpm_trans_release(txn->handle);
+        return false;
+    }
+
+    data = NULL;
+    committing = txn->handle;
+    int committed = alpm_trans_commit(txn->handle, &data);
+    committing = NULL;
+    if (committed != 0) {
+        alpm_errno_t err = alpm_errno(txn->handle);
+        set_alpm_error(txn, result, PACKAGE_TXN_ERR_COMMIT, "failed to commit transaction");
+        describe_commit_failure(err, data, result);
+        if (interrupted) {
+            result->error = PACKAGE_TXN_ERR_INTERRUPTED;
+        }
+        alpm_trans_release(txn->handle);
+        return false;
+    }
+
+    alpm_trans_release(txn->handle);
+    result->installed = target_count;
+    return true;
+}
+
+// Release the handle
+void package_txn_close(PackageTxn *txn) {
+    if (txn == NULL) {
+        return;
+    }
+    alpm_release(txn->handle);
+
+    // The lock is gone: a held-back SIGINT can take its usual course now
+    sigaction(SIGINT, &txn->saved_sigint, NULL);
+    bool deliver = interrupted;
+    interrupted = 0;
+    free(txn);
+    if (deliver) {
+        raise(SIGINT);
+    }
+}
+
+#else // !HAVE_ALPM
+
+// Report that there is no in-process backend
+static void set_unsupported(PackageTxnResult *result) {
+    package_txn_result_clear(result);
+    result->error = PACKAGE_TXN_ERR_UNSUPPORTED;
+    snprintf(result->message, sizeof(result->message), "built without libalpm (make WITH_ALPM=1)");
+}
+
+// Whether transactions run in-process
+bool package_txn_supported(void) {
+    return false;
+}
+
+// Set up a handle: not without libalpm
+PackageTxn *package_txn_open(const PackageTxnOptions *options, PackageTxnResult *result) {
+    (void)options;  // Unused
+    memset(result, 0, sizeof(PackageTxnResult));
+    set_unsupported(result);
+    return NULL;
+}
+
+bool package_txn_sync(PackageTxn *txn, PackageTxnResult *result) {
+    (void)txn;  // Unused
+    set_unsupported(result);
+    return false;
+}
+
+bool package_txn_install(PackageTxn *txn, const char *packages, PackageTxnResult *result) {
+    (void)txn;       // Unused
+    (void)packages;  // Unused
+    set_unsupported(result);
+    return false;
+}
+
+void package_txn_close(PackageTxn *txn) {
+    (void)txn;  // Unused
+}
+
+#endif // HAVE_ALPM
@@ -0,0 +1,244 @@
+/*
+ * Pacman local database reader implementation
+ *
+ * Reads /var/lib/pacman/local/<name>-<version>/desc directly instead of
+ * running `pacman -Q` once per package.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../include/pacman_db.h"
+
+// One installed package; strings live in the shared pool
+typedef struct {
+    uint32_t hash;
+    uint32_t name_offset;
+    uint32_t version_offset;
+} PacmanPackage;
+
+struct PacmanDb {
+    PacmanPackage *packages;
+    int count;
+    int capacity;
+
+    // Open addressing table of package indices (-1 = empty), size is a power of two
+    int *slots;
+    uint32_t slot_mask;
+
+    char *pool;
+    size_t pool_used;
+    size_t pool_size;
+};
+
+// FNV-1a hash of a package name
+static uint32_t hash_name(const char *name) {
+    uint32_t hash = 2166136261u;
+    while (*name) {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Copy a string of the given length into the pool, returning its offset
+static bool pool_add(PacmanDb *db, const char *str, size_t len, uint32_t *offset) {
+    if (db->pool_used + len + 1 > db->pool_size) {
+        size_t new_size = db->pool_size * 2;
+        while (db->pool_used + len + 1 > new_size) {
+            new_size *= 2;
+        }
+        char *new_pool = realloc(db->pool, new_size);
+        if (new_pool == NULL) {
+            return false;
+        }
+        db->pool = new_pool;
+        db->pool_size = new_size;
+    }
+
+    memcpy(db->pool + db->pool_used, str, len);
+    db->pool[db->pool_used + len] = '\0';
+    *offset = (uint32_t)db->pool_used;
+    db->pool_used += len + 1;
+    return true;
+}
+
+// Find the value line following a "%KEY%" header in a desc file
+static const char *find_desc_field(const char *desc, const char *key, size_t *len) {
+    size_t key_len = strlen(key);
+    const char *pos = desc;
+
+    while ((pos = strstr(pos, key)) != NULL) {
+        // Headers always start a line and are followed by a newline
+        if ((pos == desc || pos[-1] == '\n') && pos[key_len] == '\n') {
+            const char *value = pos + key_len + 1;
+            *len = strcspn(value, "\n");
+            return *len > 0 ? value : NULL;
+        }
+        pos += key_len;
+    }
+
+    return NULL;
+}
+
+// Read name and version from one package's desc file
+static bool read_package_desc(PacmanDb *db, const char *db_path, const char *entry_name) {
+    char path[512];
+    char desc[4096];
+
+    snprintf(path, sizeof(path), "%s/%s/desc", db_path, entry_name);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    // %NAME% and %VERSION% are the first fields, the head of the file is enough
+    ssize_t len = read(fd, desc, sizeof(desc) - 1);
+    close(fd);
+    if (len <= 0) {
+        return false;
+    }
+    desc[len] = '\0';
+
+    size_t name_len, version_len;
+    const char *name = find_desc_field(desc, "%NAME%", &name_len);
+    const char *version = find_desc_field(desc, "%VERSION%", &version_len);
+    if (name == NULL || version == NULL) {
+        return false;
+    }
+
+    if (db->count >= db->capacity) {
+        int new_capacity = db->capacity * 2;
+        PacmanPackage *new_packages = realloc(db->packages, sizeof(PacmanPackage) * new_capacity);
+        if (new_packages == NULL) {
+            return false;
+        }
+        db->packages = new_packages;
+        db->capacity = new_capacity;
+    }
+
+    PacmanPackage *pkg = &db->packages[db->count];
+    if (!pool_add(db, name, name_len, &pkg->name_offset) ||
+        !pool_add(db, version, version_len, &pkg->version_offset)) {
+        return false;
+    }
+    pkg->hash = hash_name(db->pool + pkg->name_offset);
+    db->count++;
+
+    return true;
+}
+
+// Build the hash index once all packages are read
+static bool build_index(PacmanDb *db) {
+    uint32_t size = 16;
+    while (size < (uint32_t)db->count * 2) {
+        size *= 2;
+    }
+
+    db->slots = malloc(sizeof(int) * size);
+    if (db->slots == NULL) {
+        return false;
+    }
+    memset(db->slots, 0xff, sizeof(int) * size);
+    db->slot_mask = size - 1;
+
+    for (int i = 0; i < db->count; i++) {
+        uint32_t slot = db->packages[i].hash & db->slot_mask;
+        while (db->slots[slot] >= 0) {
+            slot = (slot + 1) & db->slot_mask;
+        }
+        db->slots[slot] = i;
+    }
+
+    return true;
+}
+
+// Read every package in the local database
+PacmanDb *pacman_db_load(const char *local_db_path) {
+    DIR *dir = opendir(local_db_path);
+    if (dir == NULL) {
+        fprintf(stderr, "Failed to open pacman database %s\n", local_db_path);
+        return NULL;
+    }
+
+    PacmanDb *db = calloc(1, sizeof(PacmanDb));
+    if (db == NULL) {
+        closedir(dir);
+        return NULL;
+    }
+
+    db->capacity = 512;
+    db->pool_size = 16384;
+    db->packages = malloc(sizeof(PacmanPackage) * db->capacity);
+    db->pool = malloc(db->pool_size);
+    if (db->packages == NULL || db->pool == NULL) {
+        closedir(dir);
+        pacman_db_free(db);
+        return NULL;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        // Skip ".", ".." and the ALPM_DB_VERSION file
+        if (entry->d_name[0] == '.' || entry->d_type == DT_REG) {
+            continue;
+        }
+        read_package_desc(db, local_db_path, entry->d_name);
+    }
+
+    closedir(dir);
+
+    if (!build_index(db)) {
+        pacman_db_free(db);
+        return NULL;
+    }
+
+    return db;
+}
+
+// Look up the installed version of a package
+const char *pacman_db_get_version(const PacmanDb *db, const char *package_name) {
+    if (db == NULL || package_name == NULL) {
+        return NULL;
+    }
+
+    uint32_t hash = hash_name(package_name);
+    uint32_t slot = hash & db->slot_mask;
+
+    while (db->slots[slot] >= 0) {
+        const PacmanPackage *pkg = &db->packages[db->slots[slot]];
+        if (pkg->hash == hash && strcmp(db->pool + pkg->name_offset, package_name) == 0) {
+            return db->pool + pkg->version_offset;
+        }
+        slot = (slot + 1) & db->slot_mask;
+    }
+
+    return NULL;
+}
+
+// Check whether a package is installed
+bool pacman_db_has_package(const PacmanDb *db, const char *package_name) {
+    return pacman_db_get_version(db, package_name) != NULL;
+}
+
+// Number of installed packages in the snapshot
+int pacman_db_count(const PacmanDb *db) {
+    return db != NULL ? db->count : 0;
+}
+
+// Free a snapshot
+void pacman_db_free(PacmanDb *db) {
+    if (db == NULL) {
+        return;
+    }
+
+    free(db->packages);
+    free(db->slots);
+    free(db->pool);
+    free(db);
+}
@@ -0,0 +1,422 @@
+/*
+ * PCI ID database (pci.ids) name lookup implementation
+ *
+ * pci.ids lists each vendor at the start of a line ("10de  NVIDIA
+ * Corporation"), its devices below it after one tab and their subsystems
+ * after two; device classes follow at the end ("C 03  Display controller").
+ * The index holds one (key, offset) pair per vendor and device line, sorted
+ * by key: vendor lines are keyed by vendor ID, device lines by vendor << 16 |
+ * device. The offset is that of the name in the file, so a lookup is a binary
+ * search followed by reading one line of the mapping.
+ *
+ * Index file layout (native endianness, the cache never leaves the machine):
+ *   PciIdsIndexHeader
+ *   PciIdsEntry vendors[vendor_count]
+ *   PciIdsEntry devices[device_count]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/pci_ids.h"
+#include "../include/trace.h"
+
+#define PCI_IDS_INDEX_MAGIC "SDRVPCII"
+#define PCI_IDS_INDEX_VERSION 1
+
+typedef struct {
+    uint32_t key;
+    uint32_t offset;            // Of the name in pci.ids
+} PciIdsEntry;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t vendor_count;
+    uint32_t device_count;
+    uint32_t entry_size;        // Catches builds with a different layout
+    uint64_t file_size;         // The pci.ids the index was built from
+    uint64_t file_mtime;        // Its mtime (ns)
+} PciIdsIndexHeader;
+
+struct PciIds {
+    const char *data;           // The mapped pci.ids
+    size_t size;
+    const PciIdsEntry *vendors;
+    const PciIdsEntry *devices;
+    uint32_t vendor_count;
+    uint32_t device_count;
+    void *index_map;            // Mapped index file, or NULL when built here
+    size_t index_size;
+    PciIdsEntry *built;         // Built entries (vendors, then devices), or NULL
+};
+
+// Growable entry list used while building
+typedef struct {
+    PciIdsEntry *entries;
+    uint32_t count;
+    uint32_t capacity;
+    bool sorted;
+} EntryList;
+
+// Map a whole file read-only; false for an empty or unreadable one
+static bool map_file(const char *path, void **map, size_t *size, struct stat *st) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool ok = fstat(fd, st) == 0 && S_ISREG(st->st_mode) && st->st_size > 0;
+    if (ok) {
+        *size = st->st_size;
+        *map = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ok = *map != MAP_FAILED;
+    }
+    close(fd);
+    return ok;
+}
+
+// Parse the 4-digit hex ID at the start of a line; it must be followed by
+// whitespace and a name
+static bool parse_id(const char *p, const char *eol, uint32_t *id) {
+    uint32_t value = 0;
+
+    if (eol - p < 6) {
+        return false;
+    }
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        int digit = c >= '0' && c <= '9' ? c - '0' :
+                    c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+                    c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+        if (digit < 0) {
+            return false;
+        }
+        value = value << 4 | digit;
+    }
+    if (p[4] != ' ' && p[4] != '\t') {
+        return false;
+    }
+
+    *id = value;
+    return true;
+}
+
+// Append an entry, noting whether the list is still in key order
+static bool entry_list_add(EntryList *list, uint32_t key, uint32_t offset) {
+    if (list->count == list->capacity) {
+        uint32_t capacity = list->capacity > 0 ? list->capacity * 2 : 1024;
+        PciIdsEntry *grown = realloc(list->entries, sizeof(PciIdsEntry) * capacity);
+        if (grown == NULL) {
+            return false;
+        }
+        list->entries = grown;
+        list->capacity = capacity;
+    }
+
+    if (list->count > 0 && list->entries[list->count - 1].key > key) {
+        list->sorted = false;
+    }
+    list->entries[list->count].key = key;
+    list->entries[list->count].offset = offset;
+    list->count++;
+    return true;
+}
+
+// Order entries by key, then by position in the file (the first one wins)
+static int compare_entries(const void *a, const void *b) {
+    const PciIdsEntry *one = a;
+    const PciIdsEntry *two = b;
+    if (one->key != two->key) {
+        return one->key < two->key ? -1 : 1;
+    }
+    return (one->offset > two->offset) - (one->offset < two->offset);
+}
+
+// Index the vendor and device lines with one pass over the mapping
+static bool build_index(PciIds *ids) {
+    EntryList vendors = { NULL, 0, 0, true };
+    EntryList devices = { NULL, 0, 0, true };
+    const char *end = ids->data + ids->size;
+    uint32_t vendor = 0;
+    bool have_vendor = false;
+    bool ok = true;
+
+    for (const char *p = ids->data; ok && p < end; ) {
+        const char *eol = memchr(p, '\n', end - p);
+        if (eol == NULL) {
+            eol = end;
+        }
+
+        uint32_t id;
+        if (p[0] == 'C' && eol - p > 1 && p[1] == ' ') {
+            break;      // Device classes: no vendors follow
+        } else if (p[0] == '\t' && eol - p > 1 && p[1] != '\t') {
+            // Device of the current vendor (two tabs would be a subsystem)
+            if (have_vendor && parse_id(p + 1, eol, &id)) {
+                const char *name = p + 1 + 4 + strspn(p + 1 + 4, " \t");
+                ok = entry_list_add(&devices, vendor << 16 | id, name - ids->data);
+            }
+        } else if (parse_id(p, eol, &id)) {
+            const char *name = p + 4 + strspn(p + 4, " \t");
+            vendor = id;
+            have_vendor = true;
+            ok = entry_list_add(&vendors, id, name - ids->data);
+        }
+
+        p = eol + 1;
+    }
+
+    if (!ok) {
+        free(vendors.entries);
+        free(devices.entries);
+        return false;
+    }
+
+    // hwdata keeps the file sorted; sort anyway if an edited copy is not
+    if (!vendors.sorted) {
+        qsort(vendors.entries, vendors.count, sizeof(PciIdsEntry), compare_entries);
+    }
+    if (!devices.sorted) {
+        qsort(devices.entries, devices.count, sizeof(PciIdsEntry), compare_entries);
+    }
+
+    // One block, so that closing has a single pointer to free
+    ids->built = malloc(sizeof(PciIdsEntry) * ((size_t)vendors.count + devices.count + 1));
+    if (ids->built == NULL) {
+        free(vendors.entries);
+        free(devices.entries);
+        return false;
+    }
+    memcpy(ids->built, vendors.entries, sizeof(PciIdsEntry) * vendors.count);
+    memcpy(ids->built + vendors.count, devices.entries, sizeof(PciIdsEntry) * devices.count);
+    free(vendors.entries);
+    free(devices.entries);
+
+    ids->vendors = ids->built;
+    ids->devices = ids->built + vendors.count;
+    ids->vendor_count = vendors.count;
+    ids->device_count = devices.count;
+    return true;
+}
+
+// Use a saved index if it was built from this very file
+static bool load_index(PciIds *ids, const char *index_path, const struct stat *st) {
+    void *map;
+    size_t size;
+    struct stat index_st;
+
+    if (!map_file(index_path, &map, &size, &index_st)) {
+        return false;
+    }
+
+    const PciIdsIndexHeader *header = map;
+    bool ok = size >= sizeof(PciIdsIndexHeader) &&
+              memcmp(header->magic, PCI_IDS_INDEX_MAGIC, sizeof(header->magic)) == 0 &&
+              header->version == PCI_IDS_INDEX_VERSION &&
+              header->entry_size == sizeof(PciIdsEntry) &&
+              header->file_size == (uint64_t)st->st_size &&
+              header->file_mtime == (uint64_t)st->st_mtim.tv_sec * 1000000000ull + st->st_mtim.tv_nsec &&
+              size == sizeof(PciIdsIndexHeader) +
+                      sizeof(PciIdsEntry) * ((size_t)header->vendor_count + header->device_count);
+    if (!ok) {
+        munmap(map, size);
+        return false;
+    }
+
+    ids->index_map = map;
+    ids->index_size = size;
+    ids->vendors = (const PciIdsEntry *)(header + 1);
+    ids->devices = ids->vendors + header->vendor_count;
+    ids->vendor_count = header->vendor_count;
+    ids->device_count = header->device_count;
+    return true;
+}
+
+// Write exactly size bytes
+static bool write_full(int fd, const void *buf, size_t size) {
+    const char *pos = buf;
+    while (size > 0) {
+        ssize_t n = write(fd, pos, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        pos += n;
+        size -= n;
+    }
+    return true;
+}
+
+// Save a built index next to the scan cache (atomically replaces the file)
+static bool save_index(const PciIds *ids, const char *index_path, const struct stat *st) {
+    char dir[256];
+    snprintf(dir, sizeof(dir), "%s", index_path);
+    char *slash = strrchr(dir, '/');
+    if (slash != NULL && slash != dir) {
+        *slash = '\0';
+        if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+            return false;
+        }
+    }
+
+    PciIdsIndexHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PCI_IDS_INDEX_MAGIC, sizeof(header.magic));
+    header.version = PCI_IDS_INDEX_VERSION;
+    header.vendor_count = ids->vendor_count;
+    header.device_count = ids->device_count;
+    header.entry_size = sizeof(PciIdsEntry);
+    header.file_size = st->st_size;
+    header.file_mtime = (uint64_t)st->st_mtim.tv_sec * 1000000000ull + st->st_mtim.tv_nsec;
+
+    // Write to a temporary file and rename, so readers never see a partial index
+    char tmp_path[300];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%d.tmp", index_path, (int)getpid());
+
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = write_full(fd, &header, sizeof(header)) &&
+              write_full(fd, ids->vendors, sizeof(PciIdsEntry) * ids->vendor_count) &&
+              write_full(fd, ids->devices, sizeof(PciIdsEntry) * ids->device_count);
+    ok = close(fd) == 0 && ok;
+    if (ok) {
+        ok = rename(tmp_path, index_path) == 0;
+    }
+    if (!ok) {
+        unlink(tmp_path);
+    }
+    return ok;
+}
+
+// Map the database and load or build its index
+PciIds *pci_ids_open(const char *path, const char *index_path) {
+    unsigned long long span = trace_begin();
+    PciIds *ids = calloc(1, sizeof(PciIds));
+    void *map;
+    struct stat st;
+
+    if (ids == NULL) {
+        return NULL;
+    }
+
+    // Offsets are 32-bit; pci.ids is a few MB
+    bool mapped = map_file(path, &map, &ids->size, &st);
+    if (mapped && ids->size > UINT32_MAX) {
+        munmap(map, ids->size);
+        mapped = false;
+    }
+    if (!mapped) {
+        free(ids);
+        trace_end(span, "scan", "Open pci.ids", "%s unreadable", path);
+        return NULL;
+    }
+    ids->data = map;
+
+    bool have_index = index_path != NULL && index_path[0] != '\0';
+    bool cached = have_index && load_index(ids, index_path, &st);
+    if (!cached) {
+        if (!build_index(ids)) {
+            pci_ids_close(ids);
+            trace_end(span, "scan", "Open pci.ids", "out of memory");
+            return NULL;
+        }
+
+        // Without write access (not root) the index is simply built each time
+        if (have_index) {
+            save_index(ids, index_path, &st);
+        }
+    }
+
+    trace_end(span, "scan", "Open pci.ids", "%u vendors, %u devices, index %s",
+              ids->vendor_count, ids->device_count, cached ? "cached" : "built");
+    return ids;
+}
+
+// Binary search for the first entry with key
+static const PciIdsEntry *find_entry(const PciIdsEntry *entries, uint32_t count, uint32_t key) {
+    uint32_t low = 0;
+    uint32_t high = count;
+
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (entries[mid].key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low < count && entries[low].key == key ? &entries[low] : NULL;
+}
+
+// The name an entry points to, up to the end of its line
+static const char *entry_name(const PciIds *ids, const PciIdsEntry *entry, size_t *len) {
+    // A stale or damaged index must not read past the mapping
+    if (entry == NULL || entry->offset >= ids->size) {
+        return NULL;
+    }
+
+    const char *name = ids->data + entry->offset;
+    const char *end = ids->data + ids->size;
+    const char *eol = memchr(name, '\n', end - name);
+    if (eol == NULL) {
+        eol = end;
+    }
+    while (eol > name && (eol[-1] == '\r' || eol[-1] == ' ' || eol[-1] == '\t')) {
+        eol--;
+    }
+    if (eol == name) {
+        return NULL;
+    }
+
+    *len = eol - name;
+    return name;
+}
+
+// Name of a vendor
+const char *pci_ids_vendor(const PciIds *ids, unsigned int vendor_id, size_t *len) {
+    return entry_name(ids, find_entry(ids->vendors, ids->vendor_count, vendor_id & 0xffff), len);
+}
+
+// Name of a device of a vendor
+const char *pci_ids_device(const PciIds *ids, unsigned int vendor_id, unsigned int device_id,
+                           size_t *len) {
+    uint32_t key = (vendor_id & 0xffff) << 16 | (device_id & 0xffff);
+    return entry_name(ids, find_entry(ids->devices, ids->device_count, key), len);
+}
+
+// Number of vendors indexed
+int pci_ids_vendor_count(const PciIds *ids) {
+    return ids->vendor_count;
+}
+
+// Number of devices indexed
+int pci_ids_device_count(const PciIds *ids) {
+    return ids->device_count;
+}
+
+// Unmap the database and free the index
+void pci_ids_close(PciIds *ids) {
+    if (ids == NULL) {
+        return;
+    }
+    if (ids->data != NULL) {
+        munmap((void *)ids->data, ids->size);
+    }
+    if (ids->index_map != NULL) {
+        munmap(ids->index_map, ids->index_size);
+    }
+    free(ids->built);
+    free(ids);
+}
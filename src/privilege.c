@@ -0,0 +1,132 @@
+/*
+ * Privilege management implementation
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <grp.h>
+#include <pwd.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "../include/privilege.h"
+#include "../include/proc.h"
+#include "../include/trace.h"
+
+// Check if running as root
+bool is_root(void) {
+    return geteuid() == 0;
+}
+
+// Drop privileges to the user who started us through sudo or pkexec
+void drop_privileges(void) {
+    if (!is_root()) {
+        return;
+    }
+
+    // pkexec and sudo both record who asked; a root login has neither
+    const char *uid_str = getenv("PKEXEC_UID");
+    if (uid_str == NULL) {
+        uid_str = getenv("SUDO_UID");
+    }
+    if (uid_str == NULL) {
+        return;
+    }
+
+    char *end = NULL;
+    unsigned long uid = strtoul(uid_str, &end, 10);
+    if (end == uid_str || *end != '\0' || uid == 0) {
+        return;
+    }
+
+    struct passwd *pw = getpwuid((uid_t)uid);
+    if (pw == NULL) {
+        fprintf(stderr, "Error: unknown user id %lu, refusing to continue as root\n", uid);
+        exit(1);
+    }
+
+    // Groups first: after setuid() we may no longer change them
+    if (initgroups(pw->pw_name, pw->pw_gid) != 0 || setgid(pw->pw_gid) != 0 ||
+        setuid(pw->pw_uid) != 0) {
+        fprintf(stderr, "Error: could not drop privileges to %s: %s\n", pw->pw_name, strerror(errno));
+        exit(1);
+    }
+
+    setenv("HOME", pw->pw_dir, 1);
+    setenv("USER", pw->pw_name, 1);
+    setenv("LOGNAME", pw->pw_name, 1);
+    printf("Dropped privileges to %s (UID: %d)\n", pw->pw_name, getuid());
+}
+
+// Get the uid and pid of the process on the other end of a Unix socket
+bool get_peer_credentials(int fd, uid_t *uid, pid_t *pid) {
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0 || len != sizeof(cred)) {
+        return false;
+    }
+    *uid = cred.uid;
+    *pid = cred.pid;
+    return true;
+}
+
+// Start time of a process in clock ticks since boot (field 22 of /proc/<pid>/stat)
+static unsigned long long process_start_time(pid_t pid) {
+    char path[64];
+    char stat[1024];
+
+    snprintf(path, sizeof(path), "/proc/%d/stat", (int)pid);
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        return 0;
+    }
+    size_t len = fread(stat, 1, sizeof(stat) - 1, fp);
+    fclose(fp);
+    stat[len] = '\0';
+
+    // The command name may contain spaces; fields are counted after its ')'
+    char *p = strrchr(stat, ')');
+    for (int field = 2; p != NULL && field < 22; field++) {
+        p = strchr(p + 1, ' ');
+    }
+    return p != NULL ? strtoull(p + 1, NULL, 10) : 0;
+}
+
+// Check that the peer of a Unix socket may perform a polkit action
+bool authorize_peer(int fd, const char *action_id) {
+    uid_t uid;
+    pid_t pid;
+
+    if (!get_peer_credentials(fd, &uid, &pid)) {
+        fprintf(stderr, "Could not get peer credentials: %s\n", strerror(errno));
+        return false;
+    }
+    if (uid == 0) {
+        return true;
+    }
+
+    // pid,start-time,uid identifies the process even if the pid is reused
+    unsigned long long start_time = process_start_time(pid);
+    if (start_time == 0) {
+        return false;
+    }
+
+    char subject[96];
+    snprintf(subject, sizeof(subject), "%d,%llu,%u", (int)pid, start_time, (unsigned int)uid);
+    char *argv[] = { "pkcheck", "--action-id", (char *)action_id, "--process", subject,
+                     "--allow-user-interaction", NULL };
+
+    unsigned long long span = trace_begin();
+    ProcResult result;
+    bool authorized = proc_run(argv, PROC_CAPTURE_STDOUT | PROC_MERGE_STDERR, &result);
+    trace_end(span, "privilege", "pkcheck", "uid %u: %s", (unsigned int)uid,
+              authorized ? "authorized" : "denied");
+
+    if (!authorized && result.out != NULL && result.out[0] != '\0') {
+        fprintf(stderr, "pkcheck: %s", result.out);
+    }
+    proc_result_free(&result);
+    return authorized;
+}
@@ -0,0 +1,357 @@
+/*
+ * External command execution implementation
+ *
+ * Every external command is started with posix_spawnp() from an argv
+ * vector, so no shell is involved and nothing is built into fixed-size
+ * command strings. Output is collected from non-blocking pipes with
+ * poll(), which also lets independent commands run side by side.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "../include/proc.h"
+#include "../include/trace.h"
+
+extern char **environ;
+
+// How often commands without pipes are checked for exit while others are polled
+#define PROC_REAP_INTERVAL_MS 20
+
+// Output collected from one pipe
+typedef struct {
+    int fd;
+    char *data;
+    size_t len;
+    size_t capacity;
+} ProcPipe;
+
+// A job started by proc_run_many()
+typedef struct {
+    ProcJob *job;
+    pid_t pid;
+    ProcPipe pipes[2];      // stdout, stderr
+    unsigned long long span;
+    unsigned long long started_us;
+} RunningJob;
+
+// Decode a waitpid() status into an exit code
+int proc_exit_code(int status) {
+    if (status < 0) {
+        return -1;
+    }
+    if (WIFEXITED(status)) {
+        return WEXITSTATUS(status);
+    }
+    if (WIFSIGNALED(status)) {
+        return 128 + WTERMSIG(status);
+    }
+    return -1;
+}
+
+// Monotonic clock in microseconds
+static unsigned long long monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+// Close both ends of a pipe that may be partly open
+static void close_pipe(int fds[2]) {
+    for (int i = 0; i < 2; i++) {
+        if (fds[i] >= 0) {
+            close(fds[i]);
+            fds[i] = -1;
+        }
+    }
+}
+
+// Start a command without waiting
+bool proc_spawn(char *const argv[], int flags, ProcHandle *handle) {
+    int out_pipe[2] = {-1, -1};
+    int err_pipe[2] = {-1, -1};
+    bool capture_out = (flags & PROC_CAPTURE_STDOUT) != 0;
+    bool capture_err = (flags & PROC_CAPTURE_STDERR) != 0 && (flags & PROC_MERGE_STDERR) == 0;
+
+    handle->pid = -1;
+    handle->out_fd = -1;
+    handle->err_fd = -1;
+
+    if ((capture_out && pipe2(out_pipe, O_CLOEXEC) != 0) ||
+        (capture_err && pipe2(err_pipe, O_CLOEXEC) != 0)) {
+        fprintf(stderr, "Failed to create pipe for %s: %s\n", argv[0], strerror(errno));
+        close_pipe(out_pipe);
+        close_pipe(err_pipe);
+        return false;
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    if (capture_out) {
+        posix_spawn_file_actions_adddup2(&actions, out_pipe[1], STDOUT_FILENO);
+        if (flags & PROC_MERGE_STDERR) {
+            posix_spawn_file_actions_adddup2(&actions, out_pipe[1], STDERR_FILENO);
+        }
+    }
+    if (capture_err) {
+        posix_spawn_file_actions_adddup2(&actions, err_pipe[1], STDERR_FILENO);
+    }
+
+    int rc = posix_spawnp(&handle->pid, argv[0], &actions, NULL, argv, environ);
+    posix_spawn_file_actions_destroy(&actions);
+
+    // The write ends belong to the child now
+    if (out_pipe[1] >= 0) {
+        close(out_pipe[1]);
+    }
+    if (err_pipe[1] >= 0) {
+        close(err_pipe[1]);
+    }
+
+    if (rc != 0) {
+        fprintf(stderr, "Failed to run %s: %s\n", argv[0], strerror(rc));
+        close_pipe(out_pipe);
+        close_pipe(err_pipe);
+        handle->pid = -1;
+        errno = rc;
+        return false;
+    }
+
+    handle->out_fd = out_pipe[0];
+    handle->err_fd = err_pipe[0];
+    return true;
+}
+
+// Read whatever a pipe has; closes it at end of file
+static void drain_pipe(ProcPipe *pipe) {
+    char scratch[4096];
+
+    while (pipe->fd >= 0) {
+        // Read into the buffer while under the limit, drop the rest
+        char *dest = scratch;
+        size_t room = sizeof(scratch);
+        if (pipe->len < PROC_OUTPUT_MAX) {
+            if (pipe->capacity - pipe->len < sizeof(scratch) + 1) {
+                size_t capacity = pipe->capacity > 0 ? pipe->capacity * 2 : 8192;
+                char *data = realloc(pipe->data, capacity);
+                if (data != NULL) {
+                    pipe->data = data;
+                    pipe->capacity = capacity;
+                }
+            }
+            if (pipe->capacity - pipe->len >= sizeof(scratch) + 1) {
+                dest = pipe->data + pipe->len;
+            }
+        }
+
+        ssize_t n = read(pipe->fd, dest, room);
+        if (n > 0) {
+            if (dest != scratch) {
+                pipe->len += n;
+            }
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && errno == EAGAIN) {
+            return;
+        } else {
+            close(pipe->fd);
+            pipe->fd = -1;
+        }
+    }
+}
+
+// Start one job in a free worker slot; the slot stays free if it can't start
+static void start_job(RunningJob *slot, ProcJob *job) {
+    ProcHandle handle;
+
+    unsigned long long span = trace_begin();
+    unsigned long long started_us = monotonic_us();
+    if (!proc_spawn(job->argv, job->flags, &handle)) {
+        return;
+    }
+
+    memset(slot, 0, sizeof(RunningJob));
+    slot->job = job;
+    slot->pid = handle.pid;
+    slot->span = span;
+    slot->started_us = started_us;
+    slot->pipes[0].fd = handle.out_fd;
+    slot->pipes[1].fd = handle.err_fd;
+
+    for (int p = 0; p < 2; p++) {
+        if (slot->pipes[p].fd >= 0) {
+            fcntl(slot->pipes[p].fd, F_SETFL, fcntl(slot->pipes[p].fd, F_GETFL) | O_NONBLOCK);
+        }
+    }
+}
+
+// Hand the captured output of a pipe over to a result field
+static void take_output(ProcPipe *pipe, bool captured, char **out, size_t *out_len) {
+    if (!captured) {
+        free(pipe->data);
+        return;
+    }
+
+    if (pipe->data == NULL) {
+        pipe->data = malloc(1);
+    }
+    if (pipe->data != NULL) {
+        pipe->data[pipe->len] = '\0';
+    }
+    *out = pipe->data;
+    *out_len = pipe->data != NULL ? pipe->len : 0;
+}
+
+// Record a reaped job and free its slot
+static void finish_job(RunningJob *slot, int status) {
+    ProcJob *job = slot->job;
+    int flags = job->flags;
+
+    job->result.status = status;
+    job->result.exit_code = proc_exit_code(status);
+    job->result.elapsed_us = monotonic_us() - slot->started_us;
+    take_output(&slot->pipes[0], (flags & PROC_CAPTURE_STDOUT) != 0,
+                &job->result.out, &job->result.out_len);
+    take_output(&slot->pipes[1], (flags & PROC_CAPTURE_STDERR) && !(flags & PROC_MERGE_STDERR),
+                &job->result.err, &job->result.err_len);
+
+    trace_end(slot->span, "proc", job->argv[0], "exit %d", job->result.exit_code);
+    slot->job = NULL;
+}
+
+// Run independent commands concurrently, at most max_workers at a time
+int proc_run_many(ProcJob *jobs, int count, int max_workers) {
+    if (max_workers < 1) {
+        max_workers = 1;
+    }
+    if (max_workers > count) {
+        max_workers = count > 0 ? count : 1;
+    }
+
+    RunningJob *slots = calloc(max_workers, sizeof(RunningJob));
+    struct pollfd *fds = calloc(max_workers * 2, sizeof(struct pollfd));
+    ProcPipe **fd_pipes = calloc(max_workers * 2, sizeof(ProcPipe *));
+    int next = 0;
+    int active = 0;
+    int succeeded = 0;
+
+    // Jobs that never start keep this result
+    for (int i = 0; i < count; i++) {
+        memset(&jobs[i].result, 0, sizeof(ProcResult));
+        jobs[i].result.status = -1;
+        jobs[i].result.exit_code = -1;
+    }
+
+    if (slots == NULL || fds == NULL || fd_pipes == NULL) {
+        free(slots);
+        free(fds);
+        free(fd_pipes);
+        return 0;
+    }
+
+    while (next < count || active > 0) {
+        // Fill free worker slots
+        for (int w = 0; w < max_workers && next < count; w++) {
+            if (slots[w].job == NULL) {
+                start_job(&slots[w], &jobs[next++]);
+                if (slots[w].job != NULL) {
+                    active++;
+                }
+            }
+        }
+        if (active == 0) {
+            continue;
+        }
+
+        // Wait for output from any running job
+        int nfds = 0;
+        bool pipeless = false;
+        for (int w = 0; w < max_workers; w++) {
+            if (slots[w].job == NULL) {
+                continue;
+            }
+            bool open = false;
+            for (int p = 0; p < 2; p++) {
+                if (slots[w].pipes[p].fd >= 0) {
+                    fds[nfds].fd = slots[w].pipes[p].fd;
+                    fds[nfds].events = POLLIN;
+                    fds[nfds].revents = 0;
+                    fd_pipes[nfds++] = &slots[w].pipes[p];
+                    open = true;
+                }
+            }
+            pipeless = pipeless || !open;
+        }
+
+        if (nfds > 0) {
+            int ready = poll(fds, nfds, pipeless ? PROC_REAP_INTERVAL_MS : -1);
+            for (int i = 0; ready > 0 && i < nfds; i++) {
+                if (fds[i].revents != 0) {
+                    drain_pipe(fd_pipes[i]);
+                }
+            }
+        }
+
+        // Reap jobs whose output is complete. With nothing to poll, block on the first.
+        bool may_block = nfds == 0;
+        for (int w = 0; w < max_workers; w++) {
+            RunningJob *slot = &slots[w];
+            if (slot->job == NULL || slot->pipes[0].fd >= 0 || slot->pipes[1].fd >= 0) {
+                continue;
+            }
+
+            int status;
+            pid_t reaped = waitpid(slot->pid, &status, may_block ? 0 : WNOHANG);
+            may_block = false;
+            if (reaped == 0 || (reaped < 0 && errno == EINTR)) {
+                continue;
+            }
+
+            finish_job(slot, reaped == slot->pid ? status : -1);
+            active--;
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (jobs[i].result.exit_code == 0) {
+            succeeded++;
+        }
+    }
+
+    free(slots);
+    free(fds);
+    free(fd_pipes);
+    return succeeded;
+}
+
+// Run a command and wait for it
+bool proc_run(char *const argv[], int flags, ProcResult *result) {
+    ProcJob job = { .argv = argv, .flags = flags };
+
+    proc_run_many(&job, 1, 1);
+
+    if (result != NULL) {
+        *result = job.result;
+    } else {
+        proc_result_free(&job.result);
+    }
+    return job.result.exit_code == 0;
+}
+
+// Free captured output
+void proc_result_free(ProcResult *result) {
+    free(result->out);
+    free(result->err);
+    result->out = NULL;
+    result->err = NULL;
+    result->out_len = 0;
+    result->err_len = 0;
+}
@@ -0,0 +1,256 @@
+/*
+ * Driver profiles implementation
+ *
+ * Exporting writes one driver database entry per device group and installed
+ * driver. Applying parses the profile with the driver database parser,
+ * indexes it the same way, and looks every detected device up in it: an
+ * entry selects the detected driver with the same packages for a device it
+ * matches. Only the selected drivers that are not installed go into the
+ * transaction, so a satisfied profile costs a scan (usually cached) and a
+ * few hash lookups.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../include/profile.h"
+#include "../include/trace.h"
+
+// Monotonic clock in microseconds
+static unsigned long long monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+// Short name of a status
+const char *profile_status_name(ProfileStatus status) {
+    switch (status) {
+    case PROFILE_NO_HARDWARE: return "no-hardware";
+    case PROFILE_NOT_OFFERED: return "not-offered";
+    case PROFILE_UNAVAILABLE: return "unavailable";
+    case PROFILE_SATISFIED:   return "satisfied";
+    case PROFILE_PENDING:     return "pending";
+    case PROFILE_INSTALLED:   return "installed";
+    case PROFILE_FAILED:      return "failed";
+    }
+    return "unknown";
+}
+
+// Format the match column of an entry the way the parser reads it
+static void format_match(const DriverMapping *entry, char *match, size_t size) {
+    if (entry->vendor_id == DRIVER_DB_ANY_ID) {
+        snprintf(match, size, "*");
+    } else if (entry->device_first == DRIVER_DB_ANY_ID) {
+        snprintf(match, size, "%04x:*", entry->vendor_id);
+    } else if (entry->device_first == entry->device_last) {
+        snprintf(match, size, "%04x:%04x", entry->vendor_id, entry->device_first);
+    } else {
+        snprintf(match, size, "%04x:%04x-%04x", entry->vendor_id, entry->device_first,
+                 entry->device_last);
+    }
+}
+
+// Match column for a device: its PCI IDs, or its type alone when it has none
+static void device_match(const HardwareInfo *hw, char *match, size_t size) {
+    if (hw->bus == HW_BUS_PCI && hw->vendor_id != 0) {
+        snprintf(match, size, "%04x:%04x", hw->vendor_id, hw->device_id);
+    } else {
+        snprintf(match, size, "*");
+    }
+}
+
+// Write a profile of the drivers installed for the detected hardware
+int profile_write(FILE *out, const HardwareInfo *hw_list, int hw_count,
+                  const DriverInfo *drivers, int driver_count) {
+    char host[256] = "";
+    gethostname(host, sizeof(host) - 1);
+
+    fprintf(out, "# System Drivers profile of %s\n", host[0] != '\0' ? host : "this machine");
+    fprintf(out, "#\n");
+    fprintf(out, "# Driver database format (see drivers.conf), one entry per device and\n");
+    fprintf(out, "# installed driver. Apply with: system-drivers-cli --apply-profile <file>\n");
+
+    // Identical IDs in several groups (other subsystem or class) give one line
+    char (*written)[16] = calloc((size_t)hw_count + 1, sizeof(*written));
+    if (written == NULL) {
+        return -1;
+    }
+
+    int count = 0;
+    for (int d = 0; d < driver_count; d++) {
+        const DriverInfo *driver = &drivers[d];
+        if (!driver->is_installed) {
+            continue;
+        }
+
+        int written_count = 0;
+        for (int i = 0; i < hw_count; i++) {
+            const HardwareInfo *hw = &hw_list[i];
+            if (!driver_matches_hardware(driver, hw, 1)) {
+                continue;
+            }
+
+            char match[16];
+            device_match(hw, match, sizeof(match));
+            bool duplicate = false;
+            for (int j = 0; j < written_count && !duplicate; j++) {
+                duplicate = strcmp(written[j], match) == 0;
+            }
+            if (duplicate) {
+                continue;
+            }
+            memcpy(written[written_count++], match, sizeof(match));
+
+            const char *flags = driver->needs_reboot && driver->is_recommended ? "reboot,recommended"
+                              : driver->needs_reboot ? "reboot"
+                              : driver->is_recommended ? "recommended" : "-";
+            fprintf(out, "\n# %s %s\n", hw->vendor, hw->device);
+            fprintf(out, "%s | %s | %s | %s | %s | %s\n", match, driver_db_type_name(hw->type),
+                    flags, driver->package, driver->name,
+                    driver->description[0] != '\0' ? driver->description : driver->name);
+            count++;
+        }
+    }
+
+    free(written);
+    return ferror(out) ? -1 : count;
+}
+
+// Find the detected driver with exactly the packages of an entry
+static DriverInfo *find_driver(DriverInfo *drivers, int driver_count, const char *packages) {
+    for (int i = 0; i < driver_count; i++) {
+        if (strcmp(drivers[i].package, packages) == 0) {
+            return &drivers[i];
+        }
+    }
+    return NULL;
+}
+
+// Pair every entry with a device it matches and the driver it selects there
+static void match_entries(ProfileReport *report, const DriverDbIndex *index,
+                          const HardwareInfo *hw_list, int hw_count,
+                          DriverInfo *drivers, int driver_count) {
+    for (int i = 0; i < hw_count; i++) {
+        const HardwareInfo *hw = &hw_list[i];
+        const DriverMapping *matches[DRIVER_DB_MAX_MATCHES];
+        int match_count = driver_db_index_lookup(index, hw, matches, DRIVER_DB_MAX_MATCHES);
+
+        for (int j = 0; j < match_count; j++) {
+            ProfileItem *item = &report->items[matches[j] - report->file.entries];
+            if (item->driver != NULL) {
+                continue;
+            }
+            if (item->hw == NULL) {
+                item->hw = hw;
+            }
+
+            // Only a driver offered for this very device counts
+            DriverInfo *driver = find_driver(drivers, driver_count, item->entry->package_name);
+            if (driver != NULL && driver_matches_hardware(driver, hw, 1)) {
+                item->hw = hw;
+                item->driver = driver;
+            }
+        }
+    }
+}
+
+// Diff a profile against this machine and install what is missing
+bool profile_apply(const char *path, const HardwareInfo *hw_list, int hw_count,
+                   DriverInfo *drivers, int driver_count, const ProfileApplyOptions *options,
+                   ProfileReport *report) {
+    unsigned long long start = monotonic_us();
+    unsigned long long span = trace_begin();
+    memset(report, 0, sizeof(ProfileReport));
+
+    if (!driver_db_file_load(path, &report->file)) {
+        return false;
+    }
+
+    report->count = report->file.count;
+    report->items = calloc((size_t)report->count + 1, sizeof(ProfileItem));
+    DriverInfo **batch = calloc((size_t)report->count + 1, sizeof(DriverInfo *));
+    if (report->items == NULL || batch == NULL) {
+        free(batch);
+        profile_report_free(report);
+        return false;
+    }
+
+    for (int i = 0; i < report->count; i++) {
+        report->items[i].entry = &report->file.entries[i];
+        format_match(&report->file.entries[i], report->items[i].match,
+                     sizeof(report->items[i].match));
+    }
+
+    if (report->count > 0) {
+        DriverDbIndex index;
+        if (!driver_db_index_build(report->file.entries, report->file.count, &index)) {
+            free(batch);
+            profile_report_free(report);
+            return false;
+        }
+        match_entries(report, &index, hw_list, hw_count, drivers, driver_count);
+        driver_db_index_free(&index);
+    }
+
+    // The diff: entries for hardware here whose driver is missing
+    int satisfied = 0;
+    report->success = true;
+    for (int i = 0; i < report->count; i++) {
+        ProfileItem *item = &report->items[i];
+
+        if (item->hw == NULL) {
+            item->status = PROFILE_NO_HARDWARE;
+        } else if (item->driver == NULL) {
+            item->status = PROFILE_NOT_OFFERED;
+            report->success = false;
+        } else if (item->driver->is_installed) {
+            item->status = PROFILE_SATISFIED;
+            satisfied++;
+        } else if (item->driver->availability == DRIVER_UNAVAILABLE) {
+            item->status = PROFILE_UNAVAILABLE;
+            report->success = false;
+        } else {
+            item->status = PROFILE_PENDING;
+
+            // Several devices may select the same driver
+            bool queued = false;
+            for (int j = 0; j < report->install_count && !queued; j++) {
+                queued = batch[j] == item->driver;
+            }
+            if (!queued) {
+                batch[report->install_count++] = item->driver;
+            }
+        }
+    }
+
+    // One transaction for everything missing, and none when nothing is
+    if (!options->dry_run && report->install_count > 0) {
+        bool installed = options->install != NULL
+            ? options->install(batch, report->install_count, options->user_data)
+            : install_drivers(batch, report->install_count);
+        for (int i = 0; i < report->count; i++) {
+            if (report->items[i].status == PROFILE_PENDING) {
+                report->items[i].status = installed ? PROFILE_INSTALLED : PROFILE_FAILED;
+            }
+        }
+        report->reboot_required = installed && drivers_need_reboot(batch, report->install_count);
+        report->success = report->success && installed;
+    }
+
+    free(batch);
+    report->elapsed_us = monotonic_us() - start;
+    trace_end(span, "profile", "Apply profile", "%d entries, %d satisfied, %d drivers to install%s",
+              report->count, satisfied, report->install_count, options->dry_run ? " (dry run)" : "");
+    return true;
+}
+
+// Free a report
+void profile_report_free(ProfileReport *report) {
+    driver_db_file_free(&report->file);
+    free(report->items);
+    report->items = NULL;
+    report->count = 0;
+}
@@ -0,0 +1,592 @@
+/*
+ * Scan result cache implementation
+ *
+ * File layout (native endianness, the cache never leaves the machine):
+ *   ScanCacheHeader
+ *   char strings[string_table_size]     NUL-terminated, each stored once
+ *   CachedHardware[hw_count]
+ *   CachedDriver[driver_count]
+ *
+ * Records refer to strings by their offset in the string table. Loading
+ * reads the table into the caller's arena in one piece and points the
+ * records' strings into it, so no string is copied or allocated on its own.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/utsname.h>
+#include "../include/scan_cache.h"
+#include "../include/driver_db.h"
+#include "../include/trace.h"
+
+#define SCAN_CACHE_MAGIC "SDRVSCAN"
+
+typedef struct {
+    char magic[8];
+    unsigned int version;
+    unsigned int hw_record_size;       // Catches builds with different structure layouts
+    unsigned int driver_record_size;
+    int hw_count;
+    int driver_count;
+    int has_drivers;
+    unsigned int string_table_size;
+    ScanCacheKeys keys;
+} ScanCacheHeader;
+
+// HardwareInfo on disk; strings are string table offsets
+typedef struct {
+    uint32_t type;
+    uint32_t bus;
+    uint32_t vendor;
+    uint32_t device;
+    uint32_t pci_id;
+    uint32_t modalias;
+    uint32_t vendor_id;
+    uint32_t device_id;
+    uint32_t subsys_vendor_id;
+    uint32_t subsys_device_id;
+    uint32_t class_code;
+    uint32_t count;
+    uint32_t addresses;
+    uint32_t virtual_functions;
+} CachedHardware;
+
+// DriverInfo on disk; strings are string table offsets
+typedef struct {
+    uint32_t name;
+    uint32_t package;
+    uint32_t version;
+    uint32_t description;
+    uint32_t hw_type;
+    uint8_t is_installed;
+    uint8_t is_recommended;
+    uint8_t needs_reboot;
+    uint8_t reserved;
+} CachedDriver;
+
+// String table being built for a save; lookups go through an FNV-1a hash
+typedef struct {
+    char *data;
+    size_t used;
+    size_t size;
+    uint32_t *slots;        // Offset + 1 of the string in data, 0 = empty
+    uint32_t slot_mask;
+    uint32_t count;
+} StringTable;
+
+static char cache_path[256] = SCAN_CACHE_DEFAULT_PATH;
+
+// Use another cache file
+void set_scan_cache_path(const char *path) {
+    strncpy(cache_path, path != NULL ? path : SCAN_CACHE_DEFAULT_PATH, sizeof(cache_path) - 1);
+    cache_path[sizeof(cache_path) - 1] = '\0';
+}
+
+// FNV-1a over a string, continuing from hash
+static unsigned long long hash_string(unsigned long long hash, const char *str) {
+    for (; *str; str++) {
+        hash ^= (unsigned char)*str;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// IDs of one PCI device folded into hash: its modalias holds the vendor,
+// device, subsystem and class IDs, so one read covers them all
+static unsigned long long hash_pci_ids(unsigned long long hash, DIR *devices,
+                                       const char *address) {
+    char path[272];
+    snprintf(path, sizeof(path), "%s/modalias", address);
+
+    char modalias[128] = "";
+    int fd = openat(dirfd(devices), path, O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        ssize_t n = read(fd, modalias, sizeof(modalias) - 1);
+        modalias[n > 0 ? n : 0] = '\0';
+        close(fd);
+    }
+    return hash_string(hash, modalias);
+}
+
+// Order-independent hash of the PCI devices, by address and IDs (readdir
+// order isn't stable, and a swapped card can reuse its slot's address)
+static unsigned long long hash_pci_devices(const char *sysfs_root) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/bus/pci/devices", sysfs_root);
+
+    DIR *dir = opendir(path);
+    if (dir == NULL) {
+        // No sysfs: lspci fallback, never reuse cached hardware
+        return 0;
+    }
+
+    unsigned long long sum = 0;
+    unsigned long long count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        unsigned long long h = hash_string(14695981039346656037ull, entry->d_name);
+        h = hash_pci_ids(hash_string(h, "/"), dir, entry->d_name);
+        // Mix before summing so that permutations of names don't cancel out
+        h ^= h >> 29;
+        h *= 0xbf58476d1ce4e5b9ull;
+        h ^= h >> 32;
+        sum += h;
+        count++;
+    }
+    closedir(dir);
+
+    return sum ^ (count * 0x9e3779b97f4a7c15ull) ^ 1;
+}
+
+// Compute the current invalidation keys
+void scan_cache_compute_keys(ScanCacheKeys *keys) {
+    memset(keys, 0, sizeof(ScanCacheKeys));
+
+    keys->pci_devices = hash_pci_devices(get_sysfs_root());
+
+    struct stat st;
+    if (stat(get_pacman_db_path(), &st) == 0) {
+        keys->pacman_mtime = (unsigned long long)st.st_mtim.tv_sec * 1000000000ull + st.st_mtim.tv_nsec;
+    }
+
+    keys->driver_db = driver_db_fingerprint();
+
+    struct utsname uts;
+    if (uname(&uts) == 0) {
+        snprintf(keys->kernel, sizeof(keys->kernel), "%s", uts.release);
+    }
+}
+
+// Read exactly size bytes
+static bool read_full(int fd, void *buf, size_t size) {
+    char *pos = buf;
+    while (size > 0) {
+        ssize_t n = read(fd, pos, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        pos += n;
+        size -= n;
+    }
+    return true;
+}
+
+// Write exactly size bytes
+static bool write_full(int fd, const void *buf, size_t size) {
+    const char *pos = buf;
+    while (size > 0) {
+        ssize_t n = write(fd, pos, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        pos += n;
+        size -= n;
+    }
+    return true;
+}
+
+// Resolve a string table offset; NULL if it points outside the table
+static const char *table_string(const char *table, unsigned int size, uint32_t offset) {
+    return offset < size ? table + offset : NULL;
+}
+
+// Records are read into the tail of the arena array they are converted into,
+// so no staging buffer is needed: converting front to back, record i is
+// copied out before entry i (which ends before record i + 1 begins) is written
+_Static_assert(sizeof(CachedHardware) <= sizeof(HardwareInfo), "record outgrows HardwareInfo");
+_Static_assert(sizeof(CachedDriver) <= sizeof(DriverInfo), "record outgrows DriverInfo");
+
+// Read the hardware records in place and point their strings into the table
+static bool load_hardware(int fd, const char *table, unsigned int table_size,
+                          HardwareInfo *hw_list, int count) {
+    CachedHardware *records = (CachedHardware *)((char *)hw_list + sizeof(HardwareInfo) * count) -
+                              count;
+    if (!read_full(fd, records, sizeof(CachedHardware) * count)) {
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < count && ok; i++) {
+        CachedHardware rec;
+        memcpy(&rec, &records[i], sizeof(rec));
+        HardwareInfo *hw = &hw_list[i];
+
+        hw->type = rec.type;
+        hw->bus = rec.bus;
+        hw->vendor = table_string(table, table_size, rec.vendor);
+        hw->device = table_string(table, table_size, rec.device);
+        hw->pci_id = table_string(table, table_size, rec.pci_id);
+        hw->modalias = table_string(table, table_size, rec.modalias);
+        hw->vendor_id = rec.vendor_id;
+        hw->device_id = rec.device_id;
+        hw->subsys_vendor_id = rec.subsys_vendor_id;
+        hw->subsys_device_id = rec.subsys_device_id;
+        hw->class_code = rec.class_code;
+        hw->count = (int)rec.count;
+        hw->addresses = table_string(table, table_size, rec.addresses);
+        hw->virtual_functions = (int)rec.virtual_functions;
+
+        ok = hw->vendor != NULL && hw->device != NULL && hw->pci_id != NULL && hw->modalias != NULL &&
+             hw->addresses != NULL && hw->count > 0;
+    }
+
+    return ok;
+}
+
+// Read the driver records in place and point their strings into the table
+static bool load_drivers(int fd, const char *table, unsigned int table_size,
+                         DriverInfo *driver_list, int count) {
+    CachedDriver *records = (CachedDriver *)((char *)driver_list + sizeof(DriverInfo) * count) -
+                            count;
+    if (!read_full(fd, records, sizeof(CachedDriver) * count)) {
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < count && ok; i++) {
+        CachedDriver rec;
+        memcpy(&rec, &records[i], sizeof(rec));
+        DriverInfo *driver = &driver_list[i];
+
+        memset(driver, 0, sizeof(DriverInfo));
+        driver->name = table_string(table, table_size, rec.name);
+        driver->package = table_string(table, table_size, rec.package);
+        driver->version = table_string(table, table_size, rec.version);
+        driver->description = table_string(table, table_size, rec.description);
+        driver->hw_type = rec.hw_type;
+        driver->is_installed = rec.is_installed;
+        driver->is_recommended = rec.is_recommended;
+        driver->needs_reboot = rec.needs_reboot;
+
+        ok = driver->name != NULL && driver->package != NULL &&
+             driver->version != NULL && driver->description != NULL;
+    }
+
+    return ok;
+}
+
+// Load the parts of the cache that are still valid
+ScanCacheStatus scan_cache_load(const char *path, const ScanCacheKeys *keys, Arena *arena,
+                                HardwareInfo **hw_list, int *hw_count,
+                                DriverInfo **driver_list, int *driver_count) {
+    *hw_list = NULL;
+    *hw_count = 0;
+    *driver_list = NULL;
+    *driver_count = 0;
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return SCAN_CACHE_MISS;
+    }
+
+    ScanCacheHeader header;
+    if (!read_full(fd, &header, sizeof(header)) ||
+        memcmp(header.magic, SCAN_CACHE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != SCAN_CACHE_VERSION ||
+        header.hw_record_size != sizeof(CachedHardware) ||
+        header.driver_record_size != sizeof(CachedDriver) ||
+        header.hw_count <= 0 || header.driver_count < 0 || header.string_table_size == 0) {
+        close(fd);
+        return SCAN_CACHE_MISS;
+    }
+
+    // Hardware is valid while the PCI device set and the kernel are unchanged
+    if (keys->pci_devices == 0 || header.keys.pci_devices != keys->pci_devices ||
+        strcmp(header.keys.kernel, keys->kernel) != 0) {
+        close(fd);
+        return SCAN_CACHE_MISS;
+    }
+
+    // A table that doesn't end in NUL could let a string run past its end
+    char *table = arena_alloc(arena, header.string_table_size);
+    if (table == NULL || !read_full(fd, table, header.string_table_size) ||
+        table[header.string_table_size - 1] != '\0') {
+        close(fd);
+        return SCAN_CACHE_MISS;
+    }
+
+    *hw_list = arena_alloc(arena, sizeof(HardwareInfo) * header.hw_count);
+    if (*hw_list == NULL ||
+        !load_hardware(fd, table, header.string_table_size, *hw_list, header.hw_count)) {
+        *hw_list = NULL;
+        close(fd);
+        return SCAN_CACHE_MISS;
+    }
+    *hw_count = header.hw_count;
+
+    // Drivers additionally depend on the installed packages and the driver database
+    if (!header.has_drivers || header.keys.pacman_mtime != keys->pacman_mtime ||
+        header.keys.driver_db != keys->driver_db) {
+        close(fd);
+        return SCAN_CACHE_HARDWARE_ONLY;
+    }
+
+    if (header.driver_count > 0) {
+        *driver_list = arena_alloc(arena, sizeof(DriverInfo) * header.driver_count);
+        if (*driver_list == NULL ||
+            !load_drivers(fd, table, header.string_table_size, *driver_list, header.driver_count)) {
+            *driver_list = NULL;
+            close(fd);
+            return SCAN_CACHE_HARDWARE_ONLY;
+        }
+    }
+    *driver_count = header.driver_count;
+
+    close(fd);
+    return SCAN_CACHE_HIT;
+}
+
+// Create the cache directory if needed
+static bool ensure_cache_dir(const char *path) {
+    char dir[256];
+    strncpy(dir, path, sizeof(dir) - 1);
+    dir[sizeof(dir) - 1] = '\0';
+
+    char *slash = strrchr(dir, '/');
+    if (slash == NULL || slash == dir) {
+        return true;
+    }
+    *slash = '\0';
+
+    return mkdir(dir, 0755) == 0 || errno == EEXIST;
+}
+
+// Free a string table
+static void string_table_free(StringTable *table) {
+    free(table->data);
+    free(table->slots);
+}
+
+// Add a string (once) and return its offset; false when out of memory
+static bool string_table_add(StringTable *table, const char *str, uint32_t *offset) {
+    size_t len = strlen(str);
+
+    // Keep the slots at most half full
+    if (table->count * 2 >= table->slot_mask + 1 || table->slots == NULL) {
+        uint32_t slots = table->slots != NULL ? (table->slot_mask + 1) * 2 : 256;
+        uint32_t *grown = calloc(slots, sizeof(uint32_t));
+        if (grown == NULL) {
+            return false;
+        }
+        for (uint32_t i = 0; table->slots != NULL && i <= table->slot_mask; i++) {
+            if (table->slots[i] != 0) {
+                uint32_t slot = (uint32_t)hash_string(14695981039346656037ull,
+                                                      table->data + table->slots[i] - 1) & (slots - 1);
+                while (grown[slot] != 0) {
+                    slot = (slot + 1) & (slots - 1);
+                }
+                grown[slot] = table->slots[i];
+            }
+        }
+        free(table->slots);
+        table->slots = grown;
+        table->slot_mask = slots - 1;
+    }
+
+    uint32_t slot = (uint32_t)hash_string(14695981039346656037ull, str) & table->slot_mask;
+    while (table->slots[slot] != 0) {
+        if (strcmp(table->data + table->slots[slot] - 1, str) == 0) {
+            *offset = table->slots[slot] - 1;
+            return true;
+        }
+        slot = (slot + 1) & table->slot_mask;
+    }
+
+    if (table->used + len + 1 > table->size) {
+        size_t size = table->size > 0 ? table->size * 2 : 4096;
+        while (table->used + len + 1 > size) {
+            size *= 2;
+        }
+        char *data = realloc(table->data, size);
+        if (data == NULL) {
+            return false;
+        }
+        table->data = data;
+        table->size = size;
+    }
+
+    *offset = table->used;
+    memcpy(table->data + table->used, str, len + 1);
+    table->used += len + 1;
+    table->slots[slot] = *offset + 1;
+    table->count++;
+    return true;
+}
+
+// Turn the lists into on-disk records that share one string table
+static bool build_records(StringTable *table,
+                          const HardwareInfo *hw_list, int hw_count, CachedHardware *hw_records,
+                          const DriverInfo *driver_list, int driver_count, CachedDriver *driver_records) {
+    for (int i = 0; i < hw_count; i++) {
+        const HardwareInfo *hw = &hw_list[i];
+        CachedHardware *rec = &hw_records[i];
+
+        memset(rec, 0, sizeof(CachedHardware));
+        rec->type = hw->type;
+        rec->bus = hw->bus;
+        rec->vendor_id = hw->vendor_id;
+        rec->device_id = hw->device_id;
+        rec->subsys_vendor_id = hw->subsys_vendor_id;
+        rec->subsys_device_id = hw->subsys_device_id;
+        rec->class_code = hw->class_code;
+        rec->count = (uint32_t)hw->count;
+        rec->virtual_functions = (uint32_t)hw->virtual_functions;
+        if (!string_table_add(table, hw->vendor, &rec->vendor) ||
+            !string_table_add(table, hw->device, &rec->device) ||
+            !string_table_add(table, hw->pci_id, &rec->pci_id) ||
+            !string_table_add(table, hw->modalias, &rec->modalias) ||
+            !string_table_add(table, hw->addresses, &rec->addresses)) {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < driver_count; i++) {
+        const DriverInfo *driver = &driver_list[i];
+        CachedDriver *rec = &driver_records[i];
+
+        memset(rec, 0, sizeof(CachedDriver));
+        rec->hw_type = driver->hw_type;
+        rec->is_installed = driver->is_installed;
+        rec->is_recommended = driver->is_recommended;
+        rec->needs_reboot = driver->needs_reboot;
+        if (!string_table_add(table, driver->name, &rec->name) ||
+            !string_table_add(table, driver->package, &rec->package) ||
+            !string_table_add(table, driver->version, &rec->version) ||
+            !string_table_add(table, driver->description, &rec->description)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Write results and their keys to the cache
+bool scan_cache_save(const char *path, const ScanCacheKeys *keys,
+                     const HardwareInfo *hw_list, int hw_count,
+                     const DriverInfo *driver_list, int driver_count) {
+    if (hw_count <= 0 || !ensure_cache_dir(path)) {
+        return false;
+    }
+
+    ScanCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SCAN_CACHE_MAGIC, sizeof(header.magic));
+    header.version = SCAN_CACHE_VERSION;
+    header.hw_record_size = sizeof(CachedHardware);
+    header.driver_record_size = sizeof(CachedDriver);
+    header.hw_count = hw_count;
+    header.driver_count = driver_count > 0 ? driver_count : 0;
+    header.has_drivers = driver_count >= 0;
+    header.keys = *keys;
+
+    StringTable table;
+    memset(&table, 0, sizeof(table));
+    CachedHardware *hw_records = malloc(sizeof(CachedHardware) * hw_count);
+    CachedDriver *driver_records = malloc(sizeof(CachedDriver) * (header.driver_count + 1));
+    if (hw_records == NULL || driver_records == NULL ||
+        !build_records(&table, hw_list, hw_count, hw_records,
+                       driver_list, header.driver_count, driver_records)) {
+        string_table_free(&table);
+        free(hw_records);
+        free(driver_records);
+        return false;
+    }
+    header.string_table_size = table.used;
+
+    // Write to a temporary file and rename, so readers never see a partial cache
+    char tmp_path[300];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%d.tmp", path, (int)getpid());
+
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    bool ok = fd >= 0 &&
+              write_full(fd, &header, sizeof(header)) &&
+              write_full(fd, table.data, table.used) &&
+              write_full(fd, hw_records, sizeof(CachedHardware) * hw_count) &&
+              write_full(fd, driver_records, sizeof(CachedDriver) * header.driver_count);
+
+    string_table_free(&table);
+    free(hw_records);
+    free(driver_records);
+    if (fd < 0) {
+        return false;
+    }
+
+    ok = close(fd) == 0 && ok;
+    if (ok) {
+        ok = rename(tmp_path, path) == 0;
+    }
+    if (!ok) {
+        unlink(tmp_path);
+    }
+
+    return ok;
+}
+
+// Scan hardware and detect drivers, reusing whatever the cache still has valid
+int scan_and_detect_cached(Arena *arena, HardwareInfo **hw_list, int *hw_count,
+                           DriverInfo **driver_list) {
+    if (cache_path[0] == '\0') {
+        *hw_count = scan_hardware(arena, hw_list);
+        return *hw_count > 0 ? detect_drivers(arena, *hw_list, *hw_count, driver_list) : 0;
+    }
+
+    unsigned long long span = trace_begin();
+    ScanCacheKeys keys;
+    scan_cache_compute_keys(&keys);
+
+    int driver_count = 0;
+    ScanCacheStatus status = scan_cache_load(cache_path, &keys, arena, hw_list, hw_count,
+                                             driver_list, &driver_count);
+    trace_end(span, "scan", "Scan cache lookup", "%s",
+              status == SCAN_CACHE_HIT ? "hit" :
+              status == SCAN_CACHE_HARDWARE_ONLY ? "hardware only" : "miss");
+
+    if (status == SCAN_CACHE_HIT) {
+        printf("Using cached scan results: %d device groups, %d drivers\n", *hw_count, driver_count);
+
+        // Not cached: the sync databases change without invalidating the cache
+        annotate_driver_availability(arena, *driver_list, driver_count);
+        return driver_count;
+    }
+
+    if (status == SCAN_CACHE_MISS) {
+        *hw_count = scan_hardware(arena, hw_list);
+    } else {
+        printf("Using cached hardware list: %d device groups\n", *hw_count);
+    }
+
+    if (*hw_count <= 0) {
+        *driver_list = NULL;
+        return 0;
+    }
+
+    driver_count = detect_drivers(arena, *hw_list, *hw_count, driver_list);
+
+    // Installed packages may have been read after the keys were taken; recompute
+    // so a package change during detection invalidates rather than hides itself
+    ScanCacheKeys after;
+    scan_cache_compute_keys(&after);
+    if (after.pacman_mtime == keys.pacman_mtime &&
+        !scan_cache_save(cache_path, &keys, *hw_list, *hw_count, *driver_list, driver_count)) {
+        // Not being able to cache (e.g. not root) only costs speed
+        fprintf(stderr, "Could not write scan cache %s\n", cache_path);
+    }
+
+    return driver_count;
+}
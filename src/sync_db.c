@@ -0,0 +1,620 @@
+/*
+ * Pacman sync database index implementation
+ *
+ * A sync database (<dbpath>/sync/<repo>.db) is a gzip-compressed tar with one
+ * <name>-<version>/desc file per package. Each repository is streamed through
+ * zlib the first time a lookup needs it; only the fields the driver list
+ * shows are kept, in a per-repository arena with an open addressing index.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <zlib.h>
+#include "../include/sync_db.h"
+#include "../include/arena.h"
+#include "../include/trace.h"
+
+// Tar block size; headers and padded contents come in multiples of it
+#define TAR_BLOCK 512
+
+// Largest desc file read; bigger entries are skipped
+#define DESC_MAX (64 * 1024)
+
+// Most %PROVIDES% entries indexed per package
+#define PROVIDES_MAX 32
+
+// One name a repository answers to
+typedef struct {
+    uint32_t hash;
+    bool provided;              // name is provided by package, not its own name
+    const char *name;
+    const char *package;
+    const char *version;
+    unsigned long long download_size;
+    unsigned long long installed_size;
+} SyncEntry;
+
+typedef struct {
+    char name[64];
+    char path[PATH_MAX];
+
+    // The file as last seen, to notice syncs
+    bool exists;
+    struct timespec mtime;
+    off_t size;
+
+    bool loaded;                // Read since the file last changed (maybe unsuccessfully)
+    bool readable;
+    Arena *arena;               // Strings of the entries
+    SyncEntry *entries;
+    int count;
+    int capacity;
+
+    // Open addressing table of entry indices (-1 = empty), size is a power of two
+    int *slots;
+    uint32_t slot_mask;
+} SyncRepo;
+
+struct SyncDb {
+    SyncRepo *repos;            // In search order
+    int repo_count;
+};
+
+// FNV-1a hash of a package name
+static uint32_t hash_name(const char *name) {
+    uint32_t hash = 2166136261u;
+    while (*name) {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Record the file's identity; returns whether it changed
+static bool stat_repo(SyncRepo *repo) {
+    struct stat st;
+    bool exists = stat(repo->path, &st) == 0;
+    bool changed = exists != repo->exists ||
+                   (exists && (st.st_size != repo->size ||
+                               st.st_mtim.tv_sec != repo->mtime.tv_sec ||
+                               st.st_mtim.tv_nsec != repo->mtime.tv_nsec));
+
+    repo->exists = exists;
+    if (exists) {
+        repo->size = st.st_size;
+        repo->mtime = st.st_mtim;
+    }
+    return changed;
+}
+
+// Forget what was read from a repository
+static void clear_repo(SyncRepo *repo) {
+    arena_destroy(repo->arena);
+    free(repo->entries);
+    free(repo->slots);
+    repo->arena = NULL;
+    repo->entries = NULL;
+    repo->slots = NULL;
+    repo->count = 0;
+    repo->capacity = 0;
+    repo->loaded = false;
+    repo->readable = false;
+}
+
+// Add an entry for a name
+static bool add_entry(SyncRepo *repo, const SyncEntry *entry) {
+    if (repo->count >= repo->capacity) {
+        int new_capacity = repo->capacity > 0 ? repo->capacity * 2 : 1024;
+        SyncEntry *new_entries = realloc(repo->entries, sizeof(SyncEntry) * new_capacity);
+        if (new_entries == NULL) {
+            return false;
+        }
+        repo->entries = new_entries;
+        repo->capacity = new_capacity;
+    }
+
+    repo->entries[repo->count] = *entry;
+    repo->entries[repo->count].hash = hash_name(entry->name);
+    repo->count++;
+    return true;
+}
+
+// Index one desc file: the package and everything it provides
+static bool parse_desc(SyncRepo *repo, char *desc) {
+    SyncEntry entry;
+    const char *provides[PROVIDES_MAX];
+    int provide_count = 0;
+    const char *key = "";
+
+    memset(&entry, 0, sizeof(entry));
+
+    for (char *line = desc; line != NULL && *line != '\0'; ) {
+        char *next = strchr(line, '\n');
+        if (next != NULL) {
+            *next++ = '\0';
+        }
+
+        size_t len = strlen(line);
+        if (len == 0) {
+            key = "";
+        } else if (line[0] == '%' && line[len - 1] == '%') {
+            key = line;
+        } else if (strcmp(key, "%NAME%") == 0) {
+            entry.name = arena_intern(repo->arena, line);
+        } else if (strcmp(key, "%VERSION%") == 0) {
+            entry.version = arena_intern(repo->arena, line);
+        } else if (strcmp(key, "%CSIZE%") == 0) {
+            entry.download_size = strtoull(line, NULL, 10);
+        } else if (strcmp(key, "%ISIZE%") == 0) {
+            entry.installed_size = strtoull(line, NULL, 10);
+        } else if (strcmp(key, "%PROVIDES%") == 0 && provide_count < PROVIDES_MAX) {
+            // "name=version" or a bare name; only the name is looked up
+            provides[provide_count++] = arena_intern_len(repo->arena, line, strcspn(line, "=<>"));
+        }
+        line = next;
+    }
+
+    if (entry.name == NULL || entry.version == NULL) {
+        return true;
+    }
+
+    entry.package = entry.name;
+    if (!add_entry(repo, &entry)) {
+        return false;
+    }
+
+    for (int i = 0; i < provide_count; i++) {
+        entry.name = provides[i];
+        entry.provided = true;
+        if (!add_entry(repo, &entry)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Build the hash index once all entries are read
+static bool build_index(SyncRepo *repo) {
+    uint32_t size = 16;
+    while (size < (uint32_t)repo->count * 2) {
+        size *= 2;
+    }
+
+    repo->slots = malloc(sizeof(int) * size);
+    if (repo->slots == NULL) {
+        return false;
+    }
+    memset(repo->slots, 0xff, sizeof(int) * size);
+    repo->slot_mask = size - 1;
+
+    for (int i = 0; i < repo->count; i++) {
+        uint32_t slot = repo->entries[i].hash & repo->slot_mask;
+        while (repo->slots[slot] >= 0) {
+            slot = (slot + 1) & repo->slot_mask;
+        }
+        repo->slots[slot] = i;
+    }
+    return true;
+}
+
+// Get the size field of a tar header (octal)
+static unsigned long long tar_entry_size(const unsigned char *header) {
+    unsigned long long size = 0;
+    for (int i = 124; i < 136 && header[i] >= '0' && header[i] <= '7'; i++) {
+        size = size * 8 + (header[i] - '0');
+    }
+    return size;
+}
+
+// Check for the zero block that ends an archive
+static bool is_end_block(const unsigned char *header) {
+    for (int i = 0; i < TAR_BLOCK; i++) {
+        if (header[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Stream the archive and index every desc file; false on a read error
+static bool read_archive(SyncRepo *repo, gzFile gz, char *content) {
+    unsigned char header[TAR_BLOCK];
+
+    while (gzread(gz, header, TAR_BLOCK) == TAR_BLOCK && !is_end_block(header)) {
+        unsigned long long size = tar_entry_size(header);
+        unsigned long long padded = (size + TAR_BLOCK - 1) / TAR_BLOCK * TAR_BLOCK;
+        char type = header[156];
+
+        // Only desc files start with %FILENAME%/%NAME%, so names need no checking;
+        // pax headers, directories and other files are skipped the same way
+        if ((type == '0' || type == '\0') && size <= DESC_MAX) {
+            if (gzread(gz, content, padded) != (int)padded) {
+                return false;
+            }
+            content[size] = '\0';
+            if (strstr(content, "%NAME%\n") != NULL && !parse_desc(repo, content)) {
+                return false;
+            }
+            continue;
+        }
+
+        while (padded > 0) {
+            unsigned int chunk = padded < DESC_MAX ? (unsigned int)padded : DESC_MAX;
+            if (gzread(gz, content, chunk) != (int)chunk) {
+                return false;
+            }
+            padded -= chunk;
+        }
+    }
+
+    int error = Z_OK;
+    gzerror(gz, &error);
+    return error == Z_OK || error == Z_STREAM_END;
+}
+
+// Check the compression: zlib reads gzip and plain tar, nothing else
+static bool is_supported_format(const char *path, const char **format) {
+    unsigned char magic[4] = { 0 };
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        *format = "unreadable";
+        return false;
+    }
+    size_t len = fread(magic, 1, sizeof(magic), fp);
+    fclose(fp);
+
+    if (len >= 4 && magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd) {
+        *format = "zstd";
+    } else if (len >= 4 && magic[0] == 0xfd && magic[1] == '7' && magic[2] == 'z' && magic[3] == 'X') {
+        *format = "xz";
+    } else if (len >= 3 && magic[0] == 'B' && magic[1] == 'Z' && magic[2] == 'h') {
+        *format = "bzip2";
+    } else {
+        return true;
+    }
+    return false;
+}
+
+// Read and index one repository
+static void load_repo(SyncRepo *repo) {
+    unsigned long long span = trace_begin();
+    const char *format = "gzip";
+
+    repo->loaded = true;
+    repo->readable = false;
+    if (!repo->exists) {
+        trace_end(span, "pacman", "Read sync database", "%s: missing", repo->name);
+        return;
+    }
+    if (!is_supported_format(repo->path, &format)) {
+        fprintf(stderr, "Sync database %s is %s, not indexed\n", repo->path, format);
+        trace_end(span, "pacman", "Read sync database", "%s: %s", repo->name, format);
+        return;
+    }
+
+    gzFile gz = gzopen(repo->path, "rb");
+    char *content = malloc(DESC_MAX + TAR_BLOCK + 1);
+    repo->arena = arena_create();
+    bool ok = gz != NULL && content != NULL && repo->arena != NULL;
+
+    if (ok) {
+        gzbuffer(gz, 128 * 1024);
+        ok = read_archive(repo, gz, content) && build_index(repo);
+    }
+    if (gz != NULL) {
+        gzclose(gz);
+    }
+    free(content);
+
+    if (!ok) {
+        fprintf(stderr, "Could not read sync database %s\n", repo->path);
+        clear_repo(repo);
+        repo->loaded = true;
+        trace_end(span, "pacman", "Read sync database", "%s: unreadable", repo->name);
+        return;
+    }
+
+    repo->readable = true;
+    trace_end(span, "pacman", "Read sync database", "%s: %d names", repo->name, repo->count);
+}
+
+// Find a name in a repository: the package itself, or a provider
+static const SyncEntry *find_in_repo(const SyncRepo *repo, const char *name, uint32_t hash,
+                                     bool provided) {
+    uint32_t slot = hash & repo->slot_mask;
+
+    while (repo->slots[slot] >= 0) {
+        const SyncEntry *entry = &repo->entries[repo->slots[slot]];
+        if (entry->hash == hash && entry->provided == provided && strcmp(entry->name, name) == 0) {
+            return entry;
+        }
+        slot = (slot + 1) & repo->slot_mask;
+    }
+    return NULL;
+}
+
+// Append a repository to the search order
+static bool add_repo(SyncDb *db, const char *sync_dir, const char *name, size_t len) {
+    if (len == 0 || len >= sizeof(db->repos[0].name)) {
+        return true;
+    }
+
+    SyncRepo *repos = realloc(db->repos, sizeof(SyncRepo) * (db->repo_count + 1));
+    if (repos == NULL) {
+        return false;
+    }
+    db->repos = repos;
+
+    SyncRepo *repo = &db->repos[db->repo_count++];
+    memset(repo, 0, sizeof(SyncRepo));
+    memcpy(repo->name, name, len);
+    snprintf(repo->path, sizeof(repo->path), "%s/%s.db", sync_dir, repo->name);
+    stat_repo(repo);
+    return true;
+}
+
+// Take the repositories from pacman.conf's sections, in order; false if unreadable
+static bool read_conf_repos(SyncDb *db, const char *sync_dir, const char *pacman_conf) {
+    FILE *fp = fopen(pacman_conf, "r");
+    if (fp == NULL) {
+        return false;
+    }
+
+    char line[512];
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        char *start = line + strspn(line, " \t");
+        size_t len = strcspn(start, "\r\n");
+        while (len > 0 && isspace((unsigned char)start[len - 1])) {
+            len--;
+        }
+
+        if (len > 2 && start[0] == '[' && start[len - 1] == ']' &&
+            strncmp(start, "[options]", len) != 0) {
+            add_repo(db, sync_dir, start + 1, len - 2);
+        }
+    }
+
+    fclose(fp);
+    return true;
+}
+
+// Select *.db files
+static int is_db_file(const struct dirent *entry) {
+    size_t len = strlen(entry->d_name);
+    return entry->d_name[0] != '.' && len > 3 && strcmp(entry->d_name + len - 3, ".db") == 0;
+}
+
+// Open the index of the configured repositories
+SyncDb *sync_db_open(const char *sync_dir, const char *pacman_conf) {
+    SyncDb *db = calloc(1, sizeof(SyncDb));
+    if (db == NULL) {
+        return NULL;
+    }
+
+    if (read_conf_repos(db, sync_dir, pacman_conf)) {
+        return db;
+    }
+
+    // No configuration: every database there is, in a stable order
+    struct dirent **entries;
+    int count = scandir(sync_dir, &entries, is_db_file, alphasort);
+    for (int i = 0; i < count; i++) {
+        add_repo(db, sync_dir, entries[i]->d_name, strlen(entries[i]->d_name) - 3);
+        free(entries[i]);
+    }
+    if (count >= 0) {
+        free(entries);
+    }
+    return db;
+}
+
+// Notice synced databases
+void sync_db_refresh(SyncDb *db) {
+    for (int i = 0; db != NULL && i < db->repo_count; i++) {
+        if (stat_repo(&db->repos[i])) {
+            clear_repo(&db->repos[i]);
+        }
+    }
+}
+
+// Look a package up like pacman -S does
+SyncDbLookup sync_db_find(SyncDb *db, const char *name, SyncPackage *pkg) {
+    if (db == NULL || db->repo_count == 0) {
+        return SYNC_DB_UNKNOWN;
+    }
+
+    uint32_t hash = hash_name(name);
+    bool unknown = false;
+
+    // Repositories are read one at a time, so a package from the first is
+    // found without decompressing the rest
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < db->repo_count; i++) {
+            SyncRepo *repo = &db->repos[i];
+            if (!repo->loaded) {
+                load_repo(repo);
+            }
+            if (!repo->readable) {
+                unknown = true;
+                continue;
+            }
+
+            const SyncEntry *entry = find_in_repo(repo, name, hash, pass == 1);
+            if (entry != NULL) {
+                pkg->repo = repo->name;
+                pkg->name = entry->package;
+                pkg->version = entry->version;
+                pkg->download_size = entry->download_size;
+                pkg->installed_size = entry->installed_size;
+                return SYNC_DB_FOUND;
+            }
+        }
+    }
+
+    return unknown ? SYNC_DB_UNKNOWN : SYNC_DB_MISSING;
+}
+
+// Number of repositories read so far
+int sync_db_loaded_count(const SyncDb *db) {
+    int loaded = 0;
+    for (int i = 0; db != NULL && i < db->repo_count; i++) {
+        loaded += db->repos[i].loaded && db->repos[i].readable;
+    }
+    return loaded;
+}
+
+// Free the index
+void sync_db_free(SyncDb *db) {
+    if (db == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < db->repo_count; i++) {
+        clear_repo(&db->repos[i]);
+    }
+    free(db->repos);
+    free(db);
+}
+
+// Compare one version component the way rpmvercmp() does: runs of digits
+// numerically, runs of letters alphabetically, letters older than digits
+static int compare_segments(const char *a, const char *b) {
+    if (strcmp(a, b) == 0) {
+        return 0;
+    }
+
+    const char *one = a;
+    const char *two = b;
+
+    while (*one != '\0' && *two != '\0') {
+        const char *sep1 = one;
+        const char *sep2 = two;
+        while (*one != '\0' && !isalnum((unsigned char)*one)) {
+            one++;
+        }
+        while (*two != '\0' && !isalnum((unsigned char)*two)) {
+            two++;
+        }
+        if (*one == '\0' || *two == '\0') {
+            break;
+        }
+
+        // Different separator lengths decide on their own
+        if (one - sep1 != two - sep2) {
+            return one - sep1 < two - sep2 ? -1 : 1;
+        }
+
+        const char *end1 = one;
+        const char *end2 = two;
+        bool numeric = isdigit((unsigned char)*one);
+        if (numeric) {
+            while (isdigit((unsigned char)*end1)) {
+                end1++;
+            }
+            while (isdigit((unsigned char)*end2)) {
+                end2++;
+            }
+        } else {
+            while (isalpha((unsigned char)*end1)) {
+                end1++;
+            }
+            while (isalpha((unsigned char)*end2)) {
+                end2++;
+            }
+        }
+
+        // A number against letters: the number is newer
+        if (end2 == two) {
+            return numeric ? 1 : -1;
+        }
+
+        if (numeric) {
+            while (*one == '0' && one < end1 - 1) {
+                one++;
+            }
+            while (*two == '0' && two < end2 - 1) {
+                two++;
+            }
+            if (end1 - one != end2 - two) {
+                return end1 - one > end2 - two ? 1 : -1;
+            }
+        }
+
+        size_t len1 = end1 - one;
+        size_t len2 = end2 - two;
+        int rc = memcmp(one, two, len1 < len2 ? len1 : len2);
+        if (rc != 0) {
+            return rc < 0 ? -1 : 1;
+        }
+        if (len1 != len2) {
+            return len1 < len2 ? -1 : 1;
+        }
+
+        one = end1;
+        two = end2;
+    }
+
+    if (*one == '\0' && *two == '\0') {
+        return 0;
+    }
+
+    // "1.0" < "1.0.1" but "1.0alpha" < "1.0"
+    return ((*one == '\0' && !isalpha((unsigned char)*two)) || isalpha((unsigned char)*one)) ? -1 : 1;
+}
+
+// Split [epoch:]version[-release] in place
+static void split_evr(char *evr, const char **epoch, const char **version, const char **release) {
+    char *s = evr;
+    while (isdigit((unsigned char)*s)) {
+        s++;
+    }
+    char *dash = strrchr(s, '-');
+
+    if (*s == ':') {
+        *s++ = '\0';
+        *epoch = evr[0] != '\0' ? evr : "0";
+        *version = s;
+    } else {
+        *epoch = "0";
+        *version = evr;
+    }
+
+    if (dash != NULL) {
+        *dash = '\0';
+        *release = dash + 1;
+    } else {
+        *release = NULL;
+    }
+}
+
+// Compare two package versions like vercmp(8)
+int pacman_vercmp(const char *a, const char *b) {
+    if (strcmp(a, b) == 0) {
+        return 0;
+    }
+
+    char full1[256], full2[256];
+    const char *epoch1, *version1, *release1;
+    const char *epoch2, *version2, *release2;
+
+    snprintf(full1, sizeof(full1), "%s", a);
+    snprintf(full2, sizeof(full2), "%s", b);
+    split_evr(full1, &epoch1, &version1, &release1);
+    split_evr(full2, &epoch2, &version2, &release2);
+
+    int result = compare_segments(epoch1, epoch2);
+    if (result == 0) {
+        result = compare_segments(version1, version2);
+        // A missing release matches any release
+        if (result == 0 && release1 != NULL && release2 != NULL) {
+            result = compare_segments(release1, release2);
+        }
+    }
+    return result;
+}
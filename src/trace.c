@@ -0,0 +1,125 @@
+/*
+ * Phase tracing implementation
+ *
+ * Spans are written as Chrome trace-event "complete" events, one per
+ * line, as soon as they end; nothing is buffered in memory.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include "../include/trace.h"
+
+bool trace_active = false;
+
+static FILE *trace_file = NULL;
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long long trace_origin = 0;
+
+// Monotonic clock in microseconds
+static unsigned long long monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000ULL + (unsigned long long)ts.tv_nsec / 1000ULL;
+}
+
+// Current trace clock in microseconds (never 0)
+unsigned long long trace_now(void) {
+    return monotonic_us() - trace_origin + 1;
+}
+
+// Write a JSON string literal
+static void write_json_string(FILE *out, const char *str) {
+    fputc('"', out);
+    for (const unsigned char *p = (const unsigned char *)str; *p != '\0'; p++) {
+        if (*p == '"' || *p == '\\') {
+            fputc('\\', out);
+            fputc(*p, out);
+        } else if (*p < 0x20) {
+            fprintf(out, "\\u%04x", *p);
+        } else {
+            fputc(*p, out);
+        }
+    }
+    fputc('"', out);
+}
+
+// Start writing a trace to a file
+bool trace_init(const char *path) {
+    if (path == NULL) {
+        path = getenv(TRACE_ENV);
+    }
+    if (path == NULL || path[0] == '\0' || trace_file != NULL) {
+        return false;
+    }
+
+    trace_file = fopen(path, "w");
+    if (trace_file == NULL) {
+        fprintf(stderr, "Could not open trace file %s\n", path);
+        return false;
+    }
+
+    trace_origin = monotonic_us();
+    fprintf(trace_file, "{\"traceEvents\": [\n");
+    fprintf(trace_file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, \"args\": {\"name\": \"system-drivers\"}}",
+            (int)getpid());
+
+    trace_active = true;
+    atexit(trace_shutdown);
+
+    printf("Tracing to %s\n", path);
+    return true;
+}
+
+// Finish the trace file
+void trace_shutdown(void) {
+    pthread_mutex_lock(&trace_lock);
+    if (trace_file != NULL) {
+        trace_active = false;
+        fprintf(trace_file, "\n], \"displayTimeUnit\": \"ms\"}\n");
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+    pthread_mutex_unlock(&trace_lock);
+}
+
+// Record a span that started at `start` and ends now
+void trace_end(unsigned long long start, const char *category, const char *name,
+               const char *detail_format, ...) {
+    if (start == 0) {
+        return;
+    }
+
+    unsigned long long end = trace_now();
+    char detail[256] = "";
+
+    if (detail_format != NULL) {
+        va_list args;
+        va_start(args, detail_format);
+        vsnprintf(detail, sizeof(detail), detail_format, args);
+        va_end(args);
+    }
+
+    pthread_mutex_lock(&trace_lock);
+    if (trace_file != NULL) {
+        fprintf(trace_file, ",\n{\"ph\": \"X\", \"pid\": %d, \"tid\": %ld, \"ts\": %llu, \"dur\": %llu, \"cat\": ",
+                (int)getpid(), (long)syscall(SYS_gettid), start, end - start);
+        write_json_string(trace_file, category);
+        fputs(", \"name\": ", trace_file);
+        write_json_string(trace_file, name);
+        if (detail[0] != '\0') {
+            fputs(", \"args\": {\"detail\": ", trace_file);
+            write_json_string(trace_file, detail);
+            fputc('}', trace_file);
+        }
+        fputc('}', trace_file);
+        // Keep what was traced so far if the process dies
+        fflush(trace_file);
+    }
+    pthread_mutex_unlock(&trace_lock);
+}
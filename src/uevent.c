@@ -0,0 +1,222 @@
+/*
+ * Kernel uevent (hotplug) implementation
+ *
+ * Listens to the kernel's NETLINK_KOBJECT_UEVENT multicast group directly,
+ * so no udev library is needed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <linux/netlink.h>
+#include "../include/uevent.h"
+
+// Kernel (not udevd) multicast group
+#define UEVENT_KERNEL_GROUP 1
+
+// USB interface classes we map to hardware types
+#define USB_CLASS_AUDIO     0x01
+#define USB_CLASS_COMM      0x02
+#define USB_CLASS_WIRELESS  0xe0
+
+// Copy a value into a fixed field
+static void copy_field(char *dest, size_t size, const char *value) {
+    strncpy(dest, value, size - 1);
+    dest[size - 1] = '\0';
+}
+
+// Parse a kernel uevent message
+bool uevent_parse(const char *buf, size_t len, Uevent *event) {
+    memset(event, 0, sizeof(Uevent));
+    event->action = UEVENT_OTHER;
+
+    // The header "action@devpath" must be there and the message NUL-terminated
+    if (len == 0 || buf[len - 1] != '\0' || strchr(buf, '@') == NULL) {
+        return false;
+    }
+
+    bool has_action = false;
+    for (const char *pos = buf + strlen(buf) + 1; pos < buf + len; pos += strlen(pos) + 1) {
+        const char *eq = strchr(pos, '=');
+        if (eq == NULL) {
+            continue;
+        }
+
+        size_t key_len = eq - pos;
+        const char *value = eq + 1;
+
+        if (key_len == 6 && strncmp(pos, "ACTION", 6) == 0) {
+            has_action = true;
+            if (strcmp(value, "add") == 0) {
+                event->action = UEVENT_ADD;
+            } else if (strcmp(value, "remove") == 0) {
+                event->action = UEVENT_REMOVE;
+            } else if (strcmp(value, "change") == 0) {
+                event->action = UEVENT_CHANGE;
+            } else if (strcmp(value, "bind") == 0) {
+                event->action = UEVENT_BIND;
+            } else if (strcmp(value, "unbind") == 0) {
+                event->action = UEVENT_UNBIND;
+            }
+        } else if (key_len == 9 && strncmp(pos, "SUBSYSTEM", 9) == 0) {
+            copy_field(event->subsystem, sizeof(event->subsystem), value);
+        } else if (key_len == 7 && strncmp(pos, "DEVTYPE", 7) == 0) {
+            copy_field(event->devtype, sizeof(event->devtype), value);
+        } else if (key_len == 7 && strncmp(pos, "DEVPATH", 7) == 0) {
+            copy_field(event->devpath, sizeof(event->devpath), value);
+        } else if (key_len == 13 && strncmp(pos, "PCI_SLOT_NAME", 13) == 0) {
+            copy_field(event->pci_slot, sizeof(event->pci_slot), value);
+        } else if (key_len == 7 && strncmp(pos, "PRODUCT", 7) == 0) {
+            copy_field(event->product, sizeof(event->product), value);
+        } else if (key_len == 9 && strncmp(pos, "INTERFACE", 9) == 0) {
+            copy_field(event->interface, sizeof(event->interface), value);
+        } else if (key_len == 8 && strncmp(pos, "MODALIAS", 8) == 0) {
+            copy_field(event->modalias, sizeof(event->modalias), value);
+        }
+    }
+
+    return has_action && event->subsystem[0] != '\0' && event->devpath[0] != '\0';
+}
+
+// Open a netlink socket subscribed to kernel uevents
+int uevent_socket_open(void) {
+    int fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = UEVENT_KERNEL_GROUP;
+
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+// Receive and parse one pending uevent
+bool uevent_socket_receive(int fd, Uevent *event) {
+    char buf[UEVENT_BUFFER_SIZE];
+    struct sockaddr_nl sender;
+    struct iovec iov = {buf, sizeof(buf) - 1};
+    struct msghdr msg;
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = &sender;
+    msg.msg_namelen = sizeof(sender);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    ssize_t len = recvmsg(fd, &msg, 0);
+    if (len <= 0) {
+        return false;
+    }
+
+    // Only trust messages sent by the kernel itself
+    if (msg.msg_namelen != sizeof(sender) || sender.nl_pid != 0) {
+        return false;
+    }
+
+    buf[len] = '\0';
+    return uevent_parse(buf, (size_t)len + (buf[len - 1] != '\0'), event);
+}
+
+// Whether an event changes the hardware list
+bool uevent_is_hotplug(const Uevent *event) {
+    if (event->action != UEVENT_ADD && event->action != UEVENT_REMOVE) {
+        return false;
+    }
+
+    return strcmp(event->subsystem, "pci") == 0 ||
+           (strcmp(event->subsystem, "usb") == 0 && strcmp(event->devtype, "usb_interface") == 0);
+}
+
+// Queue a hotplug event and restart the debounce
+bool uevent_queue_add(UeventQueue *queue, const Uevent *event, unsigned long long now_ms) {
+    if (!uevent_is_hotplug(event)) {
+        return false;
+    }
+
+    if (queue->count < UEVENT_QUEUE_SIZE && !queue->overflow) {
+        queue->events[queue->count++] = *event;
+    } else {
+        queue->overflow = true;
+    }
+    queue->deadline_ms = now_ms + UEVENT_DEBOUNCE_MS;
+    return true;
+}
+
+// Parse a raw uevent message and queue it
+bool uevent_queue_inject(UeventQueue *queue, const char *buf, size_t len,
+                         unsigned long long now_ms) {
+    Uevent event;
+    return uevent_parse(buf, len, &event) && uevent_queue_add(queue, &event, now_ms);
+}
+
+// Whether the queued burst is over
+bool uevent_queue_due(const UeventQueue *queue, unsigned long long now_ms) {
+    return (queue->count > 0 || queue->overflow) && now_ms >= queue->deadline_ms;
+}
+
+// Forget the queued burst
+void uevent_queue_clear(UeventQueue *queue) {
+    queue->count = 0;
+    queue->overflow = false;
+    queue->deadline_ms = 0;
+}
+
+// Bus address used as HardwareInfo.pci_id for the device of an event
+const char *uevent_device_address(const Uevent *event) {
+    if (event->pci_slot[0] != '\0') {
+        return event->pci_slot;
+    }
+
+    // USB interfaces are named after the last DEVPATH component, e.g. 1-2:1.0
+    const char *slash = strrchr(event->devpath, '/');
+    return slash != NULL ? slash + 1 : event->devpath;
+}
+
+// Build the HardwareInfo of a USB interface from its add event
+bool uevent_usb_hardware(Arena *arena, const Uevent *event, HardwareInfo *hw) {
+    unsigned int vendor, product, iface_class, iface_subclass, iface_protocol;
+
+    if (strcmp(event->subsystem, "usb") != 0 || strcmp(event->devtype, "usb_interface") != 0 ||
+        sscanf(event->product, "%x/%x", &vendor, &product) != 2 ||
+        sscanf(event->interface, "%u/%u/%u", &iface_class, &iface_subclass, &iface_protocol) != 3) {
+        return false;
+    }
+
+    memset(hw, 0, sizeof(HardwareInfo));
+    hw->bus = HW_BUS_USB;
+
+    switch (iface_class) {
+    case USB_CLASS_AUDIO:
+        hw->type = HW_AUDIO;
+        break;
+    case USB_CLASS_COMM:
+    case USB_CLASS_WIRELESS:
+        hw->type = HW_NETWORK;
+        break;
+    default:
+        return false;
+    }
+
+    hw->vendor_id = vendor;
+    hw->device_id = product;
+    hw->class_code = iface_class << 16 | iface_subclass << 8 | iface_protocol;
+    hw->pci_id = arena_intern(arena, uevent_device_address(event));
+    hw->modalias = arena_intern(arena, event->modalias);
+    hw->vendor = arena_printf(arena, "USB %04x", vendor);
+    hw->device = arena_printf(arena, "Device %04x", product);
+    hw->count = 1;
+    hw->addresses = hw->pci_id;
+
+    return true;
+}
@@ -0,0 +1,125 @@
+/*
+ * Driver table generator
+ *
+ * Compiles data/drivers.conf into a C source file holding the built-in
+ * driver database and its perfect-hash index, so the lookup tables cost
+ * nothing to build at runtime.
+ *
+ * Usage: gen-driver-table <drivers.conf> <output.c>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/driver_db.h"
+
+static const char *type_enum_names[] = {
+    [HW_GPU_NVIDIA] = "HW_GPU_NVIDIA",
+    [HW_GPU_AMD] = "HW_GPU_AMD",
+    [HW_GPU_INTEL] = "HW_GPU_INTEL",
+    [HW_NETWORK] = "HW_NETWORK",
+    [HW_AUDIO] = "HW_AUDIO",
+    [HW_UNKNOWN] = "HW_UNKNOWN",
+};
+
+#define TYPE_COUNT ((int)(sizeof(type_enum_names) / sizeof(type_enum_names[0])))
+
+// Write a C string literal
+static void write_string(FILE *out, const char *str) {
+    fputc('"', out);
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\') {
+            fputc('\\', out);
+        }
+        fputc(*str, out);
+    }
+    fputc('"', out);
+}
+
+// Write an unsigned array (C doesn't allow empty initializers, so pad with a 0)
+static void write_array(FILE *out, const char *name, const unsigned int *values, unsigned int count) {
+    fprintf(out, "static const unsigned int %s[] = {", name);
+    for (unsigned int i = 0; i < count; i++) {
+        fprintf(out, i % 8 == 0 ? "\n    0x%x," : " 0x%x,", values[i]);
+    }
+    if (count == 0) {
+        fprintf(out, "\n    0,");
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <drivers.conf> <output.c>\n", argv[0]);
+        return 1;
+    }
+
+    DriverDbFile file;
+    if (!driver_db_file_load(argv[1], &file)) {
+        fprintf(stderr, "Failed to load %s\n", argv[1]);
+        return 1;
+    }
+
+    DriverDbIndex index;
+    if (!driver_db_index_build(file.entries, file.count, &index)) {
+        fprintf(stderr, "Failed to build the driver index\n");
+        driver_db_file_free(&file);
+        return 1;
+    }
+
+    FILE *out = fopen(argv[2], "w");
+    if (out == NULL) {
+        perror(argv[2]);
+        driver_db_index_free(&index);
+        driver_db_file_free(&file);
+        return 1;
+    }
+
+    fprintf(out, "/*\n * Built-in driver database\n *\n");
+    fprintf(out, " * Generated by tools/gen_driver_table.c from %s - do not edit.\n */\n\n", argv[1]);
+    fprintf(out, "#include \"../include/driver_db.h\"\n\n");
+
+    fprintf(out, "static const DriverMapping entries[] = {\n");
+    for (int i = 0; i < file.count; i++) {
+        const DriverMapping *entry = &file.entries[i];
+        fprintf(out, "    {0x%x, 0x%x, 0x%x, %s,\n     ", entry->vendor_id, entry->device_first,
+                entry->device_last, type_enum_names[entry->hw_type]);
+        write_string(out, entry->package_name);
+        fprintf(out, ",\n     ");
+        write_string(out, entry->driver_name);
+        fprintf(out, ",\n     ");
+        write_string(out, entry->description);
+        fprintf(out, ",\n     %s, %s},\n", entry->needs_reboot ? "true" : "false",
+                entry->is_recommended ? "true" : "false");
+    }
+    if (file.count == 0) {
+        fprintf(out, "    {0, 0, 0, HW_UNKNOWN, \"\", \"\", \"\", false, false},\n");
+    }
+    fprintf(out, "};\n\n");
+
+    write_array(out, "displacements", index.displacements, index.bucket_count);
+    write_array(out, "slot_keys", index.slot_keys, index.slot_count);
+    write_array(out, "slot_first", index.slot_first, index.slot_count);
+    write_array(out, "slot_matches", index.slot_matches, index.slot_count);
+    write_array(out, "match_list", index.match_list, index.match_count);
+    write_array(out, "type_first", index.type_first, TYPE_COUNT);
+    write_array(out, "type_matches", index.type_matches, TYPE_COUNT);
+    write_array(out, "type_list", index.type_list, index.type_list_count);
+
+    fprintf(out, "const DriverDbIndex driver_db_builtin = {\n");
+    fprintf(out, "    entries, %d,\n", file.count);
+    fprintf(out, "    displacements, %u,\n", index.bucket_count);
+    fprintf(out, "    slot_keys, slot_first, slot_matches, %u,\n", index.slot_count);
+    fprintf(out, "    match_list, %u,\n", index.match_count);
+    fprintf(out, "    type_first, type_matches, type_list, %u,\n", index.type_list_count);
+    fprintf(out, "};\n");
+
+    bool ok = fclose(out) == 0;
+
+    printf("Generated %s: %d entries, %u device IDs in %u slots\n", argv[2], file.count,
+           index.match_count, index.slot_count);
+
+    driver_db_index_free(&index);
+    driver_db_file_free(&file);
+    return ok ? 0 : 1;
+}